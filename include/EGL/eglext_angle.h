@@ -259,6 +259,11 @@ EGLAPI EGLBoolean EGLAPIENTRY eglQueryDisplayAttribANGLE(EGLDisplay dpy, EGLint
 #define EGL_CGL_PIXEL_FORMAT_ANGLE 0x3486
 #endif
 
+#ifndef EGL_ANGLE_create_context_deferred_execution
+#define EGL_ANGLE_create_context_deferred_execution 1
+#define EGL_CONTEXT_DEFERRED_EXECUTION_ANGLE 0x348A
+#endif /* EGL_ANGLE_create_context_deferred_execution */
+
 // clang-format on
 
 #endif  // INCLUDE_EGL_EGLEXT_ANGLE_
@@ -26,7 +26,7 @@
 
 // Version number for shader translation API.
 // It is incremented every time the API changes.
-#define ANGLE_SH_VERSION 218
+#define ANGLE_SH_VERSION 219
 
 enum ShShaderSpec
 {
@@ -311,6 +311,10 @@ const ShCompileOptions SH_ADD_BASE_VERTEX_TO_VERTEX_ID = UINT64_C(1) << 48;
 // This works around the dynamic lvalue indexing of swizzled vectors on various platforms.
 const ShCompileOptions SH_REMOVE_DYNAMIC_INDEXING_OF_SWIZZLED_VECTOR = UINT64_C(1) << 49;
 
+// Measure the time spent in each pass over the AST. The timings can be queried with
+// sh::GetPassTimings after the compile.
+const ShCompileOptions SH_COLLECT_PASS_TIMINGS = UINT64_C(1) << 50;
+
 // Defines alternate strategies for implementing array index clamping.
 enum ShArrayIndexClampingStrategy
 {
@@ -614,6 +618,19 @@ const std::string &GetObjectCode(const ShHandle handle);
 // handle: Specifies the compiler
 const std::map<std::string, std::string> *GetNameHashingMap(const ShHandle handle);
 
+// The time spent in a pass over the AST.
+struct PassTiming
+{
+    std::string name;
+    double seconds;
+};
+
+// Returns the time spent in each pass over the AST, in the order the passes ran, when the last
+// compile was done with SH_COLLECT_PASS_TIMINGS. Passes that were skipped are not listed.
+// Parameters:
+// handle: Specifies the compiler
+const std::vector<PassTiming> &GetPassTimings(const ShHandle handle);
+
 // Shader variable inspection.
 // Returns a pointer to a list of variables of the designated type.
 // (See ShaderVars.h for type definitions, included above)
@@ -205,6 +205,21 @@ struct FeaturesVk : FeatureSetBase
         "Some shader compilers don't support sampler arrays as parameters, so revert to old "
         "RewriteStructSamplers behavior, which produces fewer.",
         &members, "http://anglebug.com/2703"};
+
+    // Record the graphics pipelines created by each program in the blob cache, and pre-create
+    // them on worker threads the next time the same program is linked.  Only enabled when the blob
+    // cache is backed by a disk store.
+    Feature preWarmGraphicsPipelines = {
+        "pre_warm_graphics_pipelines", FeatureCategory::VulkanFeatures,
+        "Create the graphics pipelines a program used in previous runs in the background when "
+        "the program is linked",
+        &members};
+
+    // Decode large uploads to emulated ETC textures with a compute shader, instead of on the CPU.
+    Feature transcodeEtcWithCompute = {
+        "transcode_etc_with_compute", FeatureCategory::VulkanFeatures,
+        "Decode large uploads to ETC textures the device can't sample with a compute shader",
+        &members};
 };
 
 inline FeaturesVk::FeaturesVk()  = default;
@@ -25,6 +25,41 @@ no_event_marker_exceptions_list = sorted([
     "glInsertEventMarkerEXT",
 ])
 
+# GLES entry points that contexts created with EGL_CONTEXT_DEFERRED_EXECUTION_ANGLE queue to their
+# worker thread, with the Context method that tells if the call can be queued.  They only take
+# arguments by value or offsets into buffer objects.  All other entry points wait for the queued
+# calls to run.
+deferred_commands = {
+    "glActiveTexture": None,
+    "glBindTexture": None,
+    "glBlendFunc": None,
+    "glClear": None,
+    "glClearColor": None,
+    "glColorMask": None,
+    "glDepthMask": None,
+    "glDisable": None,
+    "glDrawArrays": "canDeferDraw",
+    "glDrawArraysInstanced": "canDeferDraw",
+    "glDrawElements": "canDeferDrawElements",
+    "glDrawElementsInstanced": "canDeferDrawElements",
+    "glDrawRangeElements": "canDeferDrawElements",
+    "glEnable": None,
+    "glScissor": None,
+    "glUniform1f": None,
+    "glUniform1i": None,
+    "glUniform1ui": None,
+    "glUniform2f": None,
+    "glUniform2i": None,
+    "glUniform2ui": None,
+    "glUniform3f": None,
+    "glUniform3i": None,
+    "glUniform3ui": None,
+    "glUniform4f": None,
+    "glUniform4i": None,
+    "glUniform4ui": None,
+    "glViewport": None,
+}
+
 # Strip these suffixes from Context entry point names. NV is excluded (for now).
 strip_suffixes = ["ANGLE", "EXT", "KHR", "OES", "CHROMIUM", "OVR"]
 
@@ -160,6 +195,43 @@ template_entry_point_no_return = """void GL_APIENTRY {name}{explicit_context_suf
 }}
 """
 
+template_deferred_entry_point = """namespace
+{{
+void {name}Deferred({deferred_params})
+{{
+    std::unique_lock<std::mutex> shareContextLock = LockShareGroup(context);
+    bool isCallValid = (context->skipValidation() || Validate{name}({validate_params}));
+    if (isCallValid)
+    {{
+        context->{name_lower_no_suffix}({internal_params});
+    }}
+    ANGLE_CAPTURE({name}, isCallValid, {validate_params});
+}}
+}}  // anonymous namespace
+
+void GL_APIENTRY {name}({params})
+{{
+    Context *context = {context_getter};
+    {event_comment}EVENT("gl{name}", "context = %d{comma_if_needed}{format_params}", CID(context){comma_if_needed}{pass_params});
+
+    if (context)
+    {{{packed_gl_enum_conversions}
+        if (context->isDeferred(){deferred_condition})
+        {{
+            context->getDeferredCommandQueue()->push({name}Deferred{comma_if_needed}{internal_params});
+            return;
+        }}
+        std::unique_lock<std::mutex> shareContextLock = GetShareGroupLock(context);
+        bool isCallValid = (context->skipValidation() || Validate{name}({validate_params}));
+        if (isCallValid)
+        {{
+            context->{name_lower_no_suffix}({internal_params});
+        }}
+        ANGLE_CAPTURE({name}, isCallValid, {validate_params});
+    }}
+}}
+"""
+
 template_entry_point_with_return = """{return_type}GL_APIENTRY {name}{explicit_context_suffix}({explicit_context_param}{explicit_context_comma}{params})
 {{
     Context *context = {context_getter};
@@ -814,7 +886,7 @@ def get_packed_enums(cmd_packed_gl_enums, cmd_name):
 
 
 def format_entry_point_def(command_node, cmd_name, proto, params, is_explicit_context,
-                           cmd_packed_gl_enums):
+                           cmd_packed_gl_enums, deferrable):
     packed_gl_enums = get_packed_enums(cmd_packed_gl_enums, cmd_name)
     internal_params = [just_the_name_packed(param, packed_gl_enums) for param in params]
     packed_gl_enum_conversions = []
@@ -870,7 +942,14 @@ def format_entry_point_def(command_node, cmd_name, proto, params, is_explicit_co
             "\nASSERT(context == GetValidGlobalContext());" if is_explicit_context else ""
     }
 
-    if return_type.strip() == "void":
+    if deferrable and not is_explicit_context and cmd_name in deferred_commands:
+        deferred_condition = deferred_commands[cmd_name]
+        format_params["deferred_params"] = get_internal_params(cmd_name, ["Context *context"] +
+                                                               params, cmd_packed_gl_enums)
+        format_params["deferred_condition"] = (" && context->%s()" % deferred_condition
+                                               if deferred_condition else "")
+        return template_deferred_entry_point.format(**format_params)
+    elif return_type.strip() == "void":
         return template_entry_point_no_return.format(**format_params)
     else:
         return template_entry_point_with_return.format(**format_params)
@@ -1006,8 +1085,13 @@ def path_to(folder, file):
     return os.path.join(script_relative(".."), "src", folder, file)
 
 
-def get_entry_points(all_commands, commands, is_explicit_context, is_wgl, all_param_types,
-                     cmd_packed_gl_enums):
+def get_entry_points(all_commands,
+                     commands,
+                     is_explicit_context,
+                     is_wgl,
+                     all_param_types,
+                     cmd_packed_gl_enums,
+                     deferrable=False):
     decls = []
     defs = []
     export_defs = []
@@ -1032,7 +1116,7 @@ def get_entry_points(all_commands, commands, is_explicit_context, is_wgl, all_pa
             format_entry_point_decl(cmd_name, proto_text, param_text, is_explicit_context))
         defs.append(
             format_entry_point_def(command, cmd_name, proto_text, param_text, is_explicit_context,
-                                   cmd_packed_gl_enums))
+                                   cmd_packed_gl_enums, deferrable))
 
         export_defs.append(
             format_libgles_entry_point_def(cmd_name, proto_text, param_text, is_explicit_context))
@@ -1770,7 +1854,13 @@ def main():
         all_commands_with_suffix.extend(xml.commands[version])
 
         decls, defs, libgles_defs, validation_protos, capture_protos, capture_methods, capture_pointer_funcs = get_entry_points(
-            all_commands, gles_commands, False, False, all_gles_param_types, cmd_packed_gl_enums)
+            all_commands,
+            gles_commands,
+            False,
+            False,
+            all_gles_param_types,
+            cmd_packed_gl_enums,
+            deferrable=True)
 
         # Write the version as a comment before the first EP.
         libgles_defs.insert(0, "\n// OpenGL ES %s" % comment)
@@ -11,6 +11,10 @@
 #include <math.h>
 #include <algorithm>
 
+#if defined(ANGLE_USE_SSE) && !defined(_MSC_VER)
+#    include <cpuid.h>
+#endif
+
 namespace gl
 {
 
@@ -39,8 +43,91 @@ constexpr float g_sharedexp_max =
      static_cast<float>(1 << g_sharedexp_mantissabits)) *
     static_cast<float>(1 << (g_sharedexp_maxexponent - g_sharedexp_bias));
 
+struct CPUFeatures
+{
+    bool sse2  = false;
+    bool ssse3 = false;
+    bool avx2  = false;
+};
+
+#if defined(ANGLE_USE_SSE)
+void CPUID(int leaf, int subleaf, int info[4])
+{
+#    if defined(_MSC_VER)
+    __cpuidex(info, leaf, subleaf);
+#    else
+    unsigned int eax, ebx, ecx, edx;
+    __cpuid_count(leaf, subleaf, eax, ebx, ecx, edx);
+    info[0] = static_cast<int>(eax);
+    info[1] = static_cast<int>(ebx);
+    info[2] = static_cast<int>(ecx);
+    info[3] = static_cast<int>(edx);
+#    endif
+}
+
+uint64_t XGetBV()
+{
+#    if defined(_MSC_VER)
+    return _xgetbv(0);
+#    else
+    uint32_t eax, edx;
+    __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+    return (static_cast<uint64_t>(edx) << 32) | eax;
+#    endif
+}
+#endif  // defined(ANGLE_USE_SSE)
+
+CPUFeatures DetectCPUFeatures()
+{
+    CPUFeatures features;
+#if defined(ANGLE_USE_SSE)
+    int info[4] = {};
+    CPUID(0, 0, info);
+    int maxLeaf = info[0];
+    if (maxLeaf < 1)
+    {
+        return features;
+    }
+
+    CPUID(1, 0, info);
+    features.sse2  = ((info[3] >> 26) & 1) != 0;
+    features.ssse3 = ((info[2] >> 9) & 1) != 0;
+
+    // The AVX registers are only usable if the OS saves them on context switches.
+    bool osxsave = ((info[2] >> 27) & 1) != 0;
+    bool avx     = ((info[2] >> 28) & 1) != 0;
+    if (maxLeaf >= 7 && osxsave && avx && (XGetBV() & 0x6) == 0x6)
+    {
+        CPUID(7, 0, info);
+        features.avx2 = ((info[1] >> 5) & 1) != 0;
+    }
+#endif  // defined(ANGLE_USE_SSE)
+    return features;
+}
+
+const CPUFeatures &GetCPUFeatures()
+{
+    static const CPUFeatures features = DetectCPUFeatures();
+    return features;
+}
+
 }  // anonymous namespace
 
+bool supportsSSE2()
+{
+    return GetCPUFeatures().sse2;
+}
+
+bool supportsSSSE3()
+{
+    return GetCPUFeatures().ssse3;
+}
+
+bool supportsAVX2()
+{
+    return GetCPUFeatures().avx2;
+}
+
 unsigned int convertRGBFloatsTo999E5(float red, float green, float blue)
 {
     const float red_c   = std::max<float>(0, std::min(g_sharedexp_max, red));
@@ -89,6 +89,21 @@
 #elif defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
 #    include <x86intrin.h>
 #    define ANGLE_USE_SSE
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#    include <arm_neon.h>
+#    define ANGLE_USE_NEON
+#endif
+
+// Marks a function that uses instructions beyond the baseline.  Callers must check for them at
+// runtime with gl::supportsSSSE3() and friends first.
+#if defined(ANGLE_USE_SSE)
+#    if defined(__clang__) || defined(__GNUC__)
+#        define ANGLE_TARGET_SSSE3 __attribute__((target("ssse3")))
+#        define ANGLE_TARGET_AVX2 __attribute__((target("avx2")))
+#    else
+#        define ANGLE_TARGET_SSSE3
+#        define ANGLE_TARGET_AVX2
+#    endif
 #endif
 
 // Mips and arm devices need to include stddef for size_t.
@@ -64,6 +64,34 @@ enum class SearchType
 
 Library *OpenSharedLibrary(const char *libraryName, SearchType searchType);
 
+// A read-only view of a file's contents, mapped into memory.
+class MappedFile : angle::NonCopyable
+{
+  public:
+    virtual ~MappedFile() {}
+    virtual const uint8_t *data() const = 0;
+    virtual size_t size() const         = 0;
+};
+
+// Maps the whole file read-only.  Returns nullptr on failure, or if the platform doesn't support
+// mapping files.
+MappedFile *OpenMappedFile(const char *fileName);
+
+// An exclusive advisory lock shared by all processes that open the same file.  It only excludes
+// others that take the lock too.  The lock file is created if needed.
+class FileLock : angle::NonCopyable
+{
+  public:
+    virtual ~FileLock() {}
+
+    // Blocks until the lock is taken.  Returns false on failure.
+    virtual bool lock() = 0;
+    virtual void unlock() = 0;
+};
+
+// Returns nullptr on failure, or if the platform doesn't support file locks.
+FileLock *OpenFileLock(const char *fileName);
+
 // Returns true if the process is currently being debugged.
 bool IsDebuggerAttached();
 
@@ -11,6 +11,10 @@
 #include <array>
 
 #include <dlfcn.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <sys/wait.h>
@@ -105,6 +109,77 @@ Library *OpenSharedLibrary(const char *libraryName, SearchType searchType)
     return new PosixLibrary(libraryName, searchType);
 }
 
+class PosixMappedFile : public MappedFile
+{
+  public:
+    PosixMappedFile(void *data, size_t size) : mData(data), mSize(size) {}
+    ~PosixMappedFile() override { munmap(mData, mSize); }
+
+    const uint8_t *data() const override { return static_cast<const uint8_t *>(mData); }
+    size_t size() const override { return mSize; }
+
+  private:
+    void *mData;
+    size_t mSize;
+};
+
+MappedFile *OpenMappedFile(const char *fileName)
+{
+    int fd = open(fileName, O_RDONLY);
+    if (fd < 0)
+    {
+        return nullptr;
+    }
+
+    struct stat st;
+    void *data = MAP_FAILED;
+    if (fstat(fd, &st) == 0 && st.st_size > 0)
+    {
+        data = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_SHARED, fd, 0);
+    }
+
+    // The mapping stays valid after the file descriptor is closed.
+    close(fd);
+
+    if (data == MAP_FAILED)
+    {
+        return nullptr;
+    }
+    return new PosixMappedFile(data, static_cast<size_t>(st.st_size));
+}
+
+class PosixFileLock : public FileLock
+{
+  public:
+    PosixFileLock(int fd) : mFd(fd) {}
+    ~PosixFileLock() override { close(mFd); }
+
+    bool lock() override
+    {
+        int result;
+        do
+        {
+            result = flock(mFd, LOCK_EX);
+        } while (result != 0 && errno == EINTR);
+        return result == 0;
+    }
+
+    void unlock() override { flock(mFd, LOCK_UN); }
+
+  private:
+    int mFd;
+};
+
+FileLock *OpenFileLock(const char *fileName)
+{
+    int fd = open(fileName, O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    if (fd < 0)
+    {
+        return nullptr;
+    }
+    return new PosixFileLock(fd);
+}
+
 bool IsDirectory(const char *filename)
 {
     struct stat st;
@@ -142,6 +142,91 @@ Library *OpenSharedLibrary(const char *libraryName, SearchType searchType)
     return new Win32Library(libraryName, searchType);
 }
 
+class Win32MappedFile : public MappedFile
+{
+  public:
+    Win32MappedFile(const void *data, size_t size) : mData(data), mSize(size) {}
+    ~Win32MappedFile() override { UnmapViewOfFile(mData); }
+
+    const uint8_t *data() const override { return static_cast<const uint8_t *>(mData); }
+    size_t size() const override { return mSize; }
+
+  private:
+    const void *mData;
+    size_t mSize;
+};
+
+MappedFile *OpenMappedFile(const char *fileName)
+{
+    // Allow the file to keep being written to and replaced while it's mapped.
+    HANDLE file =
+        CreateFileA(fileName, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                    nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        return nullptr;
+    }
+
+    LARGE_INTEGER fileSize;
+    HANDLE mapping = nullptr;
+    if (GetFileSizeEx(file, &fileSize) && fileSize.QuadPart > 0)
+    {
+        mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    }
+    CloseHandle(file);
+
+    if (mapping == nullptr)
+    {
+        return nullptr;
+    }
+
+    // The view keeps the mapping alive after its handle is closed.
+    const void *data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping);
+
+    if (data == nullptr)
+    {
+        return nullptr;
+    }
+    return new Win32MappedFile(data, static_cast<size_t>(fileSize.QuadPart));
+}
+
+class Win32FileLock : public FileLock
+{
+  public:
+    Win32FileLock(HANDLE file) : mFile(file) {}
+    ~Win32FileLock() override { CloseHandle(mFile); }
+
+    bool lock() override
+    {
+        OVERLAPPED overlapped = {};
+        return LockFileEx(mFile, LOCKFILE_EXCLUSIVE_LOCK, 0, MAXDWORD, MAXDWORD, &overlapped) !=
+               FALSE;
+    }
+
+    void unlock() override
+    {
+        OVERLAPPED overlapped = {};
+        UnlockFileEx(mFile, 0, MAXDWORD, MAXDWORD, &overlapped);
+    }
+
+  private:
+    HANDLE mFile;
+};
+
+FileLock *OpenFileLock(const char *fileName)
+{
+    HANDLE file =
+        CreateFileA(fileName, GENERIC_READ | GENERIC_WRITE,
+                    FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_ALWAYS,
+                    FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        return nullptr;
+    }
+    return new Win32FileLock(file);
+}
+
 bool IsDirectory(const char *filename)
 {
     WIN32_FILE_ATTRIBUTE_DATA fileInformation;
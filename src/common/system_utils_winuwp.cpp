@@ -108,6 +108,18 @@ Library *OpenSharedLibrary(const char *libraryName, SearchType searchType)
     return new UwpLibrary(libraryName, searchType);
 }
 
+MappedFile *OpenMappedFile(const char *fileName)
+{
+    // Not implemented for UWP.  Callers fall back to reading the file.
+    return nullptr;
+}
+
+FileLock *OpenFileLock(const char *fileName)
+{
+    // Not implemented for UWP.
+    return nullptr;
+}
+
 bool IsDebuggerAttached()
 {
     return !!::IsDebuggerPresent();
@@ -24,10 +24,10 @@ namespace
 {
 
 template <class IndexType>
-gl::IndexRange ComputeTypedIndexRange(const IndexType *indices,
-                                      size_t count,
-                                      bool primitiveRestartEnabled,
-                                      GLuint primitiveRestartIndex)
+gl::IndexRange ComputeScalarIndexRange(const IndexType *indices,
+                                       size_t count,
+                                       bool primitiveRestartEnabled,
+                                       GLuint primitiveRestartIndex)
 {
     ASSERT(count > 0);
 
@@ -51,7 +51,7 @@ gl::IndexRange ComputeTypedIndexRange(const IndexType *indices,
         }
 
         // Loop over the rest of the indices
-        for (; i < count; i++)
+        for (++i; i < count; i++)
         {
             if (indices[i] != primitiveRestartIndex)
             {
@@ -90,6 +90,373 @@ gl::IndexRange ComputeTypedIndexRange(const IndexType *indices,
                           nonPrimitiveRestartIndices);
 }
 
+// The vectorized kernels below rely on the primitive restart index being the largest value of the
+// index type.  It can then never lower the minimum, and only needs to be masked out of the maximum.
+// Below this many indices the scalar loop is faster.
+constexpr size_t kMinVectorizedIndexCount = 64;
+
+// Folds the per-lane minimums and maximums of a vectorized kernel together with the indices left
+// over after the last full vector.
+template <class IndexType, bool kPrimitiveRestart>
+gl::IndexRange FinishVectorizedIndexRange(const IndexType *minLanes,
+                                          const IndexType *maxLanes,
+                                          size_t laneCount,
+                                          const IndexType *remainder,
+                                          size_t remainderCount,
+                                          size_t count,
+                                          size_t restartCount)
+{
+    constexpr IndexType kRestartIndex = std::numeric_limits<IndexType>::max();
+
+    IndexType minIndex = minLanes[0];
+    IndexType maxIndex = maxLanes[0];
+    for (size_t lane = 1; lane < laneCount; ++lane)
+    {
+        minIndex = std::min(minIndex, minLanes[lane]);
+        maxIndex = std::max(maxIndex, maxLanes[lane]);
+    }
+
+    for (size_t i = 0; i < remainderCount; ++i)
+    {
+        IndexType index = remainder[i];
+        if (kPrimitiveRestart && index == kRestartIndex)
+        {
+            restartCount++;
+            continue;
+        }
+        minIndex = std::min(minIndex, index);
+        maxIndex = std::max(maxIndex, index);
+    }
+
+    // Matches ComputeScalarIndexRange when every index is a primitive restart.
+    if (restartCount == count)
+    {
+        return gl::IndexRange();
+    }
+
+    return gl::IndexRange(static_cast<size_t>(minIndex), static_cast<size_t>(maxIndex),
+                          count - restartCount);
+}
+
+// Each Ops struct wraps the instructions of one vector ISA for one index type.  Values may be kept
+// in a biased form while in registers, which Store undoes.
+template <class Ops, bool kPrimitiveRestart>
+gl::IndexRange ComputeVectorizedIndexRange(const typename Ops::IndexType *indices, size_t count)
+{
+    using IndexType = typename Ops::IndexType;
+    using Vector    = typename Ops::Vector;
+
+    const Vector lowest    = Ops::Lowest();
+    Vector minVector       = Ops::Load(indices);
+    Vector maxVector       = lowest;
+    size_t restartCount    = 0;
+    size_t vectorizedCount = count - count % Ops::kLaneCount;
+
+    for (size_t i = 0; i < vectorizedCount; i += Ops::kLaneCount)
+    {
+        Vector value = Ops::Load(indices + i);
+        minVector    = Ops::Min(minVector, value);
+        if (kPrimitiveRestart)
+        {
+            Vector restart = Ops::IsRestart(value);
+            restartCount += Ops::CountLanes(restart);
+            value = Ops::Select(restart, lowest, value);
+        }
+        maxVector = Ops::Max(maxVector, value);
+    }
+
+    IndexType minLanes[Ops::kLaneCount];
+    IndexType maxLanes[Ops::kLaneCount];
+    Ops::Store(minLanes, minVector);
+    Ops::Store(maxLanes, maxVector);
+
+    return FinishVectorizedIndexRange<IndexType, kPrimitiveRestart>(
+        minLanes, maxLanes, Ops::kLaneCount, indices + vectorizedCount, count - vectorizedCount,
+        count, restartCount);
+}
+
+#if defined(ANGLE_USE_SSE)
+// SSE2 only has unsigned byte min/max, so shorts and ints are biased into the signed range.
+template <class IndexType>
+struct SSE2Ops;
+
+template <>
+struct SSE2Ops<GLubyte>
+{
+    using IndexType                    = GLubyte;
+    using Vector                       = __m128i;
+    static constexpr size_t kLaneCount = 16;
+
+    static Vector Load(const IndexType *src)
+    {
+        return _mm_loadu_si128(reinterpret_cast<const __m128i *>(src));
+    }
+    static void Store(IndexType *dst, Vector value)
+    {
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst), value);
+    }
+    static Vector Lowest() { return _mm_setzero_si128(); }
+    static Vector Min(Vector a, Vector b) { return _mm_min_epu8(a, b); }
+    static Vector Max(Vector a, Vector b) { return _mm_max_epu8(a, b); }
+    static Vector IsRestart(Vector value) { return _mm_cmpeq_epi8(value, _mm_set1_epi8(-1)); }
+    static Vector Select(Vector mask, Vector a, Vector b)
+    {
+        return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+    }
+    static size_t CountLanes(Vector mask)
+    {
+        return gl::BitCount(static_cast<uint32_t>(_mm_movemask_epi8(mask)));
+    }
+};
+
+template <>
+struct SSE2Ops<GLushort>
+{
+    using IndexType                    = GLushort;
+    using Vector                       = __m128i;
+    static constexpr size_t kLaneCount = 8;
+
+    static Vector Bias() { return _mm_set1_epi16(-0x8000); }
+    static Vector Load(const IndexType *src)
+    {
+        return _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i *>(src)), Bias());
+    }
+    static void Store(IndexType *dst, Vector value)
+    {
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst), _mm_xor_si128(value, Bias()));
+    }
+    static Vector Lowest() { return Bias(); }
+    static Vector Min(Vector a, Vector b) { return _mm_min_epi16(a, b); }
+    static Vector Max(Vector a, Vector b) { return _mm_max_epi16(a, b); }
+    static Vector IsRestart(Vector value) { return _mm_cmpeq_epi16(value, _mm_set1_epi16(0x7FFF)); }
+    static Vector Select(Vector mask, Vector a, Vector b)
+    {
+        return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+    }
+    static size_t CountLanes(Vector mask)
+    {
+        return gl::BitCount(static_cast<uint32_t>(_mm_movemask_epi8(mask))) / 2;
+    }
+};
+
+template <>
+struct SSE2Ops<GLuint>
+{
+    using IndexType                    = GLuint;
+    using Vector                       = __m128i;
+    static constexpr size_t kLaneCount = 4;
+
+    static Vector Bias() { return _mm_set1_epi32(static_cast<int>(0x80000000u)); }
+    static Vector Load(const IndexType *src)
+    {
+        return _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i *>(src)), Bias());
+    }
+    static void Store(IndexType *dst, Vector value)
+    {
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst), _mm_xor_si128(value, Bias()));
+    }
+    static Vector Lowest() { return Bias(); }
+    static Vector Select(Vector mask, Vector a, Vector b)
+    {
+        return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+    }
+    static Vector Min(Vector a, Vector b) { return Select(_mm_cmpgt_epi32(a, b), b, a); }
+    static Vector Max(Vector a, Vector b) { return Select(_mm_cmpgt_epi32(a, b), a, b); }
+    static Vector IsRestart(Vector value)
+    {
+        return _mm_cmpeq_epi32(value, _mm_set1_epi32(0x7FFFFFFF));
+    }
+    static size_t CountLanes(Vector mask)
+    {
+        return gl::BitCount(static_cast<uint32_t>(_mm_movemask_epi8(mask))) / 4;
+    }
+};
+
+// AVX2 has unsigned min/max for every width, so no bias is needed.  The kernel itself has to be
+// compiled for AVX2 as well for the helpers to inline, so it can't share
+// ComputeVectorizedIndexRange.
+template <class IndexType>
+struct AVX2Ops;
+
+template <>
+struct AVX2Ops<GLubyte>
+{
+    ANGLE_TARGET_AVX2 static __m256i Min(__m256i a, __m256i b) { return _mm256_min_epu8(a, b); }
+    ANGLE_TARGET_AVX2 static __m256i Max(__m256i a, __m256i b) { return _mm256_max_epu8(a, b); }
+    ANGLE_TARGET_AVX2 static __m256i IsRestart(__m256i value)
+    {
+        return _mm256_cmpeq_epi8(value, _mm256_set1_epi8(-1));
+    }
+    static constexpr int kBytesPerLane = 1;
+};
+
+template <>
+struct AVX2Ops<GLushort>
+{
+    ANGLE_TARGET_AVX2 static __m256i Min(__m256i a, __m256i b) { return _mm256_min_epu16(a, b); }
+    ANGLE_TARGET_AVX2 static __m256i Max(__m256i a, __m256i b) { return _mm256_max_epu16(a, b); }
+    ANGLE_TARGET_AVX2 static __m256i IsRestart(__m256i value)
+    {
+        return _mm256_cmpeq_epi16(value, _mm256_set1_epi16(-1));
+    }
+    static constexpr int kBytesPerLane = 2;
+};
+
+template <>
+struct AVX2Ops<GLuint>
+{
+    ANGLE_TARGET_AVX2 static __m256i Min(__m256i a, __m256i b) { return _mm256_min_epu32(a, b); }
+    ANGLE_TARGET_AVX2 static __m256i Max(__m256i a, __m256i b) { return _mm256_max_epu32(a, b); }
+    ANGLE_TARGET_AVX2 static __m256i IsRestart(__m256i value)
+    {
+        return _mm256_cmpeq_epi32(value, _mm256_set1_epi32(-1));
+    }
+    static constexpr int kBytesPerLane = 4;
+};
+
+template <class IndexType, bool kPrimitiveRestart>
+ANGLE_TARGET_AVX2 gl::IndexRange ComputeAVX2IndexRange(const IndexType *indices, size_t count)
+{
+    using Ops                   = AVX2Ops<IndexType>;
+    constexpr size_t kLaneCount = sizeof(__m256i) / sizeof(IndexType);
+
+    __m256i minVector      = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(indices));
+    __m256i maxVector      = _mm256_setzero_si256();
+    size_t restartCount    = 0;
+    size_t vectorizedCount = count - count % kLaneCount;
+
+    for (size_t i = 0; i < vectorizedCount; i += kLaneCount)
+    {
+        __m256i value = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(indices + i));
+        minVector     = Ops::Min(minVector, value);
+        if (kPrimitiveRestart)
+        {
+            __m256i restart = Ops::IsRestart(value);
+            restartCount += static_cast<size_t>(
+                gl::BitCount(static_cast<uint32_t>(_mm256_movemask_epi8(restart))) /
+                Ops::kBytesPerLane);
+            value = _mm256_andnot_si256(restart, value);
+        }
+        maxVector = Ops::Max(maxVector, value);
+    }
+
+    IndexType minLanes[kLaneCount];
+    IndexType maxLanes[kLaneCount];
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(minLanes), minVector);
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(maxLanes), maxVector);
+
+    return FinishVectorizedIndexRange<IndexType, kPrimitiveRestart>(
+        minLanes, maxLanes, kLaneCount, indices + vectorizedCount, count - vectorizedCount, count,
+        restartCount);
+}
+
+#endif  // defined(ANGLE_USE_SSE)
+
+#if defined(ANGLE_USE_NEON)
+template <class IndexType>
+struct NEONOps;
+
+template <>
+struct NEONOps<GLubyte>
+{
+    using IndexType                    = GLubyte;
+    using Vector                       = uint8x16_t;
+    static constexpr size_t kLaneCount = 16;
+
+    static Vector Load(const IndexType *src) { return vld1q_u8(src); }
+    static void Store(IndexType *dst, Vector value) { vst1q_u8(dst, value); }
+    static Vector Lowest() { return vdupq_n_u8(0); }
+    static Vector Min(Vector a, Vector b) { return vminq_u8(a, b); }
+    static Vector Max(Vector a, Vector b) { return vmaxq_u8(a, b); }
+    static Vector IsRestart(Vector value) { return vceqq_u8(value, vdupq_n_u8(0xFF)); }
+    static Vector Select(Vector mask, Vector a, Vector b) { return vbslq_u8(mask, a, b); }
+    static size_t CountLanes(Vector mask)
+    {
+        uint64x2_t counts = vpaddlq_u32(vpaddlq_u16(vpaddlq_u8(vshrq_n_u8(mask, 7))));
+        return static_cast<size_t>(vgetq_lane_u64(counts, 0) + vgetq_lane_u64(counts, 1));
+    }
+};
+
+template <>
+struct NEONOps<GLushort>
+{
+    using IndexType                    = GLushort;
+    using Vector                       = uint16x8_t;
+    static constexpr size_t kLaneCount = 8;
+
+    static Vector Load(const IndexType *src) { return vld1q_u16(src); }
+    static void Store(IndexType *dst, Vector value) { vst1q_u16(dst, value); }
+    static Vector Lowest() { return vdupq_n_u16(0); }
+    static Vector Min(Vector a, Vector b) { return vminq_u16(a, b); }
+    static Vector Max(Vector a, Vector b) { return vmaxq_u16(a, b); }
+    static Vector IsRestart(Vector value) { return vceqq_u16(value, vdupq_n_u16(0xFFFF)); }
+    static Vector Select(Vector mask, Vector a, Vector b) { return vbslq_u16(mask, a, b); }
+    static size_t CountLanes(Vector mask)
+    {
+        uint64x2_t counts = vpaddlq_u32(vpaddlq_u16(vshrq_n_u16(mask, 15)));
+        return static_cast<size_t>(vgetq_lane_u64(counts, 0) + vgetq_lane_u64(counts, 1));
+    }
+};
+
+template <>
+struct NEONOps<GLuint>
+{
+    using IndexType                    = GLuint;
+    using Vector                       = uint32x4_t;
+    static constexpr size_t kLaneCount = 4;
+
+    static Vector Load(const IndexType *src) { return vld1q_u32(src); }
+    static void Store(IndexType *dst, Vector value) { vst1q_u32(dst, value); }
+    static Vector Lowest() { return vdupq_n_u32(0); }
+    static Vector Min(Vector a, Vector b) { return vminq_u32(a, b); }
+    static Vector Max(Vector a, Vector b) { return vmaxq_u32(a, b); }
+    static Vector IsRestart(Vector value) { return vceqq_u32(value, vdupq_n_u32(0xFFFFFFFF)); }
+    static Vector Select(Vector mask, Vector a, Vector b) { return vbslq_u32(mask, a, b); }
+    static size_t CountLanes(Vector mask)
+    {
+        uint64x2_t counts = vpaddlq_u32(vshrq_n_u32(mask, 31));
+        return static_cast<size_t>(vgetq_lane_u64(counts, 0) + vgetq_lane_u64(counts, 1));
+    }
+};
+#endif  // defined(ANGLE_USE_NEON)
+
+template <class IndexType, bool kPrimitiveRestart>
+gl::IndexRange DispatchVectorizedIndexRange(const IndexType *indices, size_t count)
+{
+#if defined(ANGLE_USE_SSE)
+    if (gl::supportsAVX2())
+    {
+        return ComputeAVX2IndexRange<IndexType, kPrimitiveRestart>(indices, count);
+    }
+    if (gl::supportsSSE2())
+    {
+        return ComputeVectorizedIndexRange<SSE2Ops<IndexType>, kPrimitiveRestart>(indices, count);
+    }
+#elif defined(ANGLE_USE_NEON)
+    return ComputeVectorizedIndexRange<NEONOps<IndexType>, kPrimitiveRestart>(indices, count);
+#endif
+    return ComputeScalarIndexRange(indices, count, kPrimitiveRestart,
+                                   std::numeric_limits<IndexType>::max());
+}
+
+template <class IndexType>
+gl::IndexRange ComputeTypedIndexRange(const IndexType *indices,
+                                      size_t count,
+                                      bool primitiveRestartEnabled,
+                                      GLuint primitiveRestartIndex)
+{
+    ASSERT(primitiveRestartIndex == std::numeric_limits<IndexType>::max());
+
+    if (count < kMinVectorizedIndexCount)
+    {
+        return ComputeScalarIndexRange(indices, count, primitiveRestartEnabled,
+                                       primitiveRestartIndex);
+    }
+
+    return primitiveRestartEnabled ? DispatchVectorizedIndexRange<IndexType, true>(indices, count)
+                                   : DispatchVectorizedIndexRange<IndexType, false>(indices, count);
+}
+
 }  // anonymous namespace
 
 namespace gl
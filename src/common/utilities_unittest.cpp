@@ -8,6 +8,8 @@
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 
+#include <random>
+
 #include "common/utilities.h"
 
 namespace
@@ -177,4 +179,104 @@ TEST(ParseArrayIndex, ArrayIndexOutOfRange)
     EXPECT_EQ(15u, nameLengthWithoutArrayIndex);
 }
 
+template <typename IndexType>
+gl::IndexRange ComputeReferenceIndexRange(const std::vector<IndexType> &indices,
+                                          size_t offset,
+                                          size_t count,
+                                          bool primitiveRestartEnabled)
+{
+    constexpr IndexType kRestartIndex = std::numeric_limits<IndexType>::max();
+
+    bool found        = false;
+    size_t minIndex   = 0;
+    size_t maxIndex   = 0;
+    size_t nonRestart = 0;
+    for (size_t i = offset; i < offset + count; ++i)
+    {
+        if (primitiveRestartEnabled && indices[i] == kRestartIndex)
+        {
+            continue;
+        }
+        minIndex = found ? std::min<size_t>(minIndex, indices[i]) : indices[i];
+        maxIndex = found ? std::max<size_t>(maxIndex, indices[i]) : indices[i];
+        found    = true;
+        nonRestart++;
+    }
+    return gl::IndexRange(minIndex, maxIndex, nonRestart);
+}
+
+// Compares ComputeIndexRange against a straightforward loop for all index types, with counts and
+// offsets that exercise both the vectorized and the scalar remainder paths.
+template <typename IndexType>
+void TestComputeIndexRange(gl::DrawElementsType type)
+{
+    std::mt19937 generator(0x1234);
+    std::vector<IndexType> indices(1100);
+
+    // |restartPercent| controls how often the primitive restart index shows up.
+    for (uint32_t restartPercent : {0u, 5u, 100u})
+    {
+        std::uniform_int_distribution<uint32_t> percent(0, 99);
+        std::uniform_int_distribution<uint32_t> value(0, std::numeric_limits<IndexType>::max());
+        for (IndexType &index : indices)
+        {
+            index = percent(generator) < restartPercent ? std::numeric_limits<IndexType>::max()
+                                                         : static_cast<IndexType>(value(generator));
+        }
+
+        for (size_t offset : {0u, 1u, 3u})
+        {
+            for (size_t count : {1u, 15u, 63u, 64u, 65u, 127u, 500u, 1023u, 1024u})
+            {
+                for (bool primitiveRestart : {false, true})
+                {
+                    gl::IndexRange expected =
+                        ComputeReferenceIndexRange(indices, offset, count, primitiveRestart);
+                    gl::IndexRange actual = gl::ComputeIndexRange(type, indices.data() + offset,
+                                                                  count, primitiveRestart);
+                    EXPECT_EQ(expected.start, actual.start);
+                    EXPECT_EQ(expected.end, actual.end);
+                    EXPECT_EQ(expected.vertexIndexCount, actual.vertexIndexCount);
+                }
+            }
+        }
+    }
+}
+
+// Tests ComputeIndexRange with unsigned byte indices.
+TEST(ComputeIndexRange, UnsignedByte)
+{
+    TestComputeIndexRange<GLubyte>(gl::DrawElementsType::UnsignedByte);
+}
+
+// Tests ComputeIndexRange with unsigned short indices.
+TEST(ComputeIndexRange, UnsignedShort)
+{
+    TestComputeIndexRange<GLushort>(gl::DrawElementsType::UnsignedShort);
+}
+
+// Tests ComputeIndexRange with unsigned int indices.
+TEST(ComputeIndexRange, UnsignedInt)
+{
+    TestComputeIndexRange<GLuint>(gl::DrawElementsType::UnsignedInt);
+}
+
+// Tests that the extremes of each index type, which are biased on some platforms, are found.
+TEST(ComputeIndexRange, Extremes)
+{
+    std::vector<GLuint> indices(256, 0x80000000u);
+    indices[17]  = 0x7FFFFFFFu;
+    indices[200] = 0xFFFFFFFEu;
+    gl::IndexRange range =
+        gl::ComputeIndexRange(gl::DrawElementsType::UnsignedInt, indices.data(), 256, true);
+    EXPECT_EQ(0x7FFFFFFFu, range.start);
+    EXPECT_EQ(0xFFFFFFFEu, range.end);
+    EXPECT_EQ(256u, range.vertexIndexCount);
+
+    indices[100] = 0;
+    range = gl::ComputeIndexRange(gl::DrawElementsType::UnsignedInt, indices.data(), 256, false);
+    EXPECT_EQ(0u, range.start);
+    EXPECT_EQ(0xFFFFFFFEu, range.end);
+}
+
 }  // anonymous namespace
@@ -50,6 +50,7 @@
 #include "compiler/translator/tree_ops/VectorizeVectorScalarArithmetic.h"
 #include "compiler/translator/tree_util/BuiltIn.h"
 #include "compiler/translator/tree_util/IntermNodePatternMatcher.h"
+#include "compiler/translator/tree_util/PassManager.h"
 #include "compiler/translator/tree_util/ReplaceShadowingVariables.h"
 #include "compiler/translator/util.h"
 #include "third_party/compiler/ArrayBoundsClamper.h"
@@ -506,14 +507,19 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
                                     const TParseContext &parseContext,
                                     ShCompileOptions compileOptions)
 {
+    PassManager passes(root, (compileOptions & SH_COLLECT_PASS_TIMINGS) ? &mPassTimings : nullptr);
+
     // Disallow expressions deemed too complex.
-    if ((compileOptions & SH_LIMIT_EXPRESSION_COMPLEXITY) && !limitExpressionComplexity(root))
+    if ((compileOptions & SH_LIMIT_EXPRESSION_COMPLEXITY) &&
+        !passes.run("LimitExpressionComplexity", [&] { return limitExpressionComplexity(root); }))
     {
         return false;
     }
 
     if (shouldRunLoopAndIndexingValidation(compileOptions) &&
-        !ValidateLimitations(root, mShaderType, &mSymbolTable, &mDiagnostics))
+        !passes.run("ValidateLimitations", [&] {
+            return ValidateLimitations(root, mShaderType, &mSymbolTable, &mDiagnostics);
+        }))
     {
         return false;
     }
@@ -525,7 +531,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
 
     // Fold expressions that could not be folded before validation that was done as a part of
     // parsing.
-    if (!FoldExpressions(this, root, &mDiagnostics))
+    if (!passes.run("FoldExpressions", [&] { return FoldExpressions(this, root, &mDiagnostics); }))
     {
         return false;
     }
@@ -539,13 +545,13 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     //      for float, so float literal statements would end up with no precision which is
     //      invalid ESSL.
     // After this empty declarations are not allowed in the AST.
-    if (!PruneNoOps(this, root, &mSymbolTable))
+    if (!passes.run("PruneNoOps", [&] { return PruneNoOps(this, root, &mSymbolTable); }))
     {
         return false;
     }
 
     // Create the function DAG and check there is no recursion
-    if (!initCallDag(root))
+    if (!passes.run("CallDAG", [&] { return initCallDag(root); }))
     {
         return false;
     }
@@ -565,23 +571,35 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
 
     if (!(compileOptions & SH_DONT_PRUNE_UNUSED_FUNCTIONS))
     {
-        pruneUnusedFunctions(root);
+        if (!passes.run("PruneUnusedFunctions", [&] {
+                pruneUnusedFunctions(root);
+                return true;
+            }))
+        {
+            return false;
+        }
     }
     if (IsSpecWithFunctionBodyNewScope(mShaderSpec, mShaderVersion))
     {
-        if (!ReplaceShadowingVariables(this, root, &mSymbolTable))
+        if (!passes.run("ReplaceShadowingVariables",
+                        [&] { return ReplaceShadowingVariables(this, root, &mSymbolTable); }))
         {
             return false;
         }
     }
 
-    if (mShaderVersion >= 310 && !ValidateVaryingLocations(root, &mDiagnostics, mShaderType))
+    if (mShaderVersion >= 310 && !passes.run("ValidateVaryingLocations", [&] {
+            return ValidateVaryingLocations(root, &mDiagnostics, mShaderType);
+        }))
     {
         return false;
     }
 
     if (mShaderVersion >= 300 && mShaderType == GL_FRAGMENT_SHADER &&
-        !ValidateOutputs(root, getExtensionBehavior(), mResources.MaxDrawBuffers, &mDiagnostics))
+        !passes.run("ValidateOutputs", [&] {
+            return ValidateOutputs(root, getExtensionBehavior(), mResources.MaxDrawBuffers,
+                                   &mDiagnostics);
+        }))
     {
         return false;
     }
@@ -597,7 +615,13 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     // Clamping uniform array bounds needs to happen after validateLimitations pass.
     if (compileOptions & SH_CLAMP_INDIRECT_ARRAY_BOUNDS)
     {
-        mArrayBoundsClamper.MarkIndirectArrayBoundsForClamping(root);
+        if (!passes.run("ClampIndirectArrayBounds", [&] {
+                mArrayBoundsClamper.MarkIndirectArrayBoundsForClamping(root);
+                return true;
+            }))
+        {
+            return false;
+        }
     }
 
     if ((compileOptions & SH_INITIALIZE_BUILTINS_FOR_INSTANCED_MULTIVIEW) &&
@@ -605,8 +629,10 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
          parseContext.isExtensionEnabled(TExtension::OVR_multiview)) &&
         getShaderType() != GL_COMPUTE_SHADER)
     {
-        if (!DeclareAndInitBuiltinsForInstancedMultiview(
-                this, root, mNumViews, mShaderType, compileOptions, mOutputType, &mSymbolTable))
+        if (!passes.run("DeclareAndInitBuiltinsForInstancedMultiview", [&] {
+                return DeclareAndInitBuiltinsForInstancedMultiview(
+                    this, root, mNumViews, mShaderType, compileOptions, mOutputType, &mSymbolTable);
+            }))
         {
             return false;
         }
@@ -615,7 +641,8 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     // This pass might emit short circuits so keep it before the short circuit unfolding
     if (compileOptions & SH_REWRITE_DO_WHILE_LOOPS)
     {
-        if (!RewriteDoWhile(this, root, &mSymbolTable))
+        if (!passes.run("RewriteDoWhile",
+                        [&] { return RewriteDoWhile(this, root, &mSymbolTable); }))
         {
             return false;
         }
@@ -623,7 +650,8 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
 
     if (compileOptions & SH_ADD_AND_TRUE_TO_LOOP_CONDITION)
     {
-        if (!AddAndTrueToLoopCondition(this, root))
+        if (!passes.run("AddAndTrueToLoopCondition",
+                        [&] { return AddAndTrueToLoopCondition(this, root); }))
         {
             return false;
         }
@@ -631,7 +659,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
 
     if (compileOptions & SH_UNFOLD_SHORT_CIRCUIT)
     {
-        if (!UnfoldShortCircuitAST(this, root))
+        if (!passes.run("UnfoldShortCircuitAST", [&] { return UnfoldShortCircuitAST(this, root); }))
         {
             return false;
         }
@@ -639,7 +667,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
 
     if (compileOptions & SH_REMOVE_POW_WITH_CONSTANT_EXPONENT)
     {
-        if (!RemovePow(this, root, &mSymbolTable))
+        if (!passes.run("RemovePow", [&] { return RemovePow(this, root, &mSymbolTable); }))
         {
             return false;
         }
@@ -647,9 +675,11 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
 
     if (compileOptions & SH_REGENERATE_STRUCT_NAMES)
     {
-        RegenerateStructNames gen(&mSymbolTable);
-        root->traverse(&gen);
-        if (!validateAST(root))
+        if (!passes.run("RegenerateStructNames", [&] {
+                RegenerateStructNames gen(&mSymbolTable);
+                root->traverse(&gen);
+                return validateAST(root);
+            }))
         {
             return false;
         }
@@ -660,8 +690,10 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     {
         if ((compileOptions & SH_EMULATE_GL_DRAW_ID) != 0u)
         {
-            if (!EmulateGLDrawID(this, root, &mSymbolTable, &mUniforms,
-                                 shouldCollectVariables(compileOptions)))
+            if (!passes.run("EmulateGLDrawID", [&] {
+                    return EmulateGLDrawID(this, root, &mSymbolTable, &mUniforms,
+                                           shouldCollectVariables(compileOptions));
+                }))
             {
                 return false;
             }
@@ -673,9 +705,12 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     {
         if ((compileOptions & SH_EMULATE_GL_BASE_VERTEX_BASE_INSTANCE) != 0u)
         {
-            if (!EmulateGLBaseVertexBaseInstance(this, root, &mSymbolTable, &mUniforms,
-                                                 shouldCollectVariables(compileOptions),
-                                                 compileOptions & SH_ADD_BASE_VERTEX_TO_VERTEX_ID))
+            if (!passes.run("EmulateGLBaseVertexBaseInstance", [&] {
+                    return EmulateGLBaseVertexBaseInstance(
+                        this, root, &mSymbolTable, &mUniforms,
+                        shouldCollectVariables(compileOptions),
+                        compileOptions & SH_ADD_BASE_VERTEX_TO_VERTEX_ID);
+                }))
             {
                 return false;
             }
@@ -686,8 +721,11 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         mResources.MaxDrawBuffers > 1 &&
         IsExtensionEnabled(mExtensionBehavior, TExtension::EXT_draw_buffers))
     {
-        if (!EmulateGLFragColorBroadcast(this, root, mResources.MaxDrawBuffers, &mOutputVariables,
-                                         &mSymbolTable, mShaderVersion))
+        if (!passes.run("EmulateGLFragColorBroadcast", [&] {
+                return EmulateGLFragColorBroadcast(this, root, mResources.MaxDrawBuffers,
+                                                   &mOutputVariables, &mSymbolTable,
+                                                   mShaderVersion);
+            }))
         {
             return false;
         }
@@ -700,36 +738,42 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     // Split multi declarations and remove calls to array length().
     // Note that SimplifyLoopConditions needs to be run before any other AST transformations
     // that may need to generate new statements from loop conditions or loop expressions.
-    if (!SimplifyLoopConditions(this, root,
-                                IntermNodePatternMatcher::kMultiDeclaration |
-                                    IntermNodePatternMatcher::kArrayLengthMethod |
-                                    simplifyScalarized,
-                                &getSymbolTable()))
+    if (!passes.run("SimplifyLoopConditions", [&] {
+            return SimplifyLoopConditions(this, root,
+                                          IntermNodePatternMatcher::kMultiDeclaration |
+                                              IntermNodePatternMatcher::kArrayLengthMethod |
+                                              simplifyScalarized,
+                                          &getSymbolTable());
+        }))
     {
         return false;
     }
 
     // Note that separate declarations need to be run before other AST transformations that
     // generate new statements from expressions.
-    if (!SeparateDeclarations(this, root))
+    if (!passes.run("SeparateDeclarations", [&] { return SeparateDeclarations(this, root); }))
     {
         return false;
     }
     mValidateASTOptions.validateMultiDeclarations = true;
 
-    if (!SplitSequenceOperator(this, root,
-                               IntermNodePatternMatcher::kArrayLengthMethod | simplifyScalarized,
-                               &getSymbolTable()))
+    if (!passes.runIfPresent("SplitSequenceOperator", PassManager::kSequenceOperators, [&] {
+            return SplitSequenceOperator(
+                this, root, IntermNodePatternMatcher::kArrayLengthMethod | simplifyScalarized,
+                &getSymbolTable());
+        }))
     {
         return false;
     }
 
-    if (!RemoveArrayLengthMethod(this, root))
+    if (!passes.runIfPresent("RemoveArrayLengthMethod", PassManager::kArrayLengthMethods,
+                             [&] { return RemoveArrayLengthMethod(this, root); }))
     {
         return false;
     }
 
-    if (!RemoveUnreferencedVariables(this, root, &mSymbolTable))
+    if (!passes.run("RemoveUnreferencedVariables",
+                    [&] { return RemoveUnreferencedVariables(this, root, &mSymbolTable); }))
     {
         return false;
     }
@@ -740,7 +784,8 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     // left switch statements that only contained an empty declaration inside the final case in an
     // invalid state. Relies on that PruneNoOps and RemoveUnreferencedVariables have already been
     // run.
-    if (!PruneEmptyCases(this, root))
+    if (!passes.runIfPresent("PruneEmptyCases", PassManager::kSwitchStatements,
+                             [&] { return PruneEmptyCases(this, root); }))
     {
         return false;
     }
@@ -750,14 +795,22 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     GetGlobalPoolAllocator()->lock();
     initBuiltInFunctionEmulator(&mBuiltInFunctionEmulator, compileOptions);
     GetGlobalPoolAllocator()->unlock();
-    mBuiltInFunctionEmulator.markBuiltInFunctionsForEmulation(root);
+    if (!passes.run("BuiltInFunctionEmulation", [&] {
+            mBuiltInFunctionEmulator.markBuiltInFunctionsForEmulation(root);
+            return true;
+        }))
+    {
+        return false;
+    }
 
     bool highPrecisionSupported = mShaderVersion > 100 || mShaderType != GL_FRAGMENT_SHADER ||
                                   mResources.FragmentPrecisionHigh == 1;
     if (compileOptions & SH_SCALARIZE_VEC_AND_MAT_CONSTRUCTOR_ARGS)
     {
-        if (!ScalarizeVecAndMatConstructorArgs(this, root, mShaderType, highPrecisionSupported,
-                                               &mSymbolTable))
+        if (!passes.run("ScalarizeVecAndMatConstructorArgs", [&] {
+                return ScalarizeVecAndMatConstructorArgs(this, root, mShaderType,
+                                                         highPrecisionSupported, &mSymbolTable);
+            }))
         {
             return false;
         }
@@ -766,14 +819,22 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     if (shouldCollectVariables(compileOptions))
     {
         ASSERT(!mVariablesCollected);
-        CollectVariables(root, &mAttributes, &mOutputVariables, &mUniforms, &mInputVaryings,
-                         &mOutputVaryings, &mUniformBlocks, &mShaderStorageBlocks, &mInBlocks,
-                         mResources.HashFunction, &mSymbolTable, mShaderType, mExtensionBehavior);
+        if (!passes.run("CollectVariables", [&] {
+                CollectVariables(root, &mAttributes, &mOutputVariables, &mUniforms,
+                                 &mInputVaryings, &mOutputVaryings, &mUniformBlocks,
+                                 &mShaderStorageBlocks, &mInBlocks, mResources.HashFunction,
+                                 &mSymbolTable, mShaderType, mExtensionBehavior);
+                return true;
+            }))
+        {
+            return false;
+        }
         collectInterfaceBlocks();
         mVariablesCollected = true;
         if (compileOptions & SH_USE_UNUSED_STANDARD_SHARED_BLOCKS)
         {
-            if (!useAllMembersInUnusedStandardAndSharedBlocks(root))
+            if (!passes.run("UseInterfaceBlockFields",
+                            [&] { return useAllMembersInUnusedStandardAndSharedBlocks(root); }))
             {
                 return false;
             }
@@ -791,7 +852,8 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         }
         if ((compileOptions & SH_INIT_OUTPUT_VARIABLES) && (mShaderType != GL_COMPUTE_SHADER))
         {
-            if (!initializeOutputVariables(root))
+            if (!passes.run("InitializeOutputVariables",
+                            [&] { return initializeOutputVariables(root); }))
             {
                 return false;
             }
@@ -802,7 +864,8 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     // Otherwise, built-in invariant declarations don't apply.
     if (RemoveInvariant(mShaderType, mShaderVersion, mOutputType, compileOptions))
     {
-        if (!RemoveInvariantDeclaration(this, root))
+        if (!passes.runIfPresent("RemoveInvariantDeclaration", PassManager::kInvariantDeclarations,
+                                 [&] { return RemoveInvariantDeclaration(this, root); }))
         {
             return false;
         }
@@ -814,7 +877,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     if (mShaderType == GL_VERTEX_SHADER && !mGLPositionInitialized &&
         ((compileOptions & SH_INIT_GL_POSITION) || (mOutputType == SH_GLSL_COMPATIBILITY_OUTPUT)))
     {
-        if (!initializeGLPosition(root))
+        if (!passes.run("InitializeGLPosition", [&] { return initializeGLPosition(root); }))
         {
             return false;
         }
@@ -828,8 +891,11 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     bool initializeLocalsAndGlobals =
         (compileOptions & SH_INITIALIZE_UNINITIALIZED_LOCALS) && !IsOutputHLSL(getOutputType());
     bool canUseLoopsToInitialize = !(compileOptions & SH_DONT_USE_LOOPS_TO_INITIALIZE_VARIABLES);
-    if (!DeferGlobalInitializers(this, root, initializeLocalsAndGlobals, canUseLoopsToInitialize,
-                                 highPrecisionSupported, &mSymbolTable))
+    if (!passes.run("DeferGlobalInitializers", [&] {
+            return DeferGlobalInitializers(this, root, initializeLocalsAndGlobals,
+                                           canUseLoopsToInitialize, highPrecisionSupported,
+                                           &mSymbolTable);
+        }))
     {
         return false;
     }
@@ -846,17 +912,23 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
 
         if (!shouldRunLoopAndIndexingValidation(compileOptions))
         {
-            if (!SimplifyLoopConditions(this, root,
-                                        IntermNodePatternMatcher::kArrayDeclaration |
-                                            IntermNodePatternMatcher::kNamelessStructDeclaration,
-                                        &getSymbolTable()))
+            if (!passes.run("SimplifyLoopConditions", [&] {
+                    return SimplifyLoopConditions(
+                        this, root,
+                        IntermNodePatternMatcher::kArrayDeclaration |
+                            IntermNodePatternMatcher::kNamelessStructDeclaration,
+                        &getSymbolTable());
+                }))
             {
                 return false;
             }
         }
 
-        if (!InitializeUninitializedLocals(this, root, getShaderVersion(), canUseLoopsToInitialize,
-                                           highPrecisionSupported, &getSymbolTable()))
+        if (!passes.run("InitializeUninitializedLocals", [&] {
+                return InitializeUninitializedLocals(this, root, getShaderVersion(),
+                                                     canUseLoopsToInitialize,
+                                                     highPrecisionSupported, &getSymbolTable());
+            }))
         {
             return false;
         }
@@ -864,7 +936,9 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
 
     if (getShaderType() == GL_VERTEX_SHADER && (compileOptions & SH_CLAMP_POINT_SIZE))
     {
-        if (!ClampPointSize(this, root, mResources.MaxPointSize, &getSymbolTable()))
+        if (!passes.run("ClampPointSize", [&] {
+                return ClampPointSize(this, root, mResources.MaxPointSize, &getSymbolTable());
+            }))
         {
             return false;
         }
@@ -872,7 +946,8 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
 
     if (getShaderType() == GL_FRAGMENT_SHADER && (compileOptions & SH_CLAMP_FRAG_DEPTH))
     {
-        if (!ClampFragDepth(this, root, &getSymbolTable()))
+        if (!passes.run("ClampFragDepth",
+                        [&] { return ClampFragDepth(this, root, &getSymbolTable()); }))
         {
             return false;
         }
@@ -880,7 +955,8 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
 
     if (compileOptions & SH_REWRITE_REPEATED_ASSIGN_TO_SWIZZLED)
     {
-        if (!sh::RewriteRepeatedAssignToSwizzled(this, root))
+        if (!passes.run("RewriteRepeatedAssignToSwizzled",
+                        [&] { return sh::RewriteRepeatedAssignToSwizzled(this, root); }))
         {
             return false;
         }
@@ -888,7 +964,9 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
 
     if (compileOptions & SH_REWRITE_VECTOR_SCALAR_ARITHMETIC)
     {
-        if (!VectorizeVectorScalarArithmetic(this, root, &getSymbolTable()))
+        if (!passes.run("VectorizeVectorScalarArithmetic", [&] {
+                return VectorizeVectorScalarArithmetic(this, root, &getSymbolTable());
+            }))
         {
             return false;
         }
@@ -896,7 +974,10 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
 
     if (compileOptions & SH_REMOVE_DYNAMIC_INDEXING_OF_SWIZZLED_VECTOR)
     {
-        if (!sh::RemoveDynamicIndexingOfSwizzledVector(this, root, &getSymbolTable(), nullptr))
+        if (!passes.run("RemoveDynamicIndexingOfSwizzledVector", [&] {
+                return sh::RemoveDynamicIndexingOfSwizzledVector(this, root, &getSymbolTable(),
+                                                                 nullptr);
+            }))
         {
             return false;
         }
@@ -1130,6 +1211,7 @@ void TCompiler::clearResults()
     mBuiltInFunctionEmulator.cleanup();
 
     mNameMap.clear();
+    mPassTimings.clear();
 
     mSourcePath = nullptr;
 
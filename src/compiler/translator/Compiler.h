@@ -120,6 +120,7 @@ class TCompiler : public TShHandleBase
 
     ShHashFunction64 getHashFunction() const { return mResources.HashFunction; }
     NameMap &getNameMap() { return mNameMap; }
+    const std::vector<PassTiming> &getPassTimings() const { return mPassTimings; }
     TSymbolTable &getSymbolTable() { return mSymbolTable; }
     ShShaderSpec getShaderSpec() const { return mShaderSpec; }
     ShShaderOutput getOutputType() const { return mOutputType; }
@@ -280,6 +281,9 @@ class TCompiler : public TShHandleBase
     // name hashing.
     NameMap mNameMap;
 
+    // Time spent in the passes over the AST, if requested.
+    std::vector<PassTiming> mPassTimings;
+
     TPragma mPragma;
 
     // Track what should be validated given passes currently applied.
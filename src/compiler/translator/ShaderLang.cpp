@@ -373,6 +373,13 @@ const std::map<std::string, std::string> *GetNameHashingMap(const ShHandle handl
     return &(compiler->getNameMap());
 }
 
+const std::vector<PassTiming> &GetPassTimings(const ShHandle handle)
+{
+    TCompiler *compiler = GetCompilerFromHandle(handle);
+    ASSERT(compiler);
+    return compiler->getPassTimings();
+}
+
 const std::vector<ShaderVariable> *GetUniforms(const ShHandle handle)
 {
     TCompiler *compiler = GetCompilerFromHandle(handle);
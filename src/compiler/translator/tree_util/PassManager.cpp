@@ -0,0 +1,93 @@
+//
+// Copyright 2019 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// PassManager.cpp: Implementation of the class that runs the passes over the AST.
+//
+
+#include "compiler/translator/tree_util/PassManager.h"
+
+#include "compiler/translator/tree_util/IntermTraverse.h"
+
+namespace sh
+{
+
+namespace
+{
+
+// Finds which of the kinds of nodes passes can look for are in the AST.
+class FindFeaturesTraverser : public TIntermTraverser
+{
+  public:
+    FindFeaturesTraverser() : TIntermTraverser(true, false, false), mFeatures(0) {}
+
+    unsigned int getFeatures() const { return mFeatures; }
+
+    bool visitBinary(Visit visit, TIntermBinary *node) override
+    {
+        if (node->getOp() == EOpComma)
+        {
+            mFeatures |= PassManager::kSequenceOperators;
+        }
+        return true;
+    }
+
+    bool visitUnary(Visit visit, TIntermUnary *node) override
+    {
+        if (node->getOp() == EOpArrayLength)
+        {
+            mFeatures |= PassManager::kArrayLengthMethods;
+        }
+        return true;
+    }
+
+    bool visitSwitch(Visit visit, TIntermSwitch *node) override
+    {
+        mFeatures |= PassManager::kSwitchStatements;
+        return true;
+    }
+
+    bool visitInvariantDeclaration(Visit visit, TIntermInvariantDeclaration *node) override
+    {
+        mFeatures |= PassManager::kInvariantDeclarations;
+        return false;
+    }
+
+  private:
+    unsigned int mFeatures;
+};
+
+}  // anonymous namespace
+
+PassManager::PassManager(TIntermBlock *root, std::vector<PassTiming> *timingsOut)
+    : mRoot(root), mTimings(timingsOut), mFeaturesFound(false), mFeatures(0)
+{}
+
+PassManager::~PassManager() {}
+
+bool PassManager::isPresent(unsigned int features)
+{
+    if (!mFeaturesFound)
+    {
+        double startTime = mTimings ? angle::GetCurrentTime() : 0.0;
+
+        FindFeaturesTraverser traverser;
+        mRoot->traverse(&traverser);
+        mFeatures      = traverser.getFeatures();
+        mFeaturesFound = true;
+
+        if (mTimings)
+        {
+            addTiming("FindFeatures", startTime);
+        }
+    }
+    return (mFeatures & features) != 0;
+}
+
+void PassManager::addTiming(const char *name, double startTime)
+{
+    mTimings->push_back({name, angle::GetCurrentTime() - startTime});
+}
+
+}  // namespace sh
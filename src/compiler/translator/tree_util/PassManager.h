@@ -0,0 +1,96 @@
+//
+// Copyright 2019 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// PassManager.h: Runs the passes over the AST, optionally measuring the time spent in each.
+//
+// Some passes only change the AST if it contains a certain kind of node, such as a switch
+// statement, but still need a full traversal to find out. Such a pass can declare the nodes it
+// looks for, and is skipped if the AST doesn't contain any of them. Which nodes the AST contains is
+// found with a single traversal, the first time it is needed.
+//
+
+#ifndef COMPILER_TRANSLATOR_TREEUTIL_PASSMANAGER_H_
+#define COMPILER_TRANSLATOR_TREEUTIL_PASSMANAGER_H_
+
+#include <utility>
+#include <vector>
+
+#include "GLSLANG/ShaderLang.h"
+#include "common/angleutils.h"
+#include "common/system_utils.h"
+
+namespace sh
+{
+
+class TIntermBlock;
+
+class PassManager : angle::NonCopyable
+{
+  public:
+    // Kinds of nodes a pass can look for.
+    enum Feature
+    {
+        // Sequence operators: "a, b".
+        kSequenceOperators = 0x0001,
+        // Calls to the length() method of arrays.
+        kArrayLengthMethods = 0x0002,
+        // Switch statements.
+        kSwitchStatements = 0x0004,
+        // Invariant declarations: "invariant gl_Position;".
+        kInvariantDeclarations = 0x0008,
+    };
+
+    // If |timingsOut| is not null, the time spent in each pass is added to it.
+    PassManager(TIntermBlock *root, std::vector<PassTiming> *timingsOut);
+    ~PassManager();
+
+    // Runs a pass. Returns the result of the pass.
+    template <typename PassT>
+    ANGLE_NO_DISCARD bool run(const char *name, PassT &&pass);
+
+    // Runs a pass that only changes the AST if it contains one of |features|. Returns true without
+    // running the pass if it doesn't. The passes run before must not add nodes of these kinds to
+    // the AST.
+    template <typename PassT>
+    ANGLE_NO_DISCARD bool runIfPresent(const char *name, unsigned int features, PassT &&pass);
+
+  private:
+    bool isPresent(unsigned int features);
+    void addTiming(const char *name, double startTime);
+
+    TIntermBlock *mRoot;
+    std::vector<PassTiming> *mTimings;
+
+    bool mFeaturesFound;
+    unsigned int mFeatures;
+};
+
+template <typename PassT>
+bool PassManager::run(const char *name, PassT &&pass)
+{
+    if (mTimings == nullptr)
+    {
+        return pass();
+    }
+
+    double startTime = angle::GetCurrentTime();
+    bool result      = pass();
+    addTiming(name, startTime);
+    return result;
+}
+
+template <typename PassT>
+bool PassManager::runIfPresent(const char *name, unsigned int features, PassT &&pass)
+{
+    if (!isPresent(features))
+    {
+        return true;
+    }
+    return run(name, std::forward<PassT>(pass));
+}
+
+}  // namespace sh
+
+#endif  // COMPILER_TRANSLATOR_TREEUTIL_PASSMANAGER_H_
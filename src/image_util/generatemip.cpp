@@ -0,0 +1,612 @@
+//
+// Copyright 2019 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// generatemip.cpp: Defines the vectorized mip generation functions used by GenerateMip for the
+// most common formats.
+
+#include "image_util/generatemip.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "common/mathutil.h"
+#include "common/platform.h"
+#include "image_util/loadimage.h"
+
+namespace angle
+{
+
+namespace
+{
+// Mips are generated a row at a time.  AverageRows averages two rows element by element, and
+// AverageColumns averages each pair of neighboring pixels of a row.  The vectorized kernels handle
+// a prefix of the row and return how many pixels (or elements) they wrote; the scalar loops finish
+// the row.  Like the load kernels, they must produce exactly the same bits as T::average, so the
+// averages are taken in the same order as the generic GenerateMip functions: along z first, then
+// y, then x.
+
+#if defined(ANGLE_USE_SSE)
+inline __m128i SelectSSE2(__m128i mask, __m128i ifTrue, __m128i ifFalse)
+{
+    return _mm_or_si128(_mm_and_si128(mask, ifTrue), _mm_andnot_si128(mask, ifFalse));
+}
+
+// _mm_avg_epu8 rounds up, while gl::average rounds down.  They differ when the sum is odd.
+inline __m128i AverageBytesSSE2(__m128i a, __m128i b, __m128i one)
+{
+    return _mm_sub_epi8(_mm_avg_epu8(a, b), _mm_and_si128(_mm_xor_si128(a, b), one));
+}
+
+size_t AverageByteRowsSSE2(const uint8_t *a, const uint8_t *b, uint8_t *dest, size_t count)
+{
+    const __m128i one = _mm_set1_epi8(1);
+
+    size_t x = 0;
+    for (; x + 16 <= count; x += 16)
+    {
+        __m128i rowA = _mm_loadu_si128(reinterpret_cast<const __m128i *>(a + x));
+        __m128i rowB = _mm_loadu_si128(reinterpret_cast<const __m128i *>(b + x));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dest + x), AverageBytesSSE2(rowA, rowB, one));
+    }
+    return x;
+}
+
+// Averages each pixel with the next one, leaving the results in the low half of each pair.
+template <size_t kPixelBytes>
+inline __m128i AverageNeighborsSSE2(__m128i pixels, __m128i one)
+{
+    __m128i next;
+    switch (kPixelBytes)
+    {
+        case 1:
+            next = _mm_srli_epi16(pixels, 8);
+            break;
+        case 2:
+            next = _mm_srli_epi32(pixels, 16);
+            break;
+        default:
+            next = _mm_srli_epi64(pixels, 32);
+            break;
+    }
+    return AverageBytesSSE2(pixels, next, one);
+}
+
+// Packs the low halves of the pairs of |lo| and |hi| together.
+template <size_t kPixelBytes>
+inline __m128i PackNeighborAveragesSSE2(__m128i lo, __m128i hi)
+{
+    switch (kPixelBytes)
+    {
+        case 1:
+        {
+            const __m128i lowByteMask = _mm_set1_epi16(0x00FF);
+            return _mm_packus_epi16(_mm_and_si128(lo, lowByteMask), _mm_and_si128(hi, lowByteMask));
+        }
+        case 2:
+            // Sign extend so that the saturating pack keeps all 16 bits.
+            return _mm_packs_epi32(_mm_srai_epi32(_mm_slli_epi32(lo, 16), 16),
+                                   _mm_srai_epi32(_mm_slli_epi32(hi, 16), 16));
+        default:
+            return _mm_unpacklo_epi64(_mm_shuffle_epi32(lo, _MM_SHUFFLE(3, 1, 2, 0)),
+                                      _mm_shuffle_epi32(hi, _MM_SHUFFLE(3, 1, 2, 0)));
+    }
+}
+
+template <size_t kPixelBytes>
+size_t AverageByteColumnsSSE2(const uint8_t *source, uint8_t *dest, size_t destWidth)
+{
+    const __m128i one           = _mm_set1_epi8(1);
+    constexpr size_t kBatchSize = 16 / kPixelBytes;
+
+    size_t x = 0;
+    for (; x + kBatchSize <= destWidth; x += kBatchSize)
+    {
+        const __m128i *pixels = reinterpret_cast<const __m128i *>(source + 2 * x * kPixelBytes);
+        __m128i first         = _mm_loadu_si128(pixels);
+        __m128i second        = _mm_loadu_si128(pixels + 1);
+        __m128i lo            = AverageNeighborsSSE2<kPixelBytes>(first, one);
+        __m128i hi            = AverageNeighborsSSE2<kPixelBytes>(second, one);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dest + x * kPixelBytes),
+                         PackNeighborAveragesSSE2<kPixelBytes>(lo, hi));
+    }
+    return x;
+}
+
+size_t AverageFloatRowsSSE2(const float *a, const float *b, float *dest, size_t count)
+{
+    const __m128 half = _mm_set1_ps(0.5f);
+
+    size_t x = 0;
+    for (; x + 4 <= count; x += 4)
+    {
+        __m128 sum = _mm_add_ps(_mm_loadu_ps(a + x), _mm_loadu_ps(b + x));
+        _mm_storeu_ps(dest + x, _mm_mul_ps(sum, half));
+    }
+    return x;
+}
+
+// Only for four component pixels, which fill a register each.
+size_t AverageRGBAFloatColumnsSSE2(const float *source, float *dest, size_t destWidth)
+{
+    const __m128 half = _mm_set1_ps(0.5f);
+
+    for (size_t x = 0; x < destWidth; x++)
+    {
+        __m128 sum = _mm_add_ps(_mm_loadu_ps(source + 8 * x), _mm_loadu_ps(source + 8 * x + 4));
+        _mm_storeu_ps(dest + 4 * x, _mm_mul_ps(sum, half));
+    }
+    return destWidth;
+}
+
+// Same as gl::float16ToFloat32, which is exact, so there is nothing to round.
+inline __m128i Float16ToFloat32SSE2(__m128i value)
+{
+    const __m128i zero          = _mm_setzero_si128();
+    const __m128i absMask       = _mm_set1_epi32(0x7FFF);
+    const __m128i signMask      = _mm_set1_epi32(0x8000);
+    const __m128i exponentMask  = _mm_set1_epi32(0x0F800000);
+    const __m128i exponentBias  = _mm_set1_epi32(0x38000000);
+    const __m128i implicitOne   = _mm_set1_epi32(0x00800000);
+    const __m128 smallestNormal = _mm_castsi128_ps(_mm_set1_epi32(0x38800000));
+
+    __m128i shifted  = _mm_slli_epi32(_mm_and_si128(value, absMask), 13);
+    __m128i exponent = _mm_and_si128(shifted, exponentMask);
+    __m128i result   = _mm_add_epi32(shifted, exponentBias);
+
+    // Infinity and NaN keep the largest exponent.
+    __m128i isInfOrNaN = _mm_cmpeq_epi32(exponent, exponentMask);
+    result             = _mm_add_epi32(result, _mm_and_si128(isInfOrNaN, exponentBias));
+
+    // Denormals (and zero) are given an implicit one, which is then subtracted as a float to
+    // normalize them.
+    __m128i isDenormal = _mm_cmpeq_epi32(exponent, zero);
+    __m128i denormal   = _mm_castps_si128(
+        _mm_sub_ps(_mm_castsi128_ps(_mm_add_epi32(result, implicitOne)), smallestNormal));
+    result = SelectSSE2(isDenormal, denormal, result);
+
+    return _mm_or_si128(result, _mm_slli_epi32(_mm_and_si128(value, signMask), 16));
+}
+
+size_t Float16ToFloat32RowSSE2(const uint16_t *source, float *dest, size_t count)
+{
+    const __m128i zero = _mm_setzero_si128();
+
+    size_t x = 0;
+    for (; x + 8 <= count; x += 8)
+    {
+        __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i *>(source + x));
+        __m128i lo    = Float16ToFloat32SSE2(_mm_unpacklo_epi16(value, zero));
+        __m128i hi    = Float16ToFloat32SSE2(_mm_unpackhi_epi16(value, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dest + x), lo);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dest + x + 4), hi);
+    }
+    return x;
+}
+#endif  // defined(ANGLE_USE_SSE)
+
+#if defined(ANGLE_USE_NEON)
+// vhaddq_u8 rounds down, like gl::average.
+size_t AverageByteRowsNEON(const uint8_t *a, const uint8_t *b, uint8_t *dest, size_t count)
+{
+    size_t x = 0;
+    for (; x + 16 <= count; x += 16)
+    {
+        vst1q_u8(dest + x, vhaddq_u8(vld1q_u8(a + x), vld1q_u8(b + x)));
+    }
+    return x;
+}
+
+template <size_t kPixelBytes>
+size_t AverageByteColumnsNEON(const uint8_t *source, uint8_t *dest, size_t destWidth)
+{
+    constexpr size_t kBatchSize = 16 / kPixelBytes;
+
+    size_t x = 0;
+    for (; x + kBatchSize <= destWidth; x += kBatchSize)
+    {
+        const uint8_t *pixels = source + 2 * x * kPixelBytes;
+        uint8x16_t even, odd;
+        switch (kPixelBytes)
+        {
+            case 1:
+            {
+                uint8x16x2_t deinterleaved = vld2q_u8(pixels);
+                even                       = deinterleaved.val[0];
+                odd                        = deinterleaved.val[1];
+                break;
+            }
+            case 2:
+            {
+                uint16x8x2_t deinterleaved =
+                    vld2q_u16(reinterpret_cast<const uint16_t *>(pixels));
+                even = vreinterpretq_u8_u16(deinterleaved.val[0]);
+                odd  = vreinterpretq_u8_u16(deinterleaved.val[1]);
+                break;
+            }
+            default:
+            {
+                uint32x4x2_t deinterleaved =
+                    vld2q_u32(reinterpret_cast<const uint32_t *>(pixels));
+                even = vreinterpretq_u8_u32(deinterleaved.val[0]);
+                odd  = vreinterpretq_u8_u32(deinterleaved.val[1]);
+                break;
+            }
+        }
+        vst1q_u8(dest + x * kPixelBytes, vhaddq_u8(even, odd));
+    }
+    return x;
+}
+
+// Same as gl::float16ToFloat32.  The float subtraction only sees and produces normal numbers, so
+// it is exact even where NEON flushes denormals.
+size_t Float16ToFloat32RowNEON(const uint16_t *source, float *dest, size_t count)
+{
+    const uint32x4_t absMask         = vdupq_n_u32(0x7FFF);
+    const uint32x4_t signMask        = vdupq_n_u32(0x8000);
+    const uint32x4_t exponentMask    = vdupq_n_u32(0x0F800000);
+    const uint32x4_t exponentBias    = vdupq_n_u32(0x38000000);
+    const uint32x4_t implicitOne     = vdupq_n_u32(0x00800000);
+    const uint32x4_t zero            = vdupq_n_u32(0);
+    const float32x4_t smallestNormal = vreinterpretq_f32_u32(vdupq_n_u32(0x38800000));
+
+    size_t x = 0;
+    for (; x + 4 <= count; x += 4)
+    {
+        uint32x4_t value    = vmovl_u16(vld1_u16(source + x));
+        uint32x4_t shifted  = vshlq_n_u32(vandq_u32(value, absMask), 13);
+        uint32x4_t exponent = vandq_u32(shifted, exponentMask);
+        uint32x4_t result   = vaddq_u32(shifted, exponentBias);
+
+        uint32x4_t isInfOrNaN = vceqq_u32(exponent, exponentMask);
+        result                = vaddq_u32(result, vandq_u32(isInfOrNaN, exponentBias));
+
+        uint32x4_t isDenormal = vceqq_u32(exponent, zero);
+        uint32x4_t denormal   = vreinterpretq_u32_f32(
+            vsubq_f32(vreinterpretq_f32_u32(vaddq_u32(result, implicitOne)), smallestNormal));
+        result = vbslq_u32(isDenormal, denormal, result);
+
+        result = vorrq_u32(result, vshlq_n_u32(vandq_u32(value, signMask), 16));
+        vst1q_u32(reinterpret_cast<uint32_t *>(dest + x), result);
+    }
+    return x;
+}
+
+// 32-bit NEON flushes denormal floats to zero, so only 64-bit ARM averages floats with it.
+#    if defined(__aarch64__)
+size_t AverageFloatRowsNEON(const float *a, const float *b, float *dest, size_t count)
+{
+    size_t x = 0;
+    for (; x + 4 <= count; x += 4)
+    {
+        float32x4_t sum = vaddq_f32(vld1q_f32(a + x), vld1q_f32(b + x));
+        vst1q_f32(dest + x, vmulq_n_f32(sum, 0.5f));
+    }
+    return x;
+}
+
+size_t AverageRGBAFloatColumnsNEON(const float *source, float *dest, size_t destWidth)
+{
+    for (size_t x = 0; x < destWidth; x++)
+    {
+        float32x4_t sum = vaddq_f32(vld1q_f32(source + 8 * x), vld1q_f32(source + 8 * x + 4));
+        vst1q_f32(dest + 4 * x, vmulq_n_f32(sum, 0.5f));
+    }
+    return destWidth;
+}
+#    endif  // defined(__aarch64__)
+#endif      // defined(ANGLE_USE_NEON)
+
+size_t AverageByteRowsVectorized(const uint8_t *a, const uint8_t *b, uint8_t *dest, size_t count)
+{
+#if defined(ANGLE_USE_SSE)
+    if (gl::supportsSSE2())
+    {
+        return AverageByteRowsSSE2(a, b, dest, count);
+    }
+#elif defined(ANGLE_USE_NEON)
+    return AverageByteRowsNEON(a, b, dest, count);
+#endif
+    return 0;
+}
+
+template <size_t kPixelBytes>
+size_t AverageByteColumnsVectorized(const uint8_t *source, uint8_t *dest, size_t destWidth)
+{
+#if defined(ANGLE_USE_SSE)
+    if (gl::supportsSSE2())
+    {
+        return AverageByteColumnsSSE2<kPixelBytes>(source, dest, destWidth);
+    }
+#elif defined(ANGLE_USE_NEON)
+    return AverageByteColumnsNEON<kPixelBytes>(source, dest, destWidth);
+#endif
+    return 0;
+}
+
+size_t AverageFloatRowsVectorized(const float *a, const float *b, float *dest, size_t count)
+{
+#if defined(ANGLE_USE_SSE)
+    if (gl::supportsSSE2())
+    {
+        return AverageFloatRowsSSE2(a, b, dest, count);
+    }
+#elif defined(ANGLE_USE_NEON) && defined(__aarch64__)
+    return AverageFloatRowsNEON(a, b, dest, count);
+#endif
+    return 0;
+}
+
+size_t AverageRGBAFloatColumnsVectorized(const float *source, float *dest, size_t destWidth)
+{
+#if defined(ANGLE_USE_SSE)
+    if (gl::supportsSSE2())
+    {
+        return AverageRGBAFloatColumnsSSE2(source, dest, destWidth);
+    }
+#elif defined(ANGLE_USE_NEON) && defined(__aarch64__)
+    return AverageRGBAFloatColumnsNEON(source, dest, destWidth);
+#endif
+    return 0;
+}
+
+size_t Float16ToFloat32RowVectorized(const uint16_t *source, float *dest, size_t count)
+{
+#if defined(ANGLE_USE_SSE)
+    if (gl::supportsSSE2())
+    {
+        return Float16ToFloat32RowSSE2(source, dest, count);
+    }
+#elif defined(ANGLE_USE_NEON)
+    return Float16ToFloat32RowNEON(source, dest, count);
+#endif
+    return 0;
+}
+
+void AverageFloatRows(const float *a, const float *b, float *dest, size_t count)
+{
+    size_t x = AverageFloatRowsVectorized(a, b, dest, count);
+    for (; x < count; x++)
+    {
+        dest[x] = gl::average(a[x], b[x]);
+    }
+}
+
+void AverageRGBAFloatColumns(const float *source, float *dest, size_t destWidth)
+{
+    size_t x = AverageRGBAFloatColumnsVectorized(source, dest, destWidth);
+    for (; x < destWidth; x++)
+    {
+        for (size_t component = 0; component < 4; component++)
+        {
+            dest[4 * x + component] =
+                gl::average(source[8 * x + component], source[8 * x + 4 + component]);
+        }
+    }
+}
+
+void Float16ToFloat32Row(const uint16_t *source, float *dest, size_t count)
+{
+    size_t x = Float16ToFloat32RowVectorized(source, dest, count);
+    for (; x < count; x++)
+    {
+        dest[x] = gl::float16ToFloat32(source[x]);
+    }
+}
+
+// Normalized formats with 8-bit components, which are averaged byte by byte.
+template <size_t kPixelBytes>
+struct ByteMipKernels
+{
+    static constexpr size_t kPixelSize = kPixelBytes;
+
+    static void AverageRows(const uint8_t *a, const uint8_t *b, uint8_t *dest, size_t width)
+    {
+        size_t count = width * kPixelBytes;
+        size_t x     = AverageByteRowsVectorized(a, b, dest, count);
+        for (; x < count; x++)
+        {
+            dest[x] = gl::average(a[x], b[x]);
+        }
+    }
+
+    static void AverageColumns(const uint8_t *source, uint8_t *dest, size_t destWidth)
+    {
+        size_t x = AverageByteColumnsVectorized<kPixelBytes>(source, dest, destWidth);
+        for (; x < destWidth; x++)
+        {
+            const uint8_t *pixels = source + 2 * x * kPixelBytes;
+            uint8_t *destPixel    = dest + x * kPixelBytes;
+            for (size_t byte = 0; byte < kPixelBytes; byte++)
+            {
+                destPixel[byte] = gl::average(pixels[byte], pixels[kPixelBytes + byte]);
+            }
+        }
+    }
+};
+
+struct RGBA32FMipKernels
+{
+    static constexpr size_t kPixelSize = 16;
+
+    static void AverageRows(const uint8_t *a, const uint8_t *b, uint8_t *dest, size_t width)
+    {
+        AverageFloatRows(reinterpret_cast<const float *>(a), reinterpret_cast<const float *>(b),
+                         reinterpret_cast<float *>(dest), width * 4);
+    }
+
+    static void AverageColumns(const uint8_t *source, uint8_t *dest, size_t destWidth)
+    {
+        AverageRGBAFloatColumns(reinterpret_cast<const float *>(source),
+                                reinterpret_cast<float *>(dest), destWidth);
+    }
+};
+
+// Half floats are averaged as floats, and rounded back to half floats after each average like
+// gl::averageHalfFloat does.  The conversions go through a small buffer on the stack.
+struct RGBA16FMipKernels
+{
+    static constexpr size_t kPixelSize = 8;
+    static constexpr size_t kBatchSize = 64;
+
+    static void AverageRows(const uint8_t *a, const uint8_t *b, uint8_t *dest, size_t width)
+    {
+        const uint16_t *halfA = reinterpret_cast<const uint16_t *>(a);
+        const uint16_t *halfB = reinterpret_cast<const uint16_t *>(b);
+        uint16_t *halfDest    = reinterpret_cast<uint16_t *>(dest);
+
+        float floatA[kBatchSize * 4];
+        float floatB[kBatchSize * 4];
+        for (size_t x = 0; x < width; x += kBatchSize)
+        {
+            size_t count  = std::min(kBatchSize, width - x) * 4;
+            size_t offset = x * 4;
+            Float16ToFloat32Row(halfA + offset, floatA, count);
+            Float16ToFloat32Row(halfB + offset, floatB, count);
+            AverageFloatRows(floatA, floatB, floatA, count);
+            priv::Float32ToFloat16Row(floatA, halfDest + offset, count);
+        }
+    }
+
+    static void AverageColumns(const uint8_t *source, uint8_t *dest, size_t destWidth)
+    {
+        const uint16_t *halfSource = reinterpret_cast<const uint16_t *>(source);
+        uint16_t *halfDest         = reinterpret_cast<uint16_t *>(dest);
+
+        float floatSource[kBatchSize * 8];
+        float floatDest[kBatchSize * 4];
+        for (size_t x = 0; x < destWidth; x += kBatchSize)
+        {
+            size_t batchWidth = std::min(kBatchSize, destWidth - x);
+            Float16ToFloat32Row(halfSource + x * 8, floatSource, batchWidth * 8);
+            AverageRGBAFloatColumns(floatSource, floatDest, batchWidth);
+            priv::Float32ToFloat16Row(floatDest, halfDest + x * 4, batchWidth * 4);
+        }
+    }
+};
+
+// Handles every case where the source is wider than a pixel.  Each row of the destination is made
+// by averaging the source rows it covers into |scratch| and then averaging the columns of that.
+template <typename Kernels>
+void GenerateMipByRows(size_t sourceWidth,
+                       size_t sourceHeight,
+                       size_t sourceDepth,
+                       const uint8_t *sourceData,
+                       size_t sourceRowPitch,
+                       size_t sourceDepthPitch,
+                       size_t destWidth,
+                       size_t destHeight,
+                       size_t destDepth,
+                       uint8_t *destData,
+                       size_t destRowPitch,
+                       size_t destDepthPitch)
+{
+    ASSERT(sourceWidth > 1);
+
+    const bool averageY = sourceHeight > 1;
+    const bool averageZ = sourceDepth > 1;
+
+    // Only the pixels that contribute to the destination are averaged; the last column of an odd
+    // width source is dropped, as in the generic functions.
+    const size_t sourceRowWidth = destWidth * 2;
+    std::vector<uint8_t> scratch;
+    if (averageY || averageZ)
+    {
+        scratch.resize(sourceRowWidth * Kernels::kPixelSize * 2);
+    }
+    uint8_t *scratch0 = scratch.data();
+    uint8_t *scratch1 = scratch0 + sourceRowWidth * Kernels::kPixelSize;
+
+    for (size_t z = 0; z < destDepth; z++)
+    {
+        for (size_t y = 0; y < destHeight; y++)
+        {
+            const uint8_t *row = sourceData + (averageY ? y * 2 : 0) * sourceRowPitch +
+                                 (averageZ ? z * 2 : 0) * sourceDepthPitch;
+
+            if (averageZ)
+            {
+                Kernels::AverageRows(row, row + sourceDepthPitch, scratch0, sourceRowWidth);
+                if (averageY)
+                {
+                    const uint8_t *nextRow = row + sourceRowPitch;
+                    Kernels::AverageRows(nextRow, nextRow + sourceDepthPitch, scratch1,
+                                         sourceRowWidth);
+                    Kernels::AverageRows(scratch0, scratch1, scratch0, sourceRowWidth);
+                }
+                row = scratch0;
+            }
+            else if (averageY)
+            {
+                Kernels::AverageRows(row, row + sourceRowPitch, scratch0, sourceRowWidth);
+                row = scratch0;
+            }
+
+            Kernels::AverageColumns(row, destData + y * destRowPitch + z * destDepthPitch,
+                                    destWidth);
+        }
+    }
+}
+
+template <typename Kernels>
+priv::MipGenerationFunction GetMipByRowsFunction(size_t sourceWidth)
+{
+    // A single column has nothing to vectorize across.
+    return sourceWidth > 1 ? GenerateMipByRows<Kernels> : nullptr;
+}
+}  // anonymous namespace
+
+namespace priv
+{
+template <>
+MipGenerationFunction GetFastMipGenerationFunction<R8>(size_t sourceWidth,
+                                                       size_t sourceHeight,
+                                                       size_t sourceDepth)
+{
+    return GetMipByRowsFunction<ByteMipKernels<1>>(sourceWidth);
+}
+
+template <>
+MipGenerationFunction GetFastMipGenerationFunction<R8G8>(size_t sourceWidth,
+                                                         size_t sourceHeight,
+                                                         size_t sourceDepth)
+{
+    return GetMipByRowsFunction<ByteMipKernels<2>>(sourceWidth);
+}
+
+template <>
+MipGenerationFunction GetFastMipGenerationFunction<R8G8B8A8>(size_t sourceWidth,
+                                                             size_t sourceHeight,
+                                                             size_t sourceDepth)
+{
+    return GetMipByRowsFunction<ByteMipKernels<4>>(sourceWidth);
+}
+
+template <>
+MipGenerationFunction GetFastMipGenerationFunction<B8G8R8A8>(size_t sourceWidth,
+                                                             size_t sourceHeight,
+                                                             size_t sourceDepth)
+{
+    return GetMipByRowsFunction<ByteMipKernels<4>>(sourceWidth);
+}
+
+template <>
+MipGenerationFunction GetFastMipGenerationFunction<R16G16B16A16F>(size_t sourceWidth,
+                                                                  size_t sourceHeight,
+                                                                  size_t sourceDepth)
+{
+    return GetMipByRowsFunction<RGBA16FMipKernels>(sourceWidth);
+}
+
+template <>
+MipGenerationFunction GetFastMipGenerationFunction<R32G32B32A32F>(size_t sourceWidth,
+                                                                  size_t sourceHeight,
+                                                                  size_t sourceDepth)
+{
+    return GetMipByRowsFunction<RGBA32FMipKernels>(sourceWidth);
+}
+}  // namespace priv
+
+}  // namespace angle
@@ -0,0 +1,186 @@
+//
+// Copyright 2019 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// generatemip_unittest.cpp: Unit tests for the mip generation functions.  The vectorized paths
+// are checked against the generic per-pixel functions.
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+#include "common/mathutil.h"
+#include "image_util/generatemip.h"
+
+using namespace angle;
+
+namespace
+{
+struct MipSize
+{
+    size_t width;
+    size_t height;
+    size_t depth;
+};
+
+// Odd and even sizes around the vector sizes, in one, two and three dimensions.
+constexpr MipSize kSizes[] = {
+    {2, 1, 1},   {3, 1, 1},   {17, 1, 1},  {64, 1, 1},  {2, 2, 1},  {5, 3, 1},
+    {16, 16, 1}, {33, 7, 1},  {67, 35, 1}, {130, 4, 1}, {1, 9, 1},  {1, 1, 6},
+    {9, 1, 4},   {1, 10, 3},  {2, 2, 2},   {31, 6, 5},  {64, 8, 8}, {67, 3, 7},
+};
+
+// Generates mips of random images with padded rows and slices, and checks that GenerateMip gives
+// the same bits as the generic function for each size.
+template <typename T, typename RandomPixelFunction>
+void CheckMip(RandomPixelFunction randomPixel)
+{
+    std::mt19937 generator(0x3119);
+
+    for (const MipSize &size : kSizes)
+    {
+        size_t destWidth  = std::max<size_t>(1, size.width >> 1);
+        size_t destHeight = std::max<size_t>(1, size.height >> 1);
+        size_t destDepth  = std::max<size_t>(1, size.depth >> 1);
+
+        // Pad by an odd amount so that rows start at unaligned addresses.
+        size_t sourceRowPitch   = size.width * sizeof(T) + 3;
+        size_t sourceDepthPitch = sourceRowPitch * size.height + 5;
+        size_t destRowPitch     = destWidth * sizeof(T) + 7;
+        size_t destDepthPitch   = destRowPitch * destHeight + 1;
+
+        std::vector<uint8_t> source(sourceDepthPitch * size.depth + 1);
+        for (size_t z = 0; z < size.depth; ++z)
+        {
+            for (size_t y = 0; y < size.height; ++y)
+            {
+                for (size_t x = 0; x < size.width; ++x)
+                {
+                    randomPixel(&generator, &source[1 + z * sourceDepthPitch +
+                                                    y * sourceRowPitch + x * sizeof(T)]);
+                }
+            }
+        }
+
+        std::vector<uint8_t> expected(destDepthPitch * destDepth + 1, 0xCD);
+        std::vector<uint8_t> actual(destDepthPitch * destDepth + 1, 0xCD);
+
+        priv::MipGenerationFunction generic =
+            priv::GetMipGenerationFunction<T>(size.width, size.height, size.depth);
+        generic(size.width, size.height, size.depth, source.data() + 1, sourceRowPitch,
+                sourceDepthPitch, destWidth, destHeight, destDepth, expected.data() + 1,
+                destRowPitch, destDepthPitch);
+        GenerateMip<T>(size.width, size.height, size.depth, source.data() + 1, sourceRowPitch,
+                       sourceDepthPitch, actual.data() + 1, destRowPitch, destDepthPitch);
+
+        for (size_t z = 0; z < destDepth; ++z)
+        {
+            for (size_t y = 0; y < destHeight; ++y)
+            {
+                for (size_t x = 0; x < destWidth; ++x)
+                {
+                    size_t offset = 1 + z * destDepthPitch + y * destRowPitch + x * sizeof(T);
+                    for (size_t byte = 0; byte < sizeof(T); ++byte)
+                    {
+                        ASSERT_EQ(expected[offset + byte], actual[offset + byte])
+                            << "size " << size.width << "x" << size.height << "x" << size.depth
+                            << ", pixel (" << x << ", " << y << ", " << z << "), byte " << byte;
+                    }
+                }
+            }
+        }
+
+        // The padding is left alone.
+        ASSERT_EQ(expected, actual);
+    }
+}
+
+void RandomBytes(std::mt19937 *generator, uint8_t *dest, size_t count)
+{
+    std::uniform_int_distribution<int> byteValue(0, 255);
+    for (size_t byte = 0; byte < count; ++byte)
+    {
+        dest[byte] = static_cast<uint8_t>(byteValue(*generator));
+    }
+}
+
+// Every half float bit pattern is fair game, including denormals, infinities and NaNs.
+void RandomHalfFloats(std::mt19937 *generator, uint8_t *dest, size_t count)
+{
+    RandomBytes(generator, dest, count * sizeof(uint16_t));
+}
+
+// Finite floats, with some denormals.  NaN payloads depend on the order the compiler gives to the
+// operands of the additions, so they are left out.
+void RandomFloats(std::mt19937 *generator, uint8_t *dest, size_t count)
+{
+    std::uniform_real_distribution<float> floatValue(-1000.0f, 1000.0f);
+    std::uniform_int_distribution<uint32_t> denormalValue(0, 0x807FFFFF);
+    std::uniform_int_distribution<int> kind(0, 7);
+
+    for (size_t component = 0; component < count; ++component)
+    {
+        float value = 0;
+        if (kind(*generator) == 0)
+        {
+            value = gl::bitCast<float>(denormalValue(*generator) & 0x807FFFFF);
+        }
+        else
+        {
+            value = floatValue(*generator);
+        }
+        memcpy(dest + component * sizeof(float), &value, sizeof(float));
+    }
+}
+
+// Tests the R8 mip generation.
+TEST(GenerateMip, R8)
+{
+    CheckMip<R8>([](std::mt19937 *generator, uint8_t *dest) { RandomBytes(generator, dest, 1); });
+}
+
+// Tests the R8G8 mip generation.
+TEST(GenerateMip, R8G8)
+{
+    CheckMip<R8G8>(
+        [](std::mt19937 *generator, uint8_t *dest) { RandomBytes(generator, dest, 2); });
+}
+
+// Tests the R8G8B8A8 mip generation.
+TEST(GenerateMip, R8G8B8A8)
+{
+    CheckMip<R8G8B8A8>(
+        [](std::mt19937 *generator, uint8_t *dest) { RandomBytes(generator, dest, 4); });
+}
+
+// Tests the B8G8R8A8 mip generation.
+TEST(GenerateMip, B8G8R8A8)
+{
+    CheckMip<B8G8R8A8>(
+        [](std::mt19937 *generator, uint8_t *dest) { RandomBytes(generator, dest, 4); });
+}
+
+// Tests the R16G16B16A16F mip generation, including the rounding of the intermediate averages.
+TEST(GenerateMip, R16G16B16A16F)
+{
+    CheckMip<R16G16B16A16F>(
+        [](std::mt19937 *generator, uint8_t *dest) { RandomHalfFloats(generator, dest, 4); });
+}
+
+// Tests the R32G32B32A32F mip generation.
+TEST(GenerateMip, R32G32B32A32F)
+{
+    CheckMip<R32G32B32A32F>(
+        [](std::mt19937 *generator, uint8_t *dest) { RandomFloats(generator, dest, 4); });
+}
+
+// Tests that formats without a vectorized path still generate mips.
+TEST(GenerateMip, R16G16)
+{
+    CheckMip<R16G16>(
+        [](std::mt19937 *generator, uint8_t *dest) { RandomBytes(generator, dest, 4); });
+}
+
+}  // anonymous namespace
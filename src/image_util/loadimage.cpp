@@ -8,6 +8,8 @@
 
 #include "image_util/loadimage.h"
 
+#include <algorithm>
+
 #include "common/mathutil.h"
 #include "common/platform.h"
 #include "image_util/imageformats.h"
@@ -15,64 +17,528 @@
 namespace angle
 {
 
-void LoadA8ToRGBA8(size_t width,
-                   size_t height,
-                   size_t depth,
-                   const uint8_t *input,
-                   size_t inputRowPitch,
-                   size_t inputDepthPitch,
-                   uint8_t *output,
-                   size_t outputRowPitch,
-                   size_t outputDepthPitch)
+namespace
+{
+// Vectorized row kernels.  Each one converts a prefix of a row and returns the number of pixels
+// (or components, for the float conversions) it wrote; the caller finishes the row with its
+// scalar loop.  They must produce exactly the same bits as the scalar code.
+
+#if defined(ANGLE_USE_SSE)
+size_t ExpandA8ToRGBA8RowSSE2(const uint8_t *source, uint8_t *dest, size_t width)
+{
+    const __m128i zeroWide = _mm_setzero_si128();
+
+    size_t x = 0;
+    for (; x + 8 <= width; x += 8)
+    {
+        __m128i sourceData = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(source + x));
+        // Interleave each byte to 16bit, make the lower byte to zero
+        sourceData = _mm_unpacklo_epi8(zeroWide, sourceData);
+        // Interleave each 16bit to 32bit, make the lower 16bit to zero
+        __m128i lo = _mm_unpacklo_epi16(zeroWide, sourceData);
+        __m128i hi = _mm_unpackhi_epi16(zeroWide, sourceData);
+
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dest + 4 * x), lo);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dest + 4 * x + 16), hi);
+    }
+    return x;
+}
+
+size_t ExpandL8ToRGBA8RowSSE2(const uint8_t *source, uint8_t *dest, size_t width)
+{
+    const __m128i opaque = _mm_set1_epi8(-1);
+
+    size_t x = 0;
+    for (; x + 16 <= width; x += 16)
+    {
+        __m128i l    = _mm_loadu_si128(reinterpret_cast<const __m128i *>(source + x));
+        __m128i llLo = _mm_unpacklo_epi8(l, l);
+        __m128i llHi = _mm_unpackhi_epi8(l, l);
+        __m128i laLo = _mm_unpacklo_epi8(l, opaque);
+        __m128i laHi = _mm_unpackhi_epi8(l, opaque);
+
+        __m128i *out = reinterpret_cast<__m128i *>(dest + 4 * x);
+        _mm_storeu_si128(out + 0, _mm_unpacklo_epi16(llLo, laLo));
+        _mm_storeu_si128(out + 1, _mm_unpackhi_epi16(llLo, laLo));
+        _mm_storeu_si128(out + 2, _mm_unpacklo_epi16(llHi, laHi));
+        _mm_storeu_si128(out + 3, _mm_unpackhi_epi16(llHi, laHi));
+    }
+    return x;
+}
+
+size_t ExpandLA8ToRGBA8RowSSE2(const uint8_t *source, uint8_t *dest, size_t width)
+{
+    const __m128i luminanceMask = _mm_set1_epi16(0x00FF);
+
+    size_t x = 0;
+    for (; x + 8 <= width; x += 8)
+    {
+        __m128i la = _mm_loadu_si128(reinterpret_cast<const __m128i *>(source + 2 * x));
+        __m128i l  = _mm_and_si128(la, luminanceMask);
+        __m128i ll = _mm_or_si128(l, _mm_slli_epi16(l, 8));
+
+        __m128i *out = reinterpret_cast<__m128i *>(dest + 4 * x);
+        _mm_storeu_si128(out + 0, _mm_unpacklo_epi16(ll, la));
+        _mm_storeu_si128(out + 1, _mm_unpackhi_epi16(ll, la));
+    }
+    return x;
+}
+
+template <bool kSwapRB>
+ANGLE_TARGET_SSSE3 size_t ExpandRGB8ToRGBX8RowSSSE3(const uint8_t *source,
+                                                     uint8_t *dest,
+                                                     size_t width,
+                                                     uint8_t fourthValue)
+{
+    const __m128i shuffle =
+        kSwapRB ? _mm_setr_epi8(2, 1, 0, -1, 5, 4, 3, -1, 8, 7, 6, -1, 11, 10, 9, -1)
+                : _mm_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+    const __m128i fourth =
+        _mm_set1_epi32(static_cast<int>(static_cast<uint32_t>(fourthValue) << 24));
+
+    // Each load reads four pixels and a third of the next 16 bytes, so stop early enough not to
+    // read past the end of the row.
+    size_t x = 0;
+    for (; x + 6 <= width; x += 4)
+    {
+        __m128i rgb  = _mm_loadu_si128(reinterpret_cast<const __m128i *>(source + 3 * x));
+        __m128i rgbx = _mm_or_si128(_mm_shuffle_epi8(rgb, shuffle), fourth);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dest + 4 * x), rgbx);
+    }
+    return x;
+}
+
+size_t SwizzleRGBA8ToBGRA8RowSSE2(const uint8_t *source, uint8_t *dest, size_t width)
+{
+    const __m128i brMask = _mm_set1_epi32(0x00ff00ff);
+
+    size_t x = 0;
+    for (; x + 4 <= width; x += 4)
+    {
+        __m128i sourceData = _mm_loadu_si128(reinterpret_cast<const __m128i *>(source + 4 * x));
+        // Mask out g and a, which don't change
+        __m128i gaComponents = _mm_andnot_si128(brMask, sourceData);
+        // Mask out b and r
+        __m128i brComponents = _mm_and_si128(sourceData, brMask);
+        // Swap b and r
+        __m128i brSwapped =
+            _mm_shufflehi_epi16(_mm_shufflelo_epi16(brComponents, _MM_SHUFFLE(2, 3, 0, 1)),
+                                _MM_SHUFFLE(2, 3, 0, 1));
+        __m128i result = _mm_or_si128(gaComponents, brSwapped);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dest + 4 * x), result);
+    }
+    return x;
+}
+
+ANGLE_TARGET_SSSE3 size_t SwizzleRGBA8ToBGRA8RowSSSE3(const uint8_t *source,
+                                                      uint8_t *dest,
+                                                      size_t width)
+{
+    const __m128i shuffle = _mm_setr_epi8(2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15);
+
+    size_t x = 0;
+    for (; x + 4 <= width; x += 4)
+    {
+        __m128i rgba = _mm_loadu_si128(reinterpret_cast<const __m128i *>(source + 4 * x));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dest + 4 * x),
+                         _mm_shuffle_epi8(rgba, shuffle));
+    }
+    return x;
+}
+
+ANGLE_TARGET_AVX2 size_t SwizzleRGBA8ToBGRA8RowAVX2(const uint8_t *source,
+                                                    uint8_t *dest,
+                                                    size_t width)
+{
+    // pshufb only moves bytes within 128-bit lanes, which is all a per-pixel swizzle needs.
+    const __m256i shuffle =
+        _mm256_setr_epi8(2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15, 2, 1, 0, 3, 6, 5, 4,
+                         7, 10, 9, 8, 11, 14, 13, 12, 15);
+
+    size_t x = 0;
+    for (; x + 8 <= width; x += 8)
+    {
+        __m256i rgba = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(source + 4 * x));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dest + 4 * x),
+                            _mm256_shuffle_epi8(rgba, shuffle));
+    }
+    return x;
+}
+
+__m128i SelectSSE2(__m128i mask, __m128i ifTrue, __m128i ifFalse)
+{
+    return _mm_or_si128(_mm_and_si128(mask, ifTrue), _mm_andnot_si128(mask, ifFalse));
+}
+
+// Same as gl::float32ToFloat16, four lanes at a time.  SSE2 has no per-lane variable shift, so
+// groups of values that would become half-float denormals are left to the scalar code.
+size_t Float32ToFloat16RowSSE2(const float *source, uint16_t *dest, size_t count)
+{
+    const __m128i absMask            = _mm_set1_epi32(0x7FFFFFFF);
+    const __m128i nanThreshold       = _mm_set1_epi32(0x7F800000);
+    const __m128i infThreshold       = _mm_set1_epi32(0x47FFEFFF);
+    const __m128i denormalThreshold  = _mm_set1_epi32(0x38800000);
+    const __m128i underflowThreshold = _mm_set1_epi32(0x2D000000);
+    const __m128i normalBias         = _mm_set1_epi32(static_cast<int>(0xC8000FFFu));
+    const __m128i nanValue           = _mm_set1_epi32(0x7FFF);
+    const __m128i infValue           = _mm_set1_epi32(0x7C00);
+    const __m128i one                = _mm_set1_epi32(1);
+
+    size_t x = 0;
+    for (; x + 4 <= count; x += 4)
+    {
+        __m128i value = _mm_castps_si128(_mm_loadu_ps(source + x));
+        __m128i abs   = _mm_and_si128(value, absMask);
+        __m128i sign  = _mm_srli_epi32(_mm_andnot_si128(absMask, value), 16);
+
+        __m128i isNaN      = _mm_cmpgt_epi32(abs, nanThreshold);
+        __m128i isInf      = _mm_cmpgt_epi32(abs, infThreshold);
+        __m128i isDenormal = _mm_cmplt_epi32(abs, denormalThreshold);
+        __m128i isZero     = _mm_cmplt_epi32(abs, underflowThreshold);
+        if (_mm_movemask_epi8(_mm_andnot_si128(isZero, isDenormal)) != 0)
+        {
+            break;
+        }
+
+        __m128i roundBit = _mm_and_si128(_mm_srli_epi32(abs, 13), one);
+        __m128i normal   =
+            _mm_srli_epi32(_mm_add_epi32(_mm_add_epi32(abs, normalBias), roundBit), 13);
+
+        __m128i result = _mm_andnot_si128(isDenormal, normal);
+        result         = SelectSSE2(isInf, infValue, result);
+        result         = _mm_or_si128(result, sign);
+        result         = SelectSSE2(isNaN, nanValue, result);
+
+        // Sign extend so that the saturating pack keeps all 16 bits.
+        result = _mm_srai_epi32(_mm_slli_epi32(result, 16), 16);
+        _mm_storel_epi64(reinterpret_cast<__m128i *>(dest + x), _mm_packs_epi32(result, result));
+    }
+    return x;
+}
+
+ANGLE_TARGET_AVX2 size_t Float32ToFloat16RowAVX2(const float *source, uint16_t *dest, size_t count)
+{
+    const __m256i absMask           = _mm256_set1_epi32(0x7FFFFFFF);
+    const __m256i nanThreshold      = _mm256_set1_epi32(0x7F800000);
+    const __m256i infThreshold      = _mm256_set1_epi32(0x47FFEFFF);
+    const __m256i denormalThreshold = _mm256_set1_epi32(0x38800000);
+    const __m256i normalBias        = _mm256_set1_epi32(static_cast<int>(0xC8000FFFu));
+    const __m256i denormalBias      = _mm256_set1_epi32(0xFFF);
+    const __m256i mantissaMask      = _mm256_set1_epi32(0x007FFFFF);
+    const __m256i implicitOne       = _mm256_set1_epi32(0x00800000);
+    const __m256i denormalExponent  = _mm256_set1_epi32(113);
+    const __m256i nanValue          = _mm256_set1_epi32(0x7FFF);
+    const __m256i infValue          = _mm256_set1_epi32(0x7C00);
+    const __m256i one               = _mm256_set1_epi32(1);
+
+    size_t x = 0;
+    for (; x + 8 <= count; x += 8)
+    {
+        __m256i value = _mm256_castps_si256(_mm256_loadu_ps(source + x));
+        __m256i abs   = _mm256_and_si256(value, absMask);
+        __m256i sign  = _mm256_srli_epi32(_mm256_andnot_si256(absMask, value), 16);
+
+        __m256i isNaN      = _mm256_cmpgt_epi32(abs, nanThreshold);
+        __m256i isInf      = _mm256_cmpgt_epi32(abs, infThreshold);
+        __m256i isDenormal = _mm256_cmpgt_epi32(denormalThreshold, abs);
+
+        __m256i roundBit = _mm256_and_si256(_mm256_srli_epi32(abs, 13), one);
+        __m256i normal   =
+            _mm256_srli_epi32(_mm256_add_epi32(_mm256_add_epi32(abs, normalBias), roundBit), 13);
+
+        // Shifts of 32 or more give zero, like the scalar code's underflow case.
+        __m256i mantissa    = _mm256_or_si256(_mm256_and_si256(abs, mantissaMask), implicitOne);
+        __m256i shift       = _mm256_sub_epi32(denormalExponent, _mm256_srli_epi32(abs, 23));
+        __m256i denormalAbs = _mm256_srlv_epi32(mantissa, shift);
+
+        __m256i denormalRoundBit = _mm256_and_si256(_mm256_srli_epi32(denormalAbs, 13), one);
+        __m256i denormal         = _mm256_srli_epi32(
+            _mm256_add_epi32(_mm256_add_epi32(denormalAbs, denormalBias), denormalRoundBit), 13);
+
+        __m256i result = _mm256_blendv_epi8(normal, denormal, isDenormal);
+        result         = _mm256_blendv_epi8(result, infValue, isInf);
+        result         = _mm256_or_si256(result, sign);
+        result         = _mm256_blendv_epi8(result, nanValue, isNaN);
+
+        // The pack works within 128-bit lanes; gather the two low halves.
+        __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi32(result, result), 0x08);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dest + x), _mm256_castsi256_si128(packed));
+    }
+    return x;
+}
+#endif  // defined(ANGLE_USE_SSE)
+
+#if defined(ANGLE_USE_NEON)
+size_t ExpandA8ToRGBA8RowNEON(const uint8_t *source, uint8_t *dest, size_t width)
+{
+    uint8x16x4_t rgba;
+    rgba.val[0] = vdupq_n_u8(0);
+    rgba.val[1] = rgba.val[0];
+    rgba.val[2] = rgba.val[0];
+
+    size_t x = 0;
+    for (; x + 16 <= width; x += 16)
+    {
+        rgba.val[3] = vld1q_u8(source + x);
+        vst4q_u8(dest + 4 * x, rgba);
+    }
+    return x;
+}
+
+size_t ExpandL8ToRGBA8RowNEON(const uint8_t *source, uint8_t *dest, size_t width)
+{
+    uint8x16x4_t rgba;
+    rgba.val[3] = vdupq_n_u8(0xFF);
+
+    size_t x = 0;
+    for (; x + 16 <= width; x += 16)
+    {
+        uint8x16_t l = vld1q_u8(source + x);
+        rgba.val[0]  = l;
+        rgba.val[1]  = l;
+        rgba.val[2]  = l;
+        vst4q_u8(dest + 4 * x, rgba);
+    }
+    return x;
+}
+
+size_t ExpandLA8ToRGBA8RowNEON(const uint8_t *source, uint8_t *dest, size_t width)
+{
+    size_t x = 0;
+    for (; x + 16 <= width; x += 16)
+    {
+        uint8x16x2_t la = vld2q_u8(source + 2 * x);
+        uint8x16x4_t rgba;
+        rgba.val[0] = la.val[0];
+        rgba.val[1] = la.val[0];
+        rgba.val[2] = la.val[0];
+        rgba.val[3] = la.val[1];
+        vst4q_u8(dest + 4 * x, rgba);
+    }
+    return x;
+}
+
+template <bool kSwapRB>
+size_t ExpandRGB8ToRGBX8RowNEON(const uint8_t *source,
+                                uint8_t *dest,
+                                size_t width,
+                                uint8_t fourthValue)
+{
+    uint8x16x4_t rgbx;
+    rgbx.val[3] = vdupq_n_u8(fourthValue);
+
+    size_t x = 0;
+    for (; x + 16 <= width; x += 16)
+    {
+        uint8x16x3_t rgb = vld3q_u8(source + 3 * x);
+        rgbx.val[0]      = rgb.val[kSwapRB ? 2 : 0];
+        rgbx.val[1]      = rgb.val[1];
+        rgbx.val[2]      = rgb.val[kSwapRB ? 0 : 2];
+        vst4q_u8(dest + 4 * x, rgbx);
+    }
+    return x;
+}
+
+size_t SwizzleRGBA8ToBGRA8RowNEON(const uint8_t *source, uint8_t *dest, size_t width)
+{
+    size_t x = 0;
+    for (; x + 16 <= width; x += 16)
+    {
+        uint8x16x4_t rgba = vld4q_u8(source + 4 * x);
+        uint8x16_t red    = rgba.val[0];
+        rgba.val[0]       = rgba.val[2];
+        rgba.val[2]       = red;
+        vst4q_u8(dest + 4 * x, rgba);
+    }
+    return x;
+}
+
+// Same as gl::float32ToFloat16, four lanes at a time.
+size_t Float32ToFloat16RowNEON(const float *source, uint16_t *dest, size_t count)
+{
+    const uint32x4_t absMask           = vdupq_n_u32(0x7FFFFFFF);
+    const uint32x4_t nanThreshold      = vdupq_n_u32(0x7F800000);
+    const uint32x4_t infThreshold      = vdupq_n_u32(0x47FFEFFF);
+    const uint32x4_t denormalThreshold = vdupq_n_u32(0x38800000);
+    const uint32x4_t normalBias        = vdupq_n_u32(0xC8000FFF);
+    const uint32x4_t denormalBias      = vdupq_n_u32(0xFFF);
+    const uint32x4_t mantissaMask      = vdupq_n_u32(0x007FFFFF);
+    const uint32x4_t implicitOne       = vdupq_n_u32(0x00800000);
+    const uint32x4_t nanValue          = vdupq_n_u32(0x7FFF);
+    const uint32x4_t infValue          = vdupq_n_u32(0x7C00);
+    const uint32x4_t one               = vdupq_n_u32(1);
+    const int32x4_t denormalExponent   = vdupq_n_s32(113);
+    const int32x4_t maxShift           = vdupq_n_s32(32);
+
+    size_t x = 0;
+    for (; x + 4 <= count; x += 4)
+    {
+        uint32x4_t value = vreinterpretq_u32_f32(vld1q_f32(source + x));
+        uint32x4_t abs   = vandq_u32(value, absMask);
+        uint32x4_t sign  = vshrq_n_u32(vbicq_u32(value, absMask), 16);
+
+        uint32x4_t isNaN      = vcgtq_u32(abs, nanThreshold);
+        uint32x4_t isInf      = vcgtq_u32(abs, infThreshold);
+        uint32x4_t isDenormal = vcltq_u32(abs, denormalThreshold);
+
+        uint32x4_t roundBit = vandq_u32(vshrq_n_u32(abs, 13), one);
+        uint32x4_t normal   = vshrq_n_u32(vaddq_u32(vaddq_u32(abs, normalBias), roundBit), 13);
+
+        // Negative shift counts shift right; shifting by 32 or more gives zero.
+        uint32x4_t mantissa = vorrq_u32(vandq_u32(abs, mantissaMask), implicitOne);
+        int32x4_t shift =
+            vminq_s32(vsubq_s32(denormalExponent, vreinterpretq_s32_u32(vshrq_n_u32(abs, 23))),
+                      maxShift);
+        uint32x4_t denormalAbs = vshlq_u32(mantissa, vnegq_s32(shift));
+
+        uint32x4_t denormalRoundBit = vandq_u32(vshrq_n_u32(denormalAbs, 13), one);
+        uint32x4_t denormal         =
+            vshrq_n_u32(vaddq_u32(vaddq_u32(denormalAbs, denormalBias), denormalRoundBit), 13);
+
+        uint32x4_t result = vbslq_u32(isDenormal, denormal, normal);
+        result            = vbslq_u32(isInf, infValue, result);
+        result            = vorrq_u32(result, sign);
+        result            = vbslq_u32(isNaN, nanValue, result);
+        vst1_u16(dest + x, vmovn_u32(result));
+    }
+    return x;
+}
+#endif  // defined(ANGLE_USE_NEON)
+
+size_t ExpandA8ToRGBA8Row(const uint8_t *source, uint8_t *dest, size_t width)
 {
 #if defined(ANGLE_USE_SSE)
     if (gl::supportsSSE2())
     {
-        __m128i zeroWide = _mm_setzero_si128();
+        return ExpandA8ToRGBA8RowSSE2(source, dest, width);
+    }
+#elif defined(ANGLE_USE_NEON)
+    return ExpandA8ToRGBA8RowNEON(source, dest, width);
+#endif
+    return 0;
+}
+
+size_t ExpandL8ToRGBA8Row(const uint8_t *source, uint8_t *dest, size_t width)
+{
+#if defined(ANGLE_USE_SSE)
+    if (gl::supportsSSE2())
+    {
+        return ExpandL8ToRGBA8RowSSE2(source, dest, width);
+    }
+#elif defined(ANGLE_USE_NEON)
+    return ExpandL8ToRGBA8RowNEON(source, dest, width);
+#endif
+    return 0;
+}
+
+size_t ExpandLA8ToRGBA8Row(const uint8_t *source, uint8_t *dest, size_t width)
+{
+#if defined(ANGLE_USE_SSE)
+    if (gl::supportsSSE2())
+    {
+        return ExpandLA8ToRGBA8RowSSE2(source, dest, width);
+    }
+#elif defined(ANGLE_USE_NEON)
+    return ExpandLA8ToRGBA8RowNEON(source, dest, width);
+#endif
+    return 0;
+}
+
+template <bool kSwapRB>
+size_t ExpandRGB8ToRGBX8Row(const uint8_t *source,
+                            uint8_t *dest,
+                            size_t width,
+                            uint8_t fourthValue)
+{
+#if defined(ANGLE_USE_SSE)
+    if (gl::supportsSSSE3())
+    {
+        return ExpandRGB8ToRGBX8RowSSSE3<kSwapRB>(source, dest, width, fourthValue);
+    }
+#elif defined(ANGLE_USE_NEON)
+    return ExpandRGB8ToRGBX8RowNEON<kSwapRB>(source, dest, width, fourthValue);
+#endif
+    return 0;
+}
+
+size_t SwizzleRGBA8ToBGRA8Row(const uint8_t *source, uint8_t *dest, size_t width)
+{
+#if defined(ANGLE_USE_SSE)
+    if (gl::supportsAVX2())
+    {
+        return SwizzleRGBA8ToBGRA8RowAVX2(source, dest, width);
+    }
+    if (gl::supportsSSSE3())
+    {
+        return SwizzleRGBA8ToBGRA8RowSSSE3(source, dest, width);
+    }
+    if (gl::supportsSSE2())
+    {
+        return SwizzleRGBA8ToBGRA8RowSSE2(source, dest, width);
+    }
+#elif defined(ANGLE_USE_NEON)
+    return SwizzleRGBA8ToBGRA8RowNEON(source, dest, width);
+#endif
+    return 0;
+}
+}  // anonymous namespace
+
+namespace priv
+{
+void LoadRGB8ToRGBX8Row(const uint8_t *source, uint8_t *dest, size_t width, uint8_t fourthValue)
+{
+    size_t x = ExpandRGB8ToRGBX8Row<false>(source, dest, width, fourthValue);
+    for (; x < width; x++)
+    {
+        dest[4 * x + 0] = source[3 * x + 0];
+        dest[4 * x + 1] = source[3 * x + 1];
+        dest[4 * x + 2] = source[3 * x + 2];
+        dest[4 * x + 3] = fourthValue;
+    }
+}
 
-        for (size_t z = 0; z < depth; z++)
+void Float32ToFloat16Row(const float *source, uint16_t *dest, size_t count)
+{
+    size_t x = 0;
+#if defined(ANGLE_USE_SSE)
+    if (gl::supportsAVX2())
+    {
+        x = Float32ToFloat16RowAVX2(source, dest, count);
+    }
+    else if (gl::supportsSSE2())
+    {
+        // Stops at the first group with a denormal result, so keep going after the scalar code
+        // has converted it.
+        while (x < count)
         {
-            for (size_t y = 0; y < height; y++)
+            x += Float32ToFloat16RowSSE2(source + x, dest + x, count - x);
+            size_t groupEnd = std::min(x + 4, count);
+            for (; x < groupEnd; x++)
             {
-                const uint8_t *source =
-                    priv::OffsetDataPointer<uint8_t>(input, y, z, inputRowPitch, inputDepthPitch);
-                uint32_t *dest = priv::OffsetDataPointer<uint32_t>(output, y, z, outputRowPitch,
-                                                                   outputDepthPitch);
-
-                size_t x = 0;
-
-                // Make output writes aligned
-                for (; ((reinterpret_cast<intptr_t>(&dest[x]) & 0xF) != 0 && x < width); x++)
-                {
-                    dest[x] = static_cast<uint32_t>(source[x]) << 24;
-                }
-
-                for (; x + 7 < width; x += 8)
-                {
-                    __m128i sourceData =
-                        _mm_loadl_epi64(reinterpret_cast<const __m128i *>(&source[x]));
-                    // Interleave each byte to 16bit, make the lower byte to zero
-                    sourceData = _mm_unpacklo_epi8(zeroWide, sourceData);
-                    // Interleave each 16bit to 32bit, make the lower 16bit to zero
-                    __m128i lo = _mm_unpacklo_epi16(zeroWide, sourceData);
-                    __m128i hi = _mm_unpackhi_epi16(zeroWide, sourceData);
-
-                    _mm_store_si128(reinterpret_cast<__m128i *>(&dest[x]), lo);
-                    _mm_store_si128(reinterpret_cast<__m128i *>(&dest[x + 4]), hi);
-                }
-
-                // Handle the remainder
-                for (; x < width; x++)
-                {
-                    dest[x] = static_cast<uint32_t>(source[x]) << 24;
-                }
+                dest[x] = gl::float32ToFloat16(source[x]);
             }
         }
-
-        return;
     }
+#elif defined(ANGLE_USE_NEON)
+    x = Float32ToFloat16RowNEON(source, dest, count);
 #endif
+    for (; x < count; x++)
+    {
+        dest[x] = gl::float32ToFloat16(source[x]);
+    }
+}
+}  // namespace priv
 
+void LoadA8ToRGBA8(size_t width,
+                   size_t height,
+                   size_t depth,
+                   const uint8_t *input,
+                   size_t inputRowPitch,
+                   size_t inputDepthPitch,
+                   uint8_t *output,
+                   size_t outputRowPitch,
+                   size_t outputDepthPitch)
+{
     for (size_t z = 0; z < depth; z++)
     {
         for (size_t y = 0; y < height; y++)
@@ -81,7 +547,8 @@ void LoadA8ToRGBA8(size_t width,
                 priv::OffsetDataPointer<uint8_t>(input, y, z, inputRowPitch, inputDepthPitch);
             uint32_t *dest =
                 priv::OffsetDataPointer<uint32_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
+            size_t x = ExpandA8ToRGBA8Row(source, reinterpret_cast<uint8_t *>(dest), width);
+            for (; x < width; x++)
             {
                 dest[x] = static_cast<uint32_t>(source[x]) << 24;
             }
@@ -180,7 +647,8 @@ void LoadL8ToRGBA8(size_t width,
                 priv::OffsetDataPointer<uint8_t>(input, y, z, inputRowPitch, inputDepthPitch);
             uint8_t *dest =
                 priv::OffsetDataPointer<uint8_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
+            size_t x = ExpandL8ToRGBA8Row(source, dest, width);
+            for (; x < width; x++)
             {
                 uint8_t sourceVal = source[x];
                 dest[4 * x + 0]   = sourceVal;
@@ -283,7 +751,8 @@ void LoadLA8ToRGBA8(size_t width,
                 priv::OffsetDataPointer<uint8_t>(input, y, z, inputRowPitch, inputDepthPitch);
             uint8_t *dest =
                 priv::OffsetDataPointer<uint8_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
+            size_t x = ExpandLA8ToRGBA8Row(source, dest, width);
+            for (; x < width; x++)
             {
                 dest[4 * x + 0] = source[2 * x + 0];
                 dest[4 * x + 1] = source[2 * x + 0];
@@ -449,7 +918,8 @@ void LoadRGB8ToBGRX8(size_t width,
                 priv::OffsetDataPointer<uint8_t>(input, y, z, inputRowPitch, inputDepthPitch);
             uint8_t *dest =
                 priv::OffsetDataPointer<uint8_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
+            size_t x = ExpandRGB8ToRGBX8Row<true>(source, dest, width, 0xFF);
+            for (; x < width; x++)
             {
                 dest[4 * x + 0] = source[x * 3 + 2];
                 dest[4 * x + 1] = source[x * 3 + 1];
@@ -594,67 +1064,19 @@ void LoadRGBA8ToBGRA8(size_t width,
                       size_t outputRowPitch,
                       size_t outputDepthPitch)
 {
-#if defined(ANGLE_USE_SSE)
-    if (gl::supportsSSE2())
-    {
-        __m128i brMask = _mm_set1_epi32(0x00ff00ff);
-
-        for (size_t z = 0; z < depth; z++)
-        {
-            for (size_t y = 0; y < height; y++)
-            {
-                const uint32_t *source =
-                    priv::OffsetDataPointer<uint32_t>(input, y, z, inputRowPitch, inputDepthPitch);
-                uint32_t *dest = priv::OffsetDataPointer<uint32_t>(output, y, z, outputRowPitch,
-                                                                   outputDepthPitch);
-
-                size_t x = 0;
-
-                // Make output writes aligned
-                for (; ((reinterpret_cast<intptr_t>(&dest[x]) & 15) != 0) && x < width; x++)
-                {
-                    uint32_t rgba = source[x];
-                    dest[x]       = (ANGLE_ROTL(rgba, 16) & 0x00ff00ff) | (rgba & 0xff00ff00);
-                }
-
-                for (; x + 3 < width; x += 4)
-                {
-                    __m128i sourceData =
-                        _mm_loadu_si128(reinterpret_cast<const __m128i *>(&source[x]));
-                    // Mask out g and a, which don't change
-                    __m128i gaComponents = _mm_andnot_si128(brMask, sourceData);
-                    // Mask out b and r
-                    __m128i brComponents = _mm_and_si128(sourceData, brMask);
-                    // Swap b and r
-                    __m128i brSwapped = _mm_shufflehi_epi16(
-                        _mm_shufflelo_epi16(brComponents, _MM_SHUFFLE(2, 3, 0, 1)),
-                        _MM_SHUFFLE(2, 3, 0, 1));
-                    __m128i result = _mm_or_si128(gaComponents, brSwapped);
-                    _mm_store_si128(reinterpret_cast<__m128i *>(&dest[x]), result);
-                }
-
-                // Perform leftover writes
-                for (; x < width; x++)
-                {
-                    uint32_t rgba = source[x];
-                    dest[x]       = (ANGLE_ROTL(rgba, 16) & 0x00ff00ff) | (rgba & 0xff00ff00);
-                }
-            }
-        }
-
-        return;
-    }
-#endif
-
     for (size_t z = 0; z < depth; z++)
     {
         for (size_t y = 0; y < height; y++)
         {
-            const uint32_t *source =
-                priv::OffsetDataPointer<uint32_t>(input, y, z, inputRowPitch, inputDepthPitch);
-            uint32_t *dest =
-                priv::OffsetDataPointer<uint32_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
+            const uint8_t *sourceBytes =
+                priv::OffsetDataPointer<uint8_t>(input, y, z, inputRowPitch, inputDepthPitch);
+            uint8_t *destBytes =
+                priv::OffsetDataPointer<uint8_t>(output, y, z, outputRowPitch, outputDepthPitch);
+            size_t x = SwizzleRGBA8ToBGRA8Row(sourceBytes, destBytes, width);
+
+            const uint32_t *source = reinterpret_cast<const uint32_t *>(sourceBytes);
+            uint32_t *dest         = reinterpret_cast<uint32_t *>(destBytes);
+            for (; x < width; x++)
             {
                 uint32_t rgba = source[x];
                 dest[x]       = (ANGLE_ROTL(rgba, 16) & 0x00ff00ff) | (rgba & 0xff00ff00);
@@ -1529,12 +1951,7 @@ void LoadRGB32FToRGB16F(size_t width,
                 priv::OffsetDataPointer<float>(input, y, z, inputRowPitch, inputDepthPitch);
             uint16_t *dest =
                 priv::OffsetDataPointer<uint16_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
-            {
-                dest[x * 3 + 0] = gl::float32ToFloat16(source[x * 3 + 0]);
-                dest[x * 3 + 1] = gl::float32ToFloat16(source[x * 3 + 1]);
-                dest[x * 3 + 2] = gl::float32ToFloat16(source[x * 3 + 2]);
-            }
+            priv::Float32ToFloat16Row(source, dest, width * 3);
         }
     }
 }
@@ -8,8 +8,11 @@
 
 #include "image_util/loadimage.h"
 
+#include <algorithm>
 #include <type_traits>
+
 #include "common/mathutil.h"
+#include "common/platform.h"
 
 #include "image_util/imageformats.h"
 
@@ -64,22 +67,15 @@ struct ETC2Block
                                    size_t destRowPitch,
                                    bool isSigned) const
     {
-        for (size_t j = 0; j < 4 && (y + j) < h; j++)
+        // Every texel of the block has one of eight values, so they are only computed once.
+        uint8_t values[8];
+        for (size_t modifierIdx = 0; modifierIdx < 8; modifierIdx++)
         {
-            uint8_t *row = dest + (j * destRowPitch);
-            for (size_t i = 0; i < 4 && (x + i) < w; i++)
-            {
-                uint8_t *pixel = row + (i * destPixelStride);
-                if (isSigned)
-                {
-                    *pixel = clampSByte(getSingleETC2Channel(i, j, isSigned));
-                }
-                else
-                {
-                    *pixel = clampByte(getSingleETC2Channel(i, j, isSigned));
-                }
-            }
+            int value = getSingleETC2Channel(modifierIdx, isSigned);
+            values[modifierIdx] =
+                isSigned ? static_cast<uint8_t>(clampSByte(value)) : clampByte(value);
         }
+        writeSingleChannel(dest, x, y, w, h, destPixelStride, destRowPitch, values);
     }
 
     // Decodes unsigned single or dual channel EAC block to 16-bit color
@@ -93,29 +89,25 @@ struct ETC2Block
                                   bool isSigned,
                                   bool isFloat) const
     {
-        for (size_t j = 0; j < 4 && (y + j) < h; j++)
+        uint16_t values[8];
+        for (size_t modifierIdx = 0; modifierIdx < 8; modifierIdx++)
         {
-            uint16_t *row = reinterpret_cast<uint16_t *>(reinterpret_cast<uint8_t *>(dest) +
-                                                         (j * destRowPitch));
-            for (size_t i = 0; i < 4 && (x + i) < w; i++)
+            if (isSigned)
             {
-                uint16_t *pixel = row + (i * destPixelStride);
-                if (isSigned)
-                {
-                    int16_t tempPixel =
-                        renormalizeEAC<int16_t>(getSingleEACChannel(i, j, isSigned));
-                    *pixel =
-                        isFloat ? gl::float32ToFloat16(float(gl::normalize(tempPixel))) : tempPixel;
-                }
-                else
-                {
-                    uint16_t tempPixel =
-                        renormalizeEAC<uint16_t>(getSingleEACChannel(i, j, isSigned));
-                    *pixel =
-                        isFloat ? gl::float32ToFloat16(float(gl::normalize(tempPixel))) : tempPixel;
-                }
+                int16_t tempValue =
+                    renormalizeEAC<int16_t>(getSingleEACChannel(modifierIdx, isSigned));
+                values[modifierIdx] =
+                    isFloat ? gl::float32ToFloat16(float(gl::normalize(tempValue))) : tempValue;
+            }
+            else
+            {
+                uint16_t tempValue =
+                    renormalizeEAC<uint16_t>(getSingleEACChannel(modifierIdx, isSigned));
+                values[modifierIdx] =
+                    isFloat ? gl::float32ToFloat16(float(gl::normalize(tempValue))) : tempValue;
             }
         }
+        writeSingleChannel(dest, x, y, w, h, destPixelStride, destRowPitch, values);
     }
 
     // Decodes RGB block to rgba8
@@ -413,6 +405,56 @@ struct ETC2Block
         return createRGBA(red, green, blue, 255);
     }
 
+    // Computes four opaque colors, each the clamped sum of a base color and a modifier.
+    static void createRGBAColors(const int baseColors[4][3],
+                                 const int modifiers[4],
+                                 R8G8B8A8 colors[4])
+    {
+#if defined(ANGLE_USE_SSE)
+        // The sums fit in 16 bits, and saturating them to bytes is the clamp.
+        __m128i colors01 = _mm_setr_epi16(
+            static_cast<int16_t>(baseColors[0][0]), static_cast<int16_t>(baseColors[0][1]),
+            static_cast<int16_t>(baseColors[0][2]), 255, static_cast<int16_t>(baseColors[1][0]),
+            static_cast<int16_t>(baseColors[1][1]), static_cast<int16_t>(baseColors[1][2]), 255);
+        __m128i colors23 = _mm_setr_epi16(
+            static_cast<int16_t>(baseColors[2][0]), static_cast<int16_t>(baseColors[2][1]),
+            static_cast<int16_t>(baseColors[2][2]), 255, static_cast<int16_t>(baseColors[3][0]),
+            static_cast<int16_t>(baseColors[3][1]), static_cast<int16_t>(baseColors[3][2]), 255);
+        __m128i modifiers01 = _mm_setr_epi16(
+            static_cast<int16_t>(modifiers[0]), static_cast<int16_t>(modifiers[0]),
+            static_cast<int16_t>(modifiers[0]), 0, static_cast<int16_t>(modifiers[1]),
+            static_cast<int16_t>(modifiers[1]), static_cast<int16_t>(modifiers[1]), 0);
+        __m128i modifiers23 = _mm_setr_epi16(
+            static_cast<int16_t>(modifiers[2]), static_cast<int16_t>(modifiers[2]),
+            static_cast<int16_t>(modifiers[2]), 0, static_cast<int16_t>(modifiers[3]),
+            static_cast<int16_t>(modifiers[3]), static_cast<int16_t>(modifiers[3]), 0);
+        __m128i packed = _mm_packus_epi16(_mm_add_epi16(colors01, modifiers01),
+                                          _mm_add_epi16(colors23, modifiers23));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(colors), packed);
+#elif defined(ANGLE_USE_NEON)
+        int16_t sums[16];
+        for (size_t colorIdx = 0; colorIdx < 4; colorIdx++)
+        {
+            for (size_t channel = 0; channel < 3; channel++)
+            {
+                sums[colorIdx * 4 + channel] =
+                    static_cast<int16_t>(baseColors[colorIdx][channel] + modifiers[colorIdx]);
+            }
+            sums[colorIdx * 4 + 3] = 255;
+        }
+        vst1q_u8(reinterpret_cast<uint8_t *>(colors),
+                 vcombine_u8(vqmovun_s16(vld1q_s16(sums)), vqmovun_s16(vld1q_s16(sums + 8))));
+#else
+        for (size_t colorIdx = 0; colorIdx < 4; colorIdx++)
+        {
+            const int modifier = modifiers[colorIdx];
+            colors[colorIdx]   = createRGBA(baseColors[colorIdx][0] + modifier,
+                                          baseColors[colorIdx][1] + modifier,
+                                          baseColors[colorIdx][2] + modifier);
+        }
+#endif
+    }
+
     static int extend_4to8bits(int x) { return (x << 4) | x; }
     static int extend_5to8bits(int x) { return (x << 3) | (x >> 2); }
     static int extend_6to8bits(int x) { return (x << 2) | (x >> 4); }
@@ -476,64 +518,23 @@ struct ETC2Block
         const IntensityModifier *intensityModifier =
             nonOpaquePunchThroughAlpha ? intensityModifierNonOpaque : intensityModifierDefault;
 
-        R8G8B8A8 subblockColors0[4];
-        R8G8B8A8 subblockColors1[4];
-        for (size_t modifierIdx = 0; modifierIdx < 4; modifierIdx++)
-        {
-            const int i1                 = intensityModifier[u.idht.mode.idm.cw1][modifierIdx];
-            subblockColors0[modifierIdx] = createRGBA(r1 + i1, g1 + i1, b1 + i1);
-
-            const int i2                 = intensityModifier[u.idht.mode.idm.cw2][modifierIdx];
-            subblockColors1[modifierIdx] = createRGBA(r2 + i2, g2 + i2, b2 + i2);
-        }
+        // The colors of the first subblock followed by those of the second.
+        R8G8B8A8 subblockColors[8];
+        const int baseColors0[4][3] = {{r1, g1, b1}, {r1, g1, b1}, {r1, g1, b1}, {r1, g1, b1}};
+        const int baseColors1[4][3] = {{r2, g2, b2}, {r2, g2, b2}, {r2, g2, b2}, {r2, g2, b2}};
+        createRGBAColors(baseColors0, intensityModifier[u.idht.mode.idm.cw1], &subblockColors[0]);
+        createRGBAColors(baseColors1, intensityModifier[u.idht.mode.idm.cw2], &subblockColors[4]);
 
-        if (u.idht.mode.idm.flipbit)
-        {
-            uint8_t *curPixel = dest;
-            for (size_t j = 0; j < 2 && (y + j) < h; j++)
-            {
-                R8G8B8A8 *row = reinterpret_cast<R8G8B8A8 *>(curPixel);
-                for (size_t i = 0; i < 4 && (x + i) < w; i++)
-                {
-                    row[i]   = subblockColors0[getIndex(i, j)];
-                    row[i].A = alphaValues[j][i];
-                }
-                curPixel += destRowPitch;
-            }
-            for (size_t j = 2; j < 4 && (y + j) < h; j++)
-            {
-                R8G8B8A8 *row = reinterpret_cast<R8G8B8A8 *>(curPixel);
-                for (size_t i = 0; i < 4 && (x + i) < w; i++)
-                {
-                    row[i]   = subblockColors1[getIndex(i, j)];
-                    row[i].A = alphaValues[j][i];
-                }
-                curPixel += destRowPitch;
-            }
-        }
-        else
-        {
-            uint8_t *curPixel = dest;
-            for (size_t j = 0; j < 4 && (y + j) < h; j++)
-            {
-                R8G8B8A8 *row = reinterpret_cast<R8G8B8A8 *>(curPixel);
-                for (size_t i = 0; i < 2 && (x + i) < w; i++)
-                {
-                    row[i]   = subblockColors0[getIndex(i, j)];
-                    row[i].A = alphaValues[j][i];
-                }
-                for (size_t i = 2; i < 4 && (x + i) < w; i++)
-                {
-                    row[i]   = subblockColors1[getIndex(i, j)];
-                    row[i].A = alphaValues[j][i];
-                }
-                curPixel += destRowPitch;
-            }
-        }
         if (nonOpaquePunchThroughAlpha)
         {
-            decodePunchThroughAlphaBlock(dest, x, y, w, h, destRowPitch);
+            subblockColors[2] = createRGBA(0, 0, 0, 0);
+            subblockColors[6] = createRGBA(0, 0, 0, 0);
         }
+
+        // The second subblock is the bottom half of the block when flipped, the right half
+        // otherwise.
+        const uint32_t subblockMask = u.idht.mode.idm.flipbit ? 0xCCCC : 0xFF00;
+        writeColors(dest, x, y, w, h, destRowPitch, subblockColors, subblockMask, alphaValues);
     }
 
     void decodeTBlock(uint8_t *dest,
@@ -558,29 +559,17 @@ struct ETC2Block
         static int distance[8] = {3, 6, 11, 16, 23, 32, 41, 64};
         const int d            = distance[block.Tda << 1 | block.Tdb];
 
-        const R8G8B8A8 paintColors[4] = {
-            createRGBA(r1, g1, b1),
-            createRGBA(r2 + d, g2 + d, b2 + d),
-            createRGBA(r2, g2, b2),
-            createRGBA(r2 - d, g2 - d, b2 - d),
-        };
-
-        uint8_t *curPixel = dest;
-        for (size_t j = 0; j < 4 && (y + j) < h; j++)
-        {
-            R8G8B8A8 *row = reinterpret_cast<R8G8B8A8 *>(curPixel);
-            for (size_t i = 0; i < 4 && (x + i) < w; i++)
-            {
-                row[i]   = paintColors[getIndex(i, j)];
-                row[i].A = alphaValues[j][i];
-            }
-            curPixel += destRowPitch;
-        }
+        R8G8B8A8 paintColors[4];
+        const int baseColors[4][3] = {{r1, g1, b1}, {r2, g2, b2}, {r2, g2, b2}, {r2, g2, b2}};
+        const int modifiers[4]     = {0, d, 0, -d};
+        createRGBAColors(baseColors, modifiers, paintColors);
 
         if (nonOpaquePunchThroughAlpha)
         {
-            decodePunchThroughAlphaBlock(dest, x, y, w, h, destRowPitch);
+            paintColors[2] = createRGBA(0, 0, 0, 0);
         }
+
+        writeColors(dest, x, y, w, h, destRowPitch, paintColors, 0, alphaValues);
     }
 
     void decodeHBlock(uint8_t *dest,
@@ -607,29 +596,17 @@ struct ETC2Block
             ((r1 << 16 | g1 << 8 | b1) >= (r2 << 16 | g2 << 8 | b2) ? 1 : 0);
         const int d = distance[(block.Hda << 2) | (block.Hdb << 1) | orderingTrickBit];
 
-        const R8G8B8A8 paintColors[4] = {
-            createRGBA(r1 + d, g1 + d, b1 + d),
-            createRGBA(r1 - d, g1 - d, b1 - d),
-            createRGBA(r2 + d, g2 + d, b2 + d),
-            createRGBA(r2 - d, g2 - d, b2 - d),
-        };
-
-        uint8_t *curPixel = dest;
-        for (size_t j = 0; j < 4 && (y + j) < h; j++)
-        {
-            R8G8B8A8 *row = reinterpret_cast<R8G8B8A8 *>(curPixel);
-            for (size_t i = 0; i < 4 && (x + i) < w; i++)
-            {
-                row[i]   = paintColors[getIndex(i, j)];
-                row[i].A = alphaValues[j][i];
-            }
-            curPixel += destRowPitch;
-        }
+        R8G8B8A8 paintColors[4];
+        const int baseColors[4][3] = {{r1, g1, b1}, {r1, g1, b1}, {r2, g2, b2}, {r2, g2, b2}};
+        const int modifiers[4]     = {d, -d, d, -d};
+        createRGBAColors(baseColors, modifiers, paintColors);
 
         if (nonOpaquePunchThroughAlpha)
         {
-            decodePunchThroughAlphaBlock(dest, x, y, w, h, destRowPitch);
+            paintColors[2] = createRGBA(0, 0, 0, 0);
         }
+
+        writeColors(dest, x, y, w, h, destRowPitch, paintColors, 0, alphaValues);
     }
 
     void decodePlanarBlock(uint8_t *dest,
@@ -680,25 +657,74 @@ struct ETC2Block
         return (msb << 1) | lsb;
     }
 
-    void decodePunchThroughAlphaBlock(uint8_t *dest,
-                                      size_t x,
-                                      size_t y,
-                                      size_t w,
-                                      size_t h,
-                                      size_t destRowPitch) const
+    // All the indices of an individual, differential, H or T mode block, with the index of the
+    // texel at (x, y) in bits 2 * (x * 4 + y).
+    uint32_t getIndices() const
     {
-        uint8_t *curPixel = dest;
-        for (size_t j = 0; j < 4 && (y + j) < h; j++)
+        uint32_t lsbs = u.idht.pixelIndexLSB[0] << 8 | u.idht.pixelIndexLSB[1];
+        uint32_t msbs = u.idht.pixelIndexMSB[0] << 8 | u.idht.pixelIndexMSB[1];
+        return interleaveWithZeros(lsbs) | interleaveWithZeros(msbs) << 1;
+    }
+
+    static uint32_t interleaveWithZeros(uint32_t bits)
+    {
+        bits = (bits | bits << 8) & 0x00FF00FF;
+        bits = (bits | bits << 4) & 0x0F0F0F0F;
+        bits = (bits | bits << 2) & 0x33333333;
+        bits = (bits | bits << 1) & 0x55555555;
+        return bits;
+    }
+
+    // Writes the texels of the block that are inside the image.  Each texel takes the color at its
+    // index, offset by 4 for the texels of the second subblock that are set in |subblockMask|.
+    // Opaque colors take their alpha from |alphaValues|, transparent ones stay transparent.
+    void writeColors(uint8_t *dest,
+                     size_t x,
+                     size_t y,
+                     size_t w,
+                     size_t h,
+                     size_t destRowPitch,
+                     const R8G8B8A8 *colors,
+                     uint32_t subblockMask,
+                     const uint8_t alphaValues[4][4]) const
+    {
+        const uint32_t indices = getIndices();
+        if (x + 4 <= w && y + 4 <= h)
         {
-            R8G8B8A8 *row = reinterpret_cast<R8G8B8A8 *>(curPixel);
-            for (size_t i = 0; i < 4 && (x + i) < w; i++)
+            // Whole blocks, the common case, with loops of known length.
+            for (size_t j = 0; j < 4; j++)
             {
-                if (getIndex(i, j) == 2)  //  msb == 1 && lsb == 0
-                {
-                    row[i] = createRGBA(0, 0, 0, 0);
-                }
+                writeColorRow(dest + (j * destRowPitch), j, 4, indices, colors, subblockMask,
+                              alphaValues[j]);
             }
-            curPixel += destRowPitch;
+            return;
+        }
+
+        const size_t blockWidth  = std::min<size_t>(4, w - x);
+        const size_t blockHeight = std::min<size_t>(4, h - y);
+        for (size_t j = 0; j < blockHeight; j++)
+        {
+            writeColorRow(dest + (j * destRowPitch), j, blockWidth, indices, colors, subblockMask,
+                          alphaValues[j]);
+        }
+    }
+
+    static void writeColorRow(uint8_t *dest,
+                              size_t j,
+                              size_t blockWidth,
+                              uint32_t indices,
+                              const R8G8B8A8 *colors,
+                              uint32_t subblockMask,
+                              const uint8_t alphaValues[4])
+    {
+        R8G8B8A8 *row = reinterpret_cast<R8G8B8A8 *>(dest);
+        for (size_t i = 0; i < blockWidth; i++)
+        {
+            const size_t bitIndex   = i * 4 + j;
+            const size_t colorIndex = ((indices >> (bitIndex * 2)) & 3) |
+                                      (((subblockMask >> bitIndex) & 1) << 2);
+            row[i] = colors[colorIndex];
+            row[i].A &= alphaValues[i];
         }
     }
 
@@ -1334,48 +1360,57 @@ struct ETC2Block
     }
 
     // Single channel utility functions
-    int getSingleEACChannel(size_t x, size_t y, bool isSigned) const
+    int getSingleEACChannel(size_t modifierIdx, bool isSigned) const
     {
         int codeword   = isSigned ? u.scblk.base_codeword.s : u.scblk.base_codeword.us;
         int multiplier = (u.scblk.multiplier == 0) ? 1 : u.scblk.multiplier * 8;
-        return codeword * 8 + 4 + getSingleChannelModifier(x, y) * multiplier;
+        return codeword * 8 + 4 + getSingleChannelModifier(modifierIdx) * multiplier;
     }
 
-    int getSingleETC2Channel(size_t x, size_t y, bool isSigned) const
+    int getSingleETC2Channel(size_t modifierIdx, bool isSigned) const
     {
         int codeword = isSigned ? u.scblk.base_codeword.s : u.scblk.base_codeword.us;
-        return codeword + getSingleChannelModifier(x, y) * u.scblk.multiplier;
+        return codeword + getSingleChannelModifier(modifierIdx) * u.scblk.multiplier;
     }
 
-    int getSingleChannelIndex(size_t x, size_t y) const
+    // The 3-bit modifier indices ma to mp of a single channel block, read as one big endian value.
+    // The index of the texel at (x, y) is in bits 45 - 3 * (x * 4 + y).
+    uint64_t getSingleChannelIndices() const
     {
-        ASSERT(x < 4 && y < 4);
+        const uint8_t *bytes = reinterpret_cast<const uint8_t *>(&u);
+        uint64_t indices     = 0;
+        for (size_t byteIdx = 2; byteIdx < 8; byteIdx++)
+        {
+            indices = (indices << 8) | bytes[byteIdx];
+        }
+        return indices;
+    }
 
-        // clang-format off
-        switch (x * 4 + y)
+    template <typename T>
+    void writeSingleChannel(T *dest,
+                            size_t x,
+                            size_t y,
+                            size_t w,
+                            size_t h,
+                            size_t destPixelStride,
+                            size_t destRowPitch,
+                            const T values[8]) const
+    {
+        const uint64_t indices   = getSingleChannelIndices();
+        const size_t blockWidth  = std::min<size_t>(4, w - x);
+        const size_t blockHeight = std::min<size_t>(4, h - y);
+        for (size_t j = 0; j < blockHeight; j++)
         {
-            case 0: return u.scblk.ma;
-            case 1: return u.scblk.mb;
-            case 2: return u.scblk.mc1 << 1 | u.scblk.mc2;
-            case 3: return u.scblk.md;
-            case 4: return u.scblk.me;
-            case 5: return u.scblk.mf1 << 2 | u.scblk.mf2;
-            case 6: return u.scblk.mg;
-            case 7: return u.scblk.mh;
-            case 8: return u.scblk.mi;
-            case 9: return u.scblk.mj;
-            case 10: return u.scblk.mk1 << 1 | u.scblk.mk2;
-            case 11: return u.scblk.ml;
-            case 12: return u.scblk.mm;
-            case 13: return u.scblk.mn1 << 2 | u.scblk.mn2;
-            case 14: return u.scblk.mo;
-            case 15: return u.scblk.mp;
-            default: UNREACHABLE(); return 0;
+            T *row = reinterpret_cast<T *>(reinterpret_cast<uint8_t *>(dest) + (j * destRowPitch));
+            for (size_t i = 0; i < blockWidth; i++)
+            {
+                const size_t shift       = 45 - 3 * (i * 4 + j);
+                row[i * destPixelStride] = values[(indices >> shift) & 7];
+            }
         }
-        // clang-format on
     }
 
-    int getSingleChannelModifier(size_t x, size_t y) const
+    int getSingleChannelModifier(size_t modifierIdx) const
     {
         // clang-format off
         static const int modifierTable[16][8] =
@@ -1399,7 +1434,7 @@ struct ETC2Block
         };
         // clang-format on
 
-        return modifierTable[u.scblk.table_index][getSingleChannelIndex(x, y)];
+        return modifierTable[u.scblk.table_index][modifierIdx];
     }
 };
 
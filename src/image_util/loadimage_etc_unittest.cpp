@@ -0,0 +1,181 @@
+//
+// Copyright 2019 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// loadimage_etc_unittest.cpp: Unit tests for the ETC and EAC decoders.  Random blocks hit every
+// block mode, and the decoded images are compared against checksums of the original per-texel
+// decoder so that any optimization of the decoders has to produce identical output.
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+#include "image_util/loadimage.h"
+
+using namespace angle;
+
+namespace
+{
+using LoadFunction = void (*)(size_t width,
+                              size_t height,
+                              size_t depth,
+                              const uint8_t *input,
+                              size_t inputRowPitch,
+                              size_t inputDepthPitch,
+                              uint8_t *output,
+                              size_t outputRowPitch,
+                              size_t outputDepthPitch);
+
+// Not a multiple of the block size, so that the partial blocks at the edges are decoded too.
+constexpr size_t kWidth  = 37;
+constexpr size_t kHeight = 22;
+constexpr size_t kDepth  = 2;
+
+// The BC1 transcoders always encode whole blocks.
+constexpr size_t kBC1Width  = 36;
+constexpr size_t kBC1Height = 20;
+
+uint64_t HashBytes(const std::vector<uint8_t> &bytes)
+{
+    // 64-bit FNV-1a
+    uint64_t hash = 0xCBF29CE484222325ull;
+    for (uint8_t byte : bytes)
+    {
+        hash ^= byte;
+        hash *= 0x100000001B3ull;
+    }
+    return hash;
+}
+
+// Decodes an image of random blocks and returns the checksum of the output, including the row and
+// image padding that the decoder must leave untouched.
+uint64_t DecodeRandomImage(LoadFunction load,
+                           size_t width,
+                           size_t height,
+                           size_t blockSize,
+                           size_t outputRowPitch,
+                           size_t outputRows)
+{
+    std::mt19937 generator(0xE7C2);
+    std::uniform_int_distribution<int> byteValue(0, 255);
+
+    size_t inputRowPitch   = ((width + 3) / 4) * blockSize;
+    size_t inputDepthPitch = inputRowPitch * ((height + 3) / 4);
+    std::vector<uint8_t> input(inputDepthPitch * kDepth);
+    for (uint8_t &value : input)
+    {
+        value = static_cast<uint8_t>(byteValue(generator));
+    }
+
+    size_t outputDepthPitch = outputRowPitch * outputRows + 8;
+    std::vector<uint8_t> output(outputDepthPitch * kDepth, 0xCD);
+    load(width, height, kDepth, input.data(), inputRowPitch, inputDepthPitch, output.data(),
+         outputRowPitch, outputDepthPitch);
+
+    return HashBytes(output);
+}
+
+uint64_t DecodeToPixels(LoadFunction load, size_t blockSize, size_t outputPixelSize)
+{
+    return DecodeRandomImage(load, kWidth, kHeight, blockSize, kWidth * outputPixelSize + 4,
+                             kHeight);
+}
+
+uint64_t DecodeToBC1(LoadFunction load)
+{
+    return DecodeRandomImage(load, kBC1Width, kBC1Height, 8, (kBC1Width / 4) * 8 + 4,
+                             kBC1Height / 4);
+}
+
+TEST(LoadImageETCTest, ETC1RGB8ToRGBA8)
+{
+    EXPECT_EQ(4175114101564339691ull, DecodeToPixels(LoadETC1RGB8ToRGBA8, 8, 4));
+}
+
+TEST(LoadImageETCTest, ETC2RGB8ToRGBA8)
+{
+    EXPECT_EQ(4175114101564339691ull, DecodeToPixels(LoadETC2RGB8ToRGBA8, 8, 4));
+}
+
+TEST(LoadImageETCTest, ETC2RGB8A1ToRGBA8)
+{
+    EXPECT_EQ(10191634327918375133ull, DecodeToPixels(LoadETC2RGB8A1ToRGBA8, 8, 4));
+}
+
+TEST(LoadImageETCTest, ETC2RGBA8ToRGBA8)
+{
+    EXPECT_EQ(9166103903352667819ull, DecodeToPixels(LoadETC2RGBA8ToRGBA8, 16, 4));
+}
+
+TEST(LoadImageETCTest, EACR11ToR8)
+{
+    EXPECT_EQ(14669368943041659520ull, DecodeToPixels(LoadEACR11ToR8, 8, 1));
+}
+
+TEST(LoadImageETCTest, EACR11SToR8)
+{
+    EXPECT_EQ(6119812097742685310ull, DecodeToPixels(LoadEACR11SToR8, 8, 1));
+}
+
+TEST(LoadImageETCTest, EACRG11ToRG8)
+{
+    EXPECT_EQ(13516099333975382025ull, DecodeToPixels(LoadEACRG11ToRG8, 16, 2));
+}
+
+TEST(LoadImageETCTest, EACRG11SToRG8)
+{
+    EXPECT_EQ(2187948852920664312ull, DecodeToPixels(LoadEACRG11SToRG8, 16, 2));
+}
+
+TEST(LoadImageETCTest, EACR11ToR16)
+{
+    EXPECT_EQ(2262430664803655686ull, DecodeToPixels(LoadEACR11ToR16, 8, 2));
+}
+
+TEST(LoadImageETCTest, EACR11SToR16)
+{
+    EXPECT_EQ(10578835776798164113ull, DecodeToPixels(LoadEACR11SToR16, 8, 2));
+}
+
+TEST(LoadImageETCTest, EACRG11ToRG16)
+{
+    EXPECT_EQ(3690506110538630545ull, DecodeToPixels(LoadEACRG11ToRG16, 16, 4));
+}
+
+TEST(LoadImageETCTest, EACRG11SToRG16)
+{
+    EXPECT_EQ(16628715572793116607ull, DecodeToPixels(LoadEACRG11SToRG16, 16, 4));
+}
+
+TEST(LoadImageETCTest, EACR11ToR16F)
+{
+    EXPECT_EQ(4925311841748137628ull, DecodeToPixels(LoadEACR11ToR16F, 8, 2));
+}
+
+TEST(LoadImageETCTest, EACR11SToR16F)
+{
+    EXPECT_EQ(8028859262710547501ull, DecodeToPixels(LoadEACR11SToR16F, 8, 2));
+}
+
+TEST(LoadImageETCTest, EACRG11ToRG16F)
+{
+    EXPECT_EQ(6733875980172760090ull, DecodeToPixels(LoadEACRG11ToRG16F, 16, 4));
+}
+
+TEST(LoadImageETCTest, EACRG11SToRG16F)
+{
+    EXPECT_EQ(11878548348533337722ull, DecodeToPixels(LoadEACRG11SToRG16F, 16, 4));
+}
+
+TEST(LoadImageETCTest, ETC2RGB8ToBC1)
+{
+    EXPECT_EQ(11418344835559573892ull, DecodeToBC1(LoadETC2RGB8ToBC1));
+}
+
+TEST(LoadImageETCTest, ETC2RGB8A1ToBC1)
+{
+    EXPECT_EQ(8909847115187229579ull, DecodeToBC1(LoadETC2RGB8A1ToBC1));
+}
+}  // anonymous namespace
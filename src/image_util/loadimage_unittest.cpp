@@ -0,0 +1,250 @@
+//
+// Copyright 2019 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// loadimage_unittest.cpp: Unit tests for the image loading functions.  The vectorized paths are
+// checked against plain per-pixel conversions.
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+#include "common/mathutil.h"
+#include "image_util/loadimage.h"
+
+using namespace angle;
+
+namespace
+{
+using LoadFunction = void (*)(size_t width,
+                              size_t height,
+                              size_t depth,
+                              const uint8_t *input,
+                              size_t inputRowPitch,
+                              size_t inputDepthPitch,
+                              uint8_t *output,
+                              size_t outputRowPitch,
+                              size_t outputDepthPitch);
+using PixelFunction = void (*)(const uint8_t *source, uint8_t *dest);
+
+// Widths around the vector sizes, so that both the vector loops and the remainders are used.
+constexpr size_t kWidths[] = {1, 3, 4, 5, 6, 7, 8, 9, 15, 16, 17, 31, 32, 33, 63, 64, 67, 100};
+constexpr size_t kHeight   = 3;
+constexpr size_t kDepth    = 2;
+
+// Loads a random image with padded rows through |load| and checks each pixel against |reference|.
+void CheckLoad(LoadFunction load,
+               PixelFunction reference,
+               size_t inputPixelSize,
+               size_t outputPixelSize)
+{
+    std::mt19937 generator(0x10AD);
+    std::uniform_int_distribution<int> byteValue(0, 255);
+
+    for (size_t width : kWidths)
+    {
+        // Pad the rows by an odd amount so that rows start at unaligned addresses.
+        size_t inputRowPitch    = width * inputPixelSize + 3;
+        size_t inputDepthPitch  = inputRowPitch * kHeight + 5;
+        size_t outputRowPitch   = width * outputPixelSize + 4;
+        size_t outputDepthPitch = outputRowPitch * kHeight + 4;
+
+        std::vector<uint8_t> input(inputDepthPitch * kDepth);
+        for (uint8_t &value : input)
+        {
+            value = static_cast<uint8_t>(byteValue(generator));
+        }
+
+        std::vector<uint8_t> output(outputDepthPitch * kDepth + 1, 0xCD);
+        load(width, kHeight, kDepth, input.data(), inputRowPitch, inputDepthPitch,
+             output.data() + 1, outputRowPitch, outputDepthPitch);
+
+        for (size_t z = 0; z < kDepth; ++z)
+        {
+            for (size_t y = 0; y < kHeight; ++y)
+            {
+                for (size_t x = 0; x < width; ++x)
+                {
+                    const uint8_t *source =
+                        &input[z * inputDepthPitch + y * inputRowPitch + x * inputPixelSize];
+                    const uint8_t *actual = &output[1 + z * outputDepthPitch + y * outputRowPitch +
+                                                    x * outputPixelSize];
+
+                    uint8_t expected[16];
+                    reference(source, expected);
+                    for (size_t byte = 0; byte < outputPixelSize; ++byte)
+                    {
+                        ASSERT_EQ(expected[byte], actual[byte])
+                            << "width " << width << ", pixel (" << x << ", " << y << ", " << z
+                            << "), byte " << byte;
+                    }
+                }
+
+                // Nothing is written past the end of the row.
+                const uint8_t *padding = &output[1 + z * outputDepthPitch + y * outputRowPitch +
+                                                 width * outputPixelSize];
+                ASSERT_EQ(0xCD, padding[0]) << "width " << width;
+            }
+        }
+    }
+}
+
+void A8ToRGBA8(const uint8_t *source, uint8_t *dest)
+{
+    uint32_t pixel = static_cast<uint32_t>(source[0]) << 24;
+    memcpy(dest, &pixel, sizeof(pixel));
+}
+
+void L8ToRGBA8(const uint8_t *source, uint8_t *dest)
+{
+    dest[0] = source[0];
+    dest[1] = source[0];
+    dest[2] = source[0];
+    dest[3] = 0xFF;
+}
+
+void LA8ToRGBA8(const uint8_t *source, uint8_t *dest)
+{
+    dest[0] = source[0];
+    dest[1] = source[0];
+    dest[2] = source[0];
+    dest[3] = source[1];
+}
+
+void RGB8ToRGBA8(const uint8_t *source, uint8_t *dest)
+{
+    dest[0] = source[0];
+    dest[1] = source[1];
+    dest[2] = source[2];
+    dest[3] = 0xFF;
+}
+
+void RGB8ToBGRX8(const uint8_t *source, uint8_t *dest)
+{
+    dest[0] = source[2];
+    dest[1] = source[1];
+    dest[2] = source[0];
+    dest[3] = 0xFF;
+}
+
+void RGBA8ToBGRA8(const uint8_t *source, uint8_t *dest)
+{
+    dest[0] = source[2];
+    dest[1] = source[1];
+    dest[2] = source[0];
+    dest[3] = source[3];
+}
+
+void RGBA32FToRGBA16F(const uint8_t *source, uint8_t *dest)
+{
+    for (size_t component = 0; component < 4; ++component)
+    {
+        float value;
+        memcpy(&value, source + component * sizeof(float), sizeof(float));
+        uint16_t half = gl::float32ToFloat16(value);
+        memcpy(dest + component * sizeof(uint16_t), &half, sizeof(uint16_t));
+    }
+}
+
+void RGB32FToRGB16F(const uint8_t *source, uint8_t *dest)
+{
+    for (size_t component = 0; component < 3; ++component)
+    {
+        float value;
+        memcpy(&value, source + component * sizeof(float), sizeof(float));
+        uint16_t half = gl::float32ToFloat16(value);
+        memcpy(dest + component * sizeof(uint16_t), &half, sizeof(uint16_t));
+    }
+}
+
+TEST(LoadImageTest, A8ToRGBA8)
+{
+    CheckLoad(LoadA8ToRGBA8, A8ToRGBA8, 1, 4);
+}
+
+TEST(LoadImageTest, L8ToRGBA8)
+{
+    CheckLoad(LoadL8ToRGBA8, L8ToRGBA8, 1, 4);
+}
+
+TEST(LoadImageTest, LA8ToRGBA8)
+{
+    CheckLoad(LoadLA8ToRGBA8, LA8ToRGBA8, 2, 4);
+}
+
+TEST(LoadImageTest, RGB8ToRGBA8)
+{
+    CheckLoad(LoadToNative3To4<uint8_t, 0xFF>, RGB8ToRGBA8, 3, 4);
+}
+
+TEST(LoadImageTest, RGB8ToBGRX8)
+{
+    CheckLoad(LoadRGB8ToBGRX8, RGB8ToBGRX8, 3, 4);
+}
+
+TEST(LoadImageTest, RGBA8ToBGRA8)
+{
+    CheckLoad(LoadRGBA8ToBGRA8, RGBA8ToBGRA8, 4, 4);
+}
+
+// Random bytes make every kind of float, including NaNs, infinities and denormals.
+TEST(LoadImageTest, RGBA32FToRGBA16F)
+{
+    CheckLoad(Load32FTo16F<4>, RGBA32FToRGBA16F, 16, 8);
+}
+
+TEST(LoadImageTest, RGB32FToRGB16F)
+{
+    CheckLoad(LoadRGB32FToRGB16F, RGB32FToRGB16F, 12, 6);
+}
+
+// Checks the float to half float conversion at the edges of each of its cases.
+TEST(LoadImageTest, Float32ToFloat16Boundaries)
+{
+    constexpr uint32_t kBoundaries[] = {
+        0x00000000,  // zero
+        0x2CFFFFFF,  // largest value that rounds to zero
+        0x2D000000,  // smallest value that may round to a denormal
+        0x33000000,  // half of the smallest denormal
+        0x33000001,  // just above half of the smallest denormal
+        0x387FC000,  // halfway between the largest denormal and the smallest normal
+        0x387FFFFF,  // largest float that produces a denormal
+        0x38800000,  // smallest normal
+        0x38801000,  // round to even down
+        0x38803000,  // round to even up
+        0x477FEFFF,  // largest value that rounds to the largest half
+        0x477FF000,  // rounds to infinity
+        0x47FFEFFF,  // largest value not clamped to infinity
+        0x47FFF000,  // clamped to infinity
+        0x7F800000,  // infinity
+        0x7F800001,  // NaN
+        0x7FC00000,  // quiet NaN
+        0x7FFFFFFF,  // NaN with all bits set
+    };
+
+    std::vector<float> input;
+    for (uint32_t bits : kBoundaries)
+    {
+        for (uint32_t delta : {0u, 1u})
+        {
+            for (uint32_t sign : {0u, 0x80000000u})
+            {
+                input.push_back(gl::bitCast<float>(((bits + delta) & 0x7FFFFFFF) | sign));
+            }
+        }
+    }
+
+    // Load as a single row of single component pixels.
+    std::vector<uint16_t> output(input.size());
+    Load32FTo16F<1>(input.size(), 1, 1, reinterpret_cast<const uint8_t *>(input.data()), 0, 0,
+                    reinterpret_cast<uint8_t *>(output.data()), 0, 0);
+
+    for (size_t index = 0; index < input.size(); ++index)
+    {
+        EXPECT_EQ(gl::float32ToFloat16(input[index]), output[index])
+            << "input 0x" << std::hex << gl::bitCast<uint32_t>(input[index]);
+    }
+}
+}  // anonymous namespace
@@ -9,6 +9,7 @@
 
 #include "libANGLE/BlobCache.h"
 #include "common/utilities.h"
+#include "libANGLE/BlobCacheDiskStore.h"
 #include "common/version.h"
 #include "libANGLE/Context.h"
 #include "libANGLE/Display.h"
@@ -31,7 +32,14 @@ enum CacheResult
 }  // anonymous namespace
 
 BlobCache::BlobCache(size_t maxCacheSizeBytes)
-    : mBlobCache(maxCacheSizeBytes), mSetBlobFunc(nullptr), mGetBlobFunc(nullptr)
+    : BlobCache(maxCacheSizeBytes, "GPU.ANGLE.ProgramCache.CacheResult")
+{}
+
+BlobCache::BlobCache(size_t maxCacheSizeBytes, const char *cacheResultHistogram)
+    : mBlobCache(maxCacheSizeBytes),
+      mSetBlobFunc(nullptr),
+      mGetBlobFunc(nullptr),
+      mCacheResultHistogram(cacheResultHistogram)
 {}
 
 BlobCache::~BlobCache() {}
@@ -45,7 +53,12 @@ void BlobCache::put(const BlobCache::Key &key, angle::MemoryBuffer &&value)
     }
     else
     {
-        populate(key, std::move(value), CacheSource::Memory);
+        std::lock_guard<std::mutex> lock(mMutex);
+        if (mDiskStore)
+        {
+            mDiskStore->put(key, value.data(), value.size());
+        }
+        populateLocked(key, std::move(value), CacheSource::Memory);
     }
 }
 
@@ -55,16 +68,34 @@ void BlobCache::putApplication(const BlobCache::Key &key, const angle::MemoryBuf
     {
         mSetBlobFunc(key.data(), key.size(), value.data(), value.size());
     }
+    else
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        if (mDiskStore)
+        {
+            mDiskStore->put(key, value.data(), value.size());
+        }
+    }
 }
 
 void BlobCache::populate(const BlobCache::Key &key, angle::MemoryBuffer &&value, CacheSource source)
 {
+    std::lock_guard<std::mutex> lock(mMutex);
+    populateLocked(key, std::move(value), source);
+}
+
+void BlobCache::populateLocked(const BlobCache::Key &key,
+                               angle::MemoryBuffer &&value,
+                               CacheSource source)
+{
+    size_t size = value.size();
+
     CacheEntry newEntry;
-    newEntry.first  = std::move(value);
+    newEntry.first  = std::make_shared<angle::MemoryBuffer>(std::move(value));
     newEntry.second = source;
 
     // Cache it inside blob cache only if caching inside the application is not possible.
-    mBlobCache.put(key, std::move(newEntry), newEntry.first.size());
+    mBlobCache.put(key, std::move(newEntry), size);
 }
 
 bool BlobCache::get(angle::ScratchBuffer *scratchBuffer,
@@ -107,6 +138,7 @@ bool BlobCache::get(angle::ScratchBuffer *scratchBuffer,
     }
 
     // Otherwise we are doing caching internally, so try to find it there
+    std::lock_guard<std::mutex> lock(mMutex);
     const CacheEntry *entry;
     bool result = mBlobCache.get(key, &entry);
 
@@ -114,21 +146,23 @@ bool BlobCache::get(angle::ScratchBuffer *scratchBuffer,
     {
         if (entry->second == CacheSource::Memory)
         {
-            ANGLE_HISTOGRAM_ENUMERATION("GPU.ANGLE.ProgramCache.CacheResult", kCacheHitMemory,
-                                        kCacheResultMax);
+            ANGLE_HISTOGRAM_ENUMERATION(mCacheResultHistogram, kCacheHitMemory, kCacheResultMax);
         }
         else
         {
-            ANGLE_HISTOGRAM_ENUMERATION("GPU.ANGLE.ProgramCache.CacheResult", kCacheHitDisk,
-                                        kCacheResultMax);
+            ANGLE_HISTOGRAM_ENUMERATION(mCacheResultHistogram, kCacheHitDisk, kCacheResultMax);
         }
 
-        *valueOut = BlobCache::Value(entry->first.data(), entry->first.size());
+        *valueOut = BlobCache::Value(entry->first->data(), entry->first->size(), entry->first);
+    }
+    else if (mDiskStore && mDiskStore->get(key, valueOut))
+    {
+        ANGLE_HISTOGRAM_ENUMERATION(mCacheResultHistogram, kCacheHitDisk, kCacheResultMax);
+        result = true;
     }
     else
     {
-        ANGLE_HISTOGRAM_ENUMERATION("GPU.ANGLE.ProgramCache.CacheResult", kCacheMiss,
-                                    kCacheResultMax);
+        ANGLE_HISTOGRAM_ENUMERATION(mCacheResultHistogram, kCacheMiss, kCacheResultMax);
     }
 
     return result;
@@ -136,19 +170,73 @@ bool BlobCache::get(angle::ScratchBuffer *scratchBuffer,
 
 bool BlobCache::getAt(size_t index, const BlobCache::Key **keyOut, BlobCache::Value *valueOut)
 {
+    std::lock_guard<std::mutex> lock(mMutex);
     const CacheEntry *valueBuf;
     bool result = mBlobCache.getAt(index, keyOut, &valueBuf);
     if (result)
     {
-        *valueOut = BlobCache::Value(valueBuf->first.data(), valueBuf->first.size());
+        *valueOut =
+            BlobCache::Value(valueBuf->first->data(), valueBuf->first->size(), valueBuf->first);
     }
     return result;
 }
 
 void BlobCache::remove(const BlobCache::Key &key)
 {
+    std::lock_guard<std::mutex> lock(mMutex);
     bool result = mBlobCache.eraseByKey(key);
-    ASSERT(result);
+
+    if (mDiskStore)
+    {
+        // The blob may have been too large to be kept in memory.
+        mDiskStore->remove(key);
+    }
+    else
+    {
+        ASSERT(result);
+    }
+}
+
+void BlobCache::clear()
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    mBlobCache.clear();
+}
+
+void BlobCache::resize(size_t maxCacheSizeBytes)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    mBlobCache.resize(maxCacheSizeBytes);
+}
+
+size_t BlobCache::entryCount() const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mBlobCache.entryCount();
+}
+
+size_t BlobCache::trim(size_t limit)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mBlobCache.shrinkToSize(limit);
+}
+
+size_t BlobCache::size() const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mBlobCache.size();
+}
+
+bool BlobCache::empty() const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mBlobCache.empty();
+}
+
+size_t BlobCache::maxSize() const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mBlobCache.maxSize();
 }
 
 void BlobCache::setBlobCacheFuncs(EGLSetBlobFuncANDROID set, EGLGetBlobFuncANDROID get)
@@ -157,6 +245,21 @@ void BlobCache::setBlobCacheFuncs(EGLSetBlobFuncANDROID set, EGLGetBlobFuncANDRO
     mGetBlobFunc = get;
 }
 
+void BlobCache::setDiskStore(std::unique_ptr<BlobCacheDiskStore> &&diskStore)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    mDiskStore = std::move(diskStore);
+}
+
+void BlobCache::flushDiskStore()
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    if (mDiskStore)
+    {
+        mDiskStore->flush();
+    }
+}
+
 bool BlobCache::areBlobCacheFuncsSet() const
 {
     // Either none or both of the callbacks should be set.
@@ -12,6 +12,8 @@
 
 #include <array>
 #include <cstring>
+#include <memory>
+#include <mutex>
 
 #include <anglebase/sha1.h>
 #include "common/MemoryBuffer.h"
@@ -47,6 +49,7 @@ struct hash<egl::BlobCacheKey>
 
 namespace egl
 {
+class BlobCacheDiskStore;
 
 class BlobCache final : angle::NonCopyable
 {
@@ -60,12 +63,18 @@ class BlobCache final : angle::NonCopyable
       public:
         Value() : mPtr(nullptr), mSize(0) {}
         Value(const uint8_t *ptr, size_t sz) : mPtr(ptr), mSize(sz) {}
+        Value(const uint8_t *ptr, size_t sz, std::shared_ptr<const void> keepAlive)
+            : mPtr(ptr), mSize(sz), mKeepAlive(std::move(keepAlive))
+        {}
 
         // A very basic struct to hold the pointer and size together.  The objects of this class
-        // don't own the memory.
+        // don't own the memory, but may pin it: as long as a Value holding a keep-alive reference
+        // exists, the memory it points to stays valid even if the blob is evicted from the cache.
         const uint8_t *data() { return mPtr; }
         size_t size() { return mSize; }
 
+        const std::shared_ptr<const void> &getKeepAlive() const { return mKeepAlive; }
+
         const uint8_t &operator[](size_t pos) const
         {
             ASSERT(pos < mSize);
@@ -75,6 +84,7 @@ class BlobCache final : angle::NonCopyable
       private:
         const uint8_t *mPtr;
         size_t mSize;
+        std::shared_ptr<const void> mKeepAlive;
     };
     enum class CacheSource
     {
@@ -83,13 +93,17 @@ class BlobCache final : angle::NonCopyable
     };
 
     explicit BlobCache(size_t maxCacheSizeBytes);
+    // Lookups are recorded in the named enumeration histogram instead of the program cache's.
+    BlobCache(size_t maxCacheSizeBytes, const char *cacheResultHistogram);
     ~BlobCache();
 
     // Store a key-blob pair in the cache.  If application callbacks are set, the application cache
-    // will be used.  Otherwise the value is cached in this object.
+    // will be used.  Otherwise the value is cached in this object, and in the disk store if one is
+    // set.
     void put(const BlobCache::Key &key, angle::MemoryBuffer &&value);
 
     // Store a key-blob pair in the application cache, only if application callbacks are set.
+    // Otherwise the value is stored in the disk store, if one is set.
     void putApplication(const BlobCache::Key &key, const angle::MemoryBuffer &value);
 
     // Store a key-blob pair in the cache without making callbacks to the application.  This is used
@@ -99,7 +113,9 @@ class BlobCache final : angle::NonCopyable
                   CacheSource source = CacheSource::Disk);
 
     // Check if the cache contains the blob corresponding to this key.  If application callbacks are
-    // set, those will be used.  Otherwise they key is looked up in this object's cache.
+    // set, those will be used and the blob is copied into the scratch buffer.  Otherwise they key is
+    // looked up in this object's cache, and then in the disk store if one is set.  Blobs found this
+    // way are not copied, and are pinned by the returned value.
     ANGLE_NO_DISCARD bool get(angle::ScratchBuffer *scratchBuffer,
                               const BlobCache::Key &key,
                               BlobCache::Value *valueOut);
@@ -109,43 +125,64 @@ class BlobCache final : angle::NonCopyable
                                 const BlobCache::Key **keyOut,
                                 BlobCache::Value *valueOut);
 
-    // Evict a blob from the binary cache.
+    // Evict a blob from the binary cache and the disk store.
     void remove(const BlobCache::Key &key);
 
-    // Empty the cache.
-    void clear() { mBlobCache.clear(); }
+    // Empty the in-memory cache.  The disk store is not affected.
+    void clear();
 
     // Resize the cache. Discards current contents.
-    void resize(size_t maxCacheSizeBytes) { mBlobCache.resize(maxCacheSizeBytes); }
+    void resize(size_t maxCacheSizeBytes);
 
     // Returns the number of entries in the cache.
-    size_t entryCount() const { return mBlobCache.entryCount(); }
+    size_t entryCount() const;
 
     // Reduces the current cache size and returns the number of bytes freed.
-    size_t trim(size_t limit) { return mBlobCache.shrinkToSize(limit); }
+    size_t trim(size_t limit);
 
     // Returns the current cache size in bytes.
-    size_t size() const { return mBlobCache.size(); }
+    size_t size() const;
 
     // Returns whether the cache is empty
-    bool empty() const { return mBlobCache.empty(); }
+    bool empty() const;
 
     // Returns the maximum cache size in bytes.
-    size_t maxSize() const { return mBlobCache.maxSize(); }
+    size_t maxSize() const;
 
     void setBlobCacheFuncs(EGLSetBlobFuncANDROID set, EGLGetBlobFuncANDROID get);
 
     bool areBlobCacheFuncsSet() const;
 
-    bool isCachingEnabled() const { return areBlobCacheFuncsSet() || maxSize() > 0; }
+    // Set a persistent store that backs the in-memory cache when no application callbacks are set.
+    void setDiskStore(std::unique_ptr<BlobCacheDiskStore> &&diskStore);
+    BlobCacheDiskStore *getDiskStore() const { return mDiskStore.get(); }
+
+    // Write out any pending disk store metadata.
+    void flushDiskStore();
+
+    bool isCachingEnabled() const
+    {
+        return areBlobCacheFuncsSet() || maxSize() > 0 || mDiskStore != nullptr;
+    }
 
   private:
+    void populateLocked(const BlobCache::Key &key, angle::MemoryBuffer &&value, CacheSource source);
+
+    // Contexts in different share groups use the cache concurrently, so the in-memory cache and
+    // the disk store are accessed under this lock.
+    mutable std::mutex mMutex;
+
     // This internal cache is used only if the application is not providing caching callbacks
-    using CacheEntry = std::pair<angle::MemoryBuffer, CacheSource>;
+    // The blobs are shared with the values returned by get(), which pin them.
+    using CacheEntry = std::pair<std::shared_ptr<angle::MemoryBuffer>, CacheSource>;
     angle::SizedMRUCache<BlobCache::Key, CacheEntry> mBlobCache;
 
     EGLSetBlobFuncANDROID mSetBlobFunc;
     EGLGetBlobFuncANDROID mGetBlobFunc;
+
+    std::unique_ptr<BlobCacheDiskStore> mDiskStore;
+
+    const char *mCacheResultHistogram;
 };
 
 }  // namespace egl
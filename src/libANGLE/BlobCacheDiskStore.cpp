@@ -0,0 +1,796 @@
+//
+// Copyright 2019 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// BlobCacheDiskStore: Persistent on-disk backend for BlobCache.
+
+#include "libANGLE/BlobCacheDiskStore.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <limits>
+#include <vector>
+
+#include "common/debug.h"
+#include "common/platform.h"
+#include "common/system_utils.h"
+#include "common/third_party/xxhash/xxhash.h"
+
+namespace egl
+{
+
+namespace
+{
+constexpr uint32_t kDataFileMagic       = 0x42444E41;  // "ANDB"
+constexpr uint32_t kIndexFileMagic      = 0x49444E41;  // "ANDI"
+constexpr uint32_t kRecordMagic         = 0x52444E41;  // "ANDR"
+constexpr uint32_t kFormatVersion       = 1;
+constexpr uint32_t kRecordFlagTombstone = 1;
+constexpr uint32_t kChecksumSeed        = 0x9E3779B9;
+
+// Don't bother compacting data files that are smaller than this.
+constexpr uint64_t kMinCompactionSize = 1024 * 1024;
+
+struct DataFileHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    uint64_t generation;
+};
+static_assert(sizeof(DataFileHeader) == 16, "Unexpected DataFileHeader padding");
+
+struct RecordHeader
+{
+    uint32_t magic;
+    uint32_t flags;
+    uint32_t size;
+    uint32_t checksum;
+    BlobCacheKey key;
+};
+static_assert(sizeof(RecordHeader) == 16 + kBlobCacheKeyLength, "Unexpected RecordHeader padding");
+
+struct IndexFileHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    uint64_t generation;
+    uint64_t coveredDataFileSize;
+    uint32_t entryCount;
+    uint32_t checksum;
+};
+static_assert(sizeof(IndexFileHeader) == 32, "Unexpected IndexFileHeader padding");
+
+struct IndexEntry
+{
+    BlobCacheKey key;
+    uint32_t size;
+    uint64_t offset;
+};
+static_assert(sizeof(IndexEntry) == 32, "Unexpected IndexEntry padding");
+
+size_t GetRecordSize(uint32_t blobSize)
+{
+    return sizeof(RecordHeader) + blobSize;
+}
+
+uint32_t ComputeChecksum(const void *data, size_t size)
+{
+    return XXH32(data, size, kChecksumSeed);
+}
+
+uint32_t ComputeChecksum(const angle::MemoryBuffer &blob)
+{
+    return ComputeChecksum(blob.data(), blob.size());
+}
+
+bool Seek(FILE *file, uint64_t offset)
+{
+#if defined(ANGLE_PLATFORM_WINDOWS)
+    return _fseeki64(file, static_cast<__int64>(offset), SEEK_SET) == 0;
+#else
+    return fseeko(file, static_cast<off_t>(offset), SEEK_SET) == 0;
+#endif
+}
+
+bool ReadAt(FILE *file, uint64_t offset, void *data, size_t size)
+{
+    return Seek(file, offset) && fread(data, 1, size, file) == size;
+}
+
+bool WriteAt(FILE *file, uint64_t offset, const void *data, size_t size)
+{
+    return Seek(file, offset) && fwrite(data, 1, size, file) == size;
+}
+
+bool IsValidRecord(const RecordHeader &header, const BlobCacheKey &key, uint32_t size)
+{
+    return header.magic == kRecordMagic && header.key == key && header.size == size &&
+           (header.flags & kRecordFlagTombstone) == 0;
+}
+
+// Reads a blob from the current position of the file.
+bool ReadBlob(FILE *file, uint32_t size, angle::MemoryBuffer *blobOut)
+{
+    if (!blobOut->resize(size))
+    {
+        return false;
+    }
+    return size == 0 || fread(blobOut->data(), 1, size, file) == size;
+}
+
+uint64_t GetFileSize(FILE *file)
+{
+#if defined(ANGLE_PLATFORM_WINDOWS)
+    if (_fseeki64(file, 0, SEEK_END) != 0)
+    {
+        return 0;
+    }
+    return static_cast<uint64_t>(_ftelli64(file));
+#else
+    if (fseeko(file, 0, SEEK_END) != 0)
+    {
+        return 0;
+    }
+    return static_cast<uint64_t>(ftello(file));
+#endif
+}
+
+bool ReplaceFile(const std::string &from, const std::string &to)
+{
+#if defined(ANGLE_PLATFORM_WINDOWS)
+    // rename() doesn't overwrite existing files on Windows.
+    std::remove(to.c_str());
+#endif
+    return std::rename(from.c_str(), to.c_str()) == 0;
+}
+
+class ScopedFileLock final : angle::NonCopyable
+{
+  public:
+    explicit ScopedFileLock(angle::FileLock *lock) : mLock(lock), mLocked(lock->lock()) {}
+    ~ScopedFileLock()
+    {
+        if (mLocked)
+        {
+            mLock->unlock();
+        }
+    }
+
+    bool locked() const { return mLocked; }
+
+  private:
+    angle::FileLock *mLock;
+    bool mLocked;
+};
+}  // anonymous namespace
+
+BlobCacheDiskStore::BlobCacheDiskStore(const std::string &basePath, size_t maxSizeBytes)
+    : mDataFilePath(basePath + ".data"),
+      mIndexFilePath(basePath + ".index"),
+      mLockFilePath(basePath + ".lock"),
+      mMaxSize(maxSizeBytes),
+      mDataFile(nullptr),
+      mGeneration(0),
+      mDataFileSize(0),
+      mLiveSize(0),
+      mIndexDirty(false),
+      mEntries(EntryMap::NO_AUTO_EVICT)
+{}
+
+BlobCacheDiskStore::~BlobCacheDiskStore()
+{
+    flush();
+    close();
+}
+
+bool BlobCacheDiskStore::initialize()
+{
+    ASSERT(mDataFile == nullptr);
+
+    // Other processes may be using the same files.  Without the lock, changes made here could
+    // clobber theirs, so don't use the store at all.
+    mLock.reset(angle::OpenFileLock(mLockFilePath.c_str()));
+    if (!mLock)
+    {
+        WARN() << "Failed to open blob cache lock file " << mLockFilePath;
+        return false;
+    }
+
+    ScopedFileLock lock(mLock.get());
+    if (!lock.locked())
+    {
+        WARN() << "Failed to lock blob cache file " << mLockFilePath;
+        mLock.reset();
+        return false;
+    }
+
+    return load();
+}
+
+bool BlobCacheDiskStore::load()
+{
+    ASSERT(mDataFile == nullptr);
+
+    mEntries.Clear();
+    mLiveSize = 0;
+
+    if (!openDataFile() && !createDataFile())
+    {
+        WARN() << "Failed to open blob cache file " << mDataFilePath;
+        return false;
+    }
+
+    // Load the index snapshot, and replay whatever was appended to the data file after it was
+    // taken.
+    uint64_t fileSize    = GetFileSize(mDataFile);
+    uint64_t coveredSize = 0;
+    if (!loadIndex(fileSize, &coveredSize))
+    {
+        mEntries.Clear();
+        mLiveSize   = 0;
+        coveredSize = sizeof(DataFileHeader);
+    }
+
+    scanDataFile(coveredSize, fileSize);
+
+    // Drop any trailing garbage, such as a record partially written before a crash.
+    if (mDataFileSize != fileSize && !compact())
+    {
+        WARN() << "Failed to compact blob cache file " << mDataFilePath;
+    }
+
+    evictToSize(mMaxSize);
+    compactIfNeeded();
+    return mDataFile != nullptr;
+}
+
+bool BlobCacheDiskStore::syncWithDataFile()
+{
+    if (mDataFile == nullptr)
+    {
+        return false;
+    }
+
+    // If another process compacted or recreated the data file, this process's handle still refers
+    // to the old file.  Start over from the new one.
+    DataFileHeader header = {};
+    FILE *currentFile     = fopen(mDataFilePath.c_str(), "rb");
+    if (currentFile != nullptr)
+    {
+        if (!ReadAt(currentFile, 0, &header, sizeof(header)))
+        {
+            header.magic = 0;
+        }
+        fclose(currentFile);
+    }
+
+    bool replaced = header.magic != kDataFileMagic || header.generation != mGeneration;
+
+    if (replaced)
+    {
+        close();
+        return load();
+    }
+
+    // Replay the records other processes appended since this process last looked.
+    uint64_t fileSize = GetFileSize(mDataFile);
+    if (fileSize == mDataFileSize)
+    {
+        return true;
+    }
+
+    // Drop anything a process left behind when it died while appending.  If compaction fails,
+    // new records simply overwrite it.
+    scanDataFile(mDataFileSize, fileSize);
+    if (mDataFileSize != fileSize && !compact())
+    {
+        WARN() << "Failed to compact blob cache file " << mDataFilePath;
+    }
+    return mDataFile != nullptr;
+}
+
+bool BlobCacheDiskStore::openDataFile()
+{
+    mDataFile = fopen(mDataFilePath.c_str(), "r+b");
+    if (mDataFile == nullptr)
+    {
+        return false;
+    }
+
+    DataFileHeader header;
+    if (!ReadAt(mDataFile, 0, &header, sizeof(header)) || header.magic != kDataFileMagic ||
+        header.version != kFormatVersion)
+    {
+        close();
+        return false;
+    }
+
+    mGeneration   = header.generation;
+    mDataFileSize = sizeof(DataFileHeader);
+    return true;
+}
+
+bool BlobCacheDiskStore::createDataFile()
+{
+    // Write the new file next to the current one and rename it into place, rather than truncating
+    // a file that other processes may have mapped.  The generation tells them that it changed, so
+    // it's taken from the clock in case the previous file's generation is unknown.
+    uint64_t clockGeneration =
+        static_cast<uint64_t>(std::chrono::system_clock::now().time_since_epoch().count());
+    uint64_t newGeneration = std::max(mGeneration + 1, clockGeneration);
+
+    std::string tempPath = mDataFilePath + ".tmp";
+    FILE *newFile        = fopen(tempPath.c_str(), "wb");
+    if (newFile == nullptr)
+    {
+        return false;
+    }
+
+    DataFileHeader header = {kDataFileMagic, kFormatVersion, newGeneration};
+    bool written          = fwrite(&header, sizeof(header), 1, newFile) == 1;
+    written               = fclose(newFile) == 0 && written;
+
+    if (!written || !ReplaceFile(tempPath, mDataFilePath) || !openDataFile())
+    {
+        std::remove(tempPath.c_str());
+        return false;
+    }
+
+    // Any existing index describes a data file that is gone.
+    std::remove(mIndexFilePath.c_str());
+
+    mIndexDirty = true;
+    return true;
+}
+
+bool BlobCacheDiskStore::loadIndex(uint64_t fileSize, uint64_t *coveredSizeOut)
+{
+    FILE *indexFile = fopen(mIndexFilePath.c_str(), "rb");
+    if (indexFile == nullptr)
+    {
+        return false;
+    }
+
+    IndexFileHeader header;
+    std::vector<IndexEntry> indexEntries;
+
+    bool valid = fread(&header, sizeof(header), 1, indexFile) == 1 &&
+                 header.magic == kIndexFileMagic && header.version == kFormatVersion &&
+                 header.generation == mGeneration &&
+                 header.coveredDataFileSize >= sizeof(DataFileHeader) &&
+                 header.coveredDataFileSize <= fileSize &&
+                 header.entryCount <= header.coveredDataFileSize / sizeof(RecordHeader);
+    if (valid)
+    {
+        indexEntries.resize(header.entryCount);
+        valid = indexEntries.empty() ||
+                fread(indexEntries.data(), sizeof(IndexEntry), indexEntries.size(), indexFile) ==
+                    indexEntries.size();
+    }
+    fclose(indexFile);
+
+    if (!valid || ComputeChecksum(indexEntries.data(), indexEntries.size() * sizeof(IndexEntry)) !=
+                      header.checksum)
+    {
+        return false;
+    }
+
+    // Entries are stored from least to most recently used.
+    for (const IndexEntry &indexEntry : indexEntries)
+    {
+        if (indexEntry.offset + GetRecordSize(indexEntry.size) > header.coveredDataFileSize ||
+            mEntries.Peek(indexEntry.key) != mEntries.end())
+        {
+            return false;
+        }
+        mEntries.Put(indexEntry.key, Entry{indexEntry.offset, indexEntry.size});
+        mLiveSize += GetRecordSize(indexEntry.size);
+    }
+
+    *coveredSizeOut = header.coveredDataFileSize;
+    return true;
+}
+
+void BlobCacheDiskStore::scanDataFile(uint64_t offset, uint64_t fileSize)
+{
+    angle::MemoryBuffer blob;
+
+    RecordHeader header;
+    while (ReadAt(mDataFile, offset, &header, sizeof(header)) && header.magic == kRecordMagic &&
+           offset + GetRecordSize(header.size) <= fileSize)
+    {
+        if ((header.flags & kRecordFlagTombstone) != 0)
+        {
+            auto iter = mEntries.Peek(header.key);
+            if (iter != mEntries.end())
+            {
+                eraseEntry(iter);
+            }
+        }
+        else
+        {
+            if (!ReadBlob(mDataFile, header.size, &blob) ||
+                ComputeChecksum(blob) != header.checksum)
+            {
+                break;
+            }
+
+            auto iter = mEntries.Peek(header.key);
+            if (iter != mEntries.end())
+            {
+                eraseEntry(iter);
+            }
+            mEntries.Put(header.key, Entry{offset, header.size});
+            mLiveSize += GetRecordSize(header.size);
+        }
+
+        offset += GetRecordSize(header.size);
+        mIndexDirty = true;
+    }
+
+    mDataFileSize = offset;
+}
+
+bool BlobCacheDiskStore::writeIndex()
+{
+    std::vector<IndexEntry> indexEntries;
+    indexEntries.reserve(mEntries.size());
+    for (auto iter = mEntries.rbegin(); iter != mEntries.rend(); ++iter)
+    {
+        indexEntries.push_back({iter->first, iter->second.size, iter->second.offset});
+    }
+
+    IndexFileHeader header = {};
+    header.magic               = kIndexFileMagic;
+    header.version             = kFormatVersion;
+    header.generation          = mGeneration;
+    header.coveredDataFileSize = mDataFileSize;
+    header.entryCount          = static_cast<uint32_t>(indexEntries.size());
+    header.checksum =
+        ComputeChecksum(indexEntries.data(), indexEntries.size() * sizeof(IndexEntry));
+
+    // Write to a temporary file first, so a crash never leaves a partially written index behind.
+    std::string tempPath = mIndexFilePath + ".tmp";
+    FILE *indexFile      = fopen(tempPath.c_str(), "wb");
+    if (indexFile == nullptr)
+    {
+        return false;
+    }
+
+    bool written = fwrite(&header, sizeof(header), 1, indexFile) == 1 &&
+                   (indexEntries.empty() ||
+                    fwrite(indexEntries.data(), sizeof(IndexEntry), indexEntries.size(),
+                           indexFile) == indexEntries.size());
+    written = fclose(indexFile) == 0 && written;
+
+    if (!written || !ReplaceFile(tempPath, mIndexFilePath))
+    {
+        std::remove(tempPath.c_str());
+        return false;
+    }
+
+    mIndexDirty = false;
+    return true;
+}
+
+void BlobCacheDiskStore::put(const BlobCacheKey &key, const uint8_t *data, size_t size)
+{
+    if (mDataFile == nullptr || size > std::numeric_limits<uint32_t>::max() ||
+        GetRecordSize(static_cast<uint32_t>(size)) > mMaxSize)
+    {
+        return;
+    }
+
+    ScopedFileLock lock(mLock.get());
+    if (!lock.locked() || !syncWithDataFile())
+    {
+        return;
+    }
+
+    auto iter = mEntries.Peek(key);
+    if (iter != mEntries.end())
+    {
+        eraseEntry(iter);
+    }
+
+    uint64_t offset = mDataFileSize;
+    uint32_t size32 = static_cast<uint32_t>(size);
+    if (!appendRecord(key, 0, data, size32))
+    {
+        return;
+    }
+
+    mEntries.Put(key, Entry{offset, size32});
+    mLiveSize += GetRecordSize(size32);
+
+    evictToSize(mMaxSize);
+    compactIfNeeded();
+}
+
+bool BlobCacheDiskStore::get(const BlobCacheKey &key, BlobCache::Value *valueOut)
+{
+    if (mDataFile == nullptr)
+    {
+        return false;
+    }
+
+    auto iter = mEntries.Get(key);
+    if (iter == mEntries.end())
+    {
+        return false;
+    }
+
+    // The LRU order changed.
+    mIndexDirty = true;
+
+    // Records appended after the data file was mapped are not part of the mapping.  The file is
+    // mapped by path, so make sure that it's still the file the entries refer to before mapping
+    // it again.  Views of the previous mapping remain valid as long as they are referenced.
+    if (mapRecord(iter->second) == nullptr)
+    {
+        ScopedFileLock lock(mLock.get());
+        if (lock.locked())
+        {
+            if (!syncWithDataFile())
+            {
+                return false;
+            }
+
+            iter = mEntries.Get(key);
+            if (iter == mEntries.end())
+            {
+                return false;
+            }
+            mapDataFile();
+        }
+    }
+
+    const uint8_t *mappedRecord = mapRecord(iter->second);
+    if (mappedRecord != nullptr)
+    {
+        // Return a view into the mapping, pinning it.
+        RecordHeader header;
+        memcpy(&header, mappedRecord, sizeof(header));
+        const uint8_t *blob = mappedRecord + sizeof(header);
+
+        if (IsValidRecord(header, key, iter->second.size) &&
+            ComputeChecksum(blob, header.size) == header.checksum)
+        {
+            *valueOut = BlobCache::Value(blob, header.size, mMappedDataFile);
+            return true;
+        }
+    }
+    else
+    {
+        // Fall back to reading the blob into memory owned by the returned value.
+        auto blob = std::make_shared<angle::MemoryBuffer>();
+        if (readRecord(key, iter->second, blob.get()))
+        {
+            *valueOut = BlobCache::Value(blob->data(), blob->size(), blob);
+            return true;
+        }
+    }
+
+    WARN() << "Evicting corrupt entry from blob cache file " << mDataFilePath;
+    remove(key);
+    return false;
+}
+
+void BlobCacheDiskStore::remove(const BlobCacheKey &key)
+{
+    if (mDataFile == nullptr)
+    {
+        return;
+    }
+
+    ScopedFileLock lock(mLock.get());
+    if (!lock.locked() || !syncWithDataFile())
+    {
+        return;
+    }
+
+    auto iter = mEntries.Peek(key);
+    if (iter == mEntries.end())
+    {
+        return;
+    }
+
+    eraseEntry(iter);
+    appendRecord(key, kRecordFlagTombstone, nullptr, 0);
+}
+
+void BlobCacheDiskStore::flush()
+{
+    if (mDataFile == nullptr || !mIndexDirty)
+    {
+        return;
+    }
+
+    // Fold in the changes of other processes first, so that the index covers them too.
+    ScopedFileLock lock(mLock.get());
+    if (lock.locked() && syncWithDataFile() && !writeIndex())
+    {
+        WARN() << "Failed to write blob cache index " << mIndexFilePath;
+    }
+}
+
+bool BlobCacheDiskStore::appendRecord(const BlobCacheKey &key,
+                                      uint32_t flags,
+                                      const uint8_t *data,
+                                      uint32_t size)
+{
+    ASSERT(mDataFile != nullptr);
+
+    RecordHeader header;
+    header.magic    = kRecordMagic;
+    header.flags    = flags;
+    header.size     = size;
+    header.checksum = ComputeChecksum(data, size);
+    header.key      = key;
+
+    bool written = WriteAt(mDataFile, mDataFileSize, &header, sizeof(header)) &&
+                   (size == 0 || fwrite(data, 1, size, mDataFile) == size) &&
+                   fflush(mDataFile) == 0;
+    if (!written)
+    {
+        // The file is in an unknown state.  It will be repaired on next startup, so stop using it
+        // in this process.
+        WARN() << "Failed to write to blob cache file " << mDataFilePath << ", disabling it";
+        close();
+        return false;
+    }
+
+    mDataFileSize += GetRecordSize(size);
+    mIndexDirty = true;
+    return true;
+}
+
+bool BlobCacheDiskStore::readRecord(const BlobCacheKey &key,
+                                    const Entry &entry,
+                                    angle::MemoryBuffer *valueOut)
+{
+    RecordHeader header;
+    if (!ReadAt(mDataFile, entry.offset, &header, sizeof(header)) ||
+        !IsValidRecord(header, key, entry.size))
+    {
+        return false;
+    }
+
+    return ReadBlob(mDataFile, header.size, valueOut) &&
+           ComputeChecksum(*valueOut) == header.checksum;
+}
+
+const uint8_t *BlobCacheDiskStore::mapRecord(const Entry &entry) const
+{
+    if (!mMappedDataFile || mMappedDataFile->size() < entry.offset + GetRecordSize(entry.size))
+    {
+        return nullptr;
+    }
+    return mMappedDataFile->data() + entry.offset;
+}
+
+void BlobCacheDiskStore::mapDataFile()
+{
+    mMappedDataFile.reset(angle::OpenMappedFile(mDataFilePath.c_str()));
+}
+
+void BlobCacheDiskStore::eraseEntry(EntryMap::iterator iter)
+{
+    ASSERT(mLiveSize >= GetRecordSize(iter->second.size));
+    mLiveSize -= GetRecordSize(iter->second.size);
+    mEntries.Erase(iter);
+    mIndexDirty = true;
+}
+
+void BlobCacheDiskStore::evictToSize(size_t limit)
+{
+    while (mLiveSize > limit && mDataFile != nullptr)
+    {
+        ASSERT(!mEntries.empty());
+        auto iter        = mEntries.rbegin();
+        BlobCacheKey key = iter->first;
+        mLiveSize -= GetRecordSize(iter->second.size);
+        mEntries.Erase(iter);
+        appendRecord(key, kRecordFlagTombstone, nullptr, 0);
+    }
+}
+
+void BlobCacheDiskStore::compactIfNeeded()
+{
+    if (mDataFile == nullptr || mDataFileSize < kMinCompactionSize)
+    {
+        return;
+    }
+
+    uint64_t deadSize = mDataFileSize - sizeof(DataFileHeader) - mLiveSize;
+    if (deadSize > mLiveSize && !compact())
+    {
+        WARN() << "Failed to compact blob cache file " << mDataFilePath;
+    }
+}
+
+bool BlobCacheDiskStore::compact()
+{
+    ASSERT(mDataFile != nullptr);
+
+    // Copy the live records, oldest first, into a new data file that then replaces the current
+    // one.  The generation is bumped so that the old index is recognized as stale if the process
+    // dies before the new index is written.
+    std::string tempPath = mDataFilePath + ".tmp";
+    FILE *newFile        = fopen(tempPath.c_str(), "wb");
+    if (newFile == nullptr)
+    {
+        return false;
+    }
+
+    uint64_t newGeneration = mGeneration + 1;
+    DataFileHeader header  = {kDataFileMagic, kFormatVersion, newGeneration};
+    bool written           = fwrite(&header, sizeof(header), 1, newFile) == 1;
+
+    std::vector<uint64_t> newOffsets;
+    newOffsets.reserve(mEntries.size());
+    uint64_t newFileSize = sizeof(DataFileHeader);
+
+    for (auto iter = mEntries.rbegin(); written && iter != mEntries.rend(); ++iter)
+    {
+        size_t recordSize = GetRecordSize(iter->second.size);
+
+        written = mCompactionBuffer.resize(recordSize) &&
+                  ReadAt(mDataFile, iter->second.offset, mCompactionBuffer.data(), recordSize) &&
+                  fwrite(mCompactionBuffer.data(), 1, recordSize, newFile) == recordSize;
+
+        newOffsets.push_back(newFileSize);
+        newFileSize += recordSize;
+    }
+    written = fclose(newFile) == 0 && written;
+    mCompactionBuffer.resize(0);
+
+    if (!written)
+    {
+        std::remove(tempPath.c_str());
+        return false;
+    }
+
+    uint64_t dataFileSize = mDataFileSize;
+    close();
+    if (!ReplaceFile(tempPath, mDataFilePath))
+    {
+        // Keep using the current file, which can't be replaced on Windows while another process
+        // has it open.
+        std::remove(tempPath.c_str());
+        if (openDataFile())
+        {
+            mDataFileSize = dataFileSize;
+        }
+        return false;
+    }
+    if (!openDataFile())
+    {
+        return false;
+    }
+    ASSERT(mGeneration == newGeneration);
+
+    size_t index = 0;
+    for (auto iter = mEntries.rbegin(); iter != mEntries.rend(); ++iter)
+    {
+        iter->second.offset = newOffsets[index++];
+    }
+    mDataFileSize = newFileSize;
+
+    return writeIndex();
+}
+
+void BlobCacheDiskStore::close()
+{
+    mMappedDataFile.reset();
+
+    if (mDataFile != nullptr)
+    {
+        fclose(mDataFile);
+        mDataFile = nullptr;
+    }
+}
+
+}  // namespace egl
@@ -0,0 +1,138 @@
+//
+// Copyright 2019 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// BlobCacheDiskStore: Persistent on-disk backend for BlobCache.  Blobs are appended to a single
+//   data file and located through an index file keyed by BlobCacheKey.  Entries are evicted in
+//   least-recently-used order once the configured size budget is exceeded.
+
+#ifndef LIBANGLE_BLOB_CACHE_DISK_STORE_H_
+#define LIBANGLE_BLOB_CACHE_DISK_STORE_H_
+
+#include <stdio.h>
+#include <memory>
+#include <string>
+
+#include <anglebase/containers/mru_cache.h>
+#include "common/MemoryBuffer.h"
+#include "libANGLE/BlobCache.h"
+
+namespace angle
+{
+class FileLock;
+class MappedFile;
+}  // namespace angle
+
+namespace egl
+{
+
+// The store is made of two files:
+//
+// - <basePath>.data: A header followed by an append-only sequence of records.  Each record
+//   holds a key, the blob size and a checksum of the blob, followed by the blob itself.
+//   Removals and evictions append a tombstone record, so the data file alone is enough to
+//   rebuild the store.
+// - <basePath>.index: A snapshot of the live entries (key, offset and size, in LRU order) and
+//   the length of the data file it covers.  It's rewritten on flush().
+//
+// On startup the index is loaded and any records appended after the snapshot are replayed.  A
+// missing or invalid index leads to a full scan of the data file.  The scan stops at the first
+// record that fails validation, such as a partially written record left behind by a crash, and
+// the data file is compacted to drop it.  Compaction also runs once more than half of the data
+// file is made of superseded records.
+//
+// Several processes can use the same store.  Every change to the files is made while holding an
+// advisory lock on <basePath>.lock, which unlike the data file is never replaced.  Before making a
+// change, a process replays the records others appended since it last looked, and reloads the
+// store if the data file was replaced by compaction.  Records are never modified once written,
+// so reads don't need the lock: a process keeps reading the file it opened, even after it was
+// replaced.  If the lock can't be taken, the store is disabled.
+class BlobCacheDiskStore final : angle::NonCopyable
+{
+  public:
+    BlobCacheDiskStore(const std::string &basePath, size_t maxSizeBytes);
+    ~BlobCacheDiskStore();
+
+    // Opens the store files, creating them if needed.  Returns false if the store is unusable.
+    bool initialize();
+
+    // Append a blob to the store, replacing any blob previously stored with the same key.
+    void put(const BlobCacheKey &key, const uint8_t *data, size_t size);
+
+    // Look up a blob in the store.  Where the platform allows it, the returned value is a view
+    // into a read-only mapping of the data file, so the blob is never copied.  Otherwise, it's read
+    // into memory owned by the returned value.  Either way the value pins the memory it points to.
+    // Entries that fail validation are evicted.
+    ANGLE_NO_DISCARD bool get(const BlobCacheKey &key, BlobCache::Value *valueOut);
+
+    // Evict a blob from the store.
+    void remove(const BlobCacheKey &key);
+
+    // Write out the index file.
+    void flush();
+
+    // Returns the number of entries in the store.
+    size_t entryCount() const { return mEntries.size(); }
+
+    // Returns the total size of the live records, including their headers.
+    size_t size() const { return mLiveSize; }
+
+    // Returns the size budget of the store.
+    size_t maxSize() const { return mMaxSize; }
+
+    // Returns the size of the data file, including superseded records.
+    size_t dataFileSize() const { return static_cast<size_t>(mDataFileSize); }
+
+    const std::string &getDataFilePath() const { return mDataFilePath; }
+    const std::string &getIndexFilePath() const { return mIndexFilePath; }
+
+  private:
+    struct Entry
+    {
+        uint64_t offset;
+        uint32_t size;
+    };
+    using EntryMap = angle::base::HashingMRUCache<BlobCacheKey, Entry>;
+
+    bool load();
+    bool syncWithDataFile();
+    bool openDataFile();
+    bool createDataFile();
+    bool loadIndex(uint64_t fileSize, uint64_t *coveredSizeOut);
+    void scanDataFile(uint64_t offset, uint64_t fileSize);
+    bool writeIndex();
+    bool appendRecord(const BlobCacheKey &key, uint32_t flags, const uint8_t *data, uint32_t size);
+    bool readRecord(const BlobCacheKey &key, const Entry &entry, angle::MemoryBuffer *valueOut);
+    const uint8_t *mapRecord(const Entry &entry) const;
+    void mapDataFile();
+    void eraseEntry(EntryMap::iterator iter);
+    void evictToSize(size_t limit);
+    void compactIfNeeded();
+    bool compact();
+    void close();
+
+    const std::string mDataFilePath;
+    const std::string mIndexFilePath;
+    const std::string mLockFilePath;
+    const size_t mMaxSize;
+
+    std::unique_ptr<angle::FileLock> mLock;
+
+    FILE *mDataFile;
+    uint64_t mGeneration;
+    uint64_t mDataFileSize;
+    size_t mLiveSize;
+    bool mIndexDirty;
+
+    EntryMap mEntries;
+    angle::MemoryBuffer mCompactionBuffer;
+
+    // Records are never modified once written, so views of the mapping stay valid while the file
+    // is appended to.
+    std::shared_ptr<angle::MappedFile> mMappedDataFile;
+};
+
+}  // namespace egl
+
+#endif  // LIBANGLE_BLOB_CACHE_DISK_STORE_H_
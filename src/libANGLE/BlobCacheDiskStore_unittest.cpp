@@ -0,0 +1,336 @@
+//
+// Copyright 2019 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// BlobCacheDiskStore_unittest.cpp: Unit tests for the on-disk blob cache store.
+
+#include <gtest/gtest.h>
+
+#include <stdio.h>
+
+#include "libANGLE/BlobCache.h"
+#include "libANGLE/BlobCacheDiskStore.h"
+#include "util/test_utils.h"
+
+namespace egl
+{
+namespace
+{
+constexpr size_t kMaxSize = 64 * 1024;
+
+BlobCacheKey MakeKey(uint8_t start)
+{
+    BlobCacheKey key;
+    for (uint8_t i = 0; i < key.size(); ++i)
+    {
+        key[i] = i + start;
+    }
+    return key;
+}
+
+angle::MemoryBuffer MakeBlob(size_t size, uint8_t start)
+{
+    angle::MemoryBuffer blob;
+    blob.resize(size);
+    for (size_t i = 0; i < size; ++i)
+    {
+        blob[i] = static_cast<uint8_t>(i + start);
+    }
+    return blob;
+}
+
+bool BlobsEqual(BlobCache::Value &a, const angle::MemoryBuffer &b)
+{
+    return a.size() == b.size() && memcmp(a.data(), b.data(), a.size()) == 0;
+}
+
+class BlobCacheDiskStoreTest : public testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        char tempDir[260];
+        char tempFile[260];
+        ASSERT_TRUE(angle::GetTempDir(tempDir, sizeof(tempDir)));
+        ASSERT_TRUE(angle::CreateTemporaryFileInDir(tempDir, tempFile, sizeof(tempFile)));
+        mBasePath = tempFile;
+    }
+
+    void TearDown() override
+    {
+        angle::DeleteFile(mBasePath.c_str());
+        angle::DeleteFile((mBasePath + ".data").c_str());
+        angle::DeleteFile((mBasePath + ".index").c_str());
+        angle::DeleteFile((mBasePath + ".lock").c_str());
+    }
+
+    std::unique_ptr<BlobCacheDiskStore> createStore(size_t maxSize = kMaxSize)
+    {
+        auto store = std::make_unique<BlobCacheDiskStore>(mBasePath, maxSize);
+        EXPECT_TRUE(store->initialize());
+        return store;
+    }
+
+    void put(BlobCacheDiskStore *store, uint8_t keyStart, size_t size)
+    {
+        angle::MemoryBuffer blob = MakeBlob(size, keyStart);
+        store->put(MakeKey(keyStart), blob.data(), blob.size());
+    }
+
+    bool contains(BlobCacheDiskStore *store, uint8_t keyStart, size_t size)
+    {
+        BlobCache::Value blob;
+        return store->get(MakeKey(keyStart), &blob) && BlobsEqual(blob, MakeBlob(size, keyStart));
+    }
+
+    std::string mBasePath;
+};
+
+// Tests that blobs survive closing and reopening the store.
+TEST_F(BlobCacheDiskStoreTest, Reopen)
+{
+    {
+        auto store = createStore();
+        put(store.get(), 0, 100);
+        put(store.get(), 1, 2000);
+        put(store.get(), 2, 1);
+        EXPECT_EQ(3u, store->entryCount());
+    }
+
+    auto store = createStore();
+    EXPECT_EQ(3u, store->entryCount());
+    EXPECT_TRUE(contains(store.get(), 0, 100));
+    EXPECT_TRUE(contains(store.get(), 1, 2000));
+    EXPECT_TRUE(contains(store.get(), 2, 1));
+    EXPECT_FALSE(contains(store.get(), 3, 100));
+}
+
+// Tests that putting a blob under an existing key replaces it.
+TEST_F(BlobCacheDiskStoreTest, Replace)
+{
+    {
+        auto store = createStore();
+        put(store.get(), 0, 100);
+        angle::MemoryBuffer blob = MakeBlob(50, 7);
+        store->put(MakeKey(0), blob.data(), blob.size());
+        EXPECT_EQ(1u, store->entryCount());
+    }
+
+    auto store = createStore();
+    BlobCache::Value blob;
+    EXPECT_TRUE(store->get(MakeKey(0), &blob));
+    EXPECT_TRUE(BlobsEqual(blob, MakeBlob(50, 7)));
+}
+
+// Tests that removals are persisted.
+TEST_F(BlobCacheDiskStoreTest, Remove)
+{
+    {
+        auto store = createStore();
+        put(store.get(), 0, 100);
+        put(store.get(), 1, 100);
+        store->remove(MakeKey(0));
+        EXPECT_FALSE(contains(store.get(), 0, 100));
+    }
+
+    auto store = createStore();
+    EXPECT_EQ(1u, store->entryCount());
+    EXPECT_FALSE(contains(store.get(), 0, 100));
+    EXPECT_TRUE(contains(store.get(), 1, 100));
+}
+
+// Tests that the least recently used blobs are evicted once the size budget is exceeded.
+TEST_F(BlobCacheDiskStoreTest, LRUEviction)
+{
+    constexpr size_t kBlobSize = 1000;
+    auto store                 = createStore(4 * kBlobSize);
+
+    put(store.get(), 0, kBlobSize);
+    put(store.get(), 1, kBlobSize);
+    put(store.get(), 2, kBlobSize);
+
+    // Touch the first blob, so the second one is the least recently used.
+    EXPECT_TRUE(contains(store.get(), 0, kBlobSize));
+
+    put(store.get(), 3, kBlobSize);
+    EXPECT_LE(store->size(), store->maxSize());
+    EXPECT_TRUE(contains(store.get(), 0, kBlobSize));
+    EXPECT_FALSE(contains(store.get(), 1, kBlobSize));
+    EXPECT_TRUE(contains(store.get(), 2, kBlobSize));
+    EXPECT_TRUE(contains(store.get(), 3, kBlobSize));
+
+    // Blobs larger than the budget are ignored.
+    put(store.get(), 4, 5 * kBlobSize);
+    EXPECT_FALSE(contains(store.get(), 4, 5 * kBlobSize));
+    EXPECT_EQ(3u, store->entryCount());
+}
+
+// Tests that the store is rebuilt from the data file when the index is missing.
+TEST_F(BlobCacheDiskStoreTest, MissingIndex)
+{
+    {
+        auto store = createStore();
+        put(store.get(), 0, 100);
+        put(store.get(), 1, 200);
+        store->remove(MakeKey(0));
+    }
+
+    angle::DeleteFile((mBasePath + ".index").c_str());
+
+    auto store = createStore();
+    EXPECT_EQ(1u, store->entryCount());
+    EXPECT_TRUE(contains(store.get(), 1, 200));
+}
+
+// Tests that a partially written record at the end of the data file is discarded.
+TEST_F(BlobCacheDiskStoreTest, TruncatedRecord)
+{
+    {
+        auto store = createStore();
+        put(store.get(), 0, 100);
+        store->flush();
+        put(store.get(), 1, 200);
+    }
+
+    // Append the start of a record, as if the process crashed while writing it.
+    FILE *dataFile = fopen((mBasePath + ".data").c_str(), "ab");
+    ASSERT_NE(nullptr, dataFile);
+    const uint8_t kGarbage[] = {0x41, 0x4E, 0x44, 0x52, 0, 0, 0, 0, 0xFF, 0xFF};
+    fwrite(kGarbage, 1, sizeof(kGarbage), dataFile);
+    fclose(dataFile);
+
+    {
+        auto store = createStore();
+        EXPECT_EQ(2u, store->entryCount());
+        EXPECT_TRUE(contains(store.get(), 0, 100));
+        EXPECT_TRUE(contains(store.get(), 1, 200));
+        put(store.get(), 2, 300);
+    }
+
+    auto store = createStore();
+    EXPECT_EQ(3u, store->entryCount());
+    EXPECT_TRUE(contains(store.get(), 2, 300));
+}
+
+// Tests that superseded records are eventually compacted away.
+TEST_F(BlobCacheDiskStoreTest, Compaction)
+{
+    constexpr size_t kBlobSize = 16 * 1024;
+    auto store                 = createStore(1024 * 1024);
+
+    for (int iteration = 0; iteration < 200; ++iteration)
+    {
+        put(store.get(), static_cast<uint8_t>(iteration % 4), kBlobSize);
+    }
+
+    EXPECT_EQ(4u, store->entryCount());
+    EXPECT_LT(store->dataFileSize(), 3 * 1024 * 1024u);
+    for (uint8_t key = 0; key < 4; ++key)
+    {
+        EXPECT_TRUE(contains(store.get(), key, kBlobSize));
+    }
+}
+
+// Tests that values returned by the store stay valid after the blob is evicted and the data file
+// is compacted.
+TEST_F(BlobCacheDiskStoreTest, PinnedValue)
+{
+    constexpr size_t kBlobSize = 16 * 1024;
+    auto store                 = createStore(1024 * 1024);
+
+    put(store.get(), 0, kBlobSize);
+
+    BlobCache::Value pinned;
+    EXPECT_TRUE(store->get(MakeKey(0), &pinned));
+    EXPECT_NE(nullptr, pinned.getKeepAlive());
+
+    store->remove(MakeKey(0));
+    for (int iteration = 0; iteration < 200; ++iteration)
+    {
+        put(store.get(), static_cast<uint8_t>(1 + iteration % 4), kBlobSize);
+    }
+
+    EXPECT_FALSE(contains(store.get(), 0, kBlobSize));
+    EXPECT_TRUE(BlobsEqual(pinned, MakeBlob(kBlobSize, 0)));
+}
+
+// Tests that stores sharing the same files, as in different processes, see each other's changes
+// and don't overwrite them.
+TEST_F(BlobCacheDiskStoreTest, SharedFiles)
+{
+    {
+        auto first  = createStore();
+        auto second = createStore();
+
+        put(first.get(), 0, 100);
+        put(second.get(), 1, 200);
+        put(first.get(), 2, 300);
+        second->remove(MakeKey(0));
+        first->flush();
+
+        EXPECT_EQ(2u, first->entryCount());
+        EXPECT_FALSE(contains(first.get(), 0, 100));
+        EXPECT_TRUE(contains(first.get(), 1, 200));
+        EXPECT_TRUE(contains(first.get(), 2, 300));
+    }
+
+    auto store = createStore();
+    EXPECT_EQ(2u, store->entryCount());
+    EXPECT_TRUE(contains(store.get(), 1, 200));
+    EXPECT_TRUE(contains(store.get(), 2, 300));
+}
+
+// Tests that a store picks up the data file another store sharing its files compacted.
+TEST_F(BlobCacheDiskStoreTest, SharedFilesCompaction)
+{
+    constexpr size_t kBlobSize = 16 * 1024;
+    auto first                 = createStore(1024 * 1024);
+    auto second                = createStore(1024 * 1024);
+
+    put(first.get(), 0, kBlobSize);
+
+    BlobCache::Value pinned;
+    EXPECT_TRUE(first->get(MakeKey(0), &pinned));
+
+    for (int iteration = 0; iteration < 200; ++iteration)
+    {
+        put(second.get(), static_cast<uint8_t>(1 + iteration % 4), kBlobSize);
+    }
+    EXPECT_LT(second->dataFileSize(), 3 * 1024 * 1024u);
+
+    put(first.get(), 5, kBlobSize);
+    EXPECT_EQ(6u, first->entryCount());
+    for (uint8_t key = 0; key < 6; ++key)
+    {
+        EXPECT_TRUE(contains(first.get(), key, kBlobSize));
+    }
+    EXPECT_TRUE(BlobsEqual(pinned, MakeBlob(kBlobSize, 0)));
+}
+
+// Tests that BlobCache falls back to the disk store, even when it doesn't cache in memory.
+TEST_F(BlobCacheDiskStoreTest, BlobCacheFallback)
+{
+    angle::ScratchBuffer scratchBuffer(1000);
+
+    {
+        BlobCache blobCache(0);
+        blobCache.setDiskStore(createStore());
+        EXPECT_TRUE(blobCache.isCachingEnabled());
+        blobCache.put(MakeKey(0), MakeBlob(100, 0));
+    }
+
+    BlobCache blobCache(0);
+    blobCache.setDiskStore(createStore());
+
+    BlobCache::Value value;
+    EXPECT_TRUE(blobCache.get(&scratchBuffer, MakeKey(0), &value));
+    ASSERT_EQ(100u, value.size());
+    EXPECT_EQ(0, memcmp(value.data(), MakeBlob(100, 0).data(), 100));
+
+    blobCache.remove(MakeKey(0));
+    EXPECT_FALSE(blobCache.get(&scratchBuffer, MakeKey(0), &value));
+}
+
+}  // anonymous namespace
+}  // namespace egl
@@ -544,6 +544,9 @@ struct Extensions
 
     // GL_ANGLE_get_image
     bool getImageANGLE = false;
+
+    // GL_ANGLE_state_call_statistics
+    bool stateCallStatistics = false;
 };
 
 // Pointer to a boolean memeber of the Extensions struct
@@ -942,6 +945,9 @@ struct DisplayExtensions
     // EGL_ANGLE_create_context_backwards_compatible
     bool createContextBackwardsCompatible = false;
 
+    // EGL_ANGLE_create_context_deferred_execution
+    bool createContextDeferredExecution = false;
+
     // EGL_KHR_no_config_context
     bool noConfigContext = false;
 };
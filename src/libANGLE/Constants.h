@@ -18,6 +18,9 @@ namespace gl
 
 // The binary cache is currently left disable by default, and the application can enable it.
 const size_t kDefaultMaxProgramCacheMemoryBytes = 0;
+// Translated shaders are cached by default.  There is no API to resize this cache, and a
+// translation is typically a few kilobytes.
+const size_t kDefaultMaxShaderCacheMemoryBytes = 2 * 1024 * 1024;
 
 enum
 {
@@ -71,6 +74,9 @@ enum
     // Maximum number of slots allocated for atomic counter buffers.
     IMPLEMENTATION_MAX_ATOMIC_COUNTER_BUFFERS = 8,
 
+    // Implementation upper limit, real maximum depends on the hardware.
+    IMPLEMENTATION_MAX_ATOMIC_COUNTER_BUFFER_BINDINGS = 32,
+
     // Implementation upper limits, real maximums depend on the hardware.
     IMPLEMENTATION_MAX_SHADER_STORAGE_BUFFER_BINDINGS = 64,
 };
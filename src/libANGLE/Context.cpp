@@ -154,6 +154,11 @@ bool GetBackwardCompatibleContext(const egl::AttributeMap &attribs)
     return attribs.get(EGL_CONTEXT_OPENGL_BACKWARDS_COMPATIBLE_ANGLE, EGL_TRUE) == EGL_TRUE;
 }
 
+bool GetDeferredExecution(const egl::AttributeMap &attribs)
+{
+    return attribs.get(EGL_CONTEXT_DEFERRED_EXECUTION_ANGLE, EGL_FALSE) == EGL_TRUE;
+}
+
 Version GetClientVersion(egl::Display *display, const egl::AttributeMap &attribs)
 {
     Version requestedVersion =
@@ -240,6 +245,23 @@ bool GetRobustResourceInit(const egl::AttributeMap &attribs)
     return (attribs.get(EGL_ROBUST_RESOURCE_INITIALIZATION_ANGLE, EGL_FALSE) == EGL_TRUE);
 }
 
+// Contexts sharing with another context join its share group, and contexts using the display's
+// texture share group join that one.  Other contexts start a share group of their own.
+std::shared_ptr<std::mutex> GetShareGroupMutex(const egl::Display *display,
+                                               const Context *shareContext,
+                                               const TextureManager *shareTextures)
+{
+    if (shareContext)
+    {
+        return shareContext->getShareGroupMutex();
+    }
+    if (shareTextures)
+    {
+        return display->getTextureShareGroupMutex();
+    }
+    return std::make_shared<std::mutex>();
+}
+
 std::string GetObjectLabelFromPointer(GLsizei length, const GLchar *label)
 {
     std::string labelName;
@@ -291,7 +313,13 @@ enum SubjectIndexes : angle::SubjectIndex
     kUniformBuffer0SubjectIndex = kImageMaxSubjectIndex,
     kUniformBufferMaxSubjectIndex =
         kUniformBuffer0SubjectIndex + IMPLEMENTATION_MAX_UNIFORM_BUFFER_BINDINGS,
-    kSampler0SubjectIndex    = kUniformBufferMaxSubjectIndex,
+    kAtomicCounterBuffer0SubjectIndex = kUniformBufferMaxSubjectIndex,
+    kAtomicCounterBufferMaxSubjectIndex =
+        kAtomicCounterBuffer0SubjectIndex + IMPLEMENTATION_MAX_ATOMIC_COUNTER_BUFFER_BINDINGS,
+    kShaderStorageBuffer0SubjectIndex = kAtomicCounterBufferMaxSubjectIndex,
+    kShaderStorageBufferMaxSubjectIndex =
+        kShaderStorageBuffer0SubjectIndex + IMPLEMENTATION_MAX_SHADER_STORAGE_BUFFER_BINDINGS,
+    kSampler0SubjectIndex    = kShaderStorageBufferMaxSubjectIndex,
     kSamplerMaxSubjectIndex  = kSampler0SubjectIndex + IMPLEMENTATION_MAX_ACTIVE_TEXTURES,
     kVertexArraySubjectIndex = kSamplerMaxSubjectIndex,
     kReadFramebufferSubjectIndex,
@@ -304,6 +332,7 @@ Context::Context(egl::Display *display,
                  const Context *shareContext,
                  TextureManager *shareTextures,
                  MemoryProgramCache *memoryProgramCache,
+                 MemoryShaderCache *memoryShaderCache,
                  const EGLenum clientType,
                  const egl::AttributeMap &attribs,
                  const egl::DisplayExtensions &displayExtensions,
@@ -320,6 +349,7 @@ Context::Context(egl::Display *display,
              GetRobustResourceInit(attribs),
              memoryProgramCache != nullptr),
       mShared(shareContext != nullptr),
+      mShareGroupMutex(GetShareGroupMutex(display, shareContext, shareTextures)),
       mSkipValidation(GetNoError(attribs)),
       mDisplayTextureShareGroup(shareTextures != nullptr),
       mErrors(this),
@@ -343,6 +373,7 @@ Context::Context(egl::Display *display,
       mBufferAccessValidationEnabled(false),
       mExtensionsEnabled(GetExtensionsEnabled(attribs, mWebGLContext)),
       mMemoryProgramCache(memoryProgramCache),
+      mMemoryShaderCache(memoryShaderCache),
       mVertexArrayObserverBinding(this, kVertexArraySubjectIndex),
       mDrawFramebufferObserverBinding(this, kDrawFramebufferSubjectIndex),
       mReadFramebufferObserverBinding(this, kReadFramebufferSubjectIndex),
@@ -358,6 +389,18 @@ Context::Context(egl::Display *display,
         mUniformBufferObserverBindings.emplace_back(this, uboIndex);
     }
 
+    for (angle::SubjectIndex acbIndex = kAtomicCounterBuffer0SubjectIndex;
+         acbIndex < kAtomicCounterBufferMaxSubjectIndex; ++acbIndex)
+    {
+        mAtomicCounterBufferObserverBindings.emplace_back(this, acbIndex);
+    }
+
+    for (angle::SubjectIndex ssboIndex = kShaderStorageBuffer0SubjectIndex;
+         ssboIndex < kShaderStorageBufferMaxSubjectIndex; ++ssboIndex)
+    {
+        mShaderStorageBufferObserverBindings.emplace_back(this, ssboIndex);
+    }
+
     for (angle::SubjectIndex samplerIndex = kSampler0SubjectIndex;
          samplerIndex < kSamplerMaxSubjectIndex; ++samplerIndex)
     {
@@ -369,6 +412,11 @@ Context::Context(egl::Display *display,
     {
         mImageObserverBindings.emplace_back(this, imageIndex);
     }
+
+    if (GetDeferredExecution(attribs))
+    {
+        mDeferredCommandQueue.reset(new DeferredCommandQueue(this));
+    }
 }
 
 void Context::initialize()
@@ -551,6 +599,9 @@ void Context::initialize()
 
 egl::Error Context::onDestroy(const egl::Display *display)
 {
+    // Run the calls still queued for the worker thread, and stop it.
+    mDeferredCommandQueue.reset();
+
     // Dump frame capture if enabled.
     mFrameCapture->onEndFrame(this);
 
@@ -1096,6 +1147,7 @@ GLboolean Context::isSampler(SamplerID samplerName)
 
 void Context::bindTexture(TextureType target, TextureID handle)
 {
+    ScopedStateCallCounter counter(&mState, StateCall::BindTexture);
     Texture *texture = nullptr;
 
     if (handle.value == 0)
@@ -1109,6 +1161,11 @@ void Context::bindTexture(TextureType target, TextureID handle)
     }
 
     ASSERT(texture);
+    if (mState.getTargetTexture(target) == texture)
+    {
+        return;
+    }
+
     mState.setSamplerTexture(this, target, texture);
     mStateCache.onActiveTextureChange(this);
 }
@@ -1132,7 +1189,13 @@ void Context::bindDrawFramebuffer(FramebufferID framebufferHandle)
 
 void Context::bindVertexArray(VertexArrayID vertexArrayHandle)
 {
+    ScopedStateCallCounter counter(&mState, StateCall::BindVertexArray);
     VertexArray *vertexArray = checkVertexArrayAllocation(vertexArrayHandle);
+    if (mState.getVertexArray() == vertexArray)
+    {
+        return;
+    }
+
     mState.setVertexArrayBinding(this, vertexArray);
     mVertexArrayObserverBinding.bind(vertexArray);
     mStateCache.onVertexArrayBindingChange(this);
@@ -1151,9 +1214,15 @@ void Context::bindVertexBuffer(GLuint bindingIndex,
 
 void Context::bindSampler(GLuint textureUnit, SamplerID samplerHandle)
 {
+    ScopedStateCallCounter counter(&mState, StateCall::BindSampler);
     ASSERT(textureUnit < mState.mCaps.maxCombinedTextureImageUnits);
     Sampler *sampler =
         mState.mSamplerManager->checkSamplerAllocation(mImplementation.get(), samplerHandle);
+    if (mState.getSampler(textureUnit) == sampler)
+    {
+        return;
+    }
+
     mState.setSamplerBinding(this, textureUnit, sampler);
     mSamplerObserverBindings[textureUnit].bind(sampler);
     mStateCache.onActiveTextureChange(this);
@@ -1174,7 +1243,10 @@ void Context::bindImageTexture(GLuint unit,
 
 void Context::useProgram(ShaderProgramID program)
 {
-    ANGLE_CONTEXT_TRY(mState.setProgram(this, getProgramResolveLink(program)));
+    ScopedStateCallCounter counter(&mState, StateCall::UseProgram);
+    Program *programObject = getProgramResolveLink(program);
+    ANGLE_CONTEXT_TRY(mState.setProgram(this, programObject));
+    // Refreshed even if the binding doesn't change, as the program may have been relinked.
     mStateCache.onProgramExecutableChange(this);
 }
 
@@ -1924,6 +1996,13 @@ void Context::getInteger64vImpl(GLenum pname, GLint64 *params)
         case GL_MAX_SHADER_STORAGE_BLOCK_SIZE:
             *params = mState.mCaps.maxShaderStorageBlockSize;
             break;
+
+        // GL_ANGLE_state_call_statistics
+        case GL_EFFECTIVE_STATE_CALLS_ANGLE:
+        case GL_REDUNDANT_STATE_CALLS_ANGLE:
+            *params = mState.getStateCallTotal(pname);
+            break;
+
         default:
             UNREACHABLE();
             break;
@@ -3460,6 +3539,9 @@ Extensions Context::generateSupportedExtensions() const
 
     supportedExtensions.memorySize = true;
 
+    // GL_ANGLE_state_call_statistics is implemented in the frontend
+    supportedExtensions.stateCallStatistics = true;
+
     // GL_CHROMIUM_lose_context is implemented in the frontend
     supportedExtensions.loseContextCHROMIUM = true;
 
@@ -3592,6 +3674,8 @@ void Context::initCaps()
     }
     ANGLE_LIMIT_CAP(mState.mCaps.maxCombinedAtomicCounterBuffers,
                     IMPLEMENTATION_MAX_ATOMIC_COUNTER_BUFFERS);
+    ANGLE_LIMIT_CAP(mState.mCaps.maxAtomicCounterBufferBindings,
+                    IMPLEMENTATION_MAX_ATOMIC_COUNTER_BUFFER_BINDINGS);
 
     for (ShaderType shaderType : AllShaderTypes())
     {
@@ -4768,6 +4852,8 @@ GLboolean Context::unmapBuffer(BufferBinding target)
     Buffer *buffer = mState.getTargetBuffer(target);
     ASSERT(buffer);
 
+    mFrameCapture->onUnmapBuffer(this, target);
+
     GLboolean result;
     if (buffer->unmap(this, &result) == angle::Result::Stop)
     {
@@ -4832,6 +4918,7 @@ void Context::activeShaderProgram(ProgramPipelineID pipeline, ShaderProgramID pr
 
 void Context::activeTexture(GLenum texture)
 {
+    ScopedStateCallCounter counter(&mState, StateCall::ActiveTexture);
     mState.setActiveSampler(texture - GL_TEXTURE0);
 }
 
@@ -4842,11 +4929,13 @@ void Context::blendBarrier()
 
 void Context::blendColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
 {
+    ScopedStateCallCounter counter(&mState, StateCall::BlendColor);
     mState.setBlendColor(clamp01(red), clamp01(green), clamp01(blue), clamp01(alpha));
 }
 
 void Context::blendEquation(GLenum mode)
 {
+    ScopedStateCallCounter counter(&mState, StateCall::BlendEquation);
     mState.setBlendEquation(mode, mode);
 }
 
@@ -4857,6 +4946,7 @@ void Context::blendEquationi(GLuint buf, GLenum mode)
 
 void Context::blendEquationSeparate(GLenum modeRGB, GLenum modeAlpha)
 {
+    ScopedStateCallCounter counter(&mState, StateCall::BlendEquationSeparate);
     mState.setBlendEquation(modeRGB, modeAlpha);
 }
 
@@ -4867,6 +4957,7 @@ void Context::blendEquationSeparatei(GLuint buf, GLenum modeRGB, GLenum modeAlph
 
 void Context::blendFunc(GLenum sfactor, GLenum dfactor)
 {
+    ScopedStateCallCounter counter(&mState, StateCall::BlendFunc);
     mState.setBlendFactors(sfactor, dfactor, sfactor, dfactor);
 }
 
@@ -4877,6 +4968,7 @@ void Context::blendFunci(GLuint buf, GLenum src, GLenum dst)
 
 void Context::blendFuncSeparate(GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha)
 {
+    ScopedStateCallCounter counter(&mState, StateCall::BlendFuncSeparate);
     mState.setBlendFactors(srcRGB, dstRGB, srcAlpha, dstAlpha);
 }
 
@@ -4891,21 +4983,25 @@ void Context::blendFuncSeparatei(GLuint buf,
 
 void Context::clearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
 {
+    ScopedStateCallCounter counter(&mState, StateCall::ClearColor);
     mState.setColorClearValue(red, green, blue, alpha);
 }
 
 void Context::clearDepthf(GLfloat depth)
 {
+    ScopedStateCallCounter counter(&mState, StateCall::ClearDepthf);
     mState.setDepthClearValue(clamp01(depth));
 }
 
 void Context::clearStencil(GLint s)
 {
+    ScopedStateCallCounter counter(&mState, StateCall::ClearStencil);
     mState.setStencilClearValue(s);
 }
 
 void Context::colorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha)
 {
+    ScopedStateCallCounter counter(&mState, StateCall::ColorMask);
     mState.setColorMask(ConvertToBool(red), ConvertToBool(green), ConvertToBool(blue),
                         ConvertToBool(alpha));
     mStateCache.onColorMaskChange(this);
@@ -4918,26 +5014,31 @@ void Context::colorMaski(GLuint index, GLboolean r, GLboolean g, GLboolean b, GL
 
 void Context::cullFace(CullFaceMode mode)
 {
+    ScopedStateCallCounter counter(&mState, StateCall::CullFace);
     mState.setCullMode(mode);
 }
 
 void Context::depthFunc(GLenum func)
 {
+    ScopedStateCallCounter counter(&mState, StateCall::DepthFunc);
     mState.setDepthFunc(func);
 }
 
 void Context::depthMask(GLboolean flag)
 {
+    ScopedStateCallCounter counter(&mState, StateCall::DepthMask);
     mState.setDepthMask(ConvertToBool(flag));
 }
 
 void Context::depthRangef(GLfloat zNear, GLfloat zFar)
 {
+    ScopedStateCallCounter counter(&mState, StateCall::DepthRangef);
     mState.setDepthRange(clamp01(zNear), clamp01(zFar));
 }
 
 void Context::disable(GLenum cap)
 {
+    ScopedStateCallCounter counter(&mState, StateCall::Disable);
     mState.setEnableFeature(cap, false);
     mStateCache.onContextCapChange(this);
 }
@@ -4955,6 +5056,7 @@ void Context::disableVertexAttribArray(GLuint index)
 
 void Context::enable(GLenum cap)
 {
+    ScopedStateCallCounter counter(&mState, StateCall::Enable);
     mState.setEnableFeature(cap, true);
     mStateCache.onContextCapChange(this);
 }
@@ -4972,6 +5074,7 @@ void Context::enableVertexAttribArray(GLuint index)
 
 void Context::frontFace(GLenum mode)
 {
+    ScopedStateCallCounter counter(&mState, StateCall::FrontFace);
     mState.setFrontFace(mode);
 }
 
@@ -5001,11 +5104,13 @@ void Context::hint(GLenum target, GLenum mode)
 
 void Context::lineWidth(GLfloat width)
 {
+    ScopedStateCallCounter counter(&mState, StateCall::LineWidth);
     mState.setLineWidth(width);
 }
 
 void Context::pixelStorei(GLenum pname, GLint param)
 {
+    ScopedStateCallCounter counter(&mState, StateCall::PixelStorei);
     switch (pname)
     {
         case GL_UNPACK_ALIGNMENT:
@@ -5068,6 +5173,7 @@ void Context::pixelStorei(GLenum pname, GLint param)
 
 void Context::polygonOffset(GLfloat factor, GLfloat units)
 {
+    ScopedStateCallCounter counter(&mState, StateCall::PolygonOffset);
     mState.setPolygonOffsetParams(factor, units);
 }
 
@@ -5083,10 +5189,17 @@ void Context::sampleMaski(GLuint maskNumber, GLbitfield mask)
 
 void Context::scissor(GLint x, GLint y, GLsizei width, GLsizei height)
 {
+    ScopedStateCallCounter counter(&mState, StateCall::Scissor);
     mState.setScissorParams(x, y, width, height);
 }
 
 void Context::stencilFuncSeparate(GLenum face, GLenum func, GLint ref, GLuint mask)
+{
+    ScopedStateCallCounter counter(&mState, StateCall::StencilFuncSeparate);
+    setStencilFuncs(face, func, ref, mask);
+}
+
+void Context::setStencilFuncs(GLenum face, GLenum func, GLint ref, GLuint mask)
 {
     GLint clampedRef = gl::clamp(ref, 0, std::numeric_limits<uint8_t>::max());
     if (face == GL_FRONT || face == GL_FRONT_AND_BACK)
@@ -5103,6 +5216,12 @@ void Context::stencilFuncSeparate(GLenum face, GLenum func, GLint ref, GLuint ma
 }
 
 void Context::stencilMaskSeparate(GLenum face, GLuint mask)
+{
+    ScopedStateCallCounter counter(&mState, StateCall::StencilMaskSeparate);
+    setStencilWritemasks(face, mask);
+}
+
+void Context::setStencilWritemasks(GLenum face, GLuint mask)
 {
     if (face == GL_FRONT || face == GL_FRONT_AND_BACK)
     {
@@ -5118,6 +5237,12 @@ void Context::stencilMaskSeparate(GLenum face, GLuint mask)
 }
 
 void Context::stencilOpSeparate(GLenum face, GLenum fail, GLenum zfail, GLenum zpass)
+{
+    ScopedStateCallCounter counter(&mState, StateCall::StencilOpSeparate);
+    setStencilOperations(face, fail, zfail, zpass);
+}
+
+void Context::setStencilOperations(GLenum face, GLenum fail, GLenum zfail, GLenum zpass)
 {
     if (face == GL_FRONT || face == GL_FRONT_AND_BACK)
     {
@@ -5231,6 +5356,7 @@ void Context::vertexBindingDivisor(GLuint bindingIndex, GLuint divisor)
 
 void Context::viewport(GLint x, GLint y, GLsizei width, GLsizei height)
 {
+    ScopedStateCallCounter counter(&mState, StateCall::Viewport);
     mState.setViewportParams(x, y, width, height);
 }
 
@@ -5502,12 +5628,21 @@ void Context::bindBufferRange(BufferBinding target,
     }
     else
     {
+        if (target == BufferBinding::AtomicCounter)
+        {
+            mAtomicCounterBufferObserverBindings[index].bind(object);
+        }
+        else if (target == BufferBinding::ShaderStorage)
+        {
+            mShaderStorageBufferObserverBindings[index].bind(object);
+        }
         mStateCache.onBufferBindingChange(this);
     }
 }
 
 void Context::bindFramebuffer(GLenum target, FramebufferID framebuffer)
 {
+    ScopedStateCallCounter counter(&mState, StateCall::BindFramebuffer);
     if (target == GL_READ_FRAMEBUFFER || target == GL_FRAMEBUFFER)
     {
         bindReadFramebuffer(framebuffer);
@@ -5521,6 +5656,7 @@ void Context::bindFramebuffer(GLenum target, FramebufferID framebuffer)
 
 void Context::bindRenderbuffer(GLenum target, RenderbufferID renderbuffer)
 {
+    ScopedStateCallCounter counter(&mState, StateCall::BindRenderbuffer);
     ASSERT(target == GL_RENDERBUFFER);
     Renderbuffer *object = mState.mRenderbufferManager->checkRenderbufferAllocation(
         mImplementation.get(), renderbuffer);
@@ -5757,37 +5893,8 @@ void Context::multiDrawArrays(PrimitiveMode mode,
                               GLsizei drawcount)
 {
     ANGLE_CONTEXT_TRY(prepareForDraw(mode));
-    Program *programObject = mState.getLinkedProgram(this);
-    const bool hasDrawID   = programObject && programObject->hasDrawIDUniform();
-    if (hasDrawID)
-    {
-        for (GLsizei drawID = 0; drawID < drawcount; ++drawID)
-        {
-            if (noopDraw(mode, counts[drawID]))
-            {
-                continue;
-            }
-            programObject->setDrawIDUniform(drawID);
-            ANGLE_CONTEXT_TRY(
-                mImplementation->drawArrays(this, mode, firsts[drawID], counts[drawID]));
-            MarkTransformFeedbackBufferUsage(this, counts[drawID], 1);
-            MarkShaderStorageBufferUsage(this);
-        }
-    }
-    else
-    {
-        for (GLsizei drawID = 0; drawID < drawcount; ++drawID)
-        {
-            if (noopDraw(mode, counts[drawID]))
-            {
-                continue;
-            }
-            ANGLE_CONTEXT_TRY(
-                mImplementation->drawArrays(this, mode, firsts[drawID], counts[drawID]));
-            MarkTransformFeedbackBufferUsage(this, counts[drawID], 1);
-            MarkShaderStorageBufferUsage(this);
-        }
-    }
+    ANGLE_CONTEXT_TRY(mImplementation->multiDrawArrays(this, mode, firsts, counts, drawcount));
+    MarkShaderStorageBufferUsage(this);
 }
 
 void Context::multiDrawArraysInstanced(PrimitiveMode mode,
@@ -5797,37 +5904,9 @@ void Context::multiDrawArraysInstanced(PrimitiveMode mode,
                                        GLsizei drawcount)
 {
     ANGLE_CONTEXT_TRY(prepareForDraw(mode));
-    Program *programObject = mState.getLinkedProgram(this);
-    const bool hasDrawID   = programObject && programObject->hasDrawIDUniform();
-    if (hasDrawID)
-    {
-        for (GLsizei drawID = 0; drawID < drawcount; ++drawID)
-        {
-            if (noopDrawInstanced(mode, counts[drawID], instanceCounts[drawID]))
-            {
-                continue;
-            }
-            programObject->setDrawIDUniform(drawID);
-            ANGLE_CONTEXT_TRY(mImplementation->drawArraysInstanced(
-                this, mode, firsts[drawID], counts[drawID], instanceCounts[drawID]));
-            MarkTransformFeedbackBufferUsage(this, counts[drawID], instanceCounts[drawID]);
-            MarkShaderStorageBufferUsage(this);
-        }
-    }
-    else
-    {
-        for (GLsizei drawID = 0; drawID < drawcount; ++drawID)
-        {
-            if (noopDrawInstanced(mode, counts[drawID], instanceCounts[drawID]))
-            {
-                continue;
-            }
-            ANGLE_CONTEXT_TRY(mImplementation->drawArraysInstanced(
-                this, mode, firsts[drawID], counts[drawID], instanceCounts[drawID]));
-            MarkTransformFeedbackBufferUsage(this, counts[drawID], instanceCounts[drawID]);
-            MarkShaderStorageBufferUsage(this);
-        }
-    }
+    ANGLE_CONTEXT_TRY(mImplementation->multiDrawArraysInstanced(this, mode, firsts, counts,
+                                                                instanceCounts, drawcount));
+    MarkShaderStorageBufferUsage(this);
 }
 
 void Context::multiDrawElements(PrimitiveMode mode,
@@ -5837,35 +5916,9 @@ void Context::multiDrawElements(PrimitiveMode mode,
                                 GLsizei drawcount)
 {
     ANGLE_CONTEXT_TRY(prepareForDraw(mode));
-    Program *programObject = mState.getLinkedProgram(this);
-    const bool hasDrawID   = programObject && programObject->hasDrawIDUniform();
-    if (hasDrawID)
-    {
-        for (GLsizei drawID = 0; drawID < drawcount; ++drawID)
-        {
-            if (noopDraw(mode, counts[drawID]))
-            {
-                continue;
-            }
-            programObject->setDrawIDUniform(drawID);
-            ANGLE_CONTEXT_TRY(
-                mImplementation->drawElements(this, mode, counts[drawID], type, indices[drawID]));
-            MarkShaderStorageBufferUsage(this);
-        }
-    }
-    else
-    {
-        for (GLsizei drawID = 0; drawID < drawcount; ++drawID)
-        {
-            if (noopDraw(mode, counts[drawID]))
-            {
-                continue;
-            }
-            ANGLE_CONTEXT_TRY(
-                mImplementation->drawElements(this, mode, counts[drawID], type, indices[drawID]));
-            MarkShaderStorageBufferUsage(this);
-        }
-    }
+    ANGLE_CONTEXT_TRY(
+        mImplementation->multiDrawElements(this, mode, counts, type, indices, drawcount));
+    MarkShaderStorageBufferUsage(this);
 }
 
 void Context::multiDrawElementsInstanced(PrimitiveMode mode,
@@ -5876,35 +5929,9 @@ void Context::multiDrawElementsInstanced(PrimitiveMode mode,
                                          GLsizei drawcount)
 {
     ANGLE_CONTEXT_TRY(prepareForDraw(mode));
-    Program *programObject = mState.getLinkedProgram(this);
-    const bool hasDrawID   = programObject && programObject->hasDrawIDUniform();
-    if (hasDrawID)
-    {
-        for (GLsizei drawID = 0; drawID < drawcount; ++drawID)
-        {
-            if (noopDrawInstanced(mode, counts[drawID], instanceCounts[drawID]))
-            {
-                continue;
-            }
-            programObject->setDrawIDUniform(drawID);
-            ANGLE_CONTEXT_TRY(mImplementation->drawElementsInstanced(
-                this, mode, counts[drawID], type, indices[drawID], instanceCounts[drawID]));
-            MarkShaderStorageBufferUsage(this);
-        }
-    }
-    else
-    {
-        for (GLsizei drawID = 0; drawID < drawcount; ++drawID)
-        {
-            if (noopDrawInstanced(mode, counts[drawID], instanceCounts[drawID]))
-            {
-                continue;
-            }
-            ANGLE_CONTEXT_TRY(mImplementation->drawElementsInstanced(
-                this, mode, counts[drawID], type, indices[drawID], instanceCounts[drawID]));
-            MarkShaderStorageBufferUsage(this);
-        }
-    }
+    ANGLE_CONTEXT_TRY(mImplementation->multiDrawElementsInstanced(this, mode, counts, type, indices,
+                                                                  instanceCounts, drawcount));
+    MarkShaderStorageBufferUsage(this);
 }
 
 namespace
@@ -6710,17 +6737,20 @@ void Context::shaderSource(ShaderProgramID shader,
 
 void Context::stencilFunc(GLenum func, GLint ref, GLuint mask)
 {
-    stencilFuncSeparate(GL_FRONT_AND_BACK, func, ref, mask);
+    ScopedStateCallCounter counter(&mState, StateCall::StencilFunc);
+    setStencilFuncs(GL_FRONT_AND_BACK, func, ref, mask);
 }
 
 void Context::stencilMask(GLuint mask)
 {
-    stencilMaskSeparate(GL_FRONT_AND_BACK, mask);
+    ScopedStateCallCounter counter(&mState, StateCall::StencilMask);
+    setStencilWritemasks(GL_FRONT_AND_BACK, mask);
 }
 
 void Context::stencilOp(GLenum fail, GLenum zfail, GLenum zpass)
 {
-    stencilOpSeparate(GL_FRONT_AND_BACK, fail, zfail, zpass);
+    ScopedStateCallCounter counter(&mState, StateCall::StencilOp);
+    setStencilOperations(GL_FRONT_AND_BACK, fail, zfail, zpass);
 }
 
 void Context::patchParameteri(GLenum pname, GLint value)
@@ -8770,6 +8800,18 @@ bool Context::getQueryParameterInfo(GLenum pname, GLenum *type, unsigned int *nu
         }
     }
 
+    if (getExtensions().stateCallStatistics)
+    {
+        switch (pname)
+        {
+            case GL_EFFECTIVE_STATE_CALLS_ANGLE:
+            case GL_REDUNDANT_STATE_CALLS_ANGLE:
+                *type      = GL_INT_64_ANGLEX;
+                *numParams = 1;
+                return true;
+        }
+    }
+
     if (getExtensions().textureMultisample)
     {
         switch (pname)
@@ -8909,6 +8951,20 @@ bool Context::getIndexedQueryParameterInfo(GLenum target,
         }
     }
 
+    if (getExtensions().stateCallStatistics)
+    {
+        switch (target)
+        {
+            case GL_EFFECTIVE_STATE_CALLS_ANGLE:
+            case GL_REDUNDANT_STATE_CALLS_ANGLE:
+            {
+                *type      = GL_INT_64_ANGLEX;
+                *numParams = 1;
+                return true;
+            }
+        }
+    }
+
     if (getClientVersion() < Version(3, 1))
     {
         return false;
@@ -9076,6 +9132,23 @@ void Context::onSubjectStateChange(angle::SubjectIndex index, angle::SubjectMess
                 mState.onUniformBufferStateChange(index - kUniformBuffer0SubjectIndex);
                 mStateCache.onUniformBufferStateChange(this);
             }
+            else if (index < kAtomicCounterBufferMaxSubjectIndex)
+            {
+                // Only a change of storage affects the binding.
+                if (message == angle::SubjectMessage::SubjectChanged)
+                {
+                    mState.onAtomicCounterBufferStateChange(index -
+                                                            kAtomicCounterBuffer0SubjectIndex);
+                }
+            }
+            else if (index < kShaderStorageBufferMaxSubjectIndex)
+            {
+                if (message == angle::SubjectMessage::SubjectChanged)
+                {
+                    mState.onShaderStorageBufferStateChange(index -
+                                                            kShaderStorageBuffer0SubjectIndex);
+                }
+            }
             else
             {
                 ASSERT(index < kSamplerMaxSubjectIndex);
@@ -9282,7 +9355,9 @@ StateCache::StateCache()
       mCachedBasicDrawStatesError(kInvalidPointer),
       mCachedBasicDrawElementsError(kInvalidPointer),
       mCachedTransformFeedbackActiveUnpaused(false)
-{}
+{
+    mCachedDrawVerdicts.fill(0);
+}
 
 StateCache::~StateCache() = default;
 
@@ -9377,11 +9452,42 @@ void StateCache::updateVertexElementLimitsImpl(Context *context)
 void StateCache::updateBasicDrawStatesError()
 {
     mCachedBasicDrawStatesError = kInvalidPointer;
+    invalidateDrawVerdicts();
 }
 
 void StateCache::updateBasicDrawElementsError()
 {
     mCachedBasicDrawElementsError = kInvalidPointer;
+    invalidateDrawVerdicts();
+}
+
+void StateCache::invalidateDrawVerdicts()
+{
+    mCachedDrawVerdicts.fill(0);
+}
+
+void StateCache::updateDrawVerdicts(Context *context) const
+{
+    uint8_t verdict = 0;
+    if (getBasicDrawStatesError(context) == 0)
+    {
+        verdict = kDrawArraysVerdict;
+        if (getBasicDrawElementsError(context) == 0)
+        {
+            for (DrawElementsType type : angle::AllEnums<DrawElementsType>())
+            {
+                if (mCachedValidDrawElementsTypes[type])
+                {
+                    verdict |= GetDrawElementsVerdict(type);
+                }
+            }
+        }
+    }
+
+    for (PrimitiveMode mode : angle::AllEnums<PrimitiveMode>())
+    {
+        mCachedDrawVerdicts[mode] = mCachedValidDrawModes[mode] ? verdict : 0;
+    }
 }
 
 intptr_t StateCache::getBasicDrawStatesErrorImpl(Context *context) const
@@ -9512,6 +9618,8 @@ void StateCache::setValidDrawModes(bool pointsOK,
 
 void StateCache::updateValidDrawModes(Context *context)
 {
+    invalidateDrawVerdicts();
+
     const State &state = context->getState();
     Program *program   = state.getProgram();
 
@@ -9586,6 +9694,8 @@ void StateCache::updateValidBindTextureTypes(Context *context)
 
 void StateCache::updateValidDrawElementsTypes(Context *context)
 {
+    invalidateDrawVerdicts();
+
     bool supportsUint =
         (context->getClientMajorVersion() >= 3 || context->getExtensions().elementIndexUint);
 
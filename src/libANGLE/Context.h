@@ -10,6 +10,8 @@
 #ifndef LIBANGLE_CONTEXT_H_
 #define LIBANGLE_CONTEXT_H_
 
+#include <memory>
+#include <mutex>
 #include <set>
 #include <string>
 
@@ -44,6 +46,7 @@
 #include "libANGLE/Context_gles_3_1_autogen.h"
 #include "libANGLE/Context_gles_3_2_autogen.h"
 #include "libANGLE/Context_gles_ext_autogen.h"
+#include "libANGLE/DeferredCommandQueue.h"
 #include "libANGLE/Error.h"
 #include "libANGLE/HandleAllocator.h"
 #include "libANGLE/RefCountObject.h"
@@ -82,6 +85,7 @@ class FenceNV;
 class Framebuffer;
 class GLES1Renderer;
 class MemoryProgramCache;
+class MemoryShaderCache;
 class MemoryObject;
 class Program;
 class ProgramPipeline;
@@ -219,6 +223,27 @@ class StateCache final : angle::NonCopyable
         return mCachedValidDrawModes[primitiveMode];
     }
 
+    // Places that can trigger invalidateDrawVerdicts:
+    // 1. updateValidDrawModes.
+    // 2. updateValidDrawElementsTypes.
+    // 3. updateBasicDrawStatesError.
+    // 4. updateBasicDrawElementsError.
+    // The verdicts combine the draw mode, basic draw states and basic draw elements checks per
+    // primitive mode and index type, so a draw that passes all of them costs a single lookup. An
+    // invalidated verdict reads as invalid and sends the draw down the full validation, which
+    // calls updateDrawVerdicts once it passes.
+    bool isDrawArraysVerdictValid(PrimitiveMode primitiveMode) const
+    {
+        return (mCachedDrawVerdicts[primitiveMode] & kDrawArraysVerdict) != 0;
+    }
+
+    bool isDrawElementsVerdictValid(PrimitiveMode primitiveMode, DrawElementsType type) const
+    {
+        return (mCachedDrawVerdicts[primitiveMode] & GetDrawElementsVerdict(type)) != 0;
+    }
+
+    void updateDrawVerdicts(Context *context) const;
+
     // Cannot change except on Context/Extension init.
     bool isValidBindTextureType(TextureType type) const
     {
@@ -289,6 +314,8 @@ class StateCache final : angle::NonCopyable
     void updateVertexAttribTypesValidation(Context *context);
     void updateActiveShaderStorageBufferIndices(Context *context);
 
+    void invalidateDrawVerdicts();
+
     void setValidDrawModes(bool pointsOK, bool linesOK, bool trisOK, bool lineAdjOK, bool triAdjOK);
 
     intptr_t getBasicDrawStatesErrorImpl(Context *context) const;
@@ -296,6 +323,14 @@ class StateCache final : angle::NonCopyable
 
     static constexpr intptr_t kInvalidPointer = 1;
 
+    // Bit 0 of a draw verdict is set when DrawArrays passes, and bit 1 + type when DrawElements
+    // with that index type passes.  DrawElementsType::InvalidEnum maps to a bit that is never set.
+    static constexpr uint8_t kDrawArraysVerdict = 1;
+    static constexpr uint8_t GetDrawElementsVerdict(DrawElementsType type)
+    {
+        return static_cast<uint8_t>(2u << static_cast<uint8_t>(type));
+    }
+
     AttributesMask mCachedActiveBufferedAttribsMask;
     AttributesMask mCachedActiveClientAttribsMask;
     AttributesMask mCachedActiveDefaultAttribsMask;
@@ -322,6 +357,9 @@ class StateCache final : angle::NonCopyable
                          VertexAttribTypeCase,
                          angle::EnumSize<VertexAttribType>() + 1>
         mCachedIntegerVertexAttribTypesValidation;
+
+    mutable angle::PackedEnumMap<PrimitiveMode, uint8_t, angle::EnumSize<PrimitiveMode>() + 1>
+        mCachedDrawVerdicts;
 };
 
 class Context final : public egl::LabeledObject, angle::NonCopyable, public angle::ObserverInterface
@@ -332,6 +370,7 @@ class Context final : public egl::LabeledObject, angle::NonCopyable, public angl
             const Context *shareContext,
             TextureManager *shareTextures,
             MemoryProgramCache *memoryProgramCache,
+            MemoryShaderCache *memoryShaderCache,
             const EGLenum clientType,
             const egl::AttributeMap &attribs,
             const egl::DisplayExtensions &displayExtensions,
@@ -484,6 +523,7 @@ class Context final : public egl::LabeledObject, angle::NonCopyable, public angl
     angle::Result prepareForDispatch();
 
     MemoryProgramCache *getMemoryProgramCache() const { return mMemoryProgramCache; }
+    MemoryShaderCache *getMemoryShaderCache() const { return mMemoryShaderCache; }
 
     bool hasBeenCurrent() const { return mHasBeenCurrent; }
     egl::Display *getDisplay() const { return mDisplay; }
@@ -503,6 +543,24 @@ class Context final : public egl::LabeledObject, angle::NonCopyable, public angl
     // Once a context is setShared() it cannot be undone
     void setShared() { mShared = true; }
 
+    // Shared contexts serialize their GL calls on a mutex owned by their share group, so that
+    // contexts in different share groups don't contend with each other.
+    const std::shared_ptr<std::mutex> &getShareGroupMutex() const { return mShareGroupMutex; }
+
+    // Contexts created with EGL_CONTEXT_DEFERRED_EXECUTION_ANGLE queue some calls to a worker
+    // thread.  Every other call waits for the queued ones to run first.
+    bool isDeferred() const { return mDeferredCommandQueue != nullptr; }
+    DeferredCommandQueue *getDeferredCommandQueue() const { return mDeferredCommandQueue.get(); }
+
+    // Deferred calls run after the application has returned from them, so draws that read
+    // client memory can't be deferred.  The calls that change the vertex arrays aren't deferred,
+    // so this can be queried while the worker thread runs.
+    bool canDeferDraw() const { return !mStateCache.hasAnyEnabledClientAttrib(); }
+    bool canDeferDrawElements() const
+    {
+        return canDeferDraw() && mState.getVertexArray()->getElementArrayBuffer() != nullptr;
+    }
+
     const State &getState() const { return mState; }
     GLint getClientMajorVersion() const { return mState.getClientMajorVersion(); }
     GLint getClientMinorVersion() const { return mState.getClientMinorVersion(); }
@@ -612,6 +670,11 @@ class Context final : public egl::LabeledObject, angle::NonCopyable, public angl
     // A small helper method to facilitate using the ANGLE_CONTEXT_TRY macro.
     void tryGenPaths(GLsizei range, PathID *createdOut);
 
+    // Shared by the stencil calls with and without a face.
+    void setStencilFuncs(GLenum face, GLenum func, GLint ref, GLuint mask);
+    void setStencilWritemasks(GLenum face, GLuint mask);
+    void setStencilOperations(GLenum face, GLenum fail, GLenum zfail, GLenum zpass);
+
     egl::Error setDefaultFramebuffer(egl::Surface *drawSurface, egl::Surface *readSurface);
     egl::Error unsetDefaultFramebuffer();
 
@@ -630,6 +693,7 @@ class Context final : public egl::LabeledObject, angle::NonCopyable, public angl
 
     State mState;
     bool mShared;
+    std::shared_ptr<std::mutex> mShareGroupMutex;
     bool mSkipValidation;
     bool mDisplayTextureShareGroup;
 
@@ -693,6 +757,7 @@ class Context final : public egl::LabeledObject, angle::NonCopyable, public angl
     bool mBufferAccessValidationEnabled;
     const bool mExtensionsEnabled;
     MemoryProgramCache *mMemoryProgramCache;
+    MemoryShaderCache *mMemoryShaderCache;
 
     State::DirtyObjects mDrawDirtyObjects;
     State::DirtyObjects mPathOperationDirtyObjects;
@@ -718,6 +783,8 @@ class Context final : public egl::LabeledObject, angle::NonCopyable, public angl
     angle::ObserverBinding mDrawFramebufferObserverBinding;
     angle::ObserverBinding mReadFramebufferObserverBinding;
     std::vector<angle::ObserverBinding> mUniformBufferObserverBindings;
+    std::vector<angle::ObserverBinding> mAtomicCounterBufferObserverBindings;
+    std::vector<angle::ObserverBinding> mShaderStorageBufferObserverBindings;
     std::vector<angle::ObserverBinding> mSamplerObserverBindings;
     std::vector<angle::ObserverBinding> mImageObserverBindings;
 
@@ -731,6 +798,9 @@ class Context final : public egl::LabeledObject, angle::NonCopyable, public angl
     std::unique_ptr<angle::FrameCapture> mFrameCapture;
 
     OverlayType mOverlay;
+
+    // Declared last, so that the worker thread stops before anything it uses is destroyed.
+    std::unique_ptr<DeferredCommandQueue> mDeferredCommandQueue;
 };
 
 }  // namespace gl
@@ -136,6 +136,7 @@ ANGLE_INLINE void StateCache::onBufferBindingChange(Context *context)
 
 ANGLE_INLINE void Context::bindBuffer(BufferBinding target, BufferID buffer)
 {
+    ScopedStateCallCounter counter(&mState, StateCall::BindBuffer);
     Buffer *bufferObject =
         mState.mBufferManager->checkBufferAllocation(mImplementation.get(), buffer);
     mState.setBufferBinding(this, target, bufferObject);
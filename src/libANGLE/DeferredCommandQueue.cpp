@@ -0,0 +1,123 @@
+//
+// Copyright 2019 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// DeferredCommandQueue.cpp:
+//   Implements the queue of calls that a deferred context runs on its worker thread.
+//
+
+#include "libANGLE/DeferredCommandQueue.h"
+
+namespace gl
+{
+namespace
+{
+// Calls usually come in bursts, so the worker polls for a while before it goes to sleep.
+constexpr int kSpinCount = 2000;
+}  // anonymous namespace
+
+DeferredCommandQueue::DeferredCommandQueue(Context *context)
+    : mContext(context),
+      mWriteIndex(0),
+      mPublishedWriteIndex(0),
+      mReadIndex(0),
+      mWorkerSleeping(false),
+      mWaiterCount(0),
+      mStopping(false)
+{
+    mThread = std::thread(&DeferredCommandQueue::threadLoop, this);
+}
+
+DeferredCommandQueue::~DeferredCommandQueue()
+{
+    finish();
+
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mStopping = true;
+    }
+    mWorkAvailable.notify_one();
+    mThread.join();
+}
+
+void DeferredCommandQueue::publish()
+{
+    // Sequentially consistent with the worker's store to mWorkerSleeping: either the worker sees
+    // the new write index before it sleeps, or this sees that it sleeps and wakes it up.
+    mPublishedWriteIndex.store(mWriteIndex);
+    if (mWorkerSleeping.load())
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mWorkAvailable.notify_one();
+    }
+}
+
+void DeferredCommandQueue::finish()
+{
+    // mWriteIndex belongs to the producer, which may be another thread.  The producer publishes
+    // every call it pushes, so for the producer itself this is the same index.  The indices only
+    // grow.
+    size_t targetIndex = mPublishedWriteIndex.load();
+    if (mReadIndex.load(std::memory_order_acquire) >= targetIndex)
+    {
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock(mMutex);
+    mWaiterCount.fetch_add(1);
+    mQueueDrained.wait(lock, [this, targetIndex]() { return mReadIndex.load() >= targetIndex; });
+    mWaiterCount.fetch_sub(1);
+}
+
+void DeferredCommandQueue::threadLoop()
+{
+    size_t readIndex = 0;
+    int spins        = 0;
+
+    while (true)
+    {
+        size_t writeIndex = mPublishedWriteIndex.load(std::memory_order_acquire);
+        if (readIndex != writeIndex)
+        {
+            for (; readIndex != writeIndex; ++readIndex)
+            {
+                const Slot &slot = mSlots[readIndex % kSlotCount];
+                slot.execute(mContext, slot.storage);
+                mReadIndex.store(readIndex + 1, std::memory_order_release);
+            }
+
+            // Same handshake as in publish(), with the threads waiting in finish().  Each may wait
+            // for a different index, so all are woken up.
+            mReadIndex.store(readIndex);
+            if (mWaiterCount.load() > 0)
+            {
+                std::lock_guard<std::mutex> lock(mMutex);
+                mQueueDrained.notify_all();
+            }
+            spins = 0;
+            continue;
+        }
+
+        if (spins < kSpinCount)
+        {
+            ++spins;
+            std::this_thread::yield();
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(mMutex);
+        mWorkerSleeping.store(true);
+        mWorkAvailable.wait(lock, [this, readIndex]() {
+            return mStopping || mPublishedWriteIndex.load() != readIndex;
+        });
+        mWorkerSleeping.store(false);
+
+        if (mStopping && mPublishedWriteIndex.load() == readIndex)
+        {
+            break;
+        }
+        spins = 0;
+    }
+}
+}  // namespace gl
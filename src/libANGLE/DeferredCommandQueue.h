@@ -0,0 +1,128 @@
+//
+// Copyright 2019 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// DeferredCommandQueue.h:
+//   Carries the GL calls of a context created with EGL_CONTEXT_DEFERRED_EXECUTION_ANGLE from the
+//   thread the context is current on to a worker thread owned by the context.  The queue is a
+//   ring of fixed-size slots with one producer and one consumer, so pushing a call takes no lock
+//   unless the worker is asleep.
+//
+
+#ifndef LIBANGLE_DEFERREDCOMMANDQUEUE_H_
+#define LIBANGLE_DEFERREDCOMMANDQUEUE_H_
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "common/angleutils.h"
+
+namespace gl
+{
+class Context;
+
+class DeferredCommandQueue final : angle::NonCopyable
+{
+  public:
+    explicit DeferredCommandQueue(Context *context);
+    // Runs the remaining calls and stops the worker thread.
+    ~DeferredCommandQueue();
+
+    // Queues a call to |function| with the given arguments.  The arguments are copied, so they
+    // must not point to memory the application may change after the call returns.
+    template <typename... Params, typename... Args>
+    void push(void (*function)(Context *, Params...), Args &&... args);
+
+    // Waits until the worker thread has run all queued calls.  Other threads may call this while
+    // the producer keeps pushing; they wait for the calls published when they started waiting.
+    void finish();
+
+  private:
+    static constexpr size_t kSlotSize  = 64;
+    static constexpr size_t kSlotCount = 1024;
+
+    using ExecuteFunction = void (*)(Context *context, const void *storage);
+
+    struct Slot
+    {
+        ExecuteFunction execute;
+        alignas(alignof(void *)) uint8_t storage[kSlotSize - sizeof(ExecuteFunction)];
+    };
+
+    template <typename... Params>
+    struct Command
+    {
+        static void Execute(Context *context, const void *storage)
+        {
+            const Command *command = static_cast<const Command *>(storage);
+            command->call(context, std::index_sequence_for<Params...>());
+        }
+
+        template <size_t... Indices>
+        void call(Context *context, std::index_sequence<Indices...>) const
+        {
+            function(context, std::get<Indices>(params)...);
+        }
+
+        void (*function)(Context *, Params...);
+        std::tuple<Params...> params;
+    };
+
+    void publish();
+    void threadLoop();
+
+    Context *mContext;
+
+    // Only touched by the producer.
+    size_t mWriteIndex;
+    // The write index as last published to the worker, and the read index as last published by
+    // the worker.
+    std::atomic<size_t> mPublishedWriteIndex;
+    std::atomic<size_t> mReadIndex;
+
+    // The worker sleeps on mWorkAvailable when the queue is empty, and threads in finish() sleep
+    // on mQueueDrained.  The flag and the waiter count tell the other side to take the mutex and
+    // notify.
+    std::mutex mMutex;
+    std::condition_variable mWorkAvailable;
+    std::condition_variable mQueueDrained;
+    std::atomic<bool> mWorkerSleeping;
+    std::atomic<uint32_t> mWaiterCount;
+    bool mStopping;
+
+    std::array<Slot, kSlotCount> mSlots;
+    std::thread mThread;
+};
+
+template <typename... Params, typename... Args>
+void DeferredCommandQueue::push(void (*function)(Context *, Params...), Args &&... args)
+{
+    using CommandType = Command<typename std::decay<Params>::type...>;
+    static_assert(sizeof(CommandType) <= sizeof(Slot::storage), "Call arguments don't fit a slot");
+    static_assert(std::is_trivially_destructible<CommandType>::value,
+                  "Call arguments must be trivially destructible");
+
+    // A full ring waits for the worker to catch up.
+    if (mWriteIndex - mReadIndex.load(std::memory_order_acquire) == kSlotCount)
+    {
+        finish();
+    }
+
+    Slot &slot   = mSlots[mWriteIndex % kSlotCount];
+    slot.execute = &CommandType::Execute;
+    new (slot.storage) CommandType{function, std::make_tuple(std::forward<Args>(args)...)};
+    mWriteIndex++;
+
+    publish();
+}
+}  // namespace gl
+
+#endif  // LIBANGLE_DEFERREDCOMMANDQUEUE_H_
@@ -27,6 +27,7 @@
 #include "common/string_utils.h"
 #include "common/system_utils.h"
 #include "common/utilities.h"
+#include "libANGLE/BlobCacheDiskStore.h"
 #include "libANGLE/Context.h"
 #include "libANGLE/Device.h"
 #include "libANGLE/EGLSync.h"
@@ -91,6 +92,17 @@ namespace egl
 namespace
 {
 
+// The on-disk blob cache is opt-in.  ANGLE_BLOB_CACHE_DIR names an existing directory to keep the
+// cache files in, and ANGLE_BLOB_CACHE_SIZE optionally overrides the size budget in bytes.
+constexpr char kBlobCacheDirectoryEnvVar[] = "ANGLE_BLOB_CACHE_DIR";
+constexpr char kBlobCacheSizeEnvVar[]      = "ANGLE_BLOB_CACHE_SIZE";
+constexpr char kBlobCacheFileName[]        = "angle_blob_cache";
+constexpr size_t kDefaultBlobCacheDiskSize = 64 * 1024 * 1024;
+
+// Translated shaders are kept in a separate file with a smaller budget.
+constexpr char kShaderBlobCacheFileName[]        = "angle_shader_cache";
+constexpr size_t kDefaultShaderBlobCacheDiskSize = 16 * 1024 * 1024;
+
 typedef std::map<EGLNativeWindowType, Surface *> WindowSurfaceMap;
 // Get a map of all EGL window surfaces to validate that no window has more than one EGL surface
 // associated with it.
@@ -499,6 +511,8 @@ Display::Display(EGLenum platform, EGLNativeDisplayType displayId, Device *eglDe
       mTextureManager(nullptr),
       mBlobCache(gl::kDefaultMaxProgramCacheMemoryBytes),
       mMemoryProgramCache(mBlobCache),
+      mShaderBlobCache(gl::kDefaultMaxShaderCacheMemoryBytes, "GPU.ANGLE.ShaderCache.CacheResult"),
+      mMemoryShaderCache(mShaderBlobCache),
       mGlobalTextureShareGroupUsers(0)
 {}
 
@@ -579,6 +593,7 @@ Error Display::initialize()
 {
     ASSERT(mImplementation != nullptr);
     mImplementation->setBlobCache(&mBlobCache);
+    initBlobCacheDiskStore();
 
     gl::InitializeDebugAnnotations(&mAnnotator);
 
@@ -670,6 +685,8 @@ Error Display::terminate(const Thread *thread)
 
     mMemoryProgramCache.clear();
     mBlobCache.setBlobCacheFuncs(nullptr, nullptr);
+    mShaderBlobCache.clear();
+    mShaderBlobCache.setBlobCacheFuncs(nullptr, nullptr);
 
     while (!mContextSet.empty())
     {
@@ -712,6 +729,10 @@ Error Display::terminate(const Thread *thread)
 
     mImplementation->terminate();
 
+    // The implementation may have stored blobs (such as its pipeline cache) while terminating.
+    mBlobCache.flushDiskStore();
+    mShaderBlobCache.flushDiskStore();
+
     mDeviceLost = false;
 
     mInitialized = false;
@@ -937,14 +958,16 @@ Error Display::createContext(const Config *configuration,
         ASSERT((mTextureManager == nullptr) == (mGlobalTextureShareGroupUsers == 0));
         if (mTextureManager == nullptr)
         {
-            mTextureManager = new gl::TextureManager();
+            mTextureManager         = new gl::TextureManager();
+            mTextureShareGroupMutex = std::make_shared<std::mutex>();
         }
 
         mGlobalTextureShareGroupUsers++;
         shareTextures = mTextureManager;
     }
 
-    gl::MemoryProgramCache *cachePointer = &mMemoryProgramCache;
+    gl::MemoryProgramCache *cachePointer      = &mMemoryProgramCache;
+    gl::MemoryShaderCache *shaderCachePointer = &mMemoryShaderCache;
 
     // Check context creation attributes to see if we are using EGL_ANGLE_program_cache_control.
     // If not, keep caching enabled for EGL_ANDROID_blob_cache, which can have its callbacks set
@@ -953,6 +976,10 @@ Error Display::createContext(const Config *configuration,
         mAttributeMap.contains(EGL_CONTEXT_PROGRAM_BINARY_CACHE_ENABLED_ANGLE);
     if (usesProgramCacheControl)
     {
+        // The application manages the contents of the cache, which it expects to only hold
+        // program binaries, so translated shaders aren't cached.
+        shaderCachePointer = nullptr;
+
         bool programCacheControlEnabled =
             (mAttributeMap.get(EGL_CONTEXT_PROGRAM_BINARY_CACHE_ENABLED_ANGLE, GL_FALSE) ==
              GL_TRUE);
@@ -964,12 +991,26 @@ Error Display::createContext(const Config *configuration,
     }
 
     gl::Context *context =
-        new gl::Context(this, configuration, shareContext, shareTextures, cachePointer, clientType,
-                        attribs, mDisplayExtensions, GetClientExtensions());
+        new gl::Context(this, configuration, shareContext, shareTextures, cachePointer,
+                        shaderCachePointer, clientType, attribs, mDisplayExtensions,
+                        GetClientExtensions());
     if (shareContext != nullptr)
     {
         shareContext->setShared();
     }
+    if (usingDisplayTextureShareGroup && mGlobalTextureShareGroupUsers > 1)
+    {
+        // The display's textures are now reachable from several contexts, which all have to take
+        // the share group lock.
+        context->setShared();
+        for (gl::Context *otherContext : mContextSet)
+        {
+            if (otherContext->usingDisplayTextureShareGroup())
+            {
+                otherContext->setShared();
+            }
+        }
+    }
 
     ASSERT(context != nullptr);
     mContextSet.insert(context);
@@ -1111,6 +1152,7 @@ Error Display::destroyContext(const Thread *thread, gl::Context *context)
             // exists
             mTextureManager->release(context);
             mTextureManager = nullptr;
+            mTextureShareGroupMutex.reset();
         }
         mGlobalTextureShareGroupUsers--;
     }
@@ -1173,6 +1215,7 @@ void Display::notifyDeviceLost()
 void Display::setBlobCacheFuncs(EGLSetBlobFuncANDROID set, EGLGetBlobFuncANDROID get)
 {
     mBlobCache.setBlobCacheFuncs(set, get);
+    mShaderBlobCache.setBlobCacheFuncs(set, get);
     mImplementation->setBlobCacheFuncs(set, get);
 }
 
@@ -1424,6 +1467,50 @@ void Display::initVendorString()
     mVendorString = mImplementation->getVendorString();
 }
 
+void Display::initBlobCacheDiskStore()
+{
+    if (mBlobCache.getDiskStore() != nullptr)
+    {
+        return;
+    }
+
+    std::string directory = angle::GetEnvironmentVar(kBlobCacheDirectoryEnvVar);
+    if (directory.empty())
+    {
+        return;
+    }
+
+    if (!angle::IsDirectory(directory.c_str()))
+    {
+        WARN() << kBlobCacheDirectoryEnvVar << " is not a directory: " << directory;
+        return;
+    }
+
+    size_t maxSize            = kDefaultBlobCacheDiskSize;
+    std::string maxSizeString = angle::GetEnvironmentVar(kBlobCacheSizeEnvVar);
+    if (!maxSizeString.empty())
+    {
+        maxSize = static_cast<size_t>(strtoull(maxSizeString.c_str(), nullptr, 10));
+    }
+
+    auto diskStore =
+        std::make_unique<BlobCacheDiskStore>(directory + "/" + kBlobCacheFileName, maxSize);
+    if (diskStore->initialize())
+    {
+        mBlobCache.setDiskStore(std::move(diskStore));
+    }
+
+    if (mShaderBlobCache.getDiskStore() == nullptr)
+    {
+        auto shaderDiskStore = std::make_unique<BlobCacheDiskStore>(
+            directory + "/" + kShaderBlobCacheFileName, kDefaultShaderBlobCacheDiskSize);
+        if (shaderDiskStore->initialize())
+        {
+            mShaderBlobCache.setDiskStore(std::move(shaderDiskStore));
+        }
+    }
+}
+
 void Display::initializeFrontendFeatures()
 {
     // Enable on all Impls
@@ -11,6 +11,8 @@
 #ifndef LIBANGLE_DISPLAY_H_
 #define LIBANGLE_DISPLAY_H_
 
+#include <memory>
+#include <mutex>
 #include <set>
 #include <vector>
 
@@ -22,6 +24,7 @@
 #include "libANGLE/Error.h"
 #include "libANGLE/LoggingAnnotator.h"
 #include "libANGLE/MemoryProgramCache.h"
+#include "libANGLE/MemoryShaderCache.h"
 #include "libANGLE/Version.h"
 #include "platform/Feature.h"
 #include "platform/FrontendFeatures.h"
@@ -199,6 +202,13 @@ class Display final : public LabeledObject, angle::NonCopyable
     typedef std::set<gl::Context *> ContextSet;
     const ContextSet &getContextSet() { return mContextSet; }
 
+    // Contexts using EGL_DISPLAY_TEXTURE_SHARE_GROUP_ANGLE share objects through the display, and
+    // lock this mutex as their share group mutex.
+    const std::shared_ptr<std::mutex> &getTextureShareGroupMutex() const
+    {
+        return mTextureShareGroupMutex;
+    }
+
     const angle::FrontendFeatures &getFrontendFeatures() { return mFrontendFeatures; }
 
     const angle::FeatureList &getFeatures() const { return mFeatures; }
@@ -216,6 +226,7 @@ class Display final : public LabeledObject, angle::NonCopyable
 
     void initDisplayExtensions();
     void initVendorString();
+    void initBlobCacheDiskStore();
     void initializeFrontendFeatures();
 
     DisplayState mState;
@@ -253,8 +264,12 @@ class Display final : public LabeledObject, angle::NonCopyable
     angle::LoggingAnnotator mAnnotator;
 
     gl::TextureManager *mTextureManager;
+    std::shared_ptr<std::mutex> mTextureShareGroupMutex;
     BlobCache mBlobCache;
     gl::MemoryProgramCache mMemoryProgramCache;
+    // Translated shaders have their own cache, so they don't take space from program binaries.
+    BlobCache mShaderBlobCache;
+    gl::MemoryShaderCache mMemoryShaderCache;
     size_t mGlobalTextureShareGroupUsers;
 
     angle::FrontendFeatures mFrontendFeatures;
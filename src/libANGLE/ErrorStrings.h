@@ -153,6 +153,7 @@ MSG kIndexExceedsMaxUniformBufferBindings = "Index must be less than MAX_UNIFORM
 MSG kIndexExceedsMaxVertexAttribute = "Index must be less than MAX_VERTEX_ATTRIBS.";
 MSG kIndexExceedsMaxWorkgroupDimensions = "Index must be less than the number of workgroup dimensions (3).";
 MSG kIndexExceedsSamples = "Index must be less than the value of SAMPLES.";
+MSG kIndexExceedsStateCalls = "Index must be less than the number of calls counted by ANGLE_state_call_statistics.";
 MSG kIndexExceedsTransformFeedbackBufferBindings = "Index is greater than or equal to the number of TRANSFORM_FEEDBACK_BUFFER indexed binding points.";
 MSG kInsufficientBufferSize = "Insufficient buffer size.";
 MSG kInsufficientParams = "More parameters are required than were provided.";
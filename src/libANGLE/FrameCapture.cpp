@@ -13,9 +13,12 @@
 #include <cstring>
 #include <fstream>
 #include <string>
+#include <unordered_map>
 
+#include "common/hash_utils.h"
 #include "common/system_utils.h"
 #include "libANGLE/Context.h"
+#include "libANGLE/FrameCaptureTrace.h"
 #include "libANGLE/Framebuffer.h"
 #include "libANGLE/Shader.h"
 #include "libANGLE/VertexArray.h"
@@ -62,10 +65,43 @@ std::string GetDefaultOutDirectory()
 #endif  // defined(ANGLE_PLATFORM_ANDROID)
 }
 
-constexpr char kEnabledVarName[]      = "ANGLE_CAPTURE_ENABLED";
-constexpr char kOutDirectoryVarName[] = "ANGLE_CAPTURE_OUT_DIR";
-constexpr char kFrameStartVarName[]   = "ANGLE_CAPTURE_FRAME_START";
-constexpr char kFrameEndVarName[]     = "ANGLE_CAPTURE_FRAME_END";
+constexpr char kEnabledVarName[]         = "ANGLE_CAPTURE_ENABLED";
+constexpr char kOutDirectoryVarName[]    = "ANGLE_CAPTURE_OUT_DIR";
+constexpr char kFrameStartVarName[]      = "ANGLE_CAPTURE_FRAME_START";
+constexpr char kFrameEndVarName[]        = "ANGLE_CAPTURE_FRAME_END";
+constexpr char kFormatVarName[]          = "ANGLE_CAPTURE_FORMAT";
+constexpr char kMaxQueuedFramesVarName[] = "ANGLE_CAPTURE_MAX_QUEUED_FRAMES";
+
+// The number of frames that can wait for the writer thread by default, and at most.
+constexpr size_t kDefaultMaxQueuedFrames = 3;
+constexpr int kMaxQueuedFramesLimit      = 64;
+
+// Data buffers at least this large are kept for later snapshots, up to this many of them.
+constexpr size_t kMinReusedSnapshotBytes   = 1024;
+constexpr size_t kMaxReusedSnapshotBuffers = 64;
+
+// Moves the large data buffers of |calls| to |buffersOut|, until it holds the most buffers kept.
+void ReclaimSnapshotBuffers(std::vector<CallCapture> *calls,
+                            std::vector<std::vector<uint8_t>> *buffersOut)
+{
+    for (CallCapture &call : *calls)
+    {
+        for (ParamCapture &param : call.params.getParamCaptures())
+        {
+            for (std::vector<uint8_t> &data : param.data)
+            {
+                if (buffersOut->size() >= kMaxReusedSnapshotBuffers)
+                {
+                    return;
+                }
+                if (data.capacity() >= kMinReusedSnapshotBytes)
+                {
+                    buffersOut->emplace_back(std::move(data));
+                }
+            }
+        }
+    }
+}
 
 struct FmtCapturePrefix
 {
@@ -134,6 +170,70 @@ void WriteInlineData(const std::vector<uint8_t> &vec, std::ostream &out)
 
 constexpr size_t kInlineDataThreshold = 128;
 
+// The granularity at which captured memory is compared to what the replay already has.
+constexpr size_t kDirtyBlockSize = 64;
+
+// The parameter data stored in a .angledata file. Data that is the same as data already stored,
+// such as a vertex buffer uploaded again every frame, is only stored once.
+struct BinaryData
+{
+    size_t append(const std::vector<uint8_t> &data);
+
+    std::vector<uint8_t> bytes;
+    std::unordered_multimap<size_t, size_t> offsetsByHash;
+};
+
+size_t BinaryData::append(const std::vector<uint8_t> &data)
+{
+    // ComputeGenericHash reads whole words. The size is mixed in to account for the rest.
+    size_t hash = angle::ComputeGenericHash(data.data(), data.size() & ~size_t(3)) ^ data.size();
+
+    auto range = offsetsByHash.equal_range(hash);
+    for (auto iter = range.first; iter != range.second; ++iter)
+    {
+        size_t offset = iter->second;
+        if (bytes.size() - offset >= data.size() &&
+            memcmp(bytes.data() + offset, data.data(), data.size()) == 0)
+        {
+            return offset;
+        }
+    }
+
+    size_t offset = bytes.size();
+    bytes.insert(bytes.end(), data.begin(), data.end());
+    offsetsByHash.emplace(hash, offset);
+    return offset;
+}
+
+// Finds the ranges of the |size| bytes of |data| that differ from |previous|, which holds the
+// first |previousSize| bytes. Bytes past |previousSize| are always different.
+void FindDirtyRanges(const uint8_t *previous,
+                     size_t previousSize,
+                     const uint8_t *data,
+                     size_t size,
+                     std::vector<std::pair<size_t, size_t>> *rangesOut)
+{
+    rangesOut->clear();
+    for (size_t blockStart = 0; blockStart < size; blockStart += kDirtyBlockSize)
+    {
+        size_t blockEnd = std::min(blockStart + kDirtyBlockSize, size);
+        if (blockEnd <= previousSize &&
+            memcmp(previous + blockStart, data + blockStart, blockEnd - blockStart) == 0)
+        {
+            continue;
+        }
+
+        if (!rangesOut->empty() && rangesOut->back().second == blockStart)
+        {
+            rangesOut->back().second = blockEnd;
+        }
+        else
+        {
+            rangesOut->emplace_back(blockStart, blockEnd);
+        }
+    }
+}
+
 void WriteStringParamReplay(std::ostream &out, const ParamCapture &param)
 {
     const std::vector<uint8_t> &data = param.data[0];
@@ -207,7 +307,7 @@ void WriteBinaryParamReplay(DataCounters *counters,
                             std::ostream &header,
                             const CallCapture &call,
                             const ParamCapture &param,
-                            std::vector<uint8_t> *binaryData)
+                            BinaryData *binaryData)
 {
     int counter = counters->getAndIncrement(call.entryPoint, param.name);
 
@@ -216,9 +316,7 @@ void WriteBinaryParamReplay(DataCounters *counters,
 
     if (data.size() > kInlineDataThreshold)
     {
-        size_t offset = binaryData->size();
-        binaryData->resize(offset + data.size());
-        memcpy(binaryData->data() + offset, data.data(), data.size());
+        size_t offset = binaryData->append(data);
         if (param.type == ParamType::TvoidConstPointer || param.type == ParamType::TvoidPointer)
         {
             out << "&gBinaryData[" << offset << "]";
@@ -277,7 +375,7 @@ void WriteCppReplayForCall(const CallCapture &call,
                            DataCounters *counters,
                            std::ostream &out,
                            std::ostream &header,
-                           std::vector<uint8_t> *binaryData)
+                           BinaryData *binaryData)
 {
     std::ostringstream callOut;
 
@@ -474,7 +572,7 @@ void WriteCppReplay(const std::string &outDir,
         out << "{\n";
 
         std::stringstream setupCallStream;
-        std::vector<uint8_t> setupBinaryData;
+        BinaryData setupBinaryData;
 
         for (const CallCapture &call : setupCalls)
         {
@@ -483,9 +581,10 @@ void WriteCppReplay(const std::string &outDir,
             setupCallStream << ";\n";
         }
 
-        if (!setupBinaryData.empty())
+        if (!setupBinaryData.bytes.empty())
         {
-            SaveBinaryData(outDir, out, contextId, frameIndex, ".setup.angledata", setupBinaryData);
+            SaveBinaryData(outDir, out, contextId, frameIndex, ".setup.angledata",
+                           setupBinaryData.bytes);
         }
 
         out << setupCallStream.str();
@@ -498,7 +597,7 @@ void WriteCppReplay(const std::string &outDir,
     out << "{\n";
 
     std::stringstream callStream;
-    std::vector<uint8_t> binaryData;
+    BinaryData binaryData;
 
     for (const CallCapture &call : frameCalls)
     {
@@ -507,9 +606,9 @@ void WriteCppReplay(const std::string &outDir,
         callStream << ";\n";
     }
 
-    if (!binaryData.empty())
+    if (!binaryData.bytes.empty())
     {
-        SaveBinaryData(outDir, out, contextId, frameIndex, ".angledata", binaryData);
+        SaveBinaryData(outDir, out, contextId, frameIndex, ".angledata", binaryData.bytes);
     }
 
     out << callStream.str();
@@ -650,14 +749,14 @@ void WriteCppReplayIndexFiles(const std::string &outDir,
 
     if (maxClientArraySize > 0)
     {
-        header
-            << "void UpdateClientArrayPointer(int arrayIndex, const void *data, uint64_t size);\n";
+        header << "void UpdateClientArrayPointer(int arrayIndex, uint64_t offset, "
+                  "const void *data, uint64_t size);\n";
 
         source << "\n";
-        source << "void UpdateClientArrayPointer(int arrayIndex, const void *data, uint64_t size)"
-               << "\n";
+        source << "void UpdateClientArrayPointer(int arrayIndex, uint64_t offset, "
+                  "const void *data, uint64_t size)\n";
         source << "{\n";
-        source << "    memcpy(gClientArrays[arrayIndex], data, size);\n";
+        source << "    memcpy(gClientArrays[arrayIndex] + offset, data, size);\n";
         source << "}\n";
     }
 
@@ -1465,14 +1564,129 @@ ReplayContext::ReplayContext(size_t readBufferSizebytes,
 }
 ReplayContext::~ReplayContext() {}
 
+CapturedFrame::CapturedFrame()
+    : contextId(0), frameIndex(0), readBufferSize(0), clientArraySizes{}
+{}
+
+CapturedFrame::~CapturedFrame() = default;
+
+CapturedFrame::CapturedFrame(CapturedFrame &&other) : CapturedFrame()
+{
+    *this = std::move(other);
+}
+
+CapturedFrame &CapturedFrame::operator=(CapturedFrame &&other)
+{
+    std::swap(contextId, other.contextId);
+    std::swap(frameIndex, other.frameIndex);
+    std::swap(setupCalls, other.setupCalls);
+    std::swap(frameCalls, other.frameCalls);
+    std::swap(readBufferSize, other.readBufferSize);
+    std::swap(clientArraySizes, other.clientArraySizes);
+    std::swap(snapshotBuffers, other.snapshotBuffers);
+    return *this;
+}
+
+FrameCaptureWriter::FrameCaptureWriter(size_t maxQueuedFrames, WriteFunction &&writeFunction)
+    : mMaxQueuedFrames(maxQueuedFrames),
+      mWriteFunction(std::move(writeFunction)),
+      mStopping(false),
+      mThread(&FrameCaptureWriter::threadLoop, this)
+{
+    ASSERT(mMaxQueuedFrames > 0);
+}
+
+FrameCaptureWriter::~FrameCaptureWriter()
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mStopping = true;
+    }
+    mFrameQueued.notify_one();
+    mThread.join();
+}
+
+double FrameCaptureWriter::push(CapturedFrame *frame)
+{
+    double stallTime = 0.0;
+
+    std::unique_lock<std::mutex> lock(mMutex);
+    if (mQueue.size() >= mMaxQueuedFrames)
+    {
+        double stallStartTime = angle::GetCurrentTime();
+        mFrameWritten.wait(lock, [this]() { return mQueue.size() < mMaxQueuedFrames; });
+        stallTime = angle::GetCurrentTime() - stallStartTime;
+    }
+
+    mQueue.emplace_back(std::move(*frame));
+    if (!mFreeCallLists.empty())
+    {
+        frame->frameCalls = std::move(mFreeCallLists.back());
+        mFreeCallLists.pop_back();
+    }
+    frame->snapshotBuffers.swap(mFreeSnapshotBuffers);
+
+    lock.unlock();
+    mFrameQueued.notify_one();
+
+    return stallTime;
+}
+
+void FrameCaptureWriter::threadLoop()
+{
+    std::unique_lock<std::mutex> lock(mMutex);
+    while (true)
+    {
+        mFrameQueued.wait(lock, [this]() { return mStopping || !mQueue.empty(); });
+        if (mQueue.empty())
+        {
+            return;
+        }
+
+        // The frame stays queued while it's written, so that it counts against the queue size.
+        CapturedFrame &frame = mQueue.front();
+        lock.unlock();
+
+        mWriteFunction(&frame);
+
+        // The calls are freed here rather than on the context's thread. The call list and the
+        // large data buffers keep their storage for a later frame.
+        std::vector<std::vector<uint8_t>> snapshotBuffers;
+        ReclaimSnapshotBuffers(&frame.frameCalls, &snapshotBuffers);
+        frame.setupCalls.clear();
+        frame.frameCalls.clear();
+
+        lock.lock();
+        mFreeCallLists.emplace_back(std::move(frame.frameCalls));
+        for (std::vector<uint8_t> &buffer : snapshotBuffers)
+        {
+            if (mFreeSnapshotBuffers.size() >= kMaxReusedSnapshotBuffers)
+            {
+                break;
+            }
+            mFreeSnapshotBuffers.emplace_back(std::move(buffer));
+        }
+        mQueue.pop_front();
+        mFrameWritten.notify_one();
+    }
+}
+
 FrameCapture::FrameCapture()
     : mEnabled(true),
+      mBinaryFormat(false),
       mClientVertexArrayMap{},
       mFrameIndex(0),
       mFrameStart(0),
       mFrameEnd(10),
       mClientArraySizes{},
       mReadBufferSize(0),
+      mFrameStartTime(angle::GetCurrentTime()),
+      mTotalFrameTime(0.0),
+      mTotalOverheadTime(0.0),
+      mMaxFrameOverheadTime(0.0),
+      mFrameOverheadTime(0.0),
+      mStallTime(0.0),
+      mOverheadFrameCount(0),
       mHasResourceType{}
 {
     reset();
@@ -1510,9 +1724,47 @@ FrameCapture::FrameCapture()
     {
         mFrameEnd = atoi(endFromEnv.c_str());
     }
+
+    std::string formatFromEnv = angle::GetEnvironmentVar(kFormatVarName);
+    if (formatFromEnv == "binary")
+    {
+        mBinaryFormat = true;
+    }
+    else if (!formatFromEnv.empty() && formatFromEnv != "cpp")
+    {
+        WARN() << "Unknown capture format '" << formatFromEnv << "', capturing to CPP.";
+    }
+
+    size_t maxQueuedFrames             = kDefaultMaxQueuedFrames;
+    std::string maxQueuedFramesFromEnv = angle::GetEnvironmentVar(kMaxQueuedFramesVarName);
+    if (!maxQueuedFramesFromEnv.empty())
+    {
+        int maxQueuedFramesValue = atoi(maxQueuedFramesFromEnv.c_str());
+        int clampedValue = std::min(std::max(maxQueuedFramesValue, 0), kMaxQueuedFramesLimit);
+        if (clampedValue != maxQueuedFramesValue)
+        {
+            WARN() << kMaxQueuedFramesVarName << " must be between 0 and "
+                   << kMaxQueuedFramesLimit << ", using " << clampedValue << ".";
+        }
+        maxQueuedFrames = static_cast<size_t>(clampedValue);
+    }
+
+    // Without a queue the frames are written on the context's thread.
+    if (mEnabled && maxQueuedFrames > 0)
+    {
+        mWriter.reset(new FrameCaptureWriter(
+            maxQueuedFrames, [this](CapturedFrame *frame) { writeFrame(frame); }));
+    }
 }
 
-FrameCapture::~FrameCapture() = default;
+FrameCapture::~FrameCapture()
+{
+    // Report a capture cut short by the context going away.
+    if (enabled() && mOverheadFrameCount > 0)
+    {
+        reportCaptureOverhead();
+    }
+}
 
 void FrameCapture::maybeCaptureClientData(const gl::Context *context, const CallCapture &call)
 {
@@ -1584,6 +1836,18 @@ void FrameCapture::maybeCaptureClientData(const gl::Context *context, const Call
             break;
         }
 
+        case gl::EntryPoint::MapBuffer:
+        case gl::EntryPoint::MapBufferOES:
+        case gl::EntryPoint::MapBufferRange:
+        case gl::EntryPoint::MapBufferRangeEXT:
+        {
+            gl::BufferBinding target =
+                call.params.getParam("targetPacked", ParamType::TBufferBinding, 0)
+                    .value.BufferBindingVal;
+            captureMappedBufferContents(context, target);
+            break;
+        }
+
         case gl::EntryPoint::CompileShader:
         {
             // Refresh the cached shader sources.
@@ -1611,16 +1875,31 @@ void FrameCapture::maybeCaptureClientData(const gl::Context *context, const Call
     }
 }
 
-void FrameCapture::captureCall(const gl::Context *context, CallCapture &&call)
+void FrameCapture::captureCall(const gl::Context *context,
+                               CallCapture &&call,
+                               double captureStartTime)
 {
     // Process client data snapshots.
     maybeCaptureClientData(context, call);
 
-    mReadBufferSize = std::max(mReadBufferSize, call.params.getReadBufferSize());
+    mReadBufferSize           = std::max(mReadBufferSize, call.params.getReadBufferSize());
+    gl::EntryPoint entryPoint = call.entryPoint;
     mFrameCalls.emplace_back(std::move(call));
 
     // Process resource ID updates.
     MaybeCaptureUpdateResourceIDs(context, &mFrameCalls);
+
+    // Replay the writes made through a mapping once the buffer is unmapped.
+    if (entryPoint == gl::EntryPoint::UnmapBuffer || entryPoint == gl::EntryPoint::UnmapBufferOES)
+    {
+        for (CallCapture &writeCall : mMappedBufferWriteCalls)
+        {
+            mFrameCalls.emplace_back(std::move(writeCall));
+        }
+        mMappedBufferWriteCalls.clear();
+    }
+
+    mFrameOverheadTime += angle::GetCurrentTime() - captureStartTime;
 }
 
 void FrameCapture::captureClientArraySnapshot(const gl::Context *context,
@@ -1653,18 +1932,45 @@ void FrameCapture::captureClientArraySnapshot(const gl::Context *context,
             CallCapture &call   = mFrameCalls[callIndex];
             ParamCapture &param = call.params.getClientArrayPointerParameter();
             ASSERT(param.type == ParamType::TvoidConstPointer);
+            const uint8_t *data = static_cast<const uint8_t *>(param.value.voidConstPointerVal);
 
-            ParamBuffer updateParamBuffer;
-            updateParamBuffer.addValueParam<GLint>("arrayIndex", ParamType::TGLint,
-                                                   static_cast<uint32_t>(attribIndex));
+            // Only capture the data that differs from what the replay's client array already
+            // holds. The frames before the start frame aren't replayed, so they don't count.
+            std::vector<uint8_t> &replayData = mClientArrayReplayData[attribIndex];
+            if (mFrameIndex < mFrameStart)
+            {
+                mDirtyRanges.assign(1, std::pair<size_t, size_t>(0, bytesToCapture));
+            }
+            else
+            {
+                FindDirtyRanges(replayData.data(), replayData.size(), data, bytesToCapture,
+                                &mDirtyRanges);
+                replayData.resize(std::max(replayData.size(), bytesToCapture));
+            }
 
-            ParamCapture updateMemory("pointer", ParamType::TvoidConstPointer);
-            CaptureMemory(param.value.voidConstPointerVal, bytesToCapture, &updateMemory);
-            updateParamBuffer.addParam(std::move(updateMemory));
+            for (const std::pair<size_t, size_t> &range : mDirtyRanges)
+            {
+                size_t rangeSize = range.second - range.first;
+
+                ParamBuffer updateParamBuffer;
+                updateParamBuffer.addValueParam<GLint>("arrayIndex", ParamType::TGLint,
+                                                       static_cast<uint32_t>(attribIndex));
+                updateParamBuffer.addValueParam<GLuint64>("offset", ParamType::TGLuint64,
+                                                          range.first);
+
+                ParamCapture updateMemory("pointer", ParamType::TvoidConstPointer);
+                captureSnapshot(data + range.first, rangeSize, &updateMemory);
+                updateParamBuffer.addParam(std::move(updateMemory));
+
+                updateParamBuffer.addValueParam<GLuint64>("size", ParamType::TGLuint64, rangeSize);
 
-            updateParamBuffer.addValueParam<GLuint64>("size", ParamType::TGLuint64, bytesToCapture);
+                mFrameCalls.emplace_back("UpdateClientArrayPointer", std::move(updateParamBuffer));
 
-            mFrameCalls.emplace_back("UpdateClientArrayPointer", std::move(updateParamBuffer));
+                if (mFrameIndex >= mFrameStart)
+                {
+                    memcpy(replayData.data() + range.first, data + range.first, rangeSize);
+                }
+            }
 
             mClientArraySizes[attribIndex] =
                 std::max(mClientArraySizes[attribIndex], bytesToCapture);
@@ -1672,24 +1978,155 @@ void FrameCapture::captureClientArraySnapshot(const gl::Context *context,
     }
 }
 
+void FrameCapture::captureMappedBufferContents(const gl::Context *context,
+                                               gl::BufferBinding target)
+{
+    const gl::Buffer *buffer = context->getState().getTargetBuffer(target);
+    if (!buffer || !buffer->isMapped() || (buffer->getAccessFlags() & GL_MAP_WRITE_BIT) == 0)
+    {
+        return;
+    }
+
+    // The contents of an invalidated range are undefined, so all of it is written at unmap.
+    std::vector<uint8_t> &contents = mMappedBufferContents[buffer->id()];
+    contents.clear();
+    if ((buffer->getAccessFlags() &
+         (GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT)) == 0)
+    {
+        const uint8_t *mapPointer = static_cast<const uint8_t *>(buffer->getMapPointer());
+        size_t mapLength          = static_cast<size_t>(buffer->getMapLength());
+        if (contents.capacity() < mapLength)
+        {
+            contents = takeSnapshotBuffer(mapLength);
+        }
+        contents.assign(mapPointer, mapPointer + mapLength);
+    }
+}
+
+std::vector<uint8_t> FrameCapture::takeSnapshotBuffer(size_t size)
+{
+    // Small snapshots aren't worth a buffer that may be much larger.
+    if (size < kMinReusedSnapshotBytes || mSnapshotBuffers.empty())
+    {
+        return std::vector<uint8_t>();
+    }
+
+    std::vector<uint8_t> buffer = std::move(mSnapshotBuffers.back());
+    mSnapshotBuffers.pop_back();
+    return buffer;
+}
+
+void FrameCapture::captureSnapshot(const uint8_t *data, size_t size, ParamCapture *paramOut)
+{
+    std::vector<uint8_t> buffer = takeSnapshotBuffer(size);
+    buffer.assign(data, data + size);
+    paramOut->data.emplace_back(std::move(buffer));
+}
+
+void FrameCapture::onUnmapBuffer(const gl::Context *context, gl::BufferBinding target)
+{
+    if (!enabled())
+    {
+        return;
+    }
+
+    const gl::Buffer *buffer = context->getState().getTargetBuffer(target);
+    auto contentsIter        = mMappedBufferContents.find(buffer->id());
+    if (contentsIter == mMappedBufferContents.end())
+    {
+        return;
+    }
+
+    // Capture the ranges the application wrote to as BufferSubData calls, made after the unmap.
+    const std::vector<uint8_t> &contents = contentsIter->second;
+    const uint8_t *mapPointer            = static_cast<const uint8_t *>(buffer->getMapPointer());
+    size_t mapLength                     = static_cast<size_t>(buffer->getMapLength());
+    FindDirtyRanges(contents.data(), contents.size(), mapPointer, mapLength, &mDirtyRanges);
+
+    for (const std::pair<size_t, size_t> &range : mDirtyRanges)
+    {
+        mMappedBufferWriteCalls.emplace_back(CaptureBufferSubData(
+            context, true, target, static_cast<GLintptr>(buffer->getMapOffset() + range.first),
+            static_cast<GLsizeiptr>(range.second - range.first), mapPointer + range.first));
+    }
+
+    if (contentsIter->second.capacity() >= kMinReusedSnapshotBytes &&
+        mSnapshotBuffers.size() < kMaxReusedSnapshotBuffers)
+    {
+        mSnapshotBuffers.emplace_back(std::move(contentsIter->second));
+    }
+    mMappedBufferContents.erase(contentsIter);
+}
+
 void FrameCapture::onEndFrame(const gl::Context *context)
 {
-    // Note that we currently capture before the start frame to collect shader and program sources.
-    if (!mFrameCalls.empty() && mFrameIndex >= mFrameStart)
+    double endFrameStartTime = angle::GetCurrentTime();
+    bool capturedFrame       = enabled();
+
+    if (!mFrameCalls.empty())
     {
-        WriteCppReplay(mOutDirectory, context->id(), mFrameIndex, mFrameCalls, mSetupCalls);
+        CapturedFrame frame;
+        frame.contextId  = context->id();
+        frame.frameIndex = mFrameIndex;
+        frame.setupCalls.swap(mSetupCalls);
+        frame.frameCalls.swap(mFrameCalls);
+        frame.readBufferSize   = mReadBufferSize;
+        frame.clientArraySizes = mClientArraySizes;
 
-        // Save the index files after the last frame.
-        if (mFrameIndex == mFrameEnd)
+        if (mWriter)
+        {
+            double stallTime = mWriter->push(&frame);
+            mStallTime += stallTime;
+            mFrameCalls.swap(frame.frameCalls);
+            for (std::vector<uint8_t> &buffer : frame.snapshotBuffers)
+            {
+                if (mSnapshotBuffers.size() >= kMaxReusedSnapshotBuffers)
+                {
+                    break;
+                }
+                mSnapshotBuffers.emplace_back(std::move(buffer));
+            }
+        }
+        else
         {
-            WriteCppReplayIndexFiles(mOutDirectory, context->id(), mFrameStart, mFrameEnd,
-                                     mReadBufferSize, mClientArraySizes, mHasResourceType);
+            writeFrame(&frame);
+            ReclaimSnapshotBuffers(&frame.frameCalls, &mSnapshotBuffers);
         }
     }
 
+    reset();
+    mFrameIndex++;
+
+    if (enabled() && mFrameIndex == mFrameStart)
+    {
+        mSetupCalls.clear();
+        CaptureMidExecutionSetup(context, &mSetupCalls, mCachedShaderSources,
+                                 mCachedProgramSources);
+    }
+
+    if (capturedFrame)
+    {
+        double frameEndTime = angle::GetCurrentTime();
+        mFrameOverheadTime += frameEndTime - endFrameStartTime;
+        mTotalFrameTime += frameEndTime - mFrameStartTime;
+        mTotalOverheadTime += mFrameOverheadTime;
+        mMaxFrameOverheadTime = std::max(mMaxFrameOverheadTime, mFrameOverheadTime);
+        mFrameOverheadTime    = 0.0;
+        mFrameStartTime       = frameEndTime;
+        mOverheadFrameCount++;
+
+        if (!enabled())
+        {
+            reportCaptureOverhead();
+        }
+    }
+}
+
+void FrameCapture::writeFrame(CapturedFrame *frame)
+{
     // Count resource IDs. This is also done on every frame. It could probably be done by checking
     // the GL state instead of the calls.
-    for (const CallCapture &call : mFrameCalls)
+    for (const CallCapture &call : frame->frameCalls)
     {
         for (const ParamCapture &param : call.params.getParamCaptures())
         {
@@ -1701,15 +2138,52 @@ void FrameCapture::onEndFrame(const gl::Context *context)
         }
     }
 
-    reset();
-    mFrameIndex++;
+    // Note that we currently capture before the start frame to collect shader and program sources.
+    if (frame->frameIndex < mFrameStart)
+    {
+        return;
+    }
 
-    if (enabled() && mFrameIndex == mFrameStart)
+    if (mBinaryFormat)
     {
-        mSetupCalls.clear();
-        CaptureMidExecutionSetup(context, &mSetupCalls, mCachedShaderSources,
-                                 mCachedProgramSources);
+        if (!mTraceWriter)
+        {
+            std::stringstream traceFileName;
+            traceFileName << mOutDirectory << FmtCapturePrefix(frame->contextId) << ".angletrace";
+            mTraceWriter.reset(new TraceWriter());
+            mTraceWriter->open(traceFileName.str(), frame->contextId);
+        }
+
+        mTraceWriter->writeFrame(frame->frameIndex, frame->setupCalls, frame->frameCalls,
+                                 frame->readBufferSize, frame->clientArraySizes);
+
+        if (frame->frameIndex == mFrameEnd)
+        {
+            mTraceWriter->close();
+        }
+        return;
     }
+
+    WriteCppReplay(mOutDirectory, frame->contextId, frame->frameIndex, frame->frameCalls,
+                   frame->setupCalls);
+
+    // Save the index files after the last frame.
+    if (frame->frameIndex == mFrameEnd)
+    {
+        WriteCppReplayIndexFiles(mOutDirectory, frame->contextId, mFrameStart, mFrameEnd,
+                                 frame->readBufferSize, frame->clientArraySizes, mHasResourceType);
+    }
+}
+
+void FrameCapture::reportCaptureOverhead() const
+{
+    double overheadPercent =
+        mTotalFrameTime > 0.0 ? 100.0 * mTotalOverheadTime / mTotalFrameTime : 0.0;
+    printf(
+        "Capture overhead: %.2f ms over %u frames (%.1f%% of the frame time), at most %.2f ms in "
+        "a frame, %.2f ms waiting for the writer thread.\n",
+        mTotalOverheadTime * 1000.0, mOverheadFrameCount, overheadPercent,
+        mMaxFrameOverheadTime * 1000.0, mStallTime * 1000.0);
 }
 
 DataCounters::DataCounters() = default;
@@ -1745,18 +2219,21 @@ void FrameCapture::replay(gl::Context *context)
                     call.params.getParam("arrayIndex", ParamType::TGLint, 0).value.GLintVal;
                 ASSERT(arrayIndex < gl::MAX_VERTEX_ATTRIBS);
 
+                size_t offset = static_cast<size_t>(
+                    call.params.getParam("offset", ParamType::TGLuint64, 1).value.GLuint64Val);
+
                 const ParamCapture &pointerParam =
-                    call.params.getParam("pointer", ParamType::TvoidConstPointer, 1);
+                    call.params.getParam("pointer", ParamType::TvoidConstPointer, 2);
                 ASSERT(pointerParam.data.size() == 1);
                 const void *pointer = pointerParam.data[0].data();
 
                 size_t size = static_cast<size_t>(
-                    call.params.getParam("size", ParamType::TGLuint64, 2).value.GLuint64Val);
+                    call.params.getParam("size", ParamType::TGLuint64, 3).value.GLuint64Val);
 
                 std::vector<uint8_t> &curClientArrayBuffer =
                     replayContext.getClientArraysBuffer()[arrayIndex];
-                ASSERT(curClientArrayBuffer.size() >= size);
-                memcpy(curClientArrayBuffer.data(), pointer, size);
+                ASSERT(curClientArrayBuffer.size() >= offset + size);
+                memcpy(curClientArrayBuffer.data() + offset, pointer, size);
             }
             continue;
         }
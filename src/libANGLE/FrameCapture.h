@@ -10,7 +10,14 @@
 #ifndef LIBANGLE_FRAME_CAPTURE_H_
 #define LIBANGLE_FRAME_CAPTURE_H_
 
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+
 #include "common/PackedEnums.h"
+#include "common/system_utils.h"
 #include "libANGLE/Context.h"
 #include "libANGLE/angletypes.h"
 #include "libANGLE/entry_points_utils.h"
@@ -68,6 +75,7 @@ class ParamBuffer final : angle::NonCopyable
     ParamCapture &getClientArrayPointerParameter();
     size_t getReadBufferSize() const { return mReadBufferSize; }
 
+    std::vector<ParamCapture> &getParamCaptures() { return mParamCaptures; }
     const std::vector<ParamCapture> &getParamCaptures() const { return mParamCaptures; }
 
   private:
@@ -140,6 +148,7 @@ class ReplayContext
     }
 
     gl::AttribArray<std::vector<uint8_t>> &getClientArraysBuffer() { return mClientArraysBuffer; }
+    const std::vector<uint8_t> &getReadBuffer() const { return mReadBuffer; }
 
   private:
     std::vector<uint8_t> mReadBuffer;
@@ -172,17 +181,82 @@ using ProgramSources = gl::ShaderMap<std::string>;
 using ShaderSourceMap  = std::map<gl::ShaderProgramID, std::string>;
 using ProgramSourceMap = std::map<gl::ShaderProgramID, ProgramSources>;
 
+class TraceWriter;
+
+// The calls of a frame, and what is needed to write them out.
+struct CapturedFrame
+{
+    CapturedFrame();
+    ~CapturedFrame();
+
+    CapturedFrame(CapturedFrame &&other);
+    CapturedFrame &operator=(CapturedFrame &&other);
+
+    int contextId;
+    uint32_t frameIndex;
+    std::vector<CallCapture> setupCalls;
+    std::vector<CallCapture> frameCalls;
+    size_t readBufferSize;
+    gl::AttribArray<size_t> clientArraySizes;
+
+    // Handed back by FrameCaptureWriter::push: the data buffers of frames already written, for the
+    // snapshots of the next frames to reuse.
+    std::vector<std::vector<uint8_t>> snapshotBuffers;
+};
+
+// Writes the captured frames on a background thread, so the thread capturing them only pays for
+// handing them over. At most |maxQueuedFrames| frames wait to be written. When the queue is full
+// the capturing thread waits for the writer: dropping a frame would leave the following frames
+// unreplayable, and letting the queue grow would hold on to an unbounded amount of captured data.
+class FrameCaptureWriter final : angle::NonCopyable
+{
+  public:
+    using WriteFunction = std::function<void(CapturedFrame *frame)>;
+
+    FrameCaptureWriter(size_t maxQueuedFrames, WriteFunction &&writeFunction);
+    // Writes the frames still queued and stops the thread.
+    ~FrameCaptureWriter();
+
+    // Queues |frame| to be written. The frame gets back the emptied call list and the snapshot
+    // buffers of frames already written, so the next frame reuses their storage while the writer
+    // works on this one. Returns the time spent waiting for room in the queue, in seconds.
+    double push(CapturedFrame *frame);
+
+  private:
+    void threadLoop();
+
+    size_t mMaxQueuedFrames;
+    WriteFunction mWriteFunction;
+
+    std::mutex mMutex;
+    std::condition_variable mFrameQueued;
+    std::condition_variable mFrameWritten;
+    std::deque<CapturedFrame> mQueue;
+    std::vector<std::vector<CallCapture>> mFreeCallLists;
+    std::vector<std::vector<uint8_t>> mFreeSnapshotBuffers;
+    bool mStopping;
+
+    std::thread mThread;
+};
+
 class FrameCapture final : angle::NonCopyable
 {
   public:
     FrameCapture();
     ~FrameCapture();
 
-    void captureCall(const gl::Context *context, CallCapture &&call);
+    // |captureStartTime| is when capturing the call started, to account for the capture overhead.
+    void captureCall(const gl::Context *context, CallCapture &&call, double captureStartTime);
     void onEndFrame(const gl::Context *context);
+    // Called before a buffer is unmapped, while the data written through the mapping is readable.
+    void onUnmapBuffer(const gl::Context *context, gl::BufferBinding target);
     bool enabled() const;
     void replay(gl::Context *context);
 
+    static void ReplayCall(gl::Context *context,
+                           ReplayContext *replayContext,
+                           const CallCapture &call);
+
   private:
     void captureClientArraySnapshot(const gl::Context *context,
                                     size_t vertexCount,
@@ -190,16 +264,20 @@ class FrameCapture final : angle::NonCopyable
 
     void reset();
     void maybeCaptureClientData(const gl::Context *context, const CallCapture &call);
+    void captureMappedBufferContents(const gl::Context *context, gl::BufferBinding target);
+    std::vector<uint8_t> takeSnapshotBuffer(size_t size);
+    void captureSnapshot(const uint8_t *data, size_t size, ParamCapture *paramOut);
 
-    static void ReplayCall(gl::Context *context,
-                           ReplayContext *replayContext,
-                           const CallCapture &call);
+    // Called on the writer thread, if any.
+    void writeFrame(CapturedFrame *frame);
+    void reportCaptureOverhead() const;
 
     std::vector<CallCapture> mSetupCalls;
     std::vector<CallCapture> mFrameCalls;
     std::vector<CallCapture> mTearDownCalls;
 
     bool mEnabled;
+    bool mBinaryFormat;
     std::string mOutDirectory;
     gl::AttribArray<int> mClientVertexArrayMap;
     uint32_t mFrameIndex;
@@ -207,11 +285,41 @@ class FrameCapture final : angle::NonCopyable
     uint32_t mFrameEnd;
     gl::AttribArray<size_t> mClientArraySizes;
     size_t mReadBufferSize;
-    HasResourceTypeMap mHasResourceType;
+
+    // The client array data the replay holds after the last captured frame, so that only the
+    // ranges that change are captured.
+    gl::AttribArray<std::vector<uint8_t>> mClientArrayReplayData;
+
+    // The contents of the buffers mapped for writing when they were mapped, and the BufferSubData
+    // calls capturing the ranges written through the mapping, added after the UnmapBuffer call.
+    std::map<gl::BufferID, std::vector<uint8_t>> mMappedBufferContents;
+    std::vector<CallCapture> mMappedBufferWriteCalls;
+    std::vector<std::pair<size_t, size_t>> mDirtyRanges;
+
+    // Storage for the client array and mapped buffer snapshots. The buffers cycle between the
+    // frame being captured and the frames being written, so snapshots don't allocate once the
+    // capture reaches a steady state.
+    std::vector<std::vector<uint8_t>> mSnapshotBuffers;
 
     // Cache most recently compiled and linked sources.
     ShaderSourceMap mCachedShaderSources;
     ProgramSourceMap mCachedProgramSources;
+
+    // Time spent capturing on the context's thread, in seconds. The total includes the stalls.
+    double mFrameStartTime;
+    double mTotalFrameTime;
+    double mTotalOverheadTime;
+    double mMaxFrameOverheadTime;
+    double mFrameOverheadTime;
+    double mStallTime;
+    uint32_t mOverheadFrameCount;
+
+    // Only used by writeFrame.
+    HasResourceTypeMap mHasResourceType;
+    std::unique_ptr<TraceWriter> mTraceWriter;
+
+    // Declared last so the writer thread stops before the members it uses are destroyed.
+    std::unique_ptr<FrameCaptureWriter> mWriter;
 };
 
 template <typename CaptureFuncT, typename... ArgsT>
@@ -224,8 +332,9 @@ void CaptureCallToFrameCapture(CaptureFuncT captureFunc,
     if (!frameCapture->enabled())
         return;
 
-    CallCapture call = captureFunc(context, isCallValid, captureParams...);
-    frameCapture->captureCall(context, std::move(call));
+    double captureStartTime = angle::GetCurrentTime();
+    CallCapture call        = captureFunc(context, isCallValid, captureParams...);
+    frameCapture->captureCall(context, std::move(call), captureStartTime);
 }
 
 template <typename T>
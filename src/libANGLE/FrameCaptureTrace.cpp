@@ -0,0 +1,844 @@
+//
+// Copyright 2019 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// FrameCaptureTrace.cpp:
+//   Binary trace format for frame capture, and an interpreter that replays it in process.
+//
+//   All values are stored in the byte order of the capturing machine. The layout is:
+//
+//     header:  char magic[8], u32 version, i32 contextId, u32 sizeof(ParamValue)
+//     string:  u8 kString, u32 length, char[length]
+//     blob:    u8 kBlob, u64 size, u8 compressed, u64 storedSize, u8[storedSize]
+//     frame:   u8 kFrame, u32 frameIndex, u64 readBufferSize, u32 clientArrayCount,
+//              u64 clientArraySizes[clientArrayCount], u32 setupCallCount, u32 callCount,
+//              u64 callsSize, call calls[setupCallCount + callCount]
+//     call:    u32 entryPoint, [u32 customNameID if entryPoint is Invalid], u32 paramCount,
+//              param params[paramCount], param returnValue
+//     param:   u32 nameID, u32 type, ParamValue value, i32 arrayClientPointerIndex,
+//              u64 readBufferSizeBytes, u32 dataCount, u32 blobIDs[dataCount]
+//
+//   String and blob IDs are implicit: they are numbered in the order their records appear.
+//   Compressed blobs are stored as zlib streams.
+//
+
+#include "libANGLE/FrameCaptureTrace.h"
+
+#include <anglebase/sha1.h>
+
+#include <zlib.h>
+
+#include <cstring>
+#include <limits>
+#include <sstream>
+#include <type_traits>
+
+#if !ANGLE_CAPTURE_ENABLED
+#    error Frame capture must be enbled to include this file.
+#endif  // !ANGLE_CAPTURE_ENABLED
+
+namespace angle
+{
+namespace
+{
+constexpr char kTraceMagic[8]    = {'A', 'N', 'G', 'L', 'E', 'T', 'R', 'C'};
+constexpr uint32_t kTraceVersion = 3;
+
+// Blobs smaller than this are not worth compressing.
+constexpr size_t kMinCompressedBlobSize = 64;
+
+enum RecordType : uint8_t
+{
+    kString = 1,
+    kBlob   = 2,
+    kFrame  = 3,
+};
+
+template <typename T>
+void Pack(std::vector<uint8_t> *bytes, T value)
+{
+    static_assert(std::is_trivially_copyable<T>::value, "Only plain values can be packed");
+    const uint8_t *valueBytes = reinterpret_cast<const uint8_t *>(&value);
+    bytes->insert(bytes->end(), valueBytes, valueBytes + sizeof(T));
+}
+
+void PackBytes(std::vector<uint8_t> *bytes, const uint8_t *data, size_t size)
+{
+    bytes->insert(bytes->end(), data, data + size);
+}
+
+// Compresses a blob with zlib.  Returns false if the compressed form isn't smaller.
+bool CompressBlob(const std::vector<uint8_t> &data, std::vector<uint8_t> *compressedOut)
+{
+    if (data.size() > std::numeric_limits<uLong>::max())
+    {
+        return false;
+    }
+
+    uLongf compressedSize = compressBound(static_cast<uLong>(data.size()));
+    compressedOut->resize(compressedSize);
+
+    // Capture runs alongside the application, so favor speed over ratio.
+    if (compress2(compressedOut->data(), &compressedSize, data.data(),
+                  static_cast<uLong>(data.size()), Z_BEST_SPEED) != Z_OK ||
+        compressedSize >= data.size())
+    {
+        return false;
+    }
+
+    compressedOut->resize(compressedSize);
+    return true;
+}
+
+bool DecompressBlob(const uint8_t *compressedData,
+                    uint64_t compressedSize,
+                    uint64_t size,
+                    std::vector<uint8_t> *blobOut)
+{
+    if (compressedSize > std::numeric_limits<uLong>::max() ||
+        size > std::numeric_limits<uLongf>::max())
+    {
+        return false;
+    }
+
+    blobOut->resize(static_cast<size_t>(size));
+    uLongf decompressedSize = static_cast<uLongf>(size);
+    return uncompress(blobOut->data(), &decompressedSize, compressedData,
+                      static_cast<uLong>(compressedSize)) == Z_OK &&
+           decompressedSize == size;
+}
+
+class TraceUnpacker final : angle::NonCopyable
+{
+  public:
+    TraceUnpacker(const uint8_t *data, size_t size) : mData(data), mSize(size), mOffset(0) {}
+
+    template <typename T>
+    bool unpack(T *valueOut)
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "Only plain values can be unpacked");
+        if (mSize - mOffset < sizeof(T))
+        {
+            return false;
+        }
+        memcpy(valueOut, mData + mOffset, sizeof(T));
+        mOffset += sizeof(T);
+        return true;
+    }
+
+    bool unpackBytes(uint64_t size, const uint8_t **bytesOut)
+    {
+        if (mSize - mOffset < size)
+        {
+            return false;
+        }
+        *bytesOut = mData + mOffset;
+        mOffset += static_cast<size_t>(size);
+        return true;
+    }
+
+    bool done() const { return mOffset == mSize; }
+
+  private:
+    const uint8_t *mData;
+    size_t mSize;
+    size_t mOffset;
+};
+
+bool IsResourceIDValueType(ParamType type)
+{
+    switch (type)
+    {
+        case ParamType::TBufferID:
+        case ParamType::TFenceNVID:
+        case ParamType::TFramebufferID:
+        case ParamType::TMemoryObjectID:
+        case ParamType::TPathID:
+        case ParamType::TProgramPipelineID:
+        case ParamType::TQueryID:
+        case ParamType::TRenderbufferID:
+        case ParamType::TSamplerID:
+        case ParamType::TSemaphoreID:
+        case ParamType::TShaderProgramID:
+        case ParamType::TTextureID:
+        case ParamType::TTransformFeedbackID:
+        case ParamType::TVertexArrayID:
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool UnpackParam(TraceUnpacker *unpacker,
+                 const std::vector<std::string> &strings,
+                 const std::vector<std::vector<uint8_t>> &blobs,
+                 ParamCapture *paramOut)
+{
+    uint32_t nameID   = 0;
+    uint32_t type     = 0;
+    uint64_t readSize = 0;
+    uint32_t dataSize = 0;
+    if (!unpacker->unpack(&nameID) || nameID >= strings.size() || !unpacker->unpack(&type) ||
+        type > static_cast<uint32_t>(ParamType::TvoidPointerPointer) ||
+        !unpacker->unpack(&paramOut->value) ||
+        !unpacker->unpack(&paramOut->arrayClientPointerIndex) || !unpacker->unpack(&readSize) ||
+        !unpacker->unpack(&dataSize))
+    {
+        return false;
+    }
+
+    if (paramOut->arrayClientPointerIndex < -1 ||
+        paramOut->arrayClientPointerIndex >= static_cast<int>(gl::MAX_VERTEX_ATTRIBS))
+    {
+        return false;
+    }
+
+    paramOut->name                = strings[nameID];
+    paramOut->type                = static_cast<ParamType>(type);
+    paramOut->readBufferSizeBytes = static_cast<size_t>(readSize);
+
+    for (uint32_t dataIndex = 0; dataIndex < dataSize; ++dataIndex)
+    {
+        uint32_t blobID = 0;
+        if (!unpacker->unpack(&blobID) || blobID >= blobs.size())
+        {
+            return false;
+        }
+        paramOut->data.push_back(blobs[blobID]);
+    }
+
+    return true;
+}
+
+bool UnpackCall(TraceUnpacker *unpacker,
+                const std::vector<std::string> &strings,
+                const std::vector<std::vector<uint8_t>> &blobs,
+                std::vector<CallCapture> *callsOut)
+{
+    uint32_t entryPoint   = 0;
+    uint32_t customNameID = 0;
+    if (!unpacker->unpack(&entryPoint) ||
+        entryPoint > static_cast<uint32_t>(gl::EntryPoint::WindowPos3sv))
+    {
+        return false;
+    }
+    if (static_cast<gl::EntryPoint>(entryPoint) == gl::EntryPoint::Invalid &&
+        (!unpacker->unpack(&customNameID) || customNameID >= strings.size()))
+    {
+        return false;
+    }
+
+    uint32_t paramCount = 0;
+    if (!unpacker->unpack(&paramCount))
+    {
+        return false;
+    }
+
+    ParamBuffer params;
+    for (uint32_t paramIndex = 0; paramIndex < paramCount; ++paramIndex)
+    {
+        ParamCapture param;
+        if (!UnpackParam(unpacker, strings, blobs, &param))
+        {
+            return false;
+        }
+        params.addParam(std::move(param));
+    }
+
+    ParamCapture returnValue;
+    if (!UnpackParam(unpacker, strings, blobs, &returnValue))
+    {
+        return false;
+    }
+    params.addReturnValue(std::move(returnValue));
+
+    if (static_cast<gl::EntryPoint>(entryPoint) == gl::EntryPoint::Invalid)
+    {
+        callsOut->emplace_back(strings[customNameID], std::move(params));
+    }
+    else
+    {
+        callsOut->emplace_back(static_cast<gl::EntryPoint>(entryPoint), std::move(params));
+    }
+
+    return true;
+}
+}  // anonymous namespace
+
+TraceWriter::TraceWriter() : mFrameCount(0), mCapturedBlobBytes(0), mWrittenBlobBytes(0) {}
+
+TraceWriter::~TraceWriter()
+{
+    close();
+}
+
+void TraceWriter::open(const std::string &filePath, int contextId)
+{
+    ASSERT(!isOpen());
+
+    mFile.open(filePath, std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!mFile.is_open())
+    {
+        FATAL() << "Could not open " << filePath;
+        return;
+    }
+    mFilePath = filePath;
+
+    std::vector<uint8_t> header;
+    PackBytes(&header, reinterpret_cast<const uint8_t *>(kTraceMagic), sizeof(kTraceMagic));
+    Pack<uint32_t>(&header, kTraceVersion);
+    Pack<int32_t>(&header, contextId);
+    Pack<uint32_t>(&header, static_cast<uint32_t>(sizeof(ParamValue)));
+    flush(&header);
+}
+
+void TraceWriter::close()
+{
+    if (!isOpen())
+    {
+        return;
+    }
+
+    mFile.close();
+    printf("Saved '%s' (%u frames, %llu bytes of data written for %llu bytes captured).\n",
+           mFilePath.c_str(), mFrameCount, static_cast<unsigned long long>(mWrittenBlobBytes),
+           static_cast<unsigned long long>(mCapturedBlobBytes));
+}
+
+void TraceWriter::writeFrame(uint32_t frameIndex,
+                             const std::vector<CallCapture> &setupCalls,
+                             const std::vector<CallCapture> &frameCalls,
+                             size_t readBufferSize,
+                             const gl::AttribArray<size_t> &clientArraySizes)
+{
+    ASSERT(isOpen());
+
+    // Packing the calls adds the records of the strings and blobs they use first.
+    mCalls.clear();
+    for (const CallCapture &call : setupCalls)
+    {
+        packCall(call);
+    }
+    for (const CallCapture &call : frameCalls)
+    {
+        packCall(call);
+    }
+
+    Pack<uint8_t>(&mRecords, kFrame);
+    Pack<uint32_t>(&mRecords, frameIndex);
+    Pack<uint64_t>(&mRecords, readBufferSize);
+    Pack<uint32_t>(&mRecords, static_cast<uint32_t>(clientArraySizes.size()));
+    for (size_t clientArraySize : clientArraySizes)
+    {
+        Pack<uint64_t>(&mRecords, clientArraySize);
+    }
+    Pack<uint32_t>(&mRecords, static_cast<uint32_t>(setupCalls.size()));
+    Pack<uint32_t>(&mRecords, static_cast<uint32_t>(frameCalls.size()));
+    Pack<uint64_t>(&mRecords, mCalls.size());
+
+    flush(&mRecords);
+    flush(&mCalls);
+    mFile.flush();
+
+    mFrameCount++;
+}
+
+uint32_t TraceWriter::getStringID(const std::string &str)
+{
+    auto iter = mStringIDs.find(str);
+    if (iter != mStringIDs.end())
+    {
+        return iter->second;
+    }
+
+    uint32_t id = static_cast<uint32_t>(mStringIDs.size());
+    mStringIDs[str] = id;
+
+    Pack<uint8_t>(&mRecords, kString);
+    Pack<uint32_t>(&mRecords, static_cast<uint32_t>(str.size()));
+    PackBytes(&mRecords, reinterpret_cast<const uint8_t *>(str.data()), str.size());
+
+    return id;
+}
+
+uint32_t TraceWriter::getBlobID(const std::vector<uint8_t> &data)
+{
+    mCapturedBlobBytes += data.size();
+
+    BlobHash hash;
+    angle::base::SHA1HashBytes(data.data(), data.size(), hash.data());
+
+    auto iter = mBlobIDs.find(hash);
+    if (iter != mBlobIDs.end())
+    {
+        return iter->second;
+    }
+
+    uint32_t id    = static_cast<uint32_t>(mBlobIDs.size());
+    mBlobIDs[hash] = id;
+
+    bool compressed =
+        data.size() >= kMinCompressedBlobSize && CompressBlob(data, &mCompressedBlob);
+    const std::vector<uint8_t> &stored = compressed ? mCompressedBlob : data;
+
+    Pack<uint8_t>(&mRecords, kBlob);
+    Pack<uint64_t>(&mRecords, data.size());
+    Pack<uint8_t>(&mRecords, compressed ? 1 : 0);
+    Pack<uint64_t>(&mRecords, stored.size());
+    PackBytes(&mRecords, stored.data(), stored.size());
+
+    // Blob records can be large, so don't hold on to them until the end of the frame.
+    flush(&mRecords);
+
+    mWrittenBlobBytes += stored.size();
+    return id;
+}
+
+void TraceWriter::packCall(const CallCapture &call)
+{
+    Pack<uint32_t>(&mCalls, static_cast<uint32_t>(call.entryPoint));
+    if (call.entryPoint == gl::EntryPoint::Invalid)
+    {
+        Pack<uint32_t>(&mCalls, getStringID(call.customFunctionName));
+    }
+
+    const std::vector<ParamCapture> &params = call.params.getParamCaptures();
+    Pack<uint32_t>(&mCalls, static_cast<uint32_t>(params.size()));
+
+    auto packParam = [this](const ParamCapture &param) {
+        Pack<uint32_t>(&mCalls, getStringID(param.name));
+        Pack<uint32_t>(&mCalls, static_cast<uint32_t>(param.type));
+        Pack<ParamValue>(&mCalls, param.value);
+        Pack<int32_t>(&mCalls, param.arrayClientPointerIndex);
+        Pack<uint64_t>(&mCalls, param.readBufferSizeBytes);
+        Pack<uint32_t>(&mCalls, static_cast<uint32_t>(param.data.size()));
+        for (const std::vector<uint8_t> &data : param.data)
+        {
+            Pack<uint32_t>(&mCalls, getBlobID(data));
+        }
+    };
+
+    for (const ParamCapture &param : params)
+    {
+        packParam(param);
+    }
+    packParam(call.params.getReturnValue());
+}
+
+void TraceWriter::flush(std::vector<uint8_t> *bytes)
+{
+    mFile.write(reinterpret_cast<const char *>(bytes->data()), bytes->size());
+    if (mFile.bad())
+    {
+        FATAL() << "Error writing to " << mFilePath;
+    }
+    bytes->clear();
+}
+
+TraceReplay::Frame::Frame() : frameIndex(0) {}
+
+TraceReplay::Frame::~Frame() = default;
+
+TraceReplay::Frame::Frame(Frame &&other) : frameIndex(0)
+{
+    *this = std::move(other);
+}
+
+TraceReplay::Frame &TraceReplay::Frame::operator=(Frame &&other)
+{
+    std::swap(frameIndex, other.frameIndex);
+    std::swap(setupCalls, other.setupCalls);
+    std::swap(calls, other.calls);
+    return *this;
+}
+
+TraceReplay::TraceReplay()
+{
+    for (ResourceIDType idType : AllEnums<ResourceIDType>())
+    {
+        std::stringstream nameStr;
+        nameStr << "Update" << GetResourceIDTypeName(idType) << "ID";
+        mUpdateIDFunctions[nameStr.str()] = idType;
+    }
+}
+
+TraceReplay::~TraceReplay() = default;
+
+bool TraceReplay::load(const std::string &filePath)
+{
+    mFrames.clear();
+    rewind();
+
+    std::ifstream file(filePath, std::ios::in | std::ios::binary);
+    if (!file.is_open())
+    {
+        ERR() << "Could not open " << filePath;
+        return false;
+    }
+    std::vector<uint8_t> fileData((std::istreambuf_iterator<char>(file)),
+                                  std::istreambuf_iterator<char>());
+
+    TraceUnpacker unpacker(fileData.data(), fileData.size());
+
+    const uint8_t *magic    = nullptr;
+    uint32_t version        = 0;
+    int32_t contextId       = 0;
+    uint32_t paramValueSize = 0;
+    if (!unpacker.unpackBytes(sizeof(kTraceMagic), &magic) ||
+        memcmp(magic, kTraceMagic, sizeof(kTraceMagic)) != 0 || !unpacker.unpack(&version) ||
+        !unpacker.unpack(&contextId) || !unpacker.unpack(&paramValueSize))
+    {
+        ERR() << filePath << " is not a trace.";
+        return false;
+    }
+    if (version != kTraceVersion || paramValueSize != sizeof(ParamValue))
+    {
+        ERR() << filePath << " was captured by an incompatible build (version " << version
+              << ").";
+        return false;
+    }
+
+    std::vector<std::string> strings;
+    std::vector<std::vector<uint8_t>> blobs;
+    size_t readBufferSize = 0;
+    gl::AttribArray<size_t> clientArraySizes{};
+
+    // A capture that ended abruptly leaves an incomplete last record, which is skipped.
+    bool complete = true;
+    while (complete && !unpacker.done())
+    {
+        uint8_t recordType = 0;
+        complete           = unpacker.unpack(&recordType);
+        if (!complete)
+        {
+            break;
+        }
+
+        switch (recordType)
+        {
+            case kString:
+            {
+                uint32_t length    = 0;
+                const uint8_t *str = nullptr;
+                complete = unpacker.unpack(&length) && unpacker.unpackBytes(length, &str);
+                if (complete)
+                {
+                    strings.emplace_back(reinterpret_cast<const char *>(str), length);
+                }
+                break;
+            }
+
+            case kBlob:
+            {
+                uint64_t size       = 0;
+                uint8_t compressed  = 0;
+                uint64_t storedSize = 0;
+                const uint8_t *data = nullptr;
+                complete = unpacker.unpack(&size) && unpacker.unpack(&compressed) &&
+                           unpacker.unpack(&storedSize) && unpacker.unpackBytes(storedSize, &data);
+                if (!complete)
+                {
+                    break;
+                }
+
+                blobs.emplace_back();
+                if (compressed)
+                {
+                    complete = DecompressBlob(data, storedSize, size, &blobs.back());
+                }
+                else
+                {
+                    complete = size == storedSize;
+                    blobs.back().assign(data, data + storedSize);
+                }
+                break;
+            }
+
+            case kFrame:
+            {
+                Frame frame;
+                uint64_t frameReadBufferSize = 0;
+                uint32_t clientArrayCount    = 0;
+                complete = unpacker.unpack(&frame.frameIndex) &&
+                           unpacker.unpack(&frameReadBufferSize) &&
+                           unpacker.unpack(&clientArrayCount) &&
+                           clientArrayCount <= clientArraySizes.size();
+                for (uint32_t index = 0; complete && index < clientArrayCount; ++index)
+                {
+                    uint64_t clientArraySize = 0;
+                    complete                 = unpacker.unpack(&clientArraySize);
+                    clientArraySizes[index] =
+                        std::max(clientArraySizes[index], static_cast<size_t>(clientArraySize));
+                }
+
+                uint32_t setupCallCount = 0;
+                uint32_t callCount      = 0;
+                uint64_t callsSize      = 0;
+                const uint8_t *calls    = nullptr;
+                complete = complete && unpacker.unpack(&setupCallCount) &&
+                           unpacker.unpack(&callCount) && unpacker.unpack(&callsSize) &&
+                           unpacker.unpackBytes(callsSize, &calls);
+                if (!complete)
+                {
+                    break;
+                }
+
+                TraceUnpacker callsUnpacker(calls, static_cast<size_t>(callsSize));
+                for (uint32_t index = 0; complete && index < setupCallCount; ++index)
+                {
+                    complete = UnpackCall(&callsUnpacker, strings, blobs, &frame.setupCalls);
+                }
+                for (uint32_t index = 0; complete && index < callCount; ++index)
+                {
+                    complete = UnpackCall(&callsUnpacker, strings, blobs, &frame.calls);
+                }
+
+                // A frame with a call that would read or write outside the replay buffers is
+                // rejected, along with the rest of the trace.
+                for (const std::vector<CallCapture> *frameCalls : {&frame.setupCalls, &frame.calls})
+                {
+                    for (size_t index = 0; complete && index < frameCalls->size(); ++index)
+                    {
+                        complete = validateCall((*frameCalls)[index],
+                                                static_cast<size_t>(frameReadBufferSize),
+                                                clientArraySizes);
+                    }
+                }
+
+                if (complete)
+                {
+                    readBufferSize =
+                        std::max(readBufferSize, static_cast<size_t>(frameReadBufferSize));
+                    mFrames.emplace_back(std::move(frame));
+                }
+                break;
+            }
+
+            default:
+                complete = false;
+                break;
+        }
+    }
+
+    if (!complete)
+    {
+        WARN() << filePath << " is truncated or corrupt after frame " << mFrames.size() << ".";
+    }
+
+    // The replay context outlives the frames, as client array pointers stay bound across frames.
+    mReplayContext.reset(new ReplayContext(readBufferSize, clientArraySizes));
+
+    return !mFrames.empty();
+}
+
+void TraceReplay::replayFrame(gl::Context *context, size_t frame)
+{
+    ASSERT(frame < mFrames.size());
+
+    for (CallCapture &call : mFrames[frame].setupCalls)
+    {
+        replayCall(context, &call);
+    }
+
+    for (CallCapture &call : mFrames[frame].calls)
+    {
+        replayCall(context, &call);
+    }
+}
+
+void TraceReplay::rewind()
+{
+    for (std::unordered_map<GLuint, GLuint> &idMap : mResourceIDMaps)
+    {
+        idMap.clear();
+    }
+}
+
+bool TraceReplay::validateCall(const CallCapture &call,
+                               size_t readBufferSize,
+                               const gl::AttribArray<size_t> &clientArraySizes) const
+{
+    const std::vector<ParamCapture> &params = call.params.getParamCaptures();
+    for (const ParamCapture &param : params)
+    {
+        if (param.readBufferSizeBytes > readBufferSize)
+        {
+            return false;
+        }
+    }
+
+    if (call.entryPoint != gl::EntryPoint::Invalid)
+    {
+        return true;
+    }
+
+    auto hasParam = [&params](size_t index, const char *name, ParamType type) {
+        return index < params.size() && params[index].name == name && params[index].type == type;
+    };
+
+    if (call.customFunctionName == "UpdateClientArrayPointer")
+    {
+        if (!hasParam(0, "arrayIndex", ParamType::TGLint) ||
+            !hasParam(1, "offset", ParamType::TGLuint64) ||
+            !hasParam(2, "pointer", ParamType::TvoidConstPointer) ||
+            !hasParam(3, "size", ParamType::TGLuint64) || params[2].data.size() != 1)
+        {
+            return false;
+        }
+
+        GLint arrayIndex = params[0].value.GLintVal;
+        uint64_t offset  = params[1].value.GLuint64Val;
+        uint64_t size    = params[3].value.GLuint64Val;
+        if (arrayIndex < 0 || arrayIndex >= static_cast<GLint>(gl::MAX_VERTEX_ATTRIBS))
+        {
+            return false;
+        }
+
+        uint64_t arraySize = clientArraySizes[arrayIndex];
+        return size <= params[2].data[0].size() && offset <= arraySize &&
+               size <= arraySize - offset;
+    }
+
+    if (mUpdateIDFunctions.count(call.customFunctionName) > 0)
+    {
+        if (!hasParam(0, "id", ParamType::TGLuint) ||
+            !hasParam(1, "readBufferOffset", ParamType::TGLsizei))
+        {
+            return false;
+        }
+
+        GLsizei readBufferOffset = params[1].value.GLsizeiVal;
+        return readBufferOffset >= 0 &&
+               static_cast<size_t>(readBufferOffset) + sizeof(GLuint) <= readBufferSize;
+    }
+
+    return true;
+}
+
+void TraceReplay::replayCall(gl::Context *context, CallCapture *call)
+{
+    const ParamBuffer &params = call->params;
+
+    if (call->entryPoint == gl::EntryPoint::Invalid)
+    {
+        if (call->customFunctionName == "UpdateClientArrayPointer")
+        {
+            GLint arrayIndex = params.getParam("arrayIndex", ParamType::TGLint, 0).value.GLintVal;
+            ASSERT(arrayIndex < gl::MAX_VERTEX_ATTRIBS);
+
+            size_t offset = static_cast<size_t>(
+                params.getParam("offset", ParamType::TGLuint64, 1).value.GLuint64Val);
+
+            const ParamCapture &pointerParam =
+                params.getParam("pointer", ParamType::TvoidConstPointer, 2);
+            ASSERT(pointerParam.data.size() == 1);
+
+            size_t size = static_cast<size_t>(
+                params.getParam("size", ParamType::TGLuint64, 3).value.GLuint64Val);
+
+            std::vector<uint8_t> &clientArrayBuffer =
+                mReplayContext->getClientArraysBuffer()[arrayIndex];
+            ASSERT(clientArrayBuffer.size() >= offset + size);
+            memcpy(clientArrayBuffer.data() + offset, pointerParam.data[0].data(), size);
+            return;
+        }
+
+        // Record the ID the replay got for a resource created by a Gen call.
+        auto updateIter = mUpdateIDFunctions.find(call->customFunctionName);
+        if (updateIter != mUpdateIDFunctions.end())
+        {
+            GLuint capturedID = params.getParam("id", ParamType::TGLuint, 0).value.GLuintVal;
+            GLsizei readBufferOffset =
+                params.getParam("readBufferOffset", ParamType::TGLsizei, 1).value.GLsizeiVal;
+
+            const std::vector<uint8_t> &readBuffer = mReplayContext->getReadBuffer();
+            ASSERT(readBufferOffset + sizeof(GLuint) <= readBuffer.size());
+
+            GLuint replayID = 0;
+            memcpy(&replayID, readBuffer.data() + readBufferOffset, sizeof(GLuint));
+            mResourceIDMaps[updateIter->second][capturedID] = replayID;
+        }
+        return;
+    }
+
+    remapResourceIDs(call, true);
+
+    // The shader and program IDs are return values, which ReplayCall doesn't keep.
+    switch (call->entryPoint)
+    {
+        case gl::EntryPoint::CreateProgram:
+            mResourceIDMaps[ResourceIDType::ShaderProgram]
+                           [params.getReturnValue().value.GLuintVal] = context->createProgram();
+            break;
+        case gl::EntryPoint::CreateShader:
+            mResourceIDMaps[ResourceIDType::ShaderProgram]
+                           [params.getReturnValue().value.GLuintVal] = context->createShader(
+                               params.getParam("typePacked", ParamType::TShaderType, 0)
+                                   .value.ShaderTypeVal);
+            break;
+        default:
+            FrameCapture::ReplayCall(context, mReplayContext.get(), *call);
+            break;
+    }
+
+    remapResourceIDs(call, false);
+}
+
+void TraceReplay::remapResourceIDs(CallCapture *call, bool toReplay)
+{
+    size_t capturedIndex = 0;
+
+    auto remapID = [this, toReplay, &capturedIndex](ResourceIDType idType, uint8_t *idBytes) {
+        GLuint id = 0;
+        if (toReplay)
+        {
+            memcpy(&id, idBytes, sizeof(GLuint));
+            mCapturedIDs.push_back(id);
+            id = getReplayID(idType, id);
+        }
+        else
+        {
+            id = mCapturedIDs[capturedIndex++];
+        }
+        memcpy(idBytes, &id, sizeof(GLuint));
+    };
+
+    for (ParamCapture &param : call->params.getParamCaptures())
+    {
+        ResourceIDType idType = GetResourceIDTypeFromParamType(param.type);
+        if (idType == ResourceIDType::InvalidEnum || param.readBufferSizeBytes > 0)
+        {
+            continue;
+        }
+
+        if (IsResourceIDValueType(param.type))
+        {
+            remapID(idType, reinterpret_cast<uint8_t *>(&param.value));
+        }
+        else if (!param.data.empty())
+        {
+            std::vector<uint8_t> &ids = param.data[0];
+            for (size_t offset = 0; offset + sizeof(GLuint) <= ids.size(); offset += sizeof(GLuint))
+            {
+                remapID(idType, ids.data() + offset);
+            }
+        }
+    }
+
+    if (!toReplay)
+    {
+        ASSERT(capturedIndex == mCapturedIDs.size());
+        mCapturedIDs.clear();
+    }
+}
+
+GLuint TraceReplay::getReplayID(ResourceIDType idType, GLuint capturedID) const
+{
+    const std::unordered_map<GLuint, GLuint> &idMap = mResourceIDMaps[idType];
+    auto iter                                        = idMap.find(capturedID);
+
+    // IDs the replay didn't create, like the default objects, are used as is.
+    return iter != idMap.end() ? iter->second : capturedID;
+}
+}  // namespace angle
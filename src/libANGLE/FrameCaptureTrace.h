@@ -0,0 +1,128 @@
+//
+// Copyright 2019 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// FrameCaptureTrace.h:
+//   Binary trace format for frame capture, and an interpreter that replays it in process.
+//
+//   A trace is a single file per context. It starts with a header, followed by a list of records:
+//   strings, data blobs and frames. Strings hold call and parameter names. Blobs hold the captured
+//   parameter data; each distinct blob is written once and compressed when that makes it smaller.
+//   Frames hold the packed calls, which refer to strings and blobs by ID. Records are only ever
+//   appended, so a trace can be written one frame at a time and a trace cut short is still valid
+//   up to its last complete frame.
+//
+
+#ifndef LIBANGLE_FRAME_CAPTURE_TRACE_H_
+#define LIBANGLE_FRAME_CAPTURE_TRACE_H_
+
+#include <array>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "libANGLE/FrameCapture.h"
+
+namespace angle
+{
+// Writes the captured frames of a context to a binary trace.
+class TraceWriter final : angle::NonCopyable
+{
+  public:
+    TraceWriter();
+    ~TraceWriter();
+
+    void open(const std::string &filePath, int contextId);
+    void close();
+    bool isOpen() const { return mFile.is_open(); }
+
+    void writeFrame(uint32_t frameIndex,
+                    const std::vector<CallCapture> &setupCalls,
+                    const std::vector<CallCapture> &frameCalls,
+                    size_t readBufferSize,
+                    const gl::AttribArray<size_t> &clientArraySizes);
+
+  private:
+    using BlobHash = std::array<uint8_t, 20>;
+
+    uint32_t getStringID(const std::string &str);
+    uint32_t getBlobID(const std::vector<uint8_t> &data);
+    void packCall(const CallCapture &call);
+    void flush(std::vector<uint8_t> *bytes);
+
+    std::ofstream mFile;
+    std::string mFilePath;
+
+    std::unordered_map<std::string, uint32_t> mStringIDs;
+    std::map<BlobHash, uint32_t> mBlobIDs;
+
+    // The string and blob records first used by the frame being written, then the frame itself.
+    std::vector<uint8_t> mRecords;
+    std::vector<uint8_t> mCalls;
+    std::vector<uint8_t> mCompressedBlob;
+
+    uint32_t mFrameCount;
+    uint64_t mCapturedBlobBytes;
+    uint64_t mWrittenBlobBytes;
+};
+
+// Loads a binary trace and replays its frames on a context.
+class TraceReplay final : angle::NonCopyable
+{
+  public:
+    TraceReplay();
+    ~TraceReplay();
+
+    bool load(const std::string &filePath);
+
+    size_t getFrameCount() const { return mFrames.size(); }
+    uint32_t getFrameIndex(size_t frame) const { return mFrames[frame].frameIndex; }
+
+    // Replays the setup calls of the frame, if any, then its calls.
+    void replayFrame(gl::Context *context, size_t frame);
+
+    // Forgets the resources created by the replay, so that the trace can be replayed again from
+    // the start on a new context.
+    void rewind();
+
+  private:
+    struct Frame
+    {
+        Frame();
+        ~Frame();
+        Frame(Frame &&other);
+        Frame &operator=(Frame &&other);
+
+        uint32_t frameIndex;
+        std::vector<CallCapture> setupCalls;
+        std::vector<CallCapture> calls;
+    };
+
+    // The custom calls index the replay buffers with values read from the trace, so they are
+    // checked against the buffer sizes when the trace is loaded.
+    bool validateCall(const CallCapture &call,
+                      size_t readBufferSize,
+                      const gl::AttribArray<size_t> &clientArraySizes) const;
+    void replayCall(gl::Context *context, CallCapture *call);
+    void remapResourceIDs(CallCapture *call, bool toReplay);
+    GLuint getReplayID(ResourceIDType idType, GLuint capturedID) const;
+
+    std::vector<Frame> mFrames;
+    std::unique_ptr<ReplayContext> mReplayContext;
+
+    // Maps the Update<Resource>ID custom calls to their resource type.
+    std::map<std::string, ResourceIDType> mUpdateIDFunctions;
+
+    // Maps the resource IDs seen at capture to the ones created by the replay.
+    angle::PackedEnumMap<ResourceIDType, std::unordered_map<GLuint, GLuint>> mResourceIDMaps;
+
+    // The captured IDs overwritten by remapResourceIDs, to be restored after the call.
+    std::vector<GLuint> mCapturedIDs;
+};
+}  // namespace angle
+
+#endif  // LIBANGLE_FRAME_CAPTURE_TRACE_H_
@@ -8,6 +8,7 @@
 //
 
 #include "libANGLE/FrameCapture.h"
+#include "libANGLE/FrameCaptureTrace.h"
 
 #if ANGLE_CAPTURE_ENABLED
 #    error Frame capture must be disabled to include this file.
@@ -18,9 +19,12 @@ namespace angle
 CallCapture::~CallCapture() {}
 ParamBuffer::~ParamBuffer() {}
 ParamCapture::~ParamCapture() {}
+TraceWriter::~TraceWriter() {}
+FrameCaptureWriter::~FrameCaptureWriter() {}
 
 FrameCapture::FrameCapture() {}
 FrameCapture::~FrameCapture() {}
 void FrameCapture::onEndFrame(const gl::Context *context) {}
+void FrameCapture::onUnmapBuffer(const gl::Context *context, gl::BufferBinding target) {}
 void FrameCapture::replay(gl::Context *context) {}
 }  // namespace angle
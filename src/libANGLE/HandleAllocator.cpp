@@ -13,6 +13,7 @@
 #include <functional>
 
 #include "common/debug.h"
+#include "common/mathutil.h"
 
 namespace gl
 {
@@ -22,13 +23,14 @@ struct HandleAllocator::HandleRangeComparator
     bool operator()(const HandleRange &range, GLuint handle) const { return (range.end < handle); }
 };
 
-HandleAllocator::HandleAllocator() : mBaseValue(1), mNextValue(1), mLoggingEnabled(false)
+HandleAllocator::HandleAllocator()
+    : mBaseValue(1), mNextValue(1), mReleasedBitCount(0), mLoggingEnabled(false)
 {
     mUnallocatedList.push_back(HandleRange(1, std::numeric_limits<GLuint>::max()));
 }
 
 HandleAllocator::HandleAllocator(GLuint maximumHandleValue)
-    : mBaseValue(1), mNextValue(1), mLoggingEnabled(false)
+    : mBaseValue(1), mNextValue(1), mReleasedBitCount(0), mLoggingEnabled(false)
 {
     mUnallocatedList.push_back(HandleRange(1, maximumHandleValue));
 }
@@ -44,7 +46,22 @@ void HandleAllocator::setBaseHandle(GLuint value)
 
 GLuint HandleAllocator::allocate()
 {
-    ASSERT(!mUnallocatedList.empty() || !mReleasedList.empty());
+    ASSERT(!mUnallocatedList.empty() || mReleasedBitCount > 0 || !mReleasedList.empty());
+
+    // Allocate from released bits, constant time.  These are all lower than the handles in the
+    // released list.
+    if (mReleasedBitCount > 0)
+    {
+        GLuint reusedHandle = getLowestReleasedBit();
+        clearReleasedBit(reusedHandle);
+
+        if (mLoggingEnabled)
+        {
+            WARN() << "HandleAllocator::allocate reusing " << reusedHandle << std::endl;
+        }
+
+        return reusedHandle;
+    }
 
     // Allocate from released list, logarithmic time for pop_heap.
     if (!mReleasedList.empty())
@@ -91,6 +108,13 @@ void HandleAllocator::release(GLuint handle)
         WARN() << "HandleAllocator::release releasing " << handle << std::endl;
     }
 
+    // Add to released bits, constant time.
+    if (handle < kReleasedBitsLimit)
+    {
+        setReleasedBit(handle);
+        return;
+    }
+
     // Add to released list, logarithmic time for push_heap.
     mReleasedList.push_back(handle);
     std::push_heap(mReleasedList.begin(), mReleasedList.end(), std::greater<GLuint>());
@@ -103,8 +127,16 @@ void HandleAllocator::reserve(GLuint handle)
         WARN() << "HandleAllocator::reserve reserving " << handle << std::endl;
     }
 
+    // Clear from released bits, constant time.
+    if (handle < kReleasedBitsLimit)
+    {
+        if (clearReleasedBit(handle))
+        {
+            return;
+        }
+    }
     // Clear from released list -- might be a slow operation.
-    if (!mReleasedList.empty())
+    else if (!mReleasedList.empty())
     {
         auto releasedIt = std::find(mReleasedList.begin(), mReleasedList.end(), handle);
         if (releasedIt != mReleasedList.end())
@@ -155,8 +187,13 @@ void HandleAllocator::reset()
     mUnallocatedList.clear();
     mUnallocatedList.push_back(HandleRange(1, std::numeric_limits<GLuint>::max()));
     mReleasedList.clear();
-    mBaseValue = 1;
-    mNextValue = 1;
+    for (std::vector<uint32_t> &level : mReleasedBits)
+    {
+        level.clear();
+    }
+    mReleasedBitCount = 0;
+    mBaseValue        = 1;
+    mNextValue        = 1;
 }
 
 void HandleAllocator::enableLogging(bool enabled)
@@ -164,4 +201,90 @@ void HandleAllocator::enableLogging(bool enabled)
     mLoggingEnabled = enabled;
 }
 
+bool HandleAllocator::isReleasedBitSet(GLuint handle) const
+{
+    ASSERT(handle < kReleasedBitsLimit);
+
+    const std::vector<uint32_t> &bottomLevel = mReleasedBits[0];
+    size_t wordIndex                         = handle >> 5;
+    return (wordIndex < bottomLevel.size() &&
+            (bottomLevel[wordIndex] & (1u << (handle & 31))) != 0);
+}
+
+void HandleAllocator::setReleasedBit(GLuint handle)
+{
+    if (isReleasedBitSet(handle))
+    {
+        return;
+    }
+    mReleasedBitCount++;
+
+    GLuint bitIndex = handle;
+    for (std::vector<uint32_t> &level : mReleasedBits)
+    {
+        size_t wordIndex = bitIndex >> 5;
+        if (level.size() <= wordIndex)
+        {
+            level.resize(wordIndex + 1, 0);
+        }
+
+        uint32_t word    = level[wordIndex];
+        level[wordIndex] = word | (1u << (bitIndex & 31));
+
+        // The levels above already know this word isn't zero.
+        if (word != 0)
+        {
+            break;
+        }
+        bitIndex = static_cast<GLuint>(wordIndex);
+    }
+}
+
+bool HandleAllocator::clearReleasedBit(GLuint handle)
+{
+    if (!isReleasedBitSet(handle))
+    {
+        return false;
+    }
+    mReleasedBitCount--;
+
+    GLuint bitIndex = handle;
+    for (std::vector<uint32_t> &level : mReleasedBits)
+    {
+        size_t wordIndex = bitIndex >> 5;
+        level[wordIndex] &= ~(1u << (bitIndex & 31));
+
+        // Only clear the bit of the level above if this word is now zero.
+        if (level[wordIndex] != 0)
+        {
+            break;
+        }
+        bitIndex = static_cast<GLuint>(wordIndex);
+    }
+    return true;
+}
+
+GLuint HandleAllocator::getLowestReleasedBit() const
+{
+    ASSERT(mReleasedBitCount > 0);
+
+    const std::vector<uint32_t> &topLevel = mReleasedBits.back();
+    size_t wordIndex                      = 0;
+    while (topLevel[wordIndex] == 0)
+    {
+        ++wordIndex;
+    }
+
+    // Walk down the levels, picking the lowest non-zero word each time.
+    GLuint bitIndex = 0;
+    for (size_t level = kReleasedBitsLevels; level-- > 0;)
+    {
+        uint32_t word = mReleasedBits[level][wordIndex];
+        ASSERT(word != 0);
+        bitIndex  = static_cast<GLuint>((wordIndex << 5) + gl::ScanForward(word));
+        wordIndex = bitIndex;
+    }
+    return bitIndex;
+}
+
 }  // namespace gl
@@ -14,6 +14,8 @@
 
 #include "angle_gl.h"
 
+#include <array>
+
 namespace gl
 {
 
@@ -53,12 +55,27 @@ class HandleAllocator final : angle::NonCopyable
 
     struct HandleRangeComparator;
 
+    bool isReleasedBitSet(GLuint handle) const;
+    void setReleasedBit(GLuint handle);
+    bool clearReleasedBit(GLuint handle);
+    GLuint getLowestReleasedBit() const;
+
     // The freelist consists of never-allocated handles, stored
     // as ranges, and handles that were previously allocated and
-    // released, stored in a heap.
+    // released.  Released handles below kReleasedBitsLimit are
+    // stored in a bitmap, the others in a heap.
     std::vector<HandleRange> mUnallocatedList;
     std::vector<GLuint> mReleasedList;
 
+    // The released handles bitmap has three levels.  A bit of level 0 is set if its handle is
+    // released, and a bit of the next levels is set if the matching word of the level below isn't
+    // zero, so the lowest released handle is found with one scan of the small top level.  All
+    // levels grow as higher handles are released.
+    static constexpr size_t kReleasedBitsLevels = 3;
+    static constexpr GLuint kReleasedBitsLimit  = 1u << (5 * (kReleasedBitsLevels + 1));
+    std::array<std::vector<uint32_t>, kReleasedBitsLevels> mReleasedBits;
+    size_t mReleasedBitCount;
+
     bool mLoggingEnabled;
 };
 
@@ -6,6 +6,8 @@
 // Unit tests for HandleAllocator.
 //
 
+#include <algorithm>
+
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 
@@ -193,4 +195,59 @@ TEST(HandleAllocatorTest, ReserveAfterReleaseBug)
     allocator.allocate();
 }
 
+// Tests that released handles are reused lowest first, whether they are stored as bits or in the
+// heap of high handles.
+TEST(HandleAllocatorTest, ReleasedHandlesReusedLowestFirst)
+{
+    gl::HandleAllocator allocator;
+
+    for (GLuint count = 1; count <= 100000; count++)
+    {
+        EXPECT_EQ(count, allocator.allocate());
+    }
+
+    constexpr GLuint kHighHandle = 0x80000000;
+    allocator.reserve(kHighHandle);
+
+    std::vector<GLuint> released = {kHighHandle, 99999, 31, 32, 33, 1024, 1025, 65536, 2};
+    for (GLuint handle : released)
+    {
+        allocator.release(handle);
+    }
+
+    std::sort(released.begin(), released.end());
+    for (GLuint handle : released)
+    {
+        EXPECT_EQ(handle, allocator.allocate());
+    }
+    EXPECT_EQ(100001u, allocator.allocate());
+}
+
+// Tests reserving handles that were released.
+TEST(HandleAllocatorTest, ReserveReleasedHandles)
+{
+    gl::HandleAllocator allocator;
+
+    for (GLuint count = 1; count <= 2000; count++)
+    {
+        allocator.allocate();
+    }
+
+    for (GLuint handle = 1; handle <= 2000; handle++)
+    {
+        allocator.release(handle);
+    }
+
+    for (GLuint handle = 1; handle <= 2000; handle += 2)
+    {
+        allocator.reserve(handle);
+    }
+
+    for (GLuint handle = 2; handle <= 2000; handle += 2)
+    {
+        EXPECT_EQ(handle, allocator.allocate());
+    }
+    EXPECT_EQ(2001u, allocator.allocate());
+}
+
 }  // anonymous namespace
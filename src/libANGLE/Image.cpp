@@ -237,7 +237,8 @@ Image::Image(rx::EGLImplFactory *factory,
              const AttributeMap &attribs)
     : mState(target, buffer, attribs),
       mImplementation(factory->createImage(mState, context, target, attribs)),
-      mOrphanedAndNeedsInit(false)
+      mOrphanedAndNeedsInit(false),
+      mShareGroupMutex(context ? context->getShareGroupMutex() : nullptr)
 {
     ASSERT(mImplementation != nullptr);
     ASSERT(buffer != nullptr);
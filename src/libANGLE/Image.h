@@ -17,6 +17,8 @@
 #include "libANGLE/RefCountObject.h"
 #include "libANGLE/formatutils.h"
 
+#include <memory>
+#include <mutex>
 #include <set>
 
 namespace rx
@@ -167,6 +169,9 @@ class Image final : public RefCountObject, public LabeledObject
     gl::InitState sourceInitState() const;
     void setInitState(gl::InitState initState);
 
+    // The lock of the share group that owns the source sibling, or null for external sources.
+    const std::shared_ptr<std::mutex> &getShareGroupMutex() const { return mShareGroupMutex; }
+
   private:
     friend class ImageSibling;
 
@@ -183,6 +188,7 @@ class Image final : public RefCountObject, public LabeledObject
     ImageState mState;
     rx::ImageImpl *mImplementation;
     bool mOrphanedAndNeedsInit;
+    std::shared_ptr<std::mutex> mShareGroupMutex;
 };
 }  // namespace egl
 
@@ -9,13 +9,34 @@
 
 #include "libANGLE/IndexRangeCache.h"
 
+#include <algorithm>
+
 #include "common/debug.h"
 #include "libANGLE/formatutils.h"
 
 namespace gl
 {
+namespace
+{
+constexpr size_t kCapacityLog2 = 6;
+constexpr size_t kSlotMask     = IndexRangeCache::kCapacity - 1;
+static_assert(IndexRangeCache::kCapacity == size_t(1) << kCapacityLog2, "Capacity mismatch");
+static_assert(IndexRangeCache::kMaxProbeLength <= IndexRangeCache::kCapacity,
+              "Probe length is larger than the table");
 
-IndexRangeCache::IndexRangeCache() {}
+uint64_t RotateLeft64(uint64_t value, size_t shift)
+{
+    shift &= 63;
+    return shift == 0 ? value : (value << shift) | (value >> (64 - shift));
+}
+}  // anonymous namespace
+
+constexpr size_t IndexRangeCache::kCapacity;
+constexpr size_t IndexRangeCache::kMaxProbeLength;
+constexpr size_t IndexRangeCache::kGranuleShift;
+constexpr size_t IndexRangeCache::kGranuleSize;
+
+IndexRangeCache::IndexRangeCache() : mSize(0), mGranuleMask(0) {}
 
 IndexRangeCache::~IndexRangeCache() {}
 
@@ -25,7 +46,42 @@ void IndexRangeCache::addRange(DrawElementsType type,
                                bool primitiveRestartEnabled,
                                const IndexRange &range)
 {
-    mIndexRangeCache[IndexRangeKey(type, offset, count, primitiveRestartEnabled)] = range;
+    if (mEntries.empty())
+    {
+        mEntries.resize(kCapacity);
+    }
+
+    // If every slot the key may live in is taken, the entry in its home slot is replaced.  That
+    // entry is reachable from its own home slot, so replacing it introduces no holes.
+    size_t homeSlot   = GetHomeSlot(type, offset, count, primitiveRestartEnabled);
+    size_t targetSlot = homeSlot;
+    size_t slot       = homeSlot;
+    for (size_t probe = 0; probe < kMaxProbeLength; ++probe, slot = (slot + 1) & kSlotMask)
+    {
+        const Entry &entry = mEntries[slot];
+        if (!entry.used)
+        {
+            mSize++;
+            targetSlot = slot;
+            break;
+        }
+        if (entry.type == type && entry.offset == offset && entry.count == count &&
+            entry.primitiveRestartEnabled == primitiveRestartEnabled)
+        {
+            targetSlot = slot;
+            break;
+        }
+    }
+
+    Entry &entry                  = mEntries[targetSlot];
+    entry.offset                  = offset;
+    entry.count                   = count;
+    entry.range                   = range;
+    entry.type                    = type;
+    entry.primitiveRestartEnabled = primitiveRestartEnabled;
+    entry.used                    = true;
+
+    mGranuleMask |= GetGranuleMask(offset, GetEntryEnd(entry));
 }
 
 bool IndexRangeCache::findRange(DrawElementsType type,
@@ -34,83 +90,157 @@ bool IndexRangeCache::findRange(DrawElementsType type,
                                 bool primitiveRestartEnabled,
                                 IndexRange *outRange) const
 {
-    auto i = mIndexRangeCache.find(IndexRangeKey(type, offset, count, primitiveRestartEnabled));
-    if (i != mIndexRangeCache.end())
+    if (mSize > 0)
     {
-        if (outRange)
+        size_t slot = GetHomeSlot(type, offset, count, primitiveRestartEnabled);
+        for (size_t probe = 0; probe < kMaxProbeLength; ++probe, slot = (slot + 1) & kSlotMask)
         {
-            *outRange = i->second;
+            const Entry &entry = mEntries[slot];
+            if (!entry.used)
+            {
+                break;
+            }
+            if (entry.type == type && entry.offset == offset && entry.count == count &&
+                entry.primitiveRestartEnabled == primitiveRestartEnabled)
+            {
+                if (outRange)
+                {
+                    *outRange = entry.range;
+                }
+                return true;
+            }
         }
-        return true;
     }
-    else
+
+    if (outRange)
     {
-        if (outRange)
-        {
-            *outRange = IndexRange();
-        }
-        return false;
+        *outRange = IndexRange();
     }
+    return false;
 }
 
 void IndexRangeCache::invalidateRange(size_t offset, size_t size)
 {
+    if (mSize == 0 || size == 0)
+    {
+        return;
+    }
+
     size_t invalidateStart = offset;
     size_t invalidateEnd   = offset + size;
-
-    auto i = mIndexRangeCache.begin();
-    while (i != mIndexRangeCache.end())
+    if ((GetGranuleMask(invalidateStart, invalidateEnd) & mGranuleMask) == 0)
     {
-        size_t rangeStart = i->first.offset;
-        size_t rangeEnd =
-            i->first.offset + (GetDrawElementsTypeSize(i->first.type) * i->first.count);
+        return;
+    }
 
-        if (invalidateEnd < rangeStart || invalidateStart > rangeEnd)
+    uint64_t granuleMask = 0;
+    for (size_t slot = 0; slot < kCapacity;)
+    {
+        const Entry &entry = mEntries[slot];
+        if (!entry.used)
         {
-            ++i;
+            ++slot;
+            continue;
         }
-        else
+
+        size_t rangeStart = entry.offset;
+        size_t rangeEnd   = GetEntryEnd(entry);
+        if (invalidateStart < rangeEnd && rangeStart < invalidateEnd)
         {
-            mIndexRangeCache.erase(i++);
+            // Erasing shifts a later entry into this slot, so look at it again.
+            eraseSlot(slot);
+            continue;
         }
+
+        granuleMask |= GetGranuleMask(rangeStart, rangeEnd);
+        ++slot;
     }
-}
 
-void IndexRangeCache::clear()
-{
-    mIndexRangeCache.clear();
+    mGranuleMask = granuleMask;
 }
 
-IndexRangeCache::IndexRangeKey::IndexRangeKey()
-    : IndexRangeCache::IndexRangeKey(DrawElementsType::InvalidEnum, 0, 0, false)
-{}
-
-IndexRangeCache::IndexRangeKey::IndexRangeKey(DrawElementsType type_,
-                                              size_t offset_,
-                                              size_t count_,
-                                              bool primitiveRestartEnabled_)
-    : type(type_), offset(offset_), count(count_), primitiveRestartEnabled(primitiveRestartEnabled_)
-{}
-
-bool IndexRangeCache::IndexRangeKey::operator<(const IndexRangeKey &rhs) const
+void IndexRangeCache::clear()
 {
-    if (type != rhs.type)
+    if (mSize == 0)
     {
-        return type < rhs.type;
+        return;
     }
-    if (offset != rhs.offset)
+
+    for (Entry &entry : mEntries)
     {
-        return offset < rhs.offset;
+        entry.used = false;
     }
-    if (count != rhs.count)
+    mSize        = 0;
+    mGranuleMask = 0;
+}
+
+// static
+size_t IndexRangeCache::GetHomeSlot(DrawElementsType type,
+                                    size_t offset,
+                                    size_t count,
+                                    bool primitiveRestartEnabled)
+{
+    uint64_t key = (static_cast<uint64_t>(offset) << 2) ^
+                   (static_cast<uint64_t>(count) * 0x9E3779B97F4A7C15ull) ^
+                   (static_cast<uint64_t>(type) << 1) ^ (primitiveRestartEnabled ? 1 : 0);
+    key *= 0xBF58476D1CE4E5B9ull;
+    return static_cast<size_t>(key >> (64 - kCapacityLog2));
+}
+
+// static
+uint64_t IndexRangeCache::GetGranuleMask(size_t start, size_t end)
+{
+    ASSERT(start < end);
+    size_t firstGranule = start >> kGranuleShift;
+    size_t lastGranule  = (end - 1) >> kGranuleShift;
+    if (lastGranule - firstGranule >= 63)
     {
-        return count < rhs.count;
+        return ~uint64_t(0);
     }
-    if (primitiveRestartEnabled != rhs.primitiveRestartEnabled)
+
+    uint64_t bits = (uint64_t(1) << (lastGranule - firstGranule + 1)) - 1;
+    return RotateLeft64(bits, firstGranule);
+}
+
+// static
+size_t IndexRangeCache::GetEntryEnd(const Entry &entry)
+{
+    // Empty draws still get a byte so that they have a valid granule mask.
+    return entry.offset + std::max<size_t>(GetDrawElementsTypeSize(entry.type) * entry.count, 1);
+}
+
+void IndexRangeCache::eraseSlot(size_t slot)
+{
+    ASSERT(mEntries[slot].used);
+    mEntries[slot].used = false;
+    mSize--;
+
+    // Backward shift deletion: move later entries of the probe sequence into the hole when that
+    // brings them closer to their home slot, so lookups can keep stopping at the first free slot.
+    size_t hole = slot;
+    size_t next = (slot + 1) & kSlotMask;
+    for (size_t step = 1; step < kCapacity && mEntries[next].used; ++step)
     {
-        return primitiveRestartEnabled;
+        const Entry &entry = mEntries[next];
+        size_t homeSlot =
+            GetHomeSlot(entry.type, entry.offset, entry.count, entry.primitiveRestartEnabled);
+        if (((next - homeSlot) & kSlotMask) >= ((next - hole) & kSlotMask))
+        {
+            mEntries[hole]      = entry;
+            mEntries[next].used = false;
+            hole                = next;
+        }
+        next = (next + 1) & kSlotMask;
     }
-    return false;
 }
 
+IndexRangeCache::Entry::Entry()
+    : offset(0),
+      count(0),
+      range(),
+      type(DrawElementsType::InvalidEnum),
+      primitiveRestartEnabled(false),
+      used(false)
+{}
+
 }  // namespace gl
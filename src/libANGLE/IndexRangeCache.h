@@ -15,14 +15,26 @@
 #include "common/angleutils.h"
 #include "common/mathutil.h"
 
-#include <map>
+#include <vector>
 
 namespace gl
 {
 
-class IndexRangeCache
+// A small open-addressing hash table with linear probing.  Its size is bounded: when all the
+// slots an entry may probe are taken, the entry replaces the one in its home slot.  Storage is
+// only allocated once the first range is added, since most buffers are never used for indices.
+//
+// Invalidation is filtered through a bitmask with one bit per kGranuleSize bytes of the buffer,
+// wrapping every 64 granules.  Writes that don't touch any granule holding a cached range return
+// without looking at the table.
+class IndexRangeCache final : angle::NonCopyable
 {
   public:
+    static constexpr size_t kCapacity       = 64;
+    static constexpr size_t kMaxProbeLength = 8;
+    static constexpr size_t kGranuleShift   = 12;
+    static constexpr size_t kGranuleSize    = size_t(1) << kGranuleShift;
+
     IndexRangeCache();
     ~IndexRangeCache();
 
@@ -37,25 +49,37 @@ class IndexRangeCache
                    bool primitiveRestartEnabled,
                    IndexRange *outRange) const;
 
+    // Removes the ranges read from any byte in [offset, offset + size).
     void invalidateRange(size_t offset, size_t size);
     void clear();
 
+    size_t size() const { return mSize; }
+
   private:
-    struct IndexRangeKey
+    struct Entry
     {
-        IndexRangeKey();
-        IndexRangeKey(DrawElementsType type, size_t offset, size_t count, bool primitiveRestart);
-
-        bool operator<(const IndexRangeKey &rhs) const;
+        Entry();
 
-        DrawElementsType type;
         size_t offset;
         size_t count;
+        IndexRange range;
+        DrawElementsType type;
         bool primitiveRestartEnabled;
+        bool used;
     };
 
-    typedef std::map<IndexRangeKey, IndexRange> IndexRangeMap;
-    IndexRangeMap mIndexRangeCache;
+    static size_t GetHomeSlot(DrawElementsType type,
+                              size_t offset,
+                              size_t count,
+                              bool primitiveRestartEnabled);
+    static uint64_t GetGranuleMask(size_t start, size_t end);
+    static size_t GetEntryEnd(const Entry &entry);
+
+    void eraseSlot(size_t slot);
+
+    std::vector<Entry> mEntries;
+    size_t mSize;
+    uint64_t mGranuleMask;
 };
 
 }  // namespace gl
@@ -0,0 +1,151 @@
+//
+// Copyright 2019 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// IndexRangeCache_unittest.cpp: Unit tests for the gl::IndexRangeCache class.
+
+#include <gtest/gtest.h>
+
+#include "libANGLE/IndexRangeCache.h"
+
+using namespace gl;
+
+namespace
+{
+constexpr DrawElementsType kUShort = DrawElementsType::UnsignedShort;
+
+IndexRange MakeRange(size_t seed)
+{
+    return IndexRange(seed, seed + 10, seed + 20);
+}
+
+void ExpectRange(const IndexRangeCache &cache,
+                 DrawElementsType type,
+                 size_t offset,
+                 size_t count,
+                 bool primitiveRestart,
+                 const IndexRange &expected)
+{
+    IndexRange range;
+    ASSERT_TRUE(cache.findRange(type, offset, count, primitiveRestart, &range));
+    EXPECT_EQ(expected.start, range.start);
+    EXPECT_EQ(expected.end, range.end);
+    EXPECT_EQ(expected.vertexIndexCount, range.vertexIndexCount);
+}
+
+// Tests that ranges are found by their full key.
+TEST(IndexRangeCacheTest, AddAndFind)
+{
+    IndexRangeCache cache;
+    EXPECT_FALSE(cache.findRange(kUShort, 0, 6, false, nullptr));
+
+    cache.addRange(kUShort, 0, 6, false, MakeRange(1));
+    cache.addRange(kUShort, 0, 6, true, MakeRange(2));
+    cache.addRange(DrawElementsType::UnsignedInt, 0, 6, false, MakeRange(3));
+    cache.addRange(kUShort, 12, 6, false, MakeRange(4));
+    cache.addRange(kUShort, 0, 12, false, MakeRange(5));
+    EXPECT_EQ(5u, cache.size());
+
+    ExpectRange(cache, kUShort, 0, 6, false, MakeRange(1));
+    ExpectRange(cache, kUShort, 0, 6, true, MakeRange(2));
+    ExpectRange(cache, DrawElementsType::UnsignedInt, 0, 6, false, MakeRange(3));
+    ExpectRange(cache, kUShort, 12, 6, false, MakeRange(4));
+    ExpectRange(cache, kUShort, 0, 12, false, MakeRange(5));
+    EXPECT_FALSE(cache.findRange(DrawElementsType::UnsignedByte, 0, 6, false, nullptr));
+
+    // Adding an existing key replaces its range.
+    cache.addRange(kUShort, 0, 6, false, MakeRange(6));
+    EXPECT_EQ(5u, cache.size());
+    ExpectRange(cache, kUShort, 0, 6, false, MakeRange(6));
+
+    cache.clear();
+    EXPECT_EQ(0u, cache.size());
+    EXPECT_FALSE(cache.findRange(kUShort, 0, 6, false, nullptr));
+}
+
+// Tests that only the ranges overlapping the written bytes are invalidated.
+TEST(IndexRangeCacheTest, InvalidateOverlapping)
+{
+    IndexRangeCache cache;
+    cache.addRange(kUShort, 0, 50, false, MakeRange(1));    // [0, 100)
+    cache.addRange(kUShort, 100, 50, false, MakeRange(2));  // [100, 200)
+    cache.addRange(kUShort, 200, 50, false, MakeRange(3));  // [200, 300)
+
+    // Touching the end of a range doesn't invalidate it.
+    cache.invalidateRange(300, 16);
+    EXPECT_EQ(3u, cache.size());
+
+    cache.invalidateRange(150, 1);
+    EXPECT_EQ(2u, cache.size());
+    ExpectRange(cache, kUShort, 0, 50, false, MakeRange(1));
+    EXPECT_FALSE(cache.findRange(kUShort, 100, 50, false, nullptr));
+    ExpectRange(cache, kUShort, 200, 50, false, MakeRange(3));
+
+    cache.invalidateRange(99, 102);
+    EXPECT_EQ(0u, cache.size());
+}
+
+// Tests that writes far away from any cached range leave the cache alone, including ranges that
+// map to the same granule bit.
+TEST(IndexRangeCacheTest, InvalidateFiltered)
+{
+    constexpr size_t kWrapSize = IndexRangeCache::kGranuleSize * 64;
+
+    IndexRangeCache cache;
+    cache.addRange(kUShort, 0, 100, false, MakeRange(1));
+    cache.invalidateRange(IndexRangeCache::kGranuleSize * 5, 100);
+    EXPECT_EQ(1u, cache.size());
+
+    // This shares a granule bit with the cached range, but doesn't overlap it.
+    cache.invalidateRange(kWrapSize, 100);
+    EXPECT_EQ(1u, cache.size());
+
+    cache.invalidateRange(0, 1);
+    EXPECT_EQ(0u, cache.size());
+}
+
+// Tests that the cache stays bounded and consistent as it fills up and entries are removed.
+TEST(IndexRangeCacheTest, Bounded)
+{
+    constexpr size_t kRangeCount = IndexRangeCache::kCapacity * 4;
+
+    IndexRangeCache cache;
+    for (size_t index = 0; index < kRangeCount; ++index)
+    {
+        cache.addRange(kUShort, index * 64, 32, false, MakeRange(index));
+        ExpectRange(cache, kUShort, index * 64, 32, false, MakeRange(index));
+    }
+    EXPECT_LE(cache.size(), IndexRangeCache::kCapacity);
+
+    // Whatever is still cached has the right range.
+    size_t found = 0;
+    for (size_t index = 0; index < kRangeCount; ++index)
+    {
+        IndexRange range;
+        if (cache.findRange(kUShort, index * 64, 32, false, &range))
+        {
+            EXPECT_EQ(index, range.start);
+            found++;
+        }
+    }
+    EXPECT_EQ(cache.size(), found);
+
+    // Invalidate every other range and check that the rest is still reachable.
+    for (size_t index = 0; index < kRangeCount; index += 2)
+    {
+        cache.invalidateRange(index * 64, 1);
+    }
+    size_t remaining = 0;
+    for (size_t index = 0; index < kRangeCount; ++index)
+    {
+        bool cached = cache.findRange(kUShort, index * 64, 32, false, nullptr);
+        if (index % 2 == 0)
+        {
+            EXPECT_FALSE(cached);
+        }
+        remaining += cached ? 1 : 0;
+    }
+    EXPECT_EQ(cache.size(), remaining);
+}
+}  // anonymous namespace
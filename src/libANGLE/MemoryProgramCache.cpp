@@ -150,7 +150,12 @@ angle::Result MemoryProgramCache::getProgram(const Context *context,
         ANGLE_TRY(result);
 
         if (result == angle::Result::Continue)
+        {
+            // The binary was parsed in place; make sure the backend can keep reading it until the
+            // link is resolved, even if the cache entry is evicted meanwhile.
+            program->retainBinaryUntilLinkResolved(binaryProgram.getKeepAlive());
             return angle::Result::Continue;
+        }
 
         // Cache load failed, evict.
         if (mIssuedWarnings++ < kWarningLimit)
@@ -0,0 +1,87 @@
+//
+// Copyright 2019 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// MemoryShaderCache: Stores translated shaders in memory so the same shader doesn't have to be
+//   translated again, by another context or, if the blob cache is persisted, another process.
+
+#include "libANGLE/MemoryShaderCache.h"
+
+#include <anglebase/sha1.h>
+
+#include <sstream>
+
+#include "common/version.h"
+#include "libANGLE/Compiler.h"
+#include "libANGLE/Context.h"
+#include "libANGLE/Shader.h"
+
+namespace gl
+{
+
+MemoryShaderCache::MemoryShaderCache(egl::BlobCache &blobCache) : mBlobCache(blobCache) {}
+
+MemoryShaderCache::~MemoryShaderCache() {}
+
+// static
+void MemoryShaderCache::ComputeHash(const Context *context,
+                                    ShCompilerInstance *compilerInstance,
+                                    const std::string &source,
+                                    ShCompileOptions compileOptions,
+                                    egl::BlobCache::Key *hashOut)
+{
+    // The separator keeps the fields from running into each other.  The source goes last, so it
+    // can't be confused with the other fields.
+    constexpr char kSeparator = ':';
+
+    std::ostringstream hashStream;
+    hashStream << ANGLE_COMMIT_HASH << kSeparator << ANGLE_SH_VERSION << kSeparator
+               << context->getString(GL_RENDERER) << kSeparator
+               << context->getClientMajorVersion() << kSeparator
+               << context->getClientMinorVersion() << kSeparator
+               << context->getExtensions().webglCompatibility << kSeparator
+               << compilerInstance->getShaderType() << kSeparator
+               << compilerInstance->getShaderOutputType() << kSeparator << compileOptions
+               << kSeparator << compilerInstance->getBuiltinResourcesString() << kSeparator
+               << source.length() << kSeparator << source;
+
+    const std::string &shaderKey = hashStream.str();
+    angle::base::SHA1HashBytes(reinterpret_cast<const unsigned char *>(shaderKey.c_str()),
+                               shaderKey.length(), hashOut->data());
+}
+
+bool MemoryShaderCache::getShader(const Context *context,
+                                  const egl::BlobCache::Key &shaderHash,
+                                  angle::MemoryBuffer *translationOut)
+{
+    // The blob may live in the context's scratch buffer, which is reused by later calls, so it is
+    // copied out.
+    egl::BlobCache::Value translation;
+    if (!mBlobCache.get(context->getScratchBuffer(), shaderHash, &translation))
+    {
+        return false;
+    }
+
+    if (!translationOut->resize(translation.size()))
+    {
+        return false;
+    }
+    memcpy(translationOut->data(), translation.data(), translation.size());
+    return true;
+}
+
+void MemoryShaderCache::putShader(const egl::BlobCache::Key &shaderHash, const Shader *shader)
+{
+    angle::MemoryBuffer serializedShader;
+    shader->serialize(&serializedShader);
+
+    mBlobCache.put(shaderHash, std::move(serializedShader));
+}
+
+void MemoryShaderCache::remove(const egl::BlobCache::Key &shaderHash)
+{
+    mBlobCache.remove(shaderHash);
+}
+
+}  // namespace gl
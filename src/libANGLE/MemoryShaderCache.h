@@ -0,0 +1,59 @@
+//
+// Copyright 2019 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// MemoryShaderCache: Stores translated shaders in memory so the same shader doesn't have to be
+//   translated again, by another context or, if the blob cache is persisted, another process.
+
+#ifndef LIBANGLE_MEMORY_SHADER_CACHE_H_
+#define LIBANGLE_MEMORY_SHADER_CACHE_H_
+
+#include <string>
+
+#include <GLSLANG/ShaderLang.h>
+
+#include "common/MemoryBuffer.h"
+#include "libANGLE/BlobCache.h"
+
+namespace gl
+{
+class Context;
+class Shader;
+class ShCompilerInstance;
+
+class MemoryShaderCache final : angle::NonCopyable
+{
+  public:
+    // |blobCache| is the display's shader cache, which is separate from the program cache.
+    explicit MemoryShaderCache(egl::BlobCache &blobCache);
+    ~MemoryShaderCache();
+
+    // The hash covers everything the translation depends on: the source, the compile options, the
+    // translator's built-in resources and output, and the ANGLE version.
+    static void ComputeHash(const Context *context,
+                            ShCompilerInstance *compilerInstance,
+                            const std::string &source,
+                            ShCompileOptions compileOptions,
+                            egl::BlobCache::Key *hashOut);
+
+    // Check if the cache contains the translation of a shader, and copy it if so.
+    bool getShader(const Context *context,
+                   const egl::BlobCache::Key &shaderHash,
+                   angle::MemoryBuffer *translationOut);
+
+    // Serialize the translation of a compiled shader and store it.
+    void putShader(const egl::BlobCache::Key &shaderHash, const Shader *shader);
+
+    // Evict a translation from the cache.
+    void remove(const egl::BlobCache::Key &shaderHash);
+
+    bool isCachingEnabled() const { return mBlobCache.isCachingEnabled(); }
+
+  private:
+    egl::BlobCache &mBlobCache;
+};
+
+}  // namespace gl
+
+#endif  // LIBANGLE_MEMORY_SHADER_CACHE_H_
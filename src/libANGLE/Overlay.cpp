@@ -27,6 +27,13 @@ constexpr std::pair<const char *, WidgetId> kWidgetNames[] = {
     {"VulkanValidationMessageCount", WidgetId::VulkanValidationMessageCount},
     {"VulkanCommandGraphSize", WidgetId::VulkanCommandGraphSize},
     {"VulkanSecondaryCommandBufferPoolWaste", WidgetId::VulkanSecondaryCommandBufferPoolWaste},
+    {"VulkanPrewarmedPipelineHits", WidgetId::VulkanPrewarmedPipelineHits},
+    {"VulkanOnDemandPipelineCreations", WidgetId::VulkanOnDemandPipelineCreations},
+    {"VulkanDeviceMemoryAllocations", WidgetId::VulkanDeviceMemoryAllocations},
+    {"VulkanDeviceMemoryUsage", WidgetId::VulkanDeviceMemoryUsage},
+    {"VulkanBufferStallsAvoided", WidgetId::VulkanBufferStallsAvoided},
+    {"VulkanDescriptorSetCacheHits", WidgetId::VulkanDescriptorSetCacheHits},
+    {"VulkanDescriptorSetCacheMisses", WidgetId::VulkanDescriptorSetCacheMisses},
 };
 }  // namespace
 
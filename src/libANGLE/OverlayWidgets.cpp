@@ -210,6 +210,41 @@ class AppendWidgetDataHelper
                                                             TextWidgetData *textWidget,
                                                             GraphWidgetData *graphWidget,
                                                             OverlayWidgetCounts *widgetCounts);
+    static void AppendVulkanPrewarmedPipelineHits(const overlay::Widget *widget,
+                                                  const gl::Extents &imageExtent,
+                                                  TextWidgetData *textWidget,
+                                                  GraphWidgetData *graphWidget,
+                                                  OverlayWidgetCounts *widgetCounts);
+    static void AppendVulkanOnDemandPipelineCreations(const overlay::Widget *widget,
+                                                      const gl::Extents &imageExtent,
+                                                      TextWidgetData *textWidget,
+                                                      GraphWidgetData *graphWidget,
+                                                      OverlayWidgetCounts *widgetCounts);
+    static void AppendVulkanDeviceMemoryAllocations(const overlay::Widget *widget,
+                                                    const gl::Extents &imageExtent,
+                                                    TextWidgetData *textWidget,
+                                                    GraphWidgetData *graphWidget,
+                                                    OverlayWidgetCounts *widgetCounts);
+    static void AppendVulkanDeviceMemoryUsage(const overlay::Widget *widget,
+                                              const gl::Extents &imageExtent,
+                                              TextWidgetData *textWidget,
+                                              GraphWidgetData *graphWidget,
+                                              OverlayWidgetCounts *widgetCounts);
+    static void AppendVulkanBufferStallsAvoided(const overlay::Widget *widget,
+                                                const gl::Extents &imageExtent,
+                                                TextWidgetData *textWidget,
+                                                GraphWidgetData *graphWidget,
+                                                OverlayWidgetCounts *widgetCounts);
+    static void AppendVulkanDescriptorSetCacheHits(const overlay::Widget *widget,
+                                                   const gl::Extents &imageExtent,
+                                                   TextWidgetData *textWidget,
+                                                   GraphWidgetData *graphWidget,
+                                                   OverlayWidgetCounts *widgetCounts);
+    static void AppendVulkanDescriptorSetCacheMisses(const overlay::Widget *widget,
+                                                     const gl::Extents &imageExtent,
+                                                     TextWidgetData *textWidget,
+                                                     GraphWidgetData *graphWidget,
+                                                     OverlayWidgetCounts *widgetCounts);
 
   private:
     static std::ostream &OutputPerSecond(std::ostream &out, const overlay::PerSecond *perSecond);
@@ -366,6 +401,105 @@ void AppendWidgetDataHelper::AppendVulkanSecondaryCommandBufferPoolWaste(
     }
 }
 
+void AppendWidgetDataHelper::AppendVulkanPrewarmedPipelineHits(const overlay::Widget *widget,
+                                                               const gl::Extents &imageExtent,
+                                                               TextWidgetData *textWidget,
+                                                               GraphWidgetData *graphWidget,
+                                                               OverlayWidgetCounts *widgetCounts)
+{
+    const overlay::Count *prewarmedPipelineHits = static_cast<const overlay::Count *>(widget);
+    std::ostringstream text;
+    text << "Pre-warmed Pipeline Hits: ";
+    OutputCount(text, prewarmedPipelineHits);
+
+    AppendTextCommon(widget, imageExtent, text.str(), textWidget, widgetCounts);
+}
+
+void AppendWidgetDataHelper::AppendVulkanOnDemandPipelineCreations(
+    const overlay::Widget *widget,
+    const gl::Extents &imageExtent,
+    TextWidgetData *textWidget,
+    GraphWidgetData *graphWidget,
+    OverlayWidgetCounts *widgetCounts)
+{
+    const overlay::Count *onDemandPipelineCreations = static_cast<const overlay::Count *>(widget);
+    std::ostringstream text;
+    text << "On-demand Pipelines: ";
+    OutputCount(text, onDemandPipelineCreations);
+
+    AppendTextCommon(widget, imageExtent, text.str(), textWidget, widgetCounts);
+}
+
+void AppendWidgetDataHelper::AppendVulkanDeviceMemoryAllocations(const overlay::Widget *widget,
+                                                                 const gl::Extents &imageExtent,
+                                                                 TextWidgetData *textWidget,
+                                                                 GraphWidgetData *graphWidget,
+                                                                 OverlayWidgetCounts *widgetCounts)
+{
+    const overlay::Count *deviceMemoryAllocations = static_cast<const overlay::Count *>(widget);
+    std::ostringstream text;
+    text << "Device Memory Allocations: ";
+    OutputCount(text, deviceMemoryAllocations);
+
+    AppendTextCommon(widget, imageExtent, text.str(), textWidget, widgetCounts);
+}
+
+void AppendWidgetDataHelper::AppendVulkanDeviceMemoryUsage(const overlay::Widget *widget,
+                                                           const gl::Extents &imageExtent,
+                                                           TextWidgetData *textWidget,
+                                                           GraphWidgetData *graphWidget,
+                                                           OverlayWidgetCounts *widgetCounts)
+{
+    const overlay::Text *deviceMemoryUsage = static_cast<const overlay::Text *>(widget);
+    std::ostringstream text;
+    text << "Device Memory: ";
+    OutputText(text, deviceMemoryUsage);
+
+    AppendTextCommon(widget, imageExtent, text.str(), textWidget, widgetCounts);
+}
+
+void AppendWidgetDataHelper::AppendVulkanBufferStallsAvoided(const overlay::Widget *widget,
+                                                             const gl::Extents &imageExtent,
+                                                             TextWidgetData *textWidget,
+                                                             GraphWidgetData *graphWidget,
+                                                             OverlayWidgetCounts *widgetCounts)
+{
+    const overlay::Count *bufferStallsAvoided = static_cast<const overlay::Count *>(widget);
+    std::ostringstream text;
+    text << "Buffer Stalls Avoided: ";
+    OutputCount(text, bufferStallsAvoided);
+
+    AppendTextCommon(widget, imageExtent, text.str(), textWidget, widgetCounts);
+}
+
+void AppendWidgetDataHelper::AppendVulkanDescriptorSetCacheHits(const overlay::Widget *widget,
+                                                                const gl::Extents &imageExtent,
+                                                                TextWidgetData *textWidget,
+                                                                GraphWidgetData *graphWidget,
+                                                                OverlayWidgetCounts *widgetCounts)
+{
+    const overlay::Count *cacheHits = static_cast<const overlay::Count *>(widget);
+    std::ostringstream text;
+    text << "Descriptor Set Cache Hits: ";
+    OutputCount(text, cacheHits);
+
+    AppendTextCommon(widget, imageExtent, text.str(), textWidget, widgetCounts);
+}
+
+void AppendWidgetDataHelper::AppendVulkanDescriptorSetCacheMisses(const overlay::Widget *widget,
+                                                                  const gl::Extents &imageExtent,
+                                                                  TextWidgetData *textWidget,
+                                                                  GraphWidgetData *graphWidget,
+                                                                  OverlayWidgetCounts *widgetCounts)
+{
+    const overlay::Count *cacheMisses = static_cast<const overlay::Count *>(widget);
+    std::ostringstream text;
+    text << "Descriptor Set Cache Misses: ";
+    OutputCount(text, cacheMisses);
+
+    AppendTextCommon(widget, imageExtent, text.str(), textWidget, widgetCounts);
+}
+
 std::ostream &AppendWidgetDataHelper::OutputPerSecond(std::ostream &out,
                                                       const overlay::PerSecond *perSecond)
 {
@@ -395,6 +529,20 @@ constexpr angle::PackedEnumMap<WidgetId, AppendWidgetDataFunc> kWidgetIdToAppend
      overlay_impl::AppendWidgetDataHelper::AppendVulkanCommandGraphSize},
     {WidgetId::VulkanSecondaryCommandBufferPoolWaste,
      overlay_impl::AppendWidgetDataHelper::AppendVulkanSecondaryCommandBufferPoolWaste},
+    {WidgetId::VulkanPrewarmedPipelineHits,
+     overlay_impl::AppendWidgetDataHelper::AppendVulkanPrewarmedPipelineHits},
+    {WidgetId::VulkanOnDemandPipelineCreations,
+     overlay_impl::AppendWidgetDataHelper::AppendVulkanOnDemandPipelineCreations},
+    {WidgetId::VulkanDeviceMemoryAllocations,
+     overlay_impl::AppendWidgetDataHelper::AppendVulkanDeviceMemoryAllocations},
+    {WidgetId::VulkanDeviceMemoryUsage,
+     overlay_impl::AppendWidgetDataHelper::AppendVulkanDeviceMemoryUsage},
+    {WidgetId::VulkanBufferStallsAvoided,
+     overlay_impl::AppendWidgetDataHelper::AppendVulkanBufferStallsAvoided},
+    {WidgetId::VulkanDescriptorSetCacheHits,
+     overlay_impl::AppendWidgetDataHelper::AppendVulkanDescriptorSetCacheHits},
+    {WidgetId::VulkanDescriptorSetCacheMisses,
+     overlay_impl::AppendWidgetDataHelper::AppendVulkanDescriptorSetCacheMisses},
 };
 }
 
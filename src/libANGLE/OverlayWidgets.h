@@ -61,6 +61,20 @@ enum class WidgetId
     VulkanCommandGraphSize,
     // Secondary Command Buffer pool memory waste (RunningHistogram).
     VulkanSecondaryCommandBufferPoolWaste,
+    // Number of pre-warmed graphics pipelines that were used (Count).
+    VulkanPrewarmedPipelineHits,
+    // Number of graphics pipelines created on demand at draw time (Count).
+    VulkanOnDemandPipelineCreations,
+    // Number of VkDeviceMemory objects allocated (Count).
+    VulkanDeviceMemoryAllocations,
+    // Usage of the device memory blocks buffers and images are sub-allocated from (Text).
+    VulkanDeviceMemoryUsage,
+    // Number of buffer updates streamed through new memory instead of waiting for the GPU (Count).
+    VulkanBufferStallsAvoided,
+    // Number of descriptor set updates that reused a cached descriptor set (Count).
+    VulkanDescriptorSetCacheHits,
+    // Number of descriptor set updates that allocated and wrote a new descriptor set (Count).
+    VulkanDescriptorSetCacheMisses,
 
     InvalidEnum,
     EnumCount = InvalidEnum,
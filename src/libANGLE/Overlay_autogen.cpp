@@ -188,6 +188,173 @@ void Overlay::initOverlayWidgets()
             widget->description.color[3]  = 1.0;
         }
     }
+
+    {
+        Count *widget = new Count;
+        {
+            const int32_t fontSize = GetFontSize(kFontLayerSmall, kLargeFont);
+            const int32_t offsetX  = -10;
+            const int32_t offsetY  = 10;
+            const int32_t width    = 35 * kFontGlyphWidths[fontSize];
+            const int32_t height   = kFontGlyphHeights[fontSize];
+
+            widget->type      = WidgetType::Count;
+            widget->fontSize  = fontSize;
+            widget->coords[0] = offsetX - width;
+            widget->coords[1] = offsetY;
+            widget->coords[2] = offsetX;
+            widget->coords[3] = offsetY + height;
+            widget->color[0]  = 0.498039215686;
+            widget->color[1]  = 1.0;
+            widget->color[2]  = 0.498039215686;
+            widget->color[3]  = 1.0;
+        }
+        mState.mOverlayWidgets[WidgetId::VulkanPrewarmedPipelineHits].reset(widget);
+    }
+
+    {
+        Count *widget = new Count;
+        {
+            const int32_t fontSize = GetFontSize(kFontLayerSmall, kLargeFont);
+            const int32_t offsetX  = -10;
+            const int32_t offsetY =
+                mState.mOverlayWidgets[WidgetId::VulkanPrewarmedPipelineHits]->coords[3];
+            const int32_t width  = 35 * kFontGlyphWidths[fontSize];
+            const int32_t height = kFontGlyphHeights[fontSize];
+
+            widget->type      = WidgetType::Count;
+            widget->fontSize  = fontSize;
+            widget->coords[0] = offsetX - width;
+            widget->coords[1] = offsetY;
+            widget->coords[2] = offsetX;
+            widget->coords[3] = offsetY + height;
+            widget->color[0]  = 1.0;
+            widget->color[1]  = 0.749019607843;
+            widget->color[2]  = 0.498039215686;
+            widget->color[3]  = 1.0;
+        }
+        mState.mOverlayWidgets[WidgetId::VulkanOnDemandPipelineCreations].reset(widget);
+    }
+
+    {
+        Count *widget = new Count;
+        {
+            const int32_t fontSize = GetFontSize(kFontLayerSmall, kLargeFont);
+            const int32_t offsetX  = -10;
+            const int32_t offsetY =
+                mState.mOverlayWidgets[WidgetId::VulkanOnDemandPipelineCreations]->coords[3];
+            const int32_t width  = 35 * kFontGlyphWidths[fontSize];
+            const int32_t height = kFontGlyphHeights[fontSize];
+
+            widget->type      = WidgetType::Count;
+            widget->fontSize  = fontSize;
+            widget->coords[0] = offsetX - width;
+            widget->coords[1] = offsetY;
+            widget->coords[2] = offsetX;
+            widget->coords[3] = offsetY + height;
+            widget->color[0]  = 0.749019607843;
+            widget->color[1]  = 0.749019607843;
+            widget->color[2]  = 1.0;
+            widget->color[3]  = 1.0;
+        }
+        mState.mOverlayWidgets[WidgetId::VulkanDeviceMemoryAllocations].reset(widget);
+    }
+
+    {
+        Text *widget = new Text;
+        {
+            const int32_t fontSize = GetFontSize(kFontLayerSmall, kLargeFont);
+            const int32_t offsetX  = -10;
+            const int32_t offsetY =
+                mState.mOverlayWidgets[WidgetId::VulkanDeviceMemoryAllocations]->coords[3];
+            const int32_t width  = 70 * kFontGlyphWidths[fontSize];
+            const int32_t height = kFontGlyphHeights[fontSize];
+
+            widget->type      = WidgetType::Text;
+            widget->fontSize  = fontSize;
+            widget->coords[0] = offsetX - width;
+            widget->coords[1] = offsetY;
+            widget->coords[2] = offsetX;
+            widget->coords[3] = offsetY + height;
+            widget->color[0]  = 0.749019607843;
+            widget->color[1]  = 0.749019607843;
+            widget->color[2]  = 1.0;
+            widget->color[3]  = 1.0;
+        }
+        mState.mOverlayWidgets[WidgetId::VulkanDeviceMemoryUsage].reset(widget);
+    }
+
+    {
+        Count *widget = new Count;
+        {
+            const int32_t fontSize = GetFontSize(kFontLayerSmall, kLargeFont);
+            const int32_t offsetX  = -10;
+            const int32_t offsetY =
+                mState.mOverlayWidgets[WidgetId::VulkanDeviceMemoryUsage]->coords[3];
+            const int32_t width  = 35 * kFontGlyphWidths[fontSize];
+            const int32_t height = kFontGlyphHeights[fontSize];
+
+            widget->type      = WidgetType::Count;
+            widget->fontSize  = fontSize;
+            widget->coords[0] = offsetX - width;
+            widget->coords[1] = offsetY;
+            widget->coords[2] = offsetX;
+            widget->coords[3] = offsetY + height;
+            widget->color[0]  = 1.0;
+            widget->color[1]  = 1.0;
+            widget->color[2]  = 0.498039215686;
+            widget->color[3]  = 1.0;
+        }
+        mState.mOverlayWidgets[WidgetId::VulkanBufferStallsAvoided].reset(widget);
+    }
+
+    {
+        Count *widget = new Count;
+        {
+            const int32_t fontSize = GetFontSize(kFontLayerSmall, kLargeFont);
+            const int32_t offsetX  = -10;
+            const int32_t offsetY =
+                mState.mOverlayWidgets[WidgetId::VulkanBufferStallsAvoided]->coords[3];
+            const int32_t width  = 35 * kFontGlyphWidths[fontSize];
+            const int32_t height = kFontGlyphHeights[fontSize];
+
+            widget->type      = WidgetType::Count;
+            widget->fontSize  = fontSize;
+            widget->coords[0] = offsetX - width;
+            widget->coords[1] = offsetY;
+            widget->coords[2] = offsetX;
+            widget->coords[3] = offsetY + height;
+            widget->color[0]  = 1.0;
+            widget->color[1]  = 1.0;
+            widget->color[2]  = 0.498039215686;
+            widget->color[3]  = 1.0;
+        }
+        mState.mOverlayWidgets[WidgetId::VulkanDescriptorSetCacheHits].reset(widget);
+    }
+
+    {
+        Count *widget = new Count;
+        {
+            const int32_t fontSize = GetFontSize(kFontLayerSmall, kLargeFont);
+            const int32_t offsetX  = -10;
+            const int32_t offsetY =
+                mState.mOverlayWidgets[WidgetId::VulkanDescriptorSetCacheHits]->coords[3];
+            const int32_t width  = 35 * kFontGlyphWidths[fontSize];
+            const int32_t height = kFontGlyphHeights[fontSize];
+
+            widget->type      = WidgetType::Count;
+            widget->fontSize  = fontSize;
+            widget->coords[0] = offsetX - width;
+            widget->coords[1] = offsetY;
+            widget->coords[2] = offsetX;
+            widget->coords[3] = offsetY + height;
+            widget->color[0]  = 1.0;
+            widget->color[1]  = 1.0;
+            widget->color[2]  = 0.498039215686;
+            widget->color[3]  = 1.0;
+        }
+        mState.mOverlayWidgets[WidgetId::VulkanDescriptorSetCacheMisses].reset(widget);
+    }
 }
 
 }  // namespace gl
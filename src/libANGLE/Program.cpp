@@ -772,6 +772,7 @@ struct Program::LinkingState
     egl::BlobCache::Key programHash;
     std::unique_ptr<rx::LinkEvent> linkEvent;
     bool linkingFromBinary;
+    std::shared_ptr<const void> retainedBinary;
 };
 
 const char *const g_fakepath = "C:\\fakepath";
@@ -1235,6 +1236,7 @@ Program::Program(rx::GLImplFactory *factory, ShaderProgramManager *manager, Shad
     : mProgram(factory->createProgram(mState)),
       mValidated(false),
       mLinked(false),
+      mLinkSerial(0),
       mLinkResolved(true),
       mDeleteStatus(false),
       mRefCount(0),
@@ -1638,6 +1640,8 @@ void Program::resolveLinkImpl(const Context *context)
         return;
     }
 
+    mLinkSerial++;
+
     if (linkingState->linkingFromBinary)
     {
         // All internal Program state is already loaded from the binary.
@@ -1905,6 +1909,15 @@ angle::Result Program::loadBinary(const Context *context,
 #endif  // #if ANGLE_PROGRAM_BINARY_LOAD == ANGLE_ENABLED
 }
 
+void Program::retainBinaryUntilLinkResolved(std::shared_ptr<const void> binary)
+{
+    if (mLinkingState)
+    {
+        ASSERT(mLinkingState->linkingFromBinary);
+        mLinkingState->retainedBinary = std::move(binary);
+    }
+}
+
 angle::Result Program::saveBinary(Context *context,
                                   GLenum *binaryFormat,
                                   void *binary,
@@ -622,6 +622,14 @@ class Program final : angle::NonCopyable, public LabeledObject
         return mLinked;
     }
 
+    // Bumped by each successful link, so contexts that share the program can tell whether the
+    // executable they last synced is still current.
+    uint32_t getLinkSerial() const
+    {
+        ASSERT(mLinkResolved);
+        return mLinkSerial;
+    }
+
     bool hasLinkedShaderStage(ShaderType shaderType) const
     {
         ASSERT(shaderType != ShaderType::InvalidEnum);
@@ -633,6 +641,9 @@ class Program final : angle::NonCopyable, public LabeledObject
                              GLenum binaryFormat,
                              const void *binary,
                              GLsizei length);
+    // Keeps the memory of a binary passed to loadBinary() alive until the link is resolved.  The
+    // program cache uses this for blobs that are parsed in place rather than copied.
+    void retainBinaryUntilLinkResolved(std::shared_ptr<const void> binary);
     angle::Result saveBinary(Context *context,
                              GLenum *binaryFormat,
                              void *binary,
@@ -1094,6 +1105,7 @@ class Program final : angle::NonCopyable, public LabeledObject
     ProgramAliasedBindings mFragmentOutputIndexes;
 
     bool mLinked;
+    uint32_t mLinkSerial;
     bool mLinkResolved;
     std::unique_ptr<LinkingState> mLinkingState;
     bool mDeleteStatus;  // Flag to indicate that the program can be deleted when no longer in use
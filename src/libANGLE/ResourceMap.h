@@ -4,8 +4,14 @@
 // found in the LICENSE file.
 //
 // ResourceMap:
-//   An optimized resource map which packs the first set of allocated objects into a
-//   flat array, and then falls back to an unordered map for the higher handle values.
+//   An optimized resource map which stores the objects of the first million handle values in a
+//   dense table of fixed-size pages, and then falls back to an unordered map for the higher
+//   handle values.
+//
+//   Pages are allocated when the first handle in their range is assigned and are never moved or
+//   freed until the map is cleared, so query() and contains() on dense handles may run
+//   concurrently with assign() and erase() from one other thread.  Lookups of handles above the
+//   dense limit, iteration and the other methods still need to be serialized with the writer.
 //
 
 #ifndef LIBANGLE_RESOURCE_MAP_H_
@@ -13,6 +19,10 @@
 
 #include "libANGLE/angletypes.h"
 
+#include <array>
+#include <atomic>
+#include <memory>
+
 namespace gl
 {
 
@@ -26,9 +36,14 @@ class ResourceMap final : angle::NonCopyable
     ANGLE_INLINE ResourceType *query(IDType id) const
     {
         GLuint handle = GetIDValue(id);
-        if (handle < mFlatResourcesSize)
+        if (handle < kDenseHandleLimit)
         {
-            ResourceType *value = mFlatResources[handle];
+            const Page *page = getPage(handle);
+            if (page == nullptr)
+            {
+                return nullptr;
+            }
+            ResourceType *value = page->load(handle);
             return (value == InvalidPointer() ? nullptr : value);
         }
         auto it = mHashedResources.find(handle);
@@ -76,56 +91,132 @@ class ResourceMap final : angle::NonCopyable
     Iterator end() const;
     Iterator find(IDType handle) const;
 
-    // Not a constant-time operation, should only be used for verification.
     bool empty() const;
 
   private:
     friend class Iterator;
 
+    // 256 handles per page.
+    static constexpr GLuint kPageShift = 8;
+    static constexpr GLuint kPageSize  = 1u << kPageShift;
+    static constexpr GLuint kPageMask  = kPageSize - 1;
+
+    // Handles below this limit are stored in pages. Generated handles are allocated from 1
+    // upwards, so only applications that choose their own large names use the hash map.
+    static constexpr GLuint kDenseHandleLimit = 0x100000;
+
+    // Start with a directory for 2 pages, which doubles as pages are added.
+    static constexpr size_t kInitialPageCount = 2;
+
+    class Page final : angle::NonCopyable
+    {
+      public:
+        Page();
+
+        ANGLE_INLINE ResourceType *load(GLuint handle) const
+        {
+            return mSlots[handle & kPageMask].load(std::memory_order_acquire);
+        }
+
+        ANGLE_INLINE void store(GLuint handle, ResourceType *resource)
+        {
+            mSlots[handle & kPageMask].store(resource, std::memory_order_release);
+        }
+
+        // The number of slots holding a resource, used to skip empty pages when iterating.  Only
+        // accessed by the writer.
+        size_t resourceCount;
+
+      private:
+        std::array<std::atomic<ResourceType *>, kPageSize> mSlots;
+    };
+
+    // The page pointers of the dense table.  When the directory grows, the previous directory is
+    // kept alive until the map is cleared so that concurrent readers can still use it.
+    struct PageDirectory final : angle::NonCopyable
+    {
+        PageDirectory(size_t pageCountIn);
+
+        size_t pageCount;
+        std::unique_ptr<std::atomic<Page *>[]> pages;
+    };
+
+    ANGLE_INLINE Page *getPage(GLuint handle) const
+    {
+        const PageDirectory *directory = mDirectory.load(std::memory_order_acquire);
+        size_t pageIndex               = handle >> kPageShift;
+        if (pageIndex >= directory->pageCount)
+        {
+            return nullptr;
+        }
+        return directory->pages[pageIndex].load(std::memory_order_acquire);
+    }
+
+    Page *getOrCreatePage(GLuint handle);
+    GLuint denseSize() const;
+    void freePages();
+
     GLuint nextNonNullResource(size_t flatIndex) const;
 
+    static bool IsResource(ResourceType *value);
+
     // constexpr methods cannot contain reinterpret_cast, so we need a static method.
     static ResourceType *InvalidPointer();
     static constexpr intptr_t kInvalidPointer = static_cast<intptr_t>(-1);
 
-    // Start with 32 maximum elements in the map, which can grow.
-    static constexpr size_t kInitialFlatResourcesSize = 0x20;
-
-    // Experimental testing suggests that 16k is a reasonable upper limit.
-    static constexpr size_t kFlatResourcesLimit = 0x4000;
+    std::atomic<PageDirectory *> mDirectory;
 
-    // Size of one map element.
-    static constexpr size_t kElementSize = sizeof(ResourceType *);
+    // Owns the current directory, which is last, and the retired ones.
+    std::vector<std::unique_ptr<PageDirectory>> mDirectories;
 
-    size_t mFlatResourcesSize;
-    ResourceType **mFlatResources;
+    // The number of slots in all pages holding a resource.
+    size_t mDenseResourceCount;
 
     // A map of GL objects indexed by object ID.
     HashMap mHashedResources;
 };
 
 template <typename ResourceType, typename IDType>
-ResourceMap<ResourceType, IDType>::ResourceMap()
-    : mFlatResourcesSize(kInitialFlatResourcesSize),
-      mFlatResources(new ResourceType *[kInitialFlatResourcesSize])
+ResourceMap<ResourceType, IDType>::Page::Page() : resourceCount(0)
 {
-    memset(mFlatResources, kInvalidPointer, mFlatResourcesSize * kElementSize);
+    for (std::atomic<ResourceType *> &slot : mSlots)
+    {
+        slot.store(InvalidPointer(), std::memory_order_relaxed);
+    }
+}
+
+template <typename ResourceType, typename IDType>
+ResourceMap<ResourceType, IDType>::PageDirectory::PageDirectory(size_t pageCountIn)
+    : pageCount(pageCountIn), pages(new std::atomic<Page *>[pageCountIn])
+{
+    for (size_t pageIndex = 0; pageIndex < pageCount; ++pageIndex)
+    {
+        pages[pageIndex].store(nullptr, std::memory_order_relaxed);
+    }
+}
+
+template <typename ResourceType, typename IDType>
+ResourceMap<ResourceType, IDType>::ResourceMap() : mDirectory(nullptr), mDenseResourceCount(0)
+{
+    mDirectories.emplace_back(new PageDirectory(kInitialPageCount));
+    mDirectory.store(mDirectories.back().get(), std::memory_order_release);
 }
 
 template <typename ResourceType, typename IDType>
 ResourceMap<ResourceType, IDType>::~ResourceMap()
 {
     ASSERT(empty());
-    delete[] mFlatResources;
+    freePages();
 }
 
 template <typename ResourceType, typename IDType>
 ANGLE_INLINE bool ResourceMap<ResourceType, IDType>::contains(IDType id) const
 {
     GLuint handle = GetIDValue(id);
-    if (handle < mFlatResourcesSize)
+    if (handle < kDenseHandleLimit)
     {
-        return (mFlatResources[handle] != InvalidPointer());
+        const Page *page = getPage(handle);
+        return (page != nullptr && page->load(handle) != InvalidPointer());
     }
     return (mHashedResources.find(handle) != mHashedResources.end());
 }
@@ -134,15 +225,27 @@ template <typename ResourceType, typename IDType>
 bool ResourceMap<ResourceType, IDType>::erase(IDType id, ResourceType **resourceOut)
 {
     GLuint handle = GetIDValue(id);
-    if (handle < mFlatResourcesSize)
+    if (handle < kDenseHandleLimit)
     {
-        auto &value = mFlatResources[handle];
+        Page *page = getPage(handle);
+        if (page == nullptr)
+        {
+            return false;
+        }
+
+        ResourceType *value = page->load(handle);
         if (value == InvalidPointer())
         {
             return false;
         }
         *resourceOut = value;
-        value        = InvalidPointer();
+        page->store(handle, InvalidPointer());
+
+        if (IsResource(value))
+        {
+            page->resourceCount--;
+            mDenseResourceCount--;
+        }
     }
     else
     {
@@ -161,28 +264,23 @@ template <typename ResourceType, typename IDType>
 void ResourceMap<ResourceType, IDType>::assign(IDType id, ResourceType *resource)
 {
     GLuint handle = GetIDValue(id);
-    if (handle < kFlatResourcesLimit)
+    if (handle < kDenseHandleLimit)
     {
-        if (handle >= mFlatResourcesSize)
-        {
-            // Use power-of-two.
-            size_t newSize = mFlatResourcesSize;
-            while (newSize <= handle)
-            {
-                newSize *= 2;
-            }
+        Page *page = getOrCreatePage(handle);
 
-            ResourceType **oldResources = mFlatResources;
+        ResourceType *previous = page->load(handle);
+        page->store(handle, resource);
 
-            mFlatResources = new ResourceType *[newSize];
-            memset(&mFlatResources[mFlatResourcesSize], kInvalidPointer,
-                   (newSize - mFlatResourcesSize) * kElementSize);
-            memcpy(mFlatResources, oldResources, mFlatResourcesSize * kElementSize);
-            mFlatResourcesSize = newSize;
-            delete[] oldResources;
+        if (IsResource(previous))
+        {
+            page->resourceCount--;
+            mDenseResourceCount--;
+        }
+        if (IsResource(resource))
+        {
+            page->resourceCount++;
+            mDenseResourceCount++;
         }
-        ASSERT(mFlatResourcesSize > handle);
-        mFlatResources[handle] = resource;
     }
     else
     {
@@ -200,50 +298,128 @@ typename ResourceMap<ResourceType, IDType>::Iterator ResourceMap<ResourceType, I
 template <typename ResourceType, typename IDType>
 typename ResourceMap<ResourceType, IDType>::Iterator ResourceMap<ResourceType, IDType>::end() const
 {
-    return Iterator(*this, static_cast<GLuint>(mFlatResourcesSize), mHashedResources.end());
+    return Iterator(*this, denseSize(), mHashedResources.end());
 }
 
 template <typename ResourceType, typename IDType>
 typename ResourceMap<ResourceType, IDType>::Iterator ResourceMap<ResourceType, IDType>::find(
-    IDType handle) const
+    IDType id) const
 {
-    if (handle < mFlatResourcesSize)
+    GLuint handle = GetIDValue(id);
+    if (handle < kDenseHandleLimit)
     {
-        return (mFlatResources[handle] != InvalidPointer()
-                    ? Iterator(handle, mHashedResources.begin())
-                    : end());
+        return (contains(id) ? Iterator(*this, handle, mHashedResources.begin()) : end());
     }
     else
     {
-        return mHashedResources.find(handle);
+        return Iterator(*this, denseSize(), mHashedResources.find(handle));
     }
 }
 
 template <typename ResourceType, typename IDType>
 bool ResourceMap<ResourceType, IDType>::empty() const
 {
-    return (begin() == end());
+    return (mDenseResourceCount == 0 && mHashedResources.empty());
 }
 
 template <typename ResourceType, typename IDType>
 void ResourceMap<ResourceType, IDType>::clear()
 {
-    memset(mFlatResources, kInvalidPointer, kInitialFlatResourcesSize * kElementSize);
-    mFlatResourcesSize = kInitialFlatResourcesSize;
+    freePages();
+    mDirectories.clear();
+    mDirectories.emplace_back(new PageDirectory(kInitialPageCount));
+    mDirectory.store(mDirectories.back().get(), std::memory_order_release);
+    mDenseResourceCount = 0;
     mHashedResources.clear();
 }
 
+template <typename ResourceType, typename IDType>
+typename ResourceMap<ResourceType, IDType>::Page *
+ResourceMap<ResourceType, IDType>::getOrCreatePage(GLuint handle)
+{
+    PageDirectory *directory = mDirectory.load(std::memory_order_relaxed);
+    size_t pageIndex         = handle >> kPageShift;
+
+    if (pageIndex >= directory->pageCount)
+    {
+        // Use power-of-two.
+        size_t newPageCount = directory->pageCount;
+        while (newPageCount <= pageIndex)
+        {
+            newPageCount *= 2;
+        }
+
+        std::unique_ptr<PageDirectory> newDirectory(new PageDirectory(newPageCount));
+        for (size_t oldIndex = 0; oldIndex < directory->pageCount; ++oldIndex)
+        {
+            newDirectory->pages[oldIndex].store(
+                directory->pages[oldIndex].load(std::memory_order_relaxed),
+                std::memory_order_relaxed);
+        }
+
+        directory = newDirectory.get();
+        mDirectories.push_back(std::move(newDirectory));
+        mDirectory.store(directory, std::memory_order_release);
+    }
+
+    Page *page = directory->pages[pageIndex].load(std::memory_order_relaxed);
+    if (page == nullptr)
+    {
+        page = new Page;
+        directory->pages[pageIndex].store(page, std::memory_order_release);
+    }
+    return page;
+}
+
+template <typename ResourceType, typename IDType>
+GLuint ResourceMap<ResourceType, IDType>::denseSize() const
+{
+    return static_cast<GLuint>(mDirectory.load(std::memory_order_relaxed)->pageCount
+                               << kPageShift);
+}
+
+template <typename ResourceType, typename IDType>
+void ResourceMap<ResourceType, IDType>::freePages()
+{
+    // The current directory holds all the pages.
+    const PageDirectory *directory = mDirectory.load(std::memory_order_relaxed);
+    for (size_t pageIndex = 0; pageIndex < directory->pageCount; ++pageIndex)
+    {
+        delete directory->pages[pageIndex].load(std::memory_order_relaxed);
+    }
+}
+
 template <typename ResourceType, typename IDType>
 GLuint ResourceMap<ResourceType, IDType>::nextNonNullResource(size_t flatIndex) const
 {
-    for (size_t index = flatIndex; index < mFlatResourcesSize; index++)
+    const PageDirectory *directory = mDirectory.load(std::memory_order_relaxed);
+    for (size_t pageIndex = flatIndex >> kPageShift; pageIndex < directory->pageCount;
+         ++pageIndex)
     {
-        if (mFlatResources[index] != nullptr && mFlatResources[index] != InvalidPointer())
+        const Page *page = directory->pages[pageIndex].load(std::memory_order_relaxed);
+        if (page == nullptr || page->resourceCount == 0)
+        {
+            continue;
+        }
+
+        size_t pageEnd = (pageIndex + 1) << kPageShift;
+        for (size_t index = std::max(flatIndex, pageIndex << kPageShift); index < pageEnd;
+             ++index)
         {
-            return static_cast<GLuint>(index);
+            if (IsResource(page->load(static_cast<GLuint>(index))))
+            {
+                return static_cast<GLuint>(index);
+            }
         }
     }
-    return static_cast<GLuint>(mFlatResourcesSize);
+    return denseSize();
+}
+
+template <typename ResourceType, typename IDType>
+// static
+ANGLE_INLINE bool ResourceMap<ResourceType, IDType>::IsResource(ResourceType *value)
+{
+    return (value != nullptr && value != InvalidPointer());
 }
 
 template <typename ResourceType, typename IDType>
@@ -279,7 +455,7 @@ template <typename ResourceType, typename IDType>
 typename ResourceMap<ResourceType, IDType>::Iterator &ResourceMap<ResourceType, IDType>::Iterator::
 operator++()
 {
-    if (mFlatIndex < static_cast<GLuint>(mOrigin.mFlatResourcesSize))
+    if (mFlatIndex < mOrigin.denseSize())
     {
         mFlatIndex = mOrigin.nextNonNullResource(mFlatIndex + 1);
     }
@@ -308,10 +484,10 @@ const typename ResourceMap<ResourceType, IDType>::IndexAndResource
 template <typename ResourceType, typename IDType>
 void ResourceMap<ResourceType, IDType>::Iterator::updateValue()
 {
-    if (mFlatIndex < static_cast<GLuint>(mOrigin.mFlatResourcesSize))
+    if (mFlatIndex < mOrigin.denseSize())
     {
         mValue.first  = mFlatIndex;
-        mValue.second = mOrigin.mFlatResources[mFlatIndex];
+        mValue.second = mOrigin.getPage(mFlatIndex)->load(mFlatIndex);
     }
     else if (mHashIndex != mOrigin.mHashedResources.end())
     {
@@ -9,6 +9,10 @@
 
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <set>
+#include <thread>
+
 #include "libANGLE/ResourceMap.h"
 
 using namespace gl;
@@ -133,4 +137,132 @@ TEST(ResourceMapTest, QueryUnassigned)
     ASSERT_FALSE(resourceMap.contains(100));
     ASSERT_EQ(nullptr, resourceMap.query(100));
 }
+
+// Tests assigning handles spread over many pages and above the dense limit, and iterating them.
+TEST(ResourceMapTest, SparseHandles)
+{
+    ResourceMap<size_t, GLuint> resourceMap;
+    std::vector<size_t> objects;
+
+    for (size_t handle = 3; handle < 0x200000; handle = handle * 3 + 1)
+    {
+        objects.push_back(handle);
+    }
+
+    for (size_t &object : objects)
+    {
+        resourceMap.assign(static_cast<GLuint>(object), &object);
+    }
+
+    // Reserved handles are skipped by the iteration.
+    resourceMap.assign(2, nullptr);
+    ASSERT_TRUE(resourceMap.contains(2));
+
+    std::set<GLuint> visited;
+    for (const auto &handleAndObject : resourceMap)
+    {
+        ASSERT_NE(nullptr, handleAndObject.second);
+        ASSERT_EQ(handleAndObject.first, *handleAndObject.second);
+        ASSERT_TRUE(visited.insert(handleAndObject.first).second);
+    }
+    ASSERT_EQ(objects.size(), visited.size());
+
+    for (size_t &object : objects)
+    {
+        GLuint handle = static_cast<GLuint>(object);
+        ASSERT_EQ(&object, resourceMap.query(handle));
+        ASSERT_NE(resourceMap.end(), resourceMap.find(handle));
+        ASSERT_EQ(handle, resourceMap.find(handle)->first);
+        ASSERT_EQ(nullptr, resourceMap.query(handle + 1));
+        ASSERT_EQ(resourceMap.end(), resourceMap.find(handle + 1));
+    }
+
+    for (size_t &object : objects)
+    {
+        size_t *found = nullptr;
+        ASSERT_TRUE(resourceMap.erase(static_cast<GLuint>(object), &found));
+        ASSERT_EQ(&object, found);
+    }
+
+    ASSERT_TRUE(resourceMap.empty());
+    ASSERT_EQ(resourceMap.end(), resourceMap.begin());
+
+    size_t *reserved = &objects[0];
+    ASSERT_TRUE(resourceMap.erase(2, &reserved));
+    ASSERT_EQ(nullptr, reserved);
+}
+
+// Tests that reassigning a handle replaces its resource.
+TEST(ResourceMapTest, Reassign)
+{
+    ResourceMap<size_t, GLuint> resourceMap;
+    size_t first  = 1;
+    size_t second = 2;
+
+    resourceMap.assign(1, nullptr);
+    ASSERT_TRUE(resourceMap.empty());
+
+    resourceMap.assign(1, &first);
+    ASSERT_FALSE(resourceMap.empty());
+    ASSERT_EQ(&first, resourceMap.query(1));
+
+    resourceMap.assign(1, &second);
+    ASSERT_EQ(&second, resourceMap.query(1));
+    ASSERT_EQ(&second, resourceMap.begin()->second);
+    ASSERT_EQ(resourceMap.end(), ++resourceMap.begin());
+
+    size_t *found = nullptr;
+    ASSERT_TRUE(resourceMap.erase(1, &found));
+    ASSERT_EQ(&second, found);
+    ASSERT_TRUE(resourceMap.empty());
+}
+
+// Tests that lookups from another thread see either no resource or the assigned one while the map
+// grows and shrinks.
+TEST(ResourceMapTest, ConcurrentQuery)
+{
+    constexpr GLuint kHandleCount = 0x4000;
+
+    ResourceMap<size_t, GLuint> resourceMap;
+    std::vector<size_t> objects(kHandleCount);
+    for (GLuint handle = 0; handle < kHandleCount; ++handle)
+    {
+        objects[handle] = handle;
+    }
+
+    std::atomic<bool> done(false);
+    std::atomic<size_t> mismatches(0);
+    std::thread reader([&]() {
+        while (!done.load())
+        {
+            for (GLuint handle = 0; handle < kHandleCount; handle += 7)
+            {
+                size_t *object = resourceMap.query(handle);
+                if (object != nullptr && *object != handle)
+                {
+                    mismatches++;
+                }
+            }
+        }
+    });
+
+    for (int iteration = 0; iteration < 4; ++iteration)
+    {
+        for (GLuint handle = 0; handle < kHandleCount; ++handle)
+        {
+            resourceMap.assign(handle, &objects[handle]);
+        }
+        for (GLuint handle = 0; handle < kHandleCount; ++handle)
+        {
+            size_t *found = nullptr;
+            resourceMap.erase(handle, &found);
+        }
+    }
+
+    done = true;
+    reader.join();
+
+    ASSERT_EQ(0u, mismatches.load());
+    ASSERT_TRUE(resourceMap.empty());
+}
 }  // anonymous namespace
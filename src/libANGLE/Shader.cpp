@@ -14,11 +14,14 @@
 #include <sstream>
 
 #include "GLSLANG/ShaderLang.h"
+#include "common/MemoryBuffer.h"
 #include "common/utilities.h"
+#include "libANGLE/BinaryStream.h"
 #include "libANGLE/Caps.h"
 #include "libANGLE/Compiler.h"
 #include "libANGLE/Constants.h"
 #include "libANGLE/Context.h"
+#include "libANGLE/MemoryShaderCache.h"
 #include "libANGLE/ResourceManager.h"
 #include "libANGLE/renderer/GLImplFactory.h"
 #include "libANGLE/renderer/ShaderImpl.h"
@@ -52,6 +55,117 @@ const std::vector<VarT> &GetShaderVariables(const std::vector<VarT> *variableLis
     return *variableList;
 }
 
+void WriteShaderVariable(BinaryOutputStream *stream, const sh::ShaderVariable &var);
+void LoadShaderVariable(BinaryInputStream *stream, sh::ShaderVariable *var);
+
+void WriteShaderVariables(BinaryOutputStream *stream, const std::vector<sh::ShaderVariable> &vars)
+{
+    stream->writeInt(vars.size());
+    for (const sh::ShaderVariable &var : vars)
+    {
+        WriteShaderVariable(stream, var);
+    }
+}
+
+void LoadShaderVariables(BinaryInputStream *stream, std::vector<sh::ShaderVariable> *vars)
+{
+    size_t count = stream->readInt<size_t>();
+    for (size_t index = 0; index < count && !stream->error(); ++index)
+    {
+        vars->emplace_back();
+        LoadShaderVariable(stream, &vars->back());
+    }
+}
+
+void WriteShaderVariable(BinaryOutputStream *stream, const sh::ShaderVariable &var)
+{
+    stream->writeInt(var.type);
+    stream->writeInt(var.precision);
+    stream->writeString(var.name);
+    stream->writeString(var.mappedName);
+    stream->writeIntVector(var.arraySizes);
+    stream->writeInt(var.staticUse);
+    stream->writeInt(var.active);
+    WriteShaderVariables(stream, var.fields);
+    stream->writeString(var.structName);
+    stream->writeInt(var.isRowMajorLayout);
+    stream->writeInt(var.location);
+    stream->writeInt(var.binding);
+    stream->writeInt(var.imageUnitFormat);
+    stream->writeInt(var.offset);
+    stream->writeInt(var.readonly);
+    stream->writeInt(var.writeonly);
+    stream->writeInt(var.index);
+    stream->writeEnum(var.interpolation);
+    stream->writeInt(var.isInvariant);
+    stream->writeInt(var.hasParentArrayIndex() ? var.parentArrayIndex() : -1);
+}
+
+void LoadShaderVariable(BinaryInputStream *stream, sh::ShaderVariable *var)
+{
+    var->type       = stream->readInt<GLenum>();
+    var->precision  = stream->readInt<GLenum>();
+    var->name       = stream->readString();
+    var->mappedName = stream->readString();
+    stream->readIntVector<unsigned int>(&var->arraySizes);
+    var->staticUse = stream->readBool();
+    var->active    = stream->readBool();
+    LoadShaderVariables(stream, &var->fields);
+    var->structName       = stream->readString();
+    var->isRowMajorLayout = stream->readBool();
+    var->location         = stream->readInt<int>();
+    var->binding          = stream->readInt<int>();
+    var->imageUnitFormat  = stream->readInt<GLenum>();
+    var->offset           = stream->readInt<int>();
+    var->readonly         = stream->readBool();
+    var->writeonly        = stream->readBool();
+    var->index            = stream->readInt<int>();
+    var->interpolation    = stream->readEnum<sh::InterpolationType>();
+    var->isInvariant      = stream->readBool();
+    var->setParentArrayIndex(stream->readInt<int>());
+}
+
+void WriteInterfaceBlocks(BinaryOutputStream *stream, const std::vector<sh::InterfaceBlock> &blocks)
+{
+    stream->writeInt(blocks.size());
+    for (const sh::InterfaceBlock &block : blocks)
+    {
+        stream->writeString(block.name);
+        stream->writeString(block.mappedName);
+        stream->writeString(block.instanceName);
+        stream->writeInt(block.arraySize);
+        stream->writeEnum(block.layout);
+        stream->writeInt(block.isRowMajorLayout);
+        stream->writeInt(block.binding);
+        stream->writeInt(block.staticUse);
+        stream->writeInt(block.active);
+        stream->writeEnum(block.blockType);
+        WriteShaderVariables(stream, block.fields);
+    }
+}
+
+void LoadInterfaceBlocks(BinaryInputStream *stream, std::vector<sh::InterfaceBlock> *blocks)
+{
+    size_t count = stream->readInt<size_t>();
+    for (size_t index = 0; index < count && !stream->error(); ++index)
+    {
+        blocks->emplace_back();
+        sh::InterfaceBlock *block = &blocks->back();
+
+        block->name             = stream->readString();
+        block->mappedName       = stream->readString();
+        block->instanceName     = stream->readString();
+        block->arraySize        = stream->readInt<unsigned int>();
+        block->layout           = stream->readEnum<sh::BlockLayoutType>();
+        block->isRowMajorLayout = stream->readBool();
+        block->binding          = stream->readInt<int>();
+        block->staticUse        = stream->readBool();
+        block->active           = stream->readBool();
+        block->blockType        = stream->readEnum<sh::BlockType>();
+        LoadShaderVariables(stream, &block->fields);
+    }
+}
+
 }  // anonymous namespace
 
 // true if varying x has a higher priority in packing than y
@@ -112,6 +226,7 @@ struct Shader::CompilingState
 {
     std::shared_ptr<rx::WaitableCompileEvent> compileEvent;
     ShCompilerInstance shCompilerInstance;
+    MemoryShaderCache *shaderCache;
 };
 
 ShaderState::ShaderState(ShaderType shaderType)
@@ -359,6 +474,7 @@ void Shader::compile(const Context *context)
 
     mCompilingState.reset(new CompilingState());
     mCompilingState->shCompilerInstance = std::move(compilerInstance);
+    mCompilingState->shaderCache        = context->getMemoryShaderCache();
     mCompilingState->compileEvent =
         mImplementation->compile(context, &(mCompilingState->shCompilerInstance), options);
 }
@@ -382,13 +498,71 @@ void Shader::resolveCompile()
         mCompilingState.reset();
     });
 
+    rx::WaitableCompileEvent *compileEvent          = mCompilingState->compileEvent.get();
+    const Optional<egl::BlobCache::Key> &shaderHash = compileEvent->getShaderHash();
+
+    // If the translation was found in the shader cache, the translator didn't run.
+    bool loadedFromCache = false;
+    if (const angle::MemoryBuffer *cachedTranslation = compileEvent->getCachedTranslation())
+    {
+        loadedFromCache = loadTranslation(*cachedTranslation);
+        if (!loadedFromCache)
+        {
+            WARN() << "Failed to load the translated shader from the cache.";
+            mCompilingState->shaderCache->remove(shaderHash.value());
+            compileEvent->translateUncached();
+        }
+    }
+
+    if (!loadedFromCache && !gatherTranslation())
+    {
+        mState.mCompileStatus = CompileStatus::NOT_COMPILED;
+        return;
+    }
+
+    if (mState.mShaderType == ShaderType::Compute && mState.mLocalSize.isDeclared())
+    {
+        angle::CheckedNumeric<uint32_t> checked_local_size_product(mState.mLocalSize[0]);
+        checked_local_size_product *= mState.mLocalSize[1];
+        checked_local_size_product *= mState.mLocalSize[2];
+
+        if (!checked_local_size_product.IsValid())
+        {
+            WARN() << std::endl
+                   << "Integer overflow when computing the product of local_size_x, "
+                   << "local_size_y and local_size_z.";
+            mState.mCompileStatus = CompileStatus::NOT_COMPILED;
+            return;
+        }
+        if (checked_local_size_product.ValueOrDie() > mCurrentMaxComputeWorkGroupInvocations)
+        {
+            WARN() << std::endl
+                   << "The total number of invocations within a work group exceeds "
+                   << "MAX_COMPUTE_WORK_GROUP_INVOCATIONS.";
+            mState.mCompileStatus = CompileStatus::NOT_COMPILED;
+            return;
+        }
+    }
+
+    ASSERT(!mState.mTranslatedSource.empty());
+
+    bool success          = compileEvent->postTranslate(&mInfoLog);
+    mState.mCompileStatus = success ? CompileStatus::COMPILED : CompileStatus::NOT_COMPILED;
+
+    if (success && !loadedFromCache && shaderHash.valid())
+    {
+        mCompilingState->shaderCache->putShader(shaderHash.value(), this);
+    }
+}
+
+bool Shader::gatherTranslation()
+{
     ShHandle compilerHandle = mCompilingState->shCompilerInstance.getHandle();
     if (!mCompilingState->compileEvent->getResult())
     {
         mInfoLog += sh::GetInfoLog(compilerHandle);
         WARN() << std::endl << mInfoLog;
-        mState.mCompileStatus = CompileStatus::NOT_COMPILED;
-        return;
+        return false;
     }
 
     mState.mTranslatedSource = sh::GetObjectCode(compilerHandle);
@@ -434,30 +608,6 @@ void Shader::resolveCompile()
         case ShaderType::Compute:
         {
             mState.mLocalSize = sh::GetComputeShaderLocalGroupSize(compilerHandle);
-            if (mState.mLocalSize.isDeclared())
-            {
-                angle::CheckedNumeric<uint32_t> checked_local_size_product(mState.mLocalSize[0]);
-                checked_local_size_product *= mState.mLocalSize[1];
-                checked_local_size_product *= mState.mLocalSize[2];
-
-                if (!checked_local_size_product.IsValid())
-                {
-                    WARN() << std::endl
-                           << "Integer overflow when computing the product of local_size_x, "
-                           << "local_size_y and local_size_z.";
-                    mState.mCompileStatus = CompileStatus::NOT_COMPILED;
-                    return;
-                }
-                if (checked_local_size_product.ValueOrDie() >
-                    mCurrentMaxComputeWorkGroupInvocations)
-                {
-                    WARN() << std::endl
-                           << "The total number of invocations within a work group exceeds "
-                           << "MAX_COMPUTE_WORK_GROUP_INVOCATIONS.";
-                    mState.mCompileStatus = CompileStatus::NOT_COMPILED;
-                    return;
-                }
-            }
             break;
         }
         case ShaderType::Vertex:
@@ -506,10 +656,113 @@ void Shader::resolveCompile()
             UNREACHABLE();
     }
 
-    ASSERT(!mState.mTranslatedSource.empty());
+    return true;
+}
 
-    bool success          = mCompilingState->compileEvent->postTranslate(&mInfoLog);
-    mState.mCompileStatus = success ? CompileStatus::COMPILED : CompileStatus::NOT_COMPILED;
+void Shader::serialize(angle::MemoryBuffer *translationOut) const
+{
+    BinaryOutputStream stream;
+
+    stream.writeString(mState.mTranslatedSource);
+    stream.writeInt(mState.mShaderVersion);
+    for (size_t index = 0; index < mState.mLocalSize.size(); ++index)
+    {
+        stream.writeInt(mState.mLocalSize[index]);
+    }
+
+    WriteShaderVariables(&stream, mState.mInputVaryings);
+    WriteShaderVariables(&stream, mState.mOutputVaryings);
+    WriteShaderVariables(&stream, mState.mUniforms);
+    WriteInterfaceBlocks(&stream, mState.mUniformBlocks);
+    WriteInterfaceBlocks(&stream, mState.mShaderStorageBlocks);
+    WriteShaderVariables(&stream, mState.mAllAttributes);
+    WriteShaderVariables(&stream, mState.mActiveAttributes);
+    WriteShaderVariables(&stream, mState.mActiveOutputVariables);
+
+    stream.writeInt(mState.mNumViews);
+
+    stream.writeInt(mState.mGeometryShaderInputPrimitiveType.valid());
+    if (mState.mGeometryShaderInputPrimitiveType.valid())
+    {
+        stream.writeEnum(mState.mGeometryShaderInputPrimitiveType.value());
+    }
+    stream.writeInt(mState.mGeometryShaderOutputPrimitiveType.valid());
+    if (mState.mGeometryShaderOutputPrimitiveType.valid())
+    {
+        stream.writeEnum(mState.mGeometryShaderOutputPrimitiveType.value());
+    }
+    stream.writeInt(mState.mGeometryShaderMaxVertices.valid());
+    if (mState.mGeometryShaderMaxVertices.valid())
+    {
+        stream.writeInt(mState.mGeometryShaderMaxVertices.value());
+    }
+    stream.writeInt(mState.mGeometryShaderInvocations);
+
+    ASSERT(translationOut);
+    translationOut->resize(stream.length());
+    memcpy(translationOut->data(), stream.data(), stream.length());
+}
+
+bool Shader::loadTranslation(const angle::MemoryBuffer &translation)
+{
+    // Load into a separate state first, so a truncated or corrupt entry leaves no trace.
+    ShaderState loaded(mState.mShaderType);
+    BinaryInputStream stream(translation.data(), translation.size());
+
+    loaded.mTranslatedSource = stream.readString();
+    loaded.mShaderVersion    = stream.readInt<int>();
+    for (size_t index = 0; index < loaded.mLocalSize.size(); ++index)
+    {
+        loaded.mLocalSize[index] = stream.readInt<int>();
+    }
+
+    LoadShaderVariables(&stream, &loaded.mInputVaryings);
+    LoadShaderVariables(&stream, &loaded.mOutputVaryings);
+    LoadShaderVariables(&stream, &loaded.mUniforms);
+    LoadInterfaceBlocks(&stream, &loaded.mUniformBlocks);
+    LoadInterfaceBlocks(&stream, &loaded.mShaderStorageBlocks);
+    LoadShaderVariables(&stream, &loaded.mAllAttributes);
+    LoadShaderVariables(&stream, &loaded.mActiveAttributes);
+    LoadShaderVariables(&stream, &loaded.mActiveOutputVariables);
+
+    loaded.mNumViews = stream.readInt<int>();
+
+    if (stream.readBool())
+    {
+        loaded.mGeometryShaderInputPrimitiveType = stream.readEnum<PrimitiveMode>();
+    }
+    if (stream.readBool())
+    {
+        loaded.mGeometryShaderOutputPrimitiveType = stream.readEnum<PrimitiveMode>();
+    }
+    if (stream.readBool())
+    {
+        loaded.mGeometryShaderMaxVertices = stream.readInt<GLint>();
+    }
+    loaded.mGeometryShaderInvocations = stream.readInt<int>();
+
+    if (stream.error() || !stream.endOfStream() || loaded.mTranslatedSource.empty())
+    {
+        return false;
+    }
+
+    mState.mTranslatedSource                  = std::move(loaded.mTranslatedSource);
+    mState.mShaderVersion                     = loaded.mShaderVersion;
+    mState.mLocalSize                         = loaded.mLocalSize;
+    mState.mInputVaryings                     = std::move(loaded.mInputVaryings);
+    mState.mOutputVaryings                    = std::move(loaded.mOutputVaryings);
+    mState.mUniforms                          = std::move(loaded.mUniforms);
+    mState.mUniformBlocks                     = std::move(loaded.mUniformBlocks);
+    mState.mShaderStorageBlocks               = std::move(loaded.mShaderStorageBlocks);
+    mState.mAllAttributes                     = std::move(loaded.mAllAttributes);
+    mState.mActiveAttributes                  = std::move(loaded.mActiveAttributes);
+    mState.mActiveOutputVariables             = std::move(loaded.mActiveOutputVariables);
+    mState.mNumViews                          = loaded.mNumViews;
+    mState.mGeometryShaderInputPrimitiveType  = loaded.mGeometryShaderInputPrimitiveType;
+    mState.mGeometryShaderOutputPrimitiveType = loaded.mGeometryShaderOutputPrimitiveType;
+    mState.mGeometryShaderMaxVertices         = loaded.mGeometryShaderMaxVertices;
+    mState.mGeometryShaderInvocations         = loaded.mGeometryShaderInvocations;
+    return true;
 }
 
 void Shader::addRef()
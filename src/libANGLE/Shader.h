@@ -36,6 +36,7 @@ class WaitableCompileEvent;
 
 namespace angle
 {
+class MemoryBuffer;
 class WaitableEvent;
 class WorkerThreadPool;
 }  // namespace angle
@@ -45,6 +46,7 @@ namespace gl
 class CompileTask;
 class Context;
 struct Limitations;
+class MemoryShaderCache;
 class ShaderProgramManager;
 class State;
 
@@ -189,6 +191,9 @@ class Shader final : angle::NonCopyable, public LabeledObject
 
     const std::string &getCompilerResourcesString() const;
 
+    // Serializes the results of a successful compile for the shader cache.
+    void serialize(angle::MemoryBuffer *translationOut) const;
+
   private:
     struct CompilingState;
 
@@ -199,6 +204,8 @@ class Shader final : angle::NonCopyable, public LabeledObject
                               char *buffer);
 
     void resolveCompile();
+    bool gatherTranslation();
+    bool loadTranslation(const angle::MemoryBuffer &translation);
 
     ShaderState mState;
     std::unique_ptr<rx::ShaderImpl> mImplementation;
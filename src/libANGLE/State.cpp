@@ -179,7 +179,7 @@ template <BufferBinding Target>
 void State::setGenericBufferBindingWithBit(const Context *context, Buffer *buffer)
 {
     UpdateNonTFBufferBinding(context, &mBoundBuffers[Target], buffer);
-    mDirtyBits.set(kBufferBindingDirtyBits[Target]);
+    setDirtyBit(kBufferBindingDirtyBits[Target]);
 }
 
 template <BufferBinding Target>
@@ -288,6 +288,7 @@ State::State(ContextID contextIn,
       mReadFramebuffer(nullptr),
       mDrawFramebuffer(nullptr),
       mProgram(nullptr),
+      mProgramLinkSerial(0),
       mProvokingVertex(gl::ProvokingVertexConvention::LastVertexConvention),
       mVertexArray(nullptr),
       mActiveSampler(0),
@@ -301,7 +302,10 @@ State::State(ContextID contextIn,
       mRobustResourceInit(robustResourceInit),
       mProgramBinaryCacheEnabled(programBinaryCacheEnabled),
       mMaxShaderCompilerThreads(std::numeric_limits<GLuint>::max()),
-      mOverlay(overlay)
+      mOverlay(overlay),
+      mStateChangeSerial(0),
+      mEffectiveStateCalls{},
+      mRedundantStateCalls{}
 {}
 
 State::~State() {}
@@ -565,7 +569,7 @@ ANGLE_INLINE void State::updateActiveTextureState(const Context *context,
         mTexturesIncompatibleWithSamplers[textureIndex] = false;
     }
 
-    mDirtyBits.set(DIRTY_BIT_TEXTURE_BINDINGS);
+    setDirtyBit(DIRTY_BIT_TEXTURE_BINDINGS);
 }
 
 ANGLE_INLINE void State::updateActiveTexture(const Context *context,
@@ -579,7 +583,7 @@ ANGLE_INLINE void State::updateActiveTexture(const Context *context,
     if (!texture)
     {
         mActiveTexturesCache[textureIndex] = nullptr;
-        mDirtyBits.set(DIRTY_BIT_TEXTURE_BINDINGS);
+        setDirtyBit(DIRTY_BIT_TEXTURE_BINDINGS);
         return;
     }
 
@@ -598,32 +602,45 @@ const DepthStencilState &State::getDepthStencilState() const
 
 void State::setColorClearValue(float red, float green, float blue, float alpha)
 {
-    mColorClearValue.red   = red;
-    mColorClearValue.green = green;
-    mColorClearValue.blue  = blue;
-    mColorClearValue.alpha = alpha;
-    mDirtyBits.set(DIRTY_BIT_CLEAR_COLOR);
+    if (mColorClearValue != ColorF(red, green, blue, alpha))
+    {
+        mColorClearValue.red   = red;
+        mColorClearValue.green = green;
+        mColorClearValue.blue  = blue;
+        mColorClearValue.alpha = alpha;
+        setDirtyBit(DIRTY_BIT_CLEAR_COLOR);
+    }
 }
 
 void State::setDepthClearValue(float depth)
 {
-    mDepthClearValue = depth;
-    mDirtyBits.set(DIRTY_BIT_CLEAR_DEPTH);
+    if (mDepthClearValue != depth)
+    {
+        mDepthClearValue = depth;
+        setDirtyBit(DIRTY_BIT_CLEAR_DEPTH);
+    }
 }
 
 void State::setStencilClearValue(int stencil)
 {
-    mStencilClearValue = stencil;
-    mDirtyBits.set(DIRTY_BIT_CLEAR_STENCIL);
+    if (mStencilClearValue != stencil)
+    {
+        mStencilClearValue = stencil;
+        setDirtyBit(DIRTY_BIT_CLEAR_STENCIL);
+    }
 }
 
 void State::setColorMask(bool red, bool green, bool blue, bool alpha)
 {
-    mBlend.colorMaskRed   = red;
-    mBlend.colorMaskGreen = green;
-    mBlend.colorMaskBlue  = blue;
-    mBlend.colorMaskAlpha = alpha;
-    mDirtyBits.set(DIRTY_BIT_COLOR_MASK);
+    if (mBlend.colorMaskRed != red || mBlend.colorMaskGreen != green ||
+        mBlend.colorMaskBlue != blue || mBlend.colorMaskAlpha != alpha)
+    {
+        mBlend.colorMaskRed   = red;
+        mBlend.colorMaskGreen = green;
+        mBlend.colorMaskBlue  = blue;
+        mBlend.colorMaskAlpha = alpha;
+        setDirtyBit(DIRTY_BIT_COLOR_MASK);
+    }
 }
 
 void State::setDepthMask(bool mask)
@@ -631,32 +648,44 @@ void State::setDepthMask(bool mask)
     if (mDepthStencil.depthMask != mask)
     {
         mDepthStencil.depthMask = mask;
-        mDirtyBits.set(DIRTY_BIT_DEPTH_MASK);
+        setDirtyBit(DIRTY_BIT_DEPTH_MASK);
     }
 }
 
 void State::setRasterizerDiscard(bool enabled)
 {
-    mRasterizer.rasterizerDiscard = enabled;
-    mDirtyBits.set(DIRTY_BIT_RASTERIZER_DISCARD_ENABLED);
+    if (mRasterizer.rasterizerDiscard != enabled)
+    {
+        mRasterizer.rasterizerDiscard = enabled;
+        setDirtyBit(DIRTY_BIT_RASTERIZER_DISCARD_ENABLED);
+    }
 }
 
 void State::setCullFace(bool enabled)
 {
-    mRasterizer.cullFace = enabled;
-    mDirtyBits.set(DIRTY_BIT_CULL_FACE_ENABLED);
+    if (mRasterizer.cullFace != enabled)
+    {
+        mRasterizer.cullFace = enabled;
+        setDirtyBit(DIRTY_BIT_CULL_FACE_ENABLED);
+    }
 }
 
 void State::setCullMode(CullFaceMode mode)
 {
-    mRasterizer.cullMode = mode;
-    mDirtyBits.set(DIRTY_BIT_CULL_FACE);
+    if (mRasterizer.cullMode != mode)
+    {
+        mRasterizer.cullMode = mode;
+        setDirtyBit(DIRTY_BIT_CULL_FACE);
+    }
 }
 
 void State::setFrontFace(GLenum front)
 {
-    mRasterizer.frontFace = front;
-    mDirtyBits.set(DIRTY_BIT_FRONT_FACE);
+    if (mRasterizer.frontFace != front)
+    {
+        mRasterizer.frontFace = front;
+        setDirtyBit(DIRTY_BIT_FRONT_FACE);
+    }
 }
 
 void State::setDepthTest(bool enabled)
@@ -664,7 +693,7 @@ void State::setDepthTest(bool enabled)
     if (mDepthStencil.depthTest != enabled)
     {
         mDepthStencil.depthTest = enabled;
-        mDirtyBits.set(DIRTY_BIT_DEPTH_TEST_ENABLED);
+        setDirtyBit(DIRTY_BIT_DEPTH_TEST_ENABLED);
     }
 }
 
@@ -673,7 +702,7 @@ void State::setDepthFunc(GLenum depthFunc)
     if (mDepthStencil.depthFunc != depthFunc)
     {
         mDepthStencil.depthFunc = depthFunc;
-        mDirtyBits.set(DIRTY_BIT_DEPTH_FUNC);
+        setDirtyBit(DIRTY_BIT_DEPTH_FUNC);
     }
 }
 
@@ -683,39 +712,52 @@ void State::setDepthRange(float zNear, float zFar)
     {
         mNearZ = zNear;
         mFarZ  = zFar;
-        mDirtyBits.set(DIRTY_BIT_DEPTH_RANGE);
+        setDirtyBit(DIRTY_BIT_DEPTH_RANGE);
     }
 }
 
 void State::setBlend(bool enabled)
 {
-    mBlend.blend = enabled;
-    mDirtyBits.set(DIRTY_BIT_BLEND_ENABLED);
+    if (mBlend.blend != enabled)
+    {
+        mBlend.blend = enabled;
+        setDirtyBit(DIRTY_BIT_BLEND_ENABLED);
+    }
 }
 
 void State::setBlendFactors(GLenum sourceRGB, GLenum destRGB, GLenum sourceAlpha, GLenum destAlpha)
 {
-    mBlend.sourceBlendRGB   = sourceRGB;
-    mBlend.destBlendRGB     = destRGB;
-    mBlend.sourceBlendAlpha = sourceAlpha;
-    mBlend.destBlendAlpha   = destAlpha;
-    mDirtyBits.set(DIRTY_BIT_BLEND_FUNCS);
+    if (mBlend.sourceBlendRGB != sourceRGB || mBlend.destBlendRGB != destRGB ||
+        mBlend.sourceBlendAlpha != sourceAlpha || mBlend.destBlendAlpha != destAlpha)
+    {
+        mBlend.sourceBlendRGB   = sourceRGB;
+        mBlend.destBlendRGB     = destRGB;
+        mBlend.sourceBlendAlpha = sourceAlpha;
+        mBlend.destBlendAlpha   = destAlpha;
+        setDirtyBit(DIRTY_BIT_BLEND_FUNCS);
+    }
 }
 
 void State::setBlendColor(float red, float green, float blue, float alpha)
 {
-    mBlendColor.red   = red;
-    mBlendColor.green = green;
-    mBlendColor.blue  = blue;
-    mBlendColor.alpha = alpha;
-    mDirtyBits.set(DIRTY_BIT_BLEND_COLOR);
+    if (mBlendColor != ColorF(red, green, blue, alpha))
+    {
+        mBlendColor.red   = red;
+        mBlendColor.green = green;
+        mBlendColor.blue  = blue;
+        mBlendColor.alpha = alpha;
+        setDirtyBit(DIRTY_BIT_BLEND_COLOR);
+    }
 }
 
 void State::setBlendEquation(GLenum rgbEquation, GLenum alphaEquation)
 {
-    mBlend.blendEquationRGB   = rgbEquation;
-    mBlend.blendEquationAlpha = alphaEquation;
-    mDirtyBits.set(DIRTY_BIT_BLEND_EQUATIONS);
+    if (mBlend.blendEquationRGB != rgbEquation || mBlend.blendEquationAlpha != alphaEquation)
+    {
+        mBlend.blendEquationRGB   = rgbEquation;
+        mBlend.blendEquationAlpha = alphaEquation;
+        setDirtyBit(DIRTY_BIT_BLEND_EQUATIONS);
+    }
 }
 
 void State::setStencilTest(bool enabled)
@@ -723,7 +765,7 @@ void State::setStencilTest(bool enabled)
     if (mDepthStencil.stencilTest != enabled)
     {
         mDepthStencil.stencilTest = enabled;
-        mDirtyBits.set(DIRTY_BIT_STENCIL_TEST_ENABLED);
+        setDirtyBit(DIRTY_BIT_STENCIL_TEST_ENABLED);
     }
 }
 
@@ -735,7 +777,7 @@ void State::setStencilParams(GLenum stencilFunc, GLint stencilRef, GLuint stenci
         mDepthStencil.stencilFunc = stencilFunc;
         mStencilRef               = stencilRef;
         mDepthStencil.stencilMask = stencilMask;
-        mDirtyBits.set(DIRTY_BIT_STENCIL_FUNCS_FRONT);
+        setDirtyBit(DIRTY_BIT_STENCIL_FUNCS_FRONT);
     }
 }
 
@@ -749,7 +791,7 @@ void State::setStencilBackParams(GLenum stencilBackFunc,
         mDepthStencil.stencilBackFunc = stencilBackFunc;
         mStencilBackRef               = stencilBackRef;
         mDepthStencil.stencilBackMask = stencilBackMask;
-        mDirtyBits.set(DIRTY_BIT_STENCIL_FUNCS_BACK);
+        setDirtyBit(DIRTY_BIT_STENCIL_FUNCS_BACK);
     }
 }
 
@@ -758,7 +800,7 @@ void State::setStencilWritemask(GLuint stencilWritemask)
     if (mDepthStencil.stencilWritemask != stencilWritemask)
     {
         mDepthStencil.stencilWritemask = stencilWritemask;
-        mDirtyBits.set(DIRTY_BIT_STENCIL_WRITEMASK_FRONT);
+        setDirtyBit(DIRTY_BIT_STENCIL_WRITEMASK_FRONT);
     }
 }
 
@@ -767,7 +809,7 @@ void State::setStencilBackWritemask(GLuint stencilBackWritemask)
     if (mDepthStencil.stencilBackWritemask != stencilBackWritemask)
     {
         mDepthStencil.stencilBackWritemask = stencilBackWritemask;
-        mDirtyBits.set(DIRTY_BIT_STENCIL_WRITEMASK_BACK);
+        setDirtyBit(DIRTY_BIT_STENCIL_WRITEMASK_BACK);
     }
 }
 
@@ -782,7 +824,7 @@ void State::setStencilOperations(GLenum stencilFail,
         mDepthStencil.stencilFail          = stencilFail;
         mDepthStencil.stencilPassDepthFail = stencilPassDepthFail;
         mDepthStencil.stencilPassDepthPass = stencilPassDepthPass;
-        mDirtyBits.set(DIRTY_BIT_STENCIL_OPS_FRONT);
+        setDirtyBit(DIRTY_BIT_STENCIL_OPS_FRONT);
     }
 }
 
@@ -797,98 +839,147 @@ void State::setStencilBackOperations(GLenum stencilBackFail,
         mDepthStencil.stencilBackFail          = stencilBackFail;
         mDepthStencil.stencilBackPassDepthFail = stencilBackPassDepthFail;
         mDepthStencil.stencilBackPassDepthPass = stencilBackPassDepthPass;
-        mDirtyBits.set(DIRTY_BIT_STENCIL_OPS_BACK);
+        setDirtyBit(DIRTY_BIT_STENCIL_OPS_BACK);
     }
 }
 
 void State::setPolygonOffsetFill(bool enabled)
 {
-    mRasterizer.polygonOffsetFill = enabled;
-    mDirtyBits.set(DIRTY_BIT_POLYGON_OFFSET_FILL_ENABLED);
+    if (mRasterizer.polygonOffsetFill != enabled)
+    {
+        mRasterizer.polygonOffsetFill = enabled;
+        setDirtyBit(DIRTY_BIT_POLYGON_OFFSET_FILL_ENABLED);
+    }
 }
 
 void State::setPolygonOffsetParams(GLfloat factor, GLfloat units)
 {
     // An application can pass NaN values here, so handle this gracefully
-    mRasterizer.polygonOffsetFactor = factor != factor ? 0.0f : factor;
-    mRasterizer.polygonOffsetUnits  = units != units ? 0.0f : units;
-    mDirtyBits.set(DIRTY_BIT_POLYGON_OFFSET);
+    factor = factor != factor ? 0.0f : factor;
+    units  = units != units ? 0.0f : units;
+
+    if (mRasterizer.polygonOffsetFactor != factor || mRasterizer.polygonOffsetUnits != units)
+    {
+        mRasterizer.polygonOffsetFactor = factor;
+        mRasterizer.polygonOffsetUnits  = units;
+        setDirtyBit(DIRTY_BIT_POLYGON_OFFSET);
+    }
 }
 
 void State::setSampleAlphaToCoverage(bool enabled)
 {
-    mBlend.sampleAlphaToCoverage = enabled;
-    mDirtyBits.set(DIRTY_BIT_SAMPLE_ALPHA_TO_COVERAGE_ENABLED);
+    if (mBlend.sampleAlphaToCoverage != enabled)
+    {
+        mBlend.sampleAlphaToCoverage = enabled;
+        setDirtyBit(DIRTY_BIT_SAMPLE_ALPHA_TO_COVERAGE_ENABLED);
+    }
 }
 
 void State::setSampleCoverage(bool enabled)
 {
-    mSampleCoverage = enabled;
-    mDirtyBits.set(DIRTY_BIT_SAMPLE_COVERAGE_ENABLED);
+    if (mSampleCoverage != enabled)
+    {
+        mSampleCoverage = enabled;
+        setDirtyBit(DIRTY_BIT_SAMPLE_COVERAGE_ENABLED);
+    }
 }
 
 void State::setSampleCoverageParams(GLclampf value, bool invert)
 {
-    mSampleCoverageValue  = value;
-    mSampleCoverageInvert = invert;
-    mDirtyBits.set(DIRTY_BIT_SAMPLE_COVERAGE);
+    if (mSampleCoverageValue != value || mSampleCoverageInvert != invert)
+    {
+        mSampleCoverageValue  = value;
+        mSampleCoverageInvert = invert;
+        setDirtyBit(DIRTY_BIT_SAMPLE_COVERAGE);
+    }
 }
 
 void State::setSampleMaskEnabled(bool enabled)
 {
-    mSampleMask = enabled;
-    mDirtyBits.set(DIRTY_BIT_SAMPLE_MASK_ENABLED);
+    if (mSampleMask != enabled)
+    {
+        mSampleMask = enabled;
+        setDirtyBit(DIRTY_BIT_SAMPLE_MASK_ENABLED);
+    }
 }
 
 void State::setSampleMaskParams(GLuint maskNumber, GLbitfield mask)
 {
     ASSERT(maskNumber < mMaxSampleMaskWords);
-    mSampleMaskValues[maskNumber] = mask;
-    // TODO(jmadill): Use a child dirty bit if we ever use more than two words.
-    mDirtyBits.set(DIRTY_BIT_SAMPLE_MASK);
+    if (mSampleMaskValues[maskNumber] != mask)
+    {
+        mSampleMaskValues[maskNumber] = mask;
+        // TODO(jmadill): Use a child dirty bit if we ever use more than two words.
+        setDirtyBit(DIRTY_BIT_SAMPLE_MASK);
+    }
 }
 
 void State::setSampleAlphaToOne(bool enabled)
 {
-    mSampleAlphaToOne = enabled;
-    mDirtyBits.set(DIRTY_BIT_SAMPLE_ALPHA_TO_ONE);
+    if (mSampleAlphaToOne != enabled)
+    {
+        mSampleAlphaToOne = enabled;
+        setDirtyBit(DIRTY_BIT_SAMPLE_ALPHA_TO_ONE);
+    }
 }
 
 void State::setMultisampling(bool enabled)
 {
-    mMultiSampling = enabled;
-    mDirtyBits.set(DIRTY_BIT_MULTISAMPLING);
+    if (mMultiSampling != enabled)
+    {
+        mMultiSampling = enabled;
+        setDirtyBit(DIRTY_BIT_MULTISAMPLING);
+    }
 }
 
 void State::setScissorTest(bool enabled)
 {
-    mScissorTest = enabled;
-    mDirtyBits.set(DIRTY_BIT_SCISSOR_TEST_ENABLED);
+    if (mScissorTest != enabled)
+    {
+        mScissorTest = enabled;
+        setDirtyBit(DIRTY_BIT_SCISSOR_TEST_ENABLED);
+    }
 }
 
 void State::setScissorParams(GLint x, GLint y, GLsizei width, GLsizei height)
 {
-    mScissor.x      = x;
-    mScissor.y      = y;
-    mScissor.width  = width;
-    mScissor.height = height;
-    mDirtyBits.set(DIRTY_BIT_SCISSOR);
+    if (mScissor.x != x || mScissor.y != y || mScissor.width != width || mScissor.height != height)
+    {
+        mScissor.x      = x;
+        mScissor.y      = y;
+        mScissor.width  = width;
+        mScissor.height = height;
+        setDirtyBit(DIRTY_BIT_SCISSOR);
+    }
 }
 
 void State::setDither(bool enabled)
 {
-    mBlend.dither = enabled;
-    mDirtyBits.set(DIRTY_BIT_DITHER_ENABLED);
+    if (mBlend.dither != enabled)
+    {
+        mBlend.dither = enabled;
+        setDirtyBit(DIRTY_BIT_DITHER_ENABLED);
+    }
 }
 
 void State::setPrimitiveRestart(bool enabled)
 {
-    mPrimitiveRestart = enabled;
-    mDirtyBits.set(DIRTY_BIT_PRIMITIVE_RESTART_ENABLED);
+    if (mPrimitiveRestart != enabled)
+    {
+        mPrimitiveRestart = enabled;
+        setDirtyBit(DIRTY_BIT_PRIMITIVE_RESTART_ENABLED);
+    }
 }
 
 void State::setEnableFeature(GLenum feature, bool enabled)
 {
+    // Not every capability has a dirty bit, so check for redundant calls here.
+    if (getEnableFeature(feature) == enabled)
+    {
+        return;
+    }
+    mStateChangeSerial++;
+
     switch (feature)
     {
         case GL_MULTISAMPLE_EXT:
@@ -1109,20 +1200,29 @@ bool State::getEnableFeature(GLenum feature) const
 
 void State::setLineWidth(GLfloat width)
 {
-    mLineWidth = width;
-    mDirtyBits.set(DIRTY_BIT_LINE_WIDTH);
+    if (mLineWidth != width)
+    {
+        mLineWidth = width;
+        setDirtyBit(DIRTY_BIT_LINE_WIDTH);
+    }
 }
 
 void State::setGenerateMipmapHint(GLenum hint)
 {
-    mGenerateMipmapHint = hint;
-    mDirtyBits.set(DIRTY_BIT_GENERATE_MIPMAP_HINT);
+    if (mGenerateMipmapHint != hint)
+    {
+        mGenerateMipmapHint = hint;
+        setDirtyBit(DIRTY_BIT_GENERATE_MIPMAP_HINT);
+    }
 }
 
 void State::setFragmentShaderDerivativeHint(GLenum hint)
 {
-    mFragmentShaderDerivativeHint = hint;
-    mDirtyBits.set(DIRTY_BIT_SHADER_DERIVATIVE_HINT);
+    if (mFragmentShaderDerivativeHint != hint)
+    {
+        mFragmentShaderDerivativeHint = hint;
+        setDirtyBit(DIRTY_BIT_SHADER_DERIVATIVE_HINT);
+    }
     // TODO: Propagate the hint to shader translator so we can write
     // ddx, ddx_coarse, or ddx_fine depending on the hint.
     // Ignore for now. It is valid for implementations to ignore hint.
@@ -1130,20 +1230,33 @@ void State::setFragmentShaderDerivativeHint(GLenum hint)
 
 void State::setViewportParams(GLint x, GLint y, GLsizei width, GLsizei height)
 {
-    mViewport.x      = x;
-    mViewport.y      = y;
-    mViewport.width  = width;
-    mViewport.height = height;
-    mDirtyBits.set(DIRTY_BIT_VIEWPORT);
+    if (mViewport.x != x || mViewport.y != y || mViewport.width != width ||
+        mViewport.height != height)
+    {
+        mViewport.x      = x;
+        mViewport.y      = y;
+        mViewport.width  = width;
+        mViewport.height = height;
+        setDirtyBit(DIRTY_BIT_VIEWPORT);
+    }
 }
 
 void State::setActiveSampler(unsigned int active)
 {
-    mActiveSampler = active;
+    if (mActiveSampler != active)
+    {
+        mActiveSampler = active;
+        mStateChangeSerial++;
+    }
 }
 
 void State::setSamplerTexture(const Context *context, TextureType type, Texture *texture)
 {
+    if (mSamplerTextures[type][mActiveSampler].get() == texture)
+    {
+        return;
+    }
+
     mSamplerTextures[type][mActiveSampler].set(context, texture);
 
     if (mProgram && mProgram->getActiveSamplersMask()[mActiveSampler] &&
@@ -1152,7 +1265,7 @@ void State::setSamplerTexture(const Context *context, TextureType type, Texture
         updateActiveTexture(context, mActiveSampler, texture);
     }
 
-    mDirtyBits.set(DIRTY_BIT_TEXTURE_BINDINGS);
+    setDirtyBit(DIRTY_BIT_TEXTURE_BINDINGS);
 }
 
 Texture *State::getTargetTexture(TextureType type) const
@@ -1241,13 +1354,18 @@ void State::initializeZeroTextures(const Context *context, const TextureMap &zer
 
 void State::invalidateTexture(TextureType type)
 {
-    mDirtyBits.set(DIRTY_BIT_TEXTURE_BINDINGS);
+    setDirtyBit(DIRTY_BIT_TEXTURE_BINDINGS);
 }
 
 void State::setSamplerBinding(const Context *context, GLuint textureUnit, Sampler *sampler)
 {
+    if (mSamplers[textureUnit].get() == sampler)
+    {
+        return;
+    }
+
     mSamplers[textureUnit].set(context, sampler);
-    mDirtyBits.set(DIRTY_BIT_SAMPLER_BINDINGS);
+    setDirtyBit(DIRTY_BIT_SAMPLER_BINDINGS);
     // This is overly conservative as it assumes the sampler has never been bound.
     setSamplerDirty(textureUnit);
     onActiveTextureChange(context, textureUnit);
@@ -1271,8 +1389,11 @@ void State::detachSampler(const Context *context, SamplerID sampler)
 
 void State::setRenderbufferBinding(const Context *context, Renderbuffer *renderbuffer)
 {
-    mRenderbuffer.set(context, renderbuffer);
-    mDirtyBits.set(DIRTY_BIT_RENDERBUFFER_BINDING);
+    if (mRenderbuffer.get() != renderbuffer)
+    {
+        mRenderbuffer.set(context, renderbuffer);
+        setDirtyBit(DIRTY_BIT_RENDERBUFFER_BINDING);
+    }
 }
 
 void State::detachRenderbuffer(const Context *context, RenderbufferID renderbuffer)
@@ -1315,7 +1436,7 @@ void State::setReadFramebufferBinding(Framebuffer *framebuffer)
         return;
 
     mReadFramebuffer = framebuffer;
-    mDirtyBits.set(DIRTY_BIT_READ_FRAMEBUFFER_BINDING);
+    setDirtyBit(DIRTY_BIT_READ_FRAMEBUFFER_BINDING);
 
     if (mReadFramebuffer && mReadFramebuffer->hasAnyDirtyBit())
     {
@@ -1329,7 +1450,7 @@ void State::setDrawFramebufferBinding(Framebuffer *framebuffer)
         return;
 
     mDrawFramebuffer = framebuffer;
-    mDirtyBits.set(DIRTY_BIT_DRAW_FRAMEBUFFER_BINDING);
+    setDirtyBit(DIRTY_BIT_DRAW_FRAMEBUFFER_BINDING);
 
     if (mDrawFramebuffer)
     {
@@ -1391,7 +1512,7 @@ void State::setVertexArrayBinding(const Context *context, VertexArray *vertexArr
     mVertexArray = vertexArray;
     if (vertexArray)
         vertexArray->onBindingChanged(context, 1);
-    mDirtyBits.set(DIRTY_BIT_VERTEX_ARRAY_BINDING);
+    setDirtyBit(DIRTY_BIT_VERTEX_ARRAY_BINDING);
 
     if (mVertexArray && mVertexArray->hasAnyDirtyBit())
     {
@@ -1405,7 +1526,7 @@ bool State::removeVertexArrayBinding(const Context *context, VertexArrayID verte
     {
         mVertexArray->onBindingChanged(context, -1);
         mVertexArray = nullptr;
-        mDirtyBits.set(DIRTY_BIT_VERTEX_ARRAY_BINDING);
+        setDirtyBit(DIRTY_BIT_VERTEX_ARRAY_BINDING);
         mDirtyObjects.set(DIRTY_OBJECT_VERTEX_ARRAY);
         return true;
     }
@@ -1468,7 +1589,12 @@ angle::Result State::setProgram(const Context *context, Program *newProgram)
         // Note that rendering is undefined if glUseProgram(0) is called. But ANGLE will generate
         // an error if the app tries to draw in this case.
 
-        mDirtyBits.set(DIRTY_BIT_PROGRAM_BINDING);
+        setDirtyBit(DIRTY_BIT_PROGRAM_BINDING);
+    }
+    else if (mProgram && mProgram->isLinked() && mProgram->getLinkSerial() != mProgramLinkSerial)
+    {
+        // Another context in the share group relinked the program after it was bound here.
+        ANGLE_TRY(onProgramExecutableChange(context, mProgram));
     }
 
     return angle::Result::Continue;
@@ -1484,7 +1610,7 @@ void State::setTransformFeedbackBinding(const Context *context,
     mTransformFeedback.set(context, transformFeedback);
     if (mTransformFeedback.get())
         mTransformFeedback->onBindingChanged(context, true);
-    mDirtyBits.set(DIRTY_BIT_TRANSFORM_FEEDBACK_BINDING);
+    setDirtyBit(DIRTY_BIT_TRANSFORM_FEEDBACK_BINDING);
 }
 
 bool State::removeTransformFeedbackBinding(const Context *context,
@@ -1679,7 +1805,7 @@ void State::setVertexAttribf(GLuint index, const GLfloat values[4])
 {
     ASSERT(static_cast<size_t>(index) < mVertexAttribCurrentValues.size());
     mVertexAttribCurrentValues[index].setFloatValues(values);
-    mDirtyBits.set(DIRTY_BIT_CURRENT_VALUES);
+    setDirtyBit(DIRTY_BIT_CURRENT_VALUES);
     mDirtyCurrentValues.set(index);
     SetComponentTypeMask(ComponentType::Float, index, &mCurrentValuesTypeMask);
 }
@@ -1688,7 +1814,7 @@ void State::setVertexAttribu(GLuint index, const GLuint values[4])
 {
     ASSERT(static_cast<size_t>(index) < mVertexAttribCurrentValues.size());
     mVertexAttribCurrentValues[index].setUnsignedIntValues(values);
-    mDirtyBits.set(DIRTY_BIT_CURRENT_VALUES);
+    setDirtyBit(DIRTY_BIT_CURRENT_VALUES);
     mDirtyCurrentValues.set(index);
     SetComponentTypeMask(ComponentType::UnsignedInt, index, &mCurrentValuesTypeMask);
 }
@@ -1697,7 +1823,7 @@ void State::setVertexAttribi(GLuint index, const GLint values[4])
 {
     ASSERT(static_cast<size_t>(index) < mVertexAttribCurrentValues.size());
     mVertexAttribCurrentValues[index].setIntValues(values);
-    mDirtyBits.set(DIRTY_BIT_CURRENT_VALUES);
+    setDirtyBit(DIRTY_BIT_CURRENT_VALUES);
     mDirtyCurrentValues.set(index);
     SetComponentTypeMask(ComponentType::Int, index, &mCurrentValuesTypeMask);
 }
@@ -1715,74 +1841,110 @@ const void *State::getVertexAttribPointer(unsigned int attribNum) const
 
 void State::setPackAlignment(GLint alignment)
 {
-    mPack.alignment = alignment;
-    mDirtyBits.set(DIRTY_BIT_PACK_STATE);
+    if (mPack.alignment != alignment)
+    {
+        mPack.alignment = alignment;
+        setDirtyBit(DIRTY_BIT_PACK_STATE);
+    }
 }
 
 void State::setPackReverseRowOrder(bool reverseRowOrder)
 {
-    mPack.reverseRowOrder = reverseRowOrder;
-    mDirtyBits.set(DIRTY_BIT_PACK_STATE);
+    if (mPack.reverseRowOrder != reverseRowOrder)
+    {
+        mPack.reverseRowOrder = reverseRowOrder;
+        setDirtyBit(DIRTY_BIT_PACK_STATE);
+    }
 }
 
 void State::setPackRowLength(GLint rowLength)
 {
-    mPack.rowLength = rowLength;
-    mDirtyBits.set(DIRTY_BIT_PACK_STATE);
+    if (mPack.rowLength != rowLength)
+    {
+        mPack.rowLength = rowLength;
+        setDirtyBit(DIRTY_BIT_PACK_STATE);
+    }
 }
 
 void State::setPackSkipRows(GLint skipRows)
 {
-    mPack.skipRows = skipRows;
-    mDirtyBits.set(DIRTY_BIT_PACK_STATE);
+    if (mPack.skipRows != skipRows)
+    {
+        mPack.skipRows = skipRows;
+        setDirtyBit(DIRTY_BIT_PACK_STATE);
+    }
 }
 
 void State::setPackSkipPixels(GLint skipPixels)
 {
-    mPack.skipPixels = skipPixels;
-    mDirtyBits.set(DIRTY_BIT_PACK_STATE);
+    if (mPack.skipPixels != skipPixels)
+    {
+        mPack.skipPixels = skipPixels;
+        setDirtyBit(DIRTY_BIT_PACK_STATE);
+    }
 }
 
 void State::setUnpackAlignment(GLint alignment)
 {
-    mUnpack.alignment = alignment;
-    mDirtyBits.set(DIRTY_BIT_UNPACK_STATE);
+    if (mUnpack.alignment != alignment)
+    {
+        mUnpack.alignment = alignment;
+        setDirtyBit(DIRTY_BIT_UNPACK_STATE);
+    }
 }
 
 void State::setUnpackRowLength(GLint rowLength)
 {
-    mUnpack.rowLength = rowLength;
-    mDirtyBits.set(DIRTY_BIT_UNPACK_STATE);
+    if (mUnpack.rowLength != rowLength)
+    {
+        mUnpack.rowLength = rowLength;
+        setDirtyBit(DIRTY_BIT_UNPACK_STATE);
+    }
 }
 
 void State::setUnpackImageHeight(GLint imageHeight)
 {
-    mUnpack.imageHeight = imageHeight;
-    mDirtyBits.set(DIRTY_BIT_UNPACK_STATE);
+    if (mUnpack.imageHeight != imageHeight)
+    {
+        mUnpack.imageHeight = imageHeight;
+        setDirtyBit(DIRTY_BIT_UNPACK_STATE);
+    }
 }
 
 void State::setUnpackSkipImages(GLint skipImages)
 {
-    mUnpack.skipImages = skipImages;
-    mDirtyBits.set(DIRTY_BIT_UNPACK_STATE);
+    if (mUnpack.skipImages != skipImages)
+    {
+        mUnpack.skipImages = skipImages;
+        setDirtyBit(DIRTY_BIT_UNPACK_STATE);
+    }
 }
 
 void State::setUnpackSkipRows(GLint skipRows)
 {
-    mUnpack.skipRows = skipRows;
-    mDirtyBits.set(DIRTY_BIT_UNPACK_STATE);
+    if (mUnpack.skipRows != skipRows)
+    {
+        mUnpack.skipRows = skipRows;
+        setDirtyBit(DIRTY_BIT_UNPACK_STATE);
+    }
 }
 
 void State::setUnpackSkipPixels(GLint skipPixels)
 {
-    mUnpack.skipPixels = skipPixels;
-    mDirtyBits.set(DIRTY_BIT_UNPACK_STATE);
+    if (mUnpack.skipPixels != skipPixels)
+    {
+        mUnpack.skipPixels = skipPixels;
+        setDirtyBit(DIRTY_BIT_UNPACK_STATE);
+    }
 }
 
 void State::setCoverageModulation(GLenum components)
 {
-    mCoverageModulation = components;
-    mDirtyBits.set(DIRTY_BIT_COVERAGE_MODULATION);
+    if (mCoverageModulation != components)
+    {
+        mCoverageModulation = components;
+        setDirtyBit(DIRTY_BIT_COVERAGE_MODULATION);
+    }
 }
 
 void State::loadPathRenderingMatrix(GLenum matrixMode, const GLfloat *matrix)
@@ -1790,12 +1952,12 @@ void State::loadPathRenderingMatrix(GLenum matrixMode, const GLfloat *matrix)
     if (matrixMode == GL_PATH_MODELVIEW_CHROMIUM)
     {
         memcpy(mPathMatrixMV, matrix, 16 * sizeof(GLfloat));
-        mDirtyBits.set(DIRTY_BIT_PATH_RENDERING);
+        setDirtyBit(DIRTY_BIT_PATH_RENDERING);
     }
     else if (matrixMode == GL_PATH_PROJECTION_CHROMIUM)
     {
         memcpy(mPathMatrixProj, matrix, 16 * sizeof(GLfloat));
-        mDirtyBits.set(DIRTY_BIT_PATH_RENDERING);
+        setDirtyBit(DIRTY_BIT_PATH_RENDERING);
     }
     else
     {
@@ -1823,13 +1985,16 @@ void State::setPathStencilFunc(GLenum func, GLint ref, GLuint mask)
     mPathStencilFunc = func;
     mPathStencilRef  = ref;
     mPathStencilMask = mask;
-    mDirtyBits.set(DIRTY_BIT_PATH_RENDERING);
+    setDirtyBit(DIRTY_BIT_PATH_RENDERING);
 }
 
 void State::setFramebufferSRGB(bool sRGB)
 {
-    mFramebufferSRGB = sRGB;
-    mDirtyBits.set(DIRTY_BIT_FRAMEBUFFER_SRGB);
+    if (mFramebufferSRGB != sRGB)
+    {
+        mFramebufferSRGB = sRGB;
+        setDirtyBit(DIRTY_BIT_FRAMEBUFFER_SRGB);
+    }
 }
 
 void State::setMaxShaderCompilerThreads(GLuint count)
@@ -2600,12 +2765,33 @@ void State::getInteger64i_v(GLenum target, GLuint index, GLint64 *data)
             ASSERT(static_cast<size_t>(index) < mShaderStorageBuffers.size());
             *data = mShaderStorageBuffers[index].getSize();
             break;
+        case GL_EFFECTIVE_STATE_CALLS_ANGLE:
+            ASSERT(static_cast<size_t>(index) < mEffectiveStateCalls.size());
+            *data = static_cast<GLint64>(mEffectiveStateCalls[static_cast<StateCall>(index)]);
+            break;
+        case GL_REDUNDANT_STATE_CALLS_ANGLE:
+            ASSERT(static_cast<size_t>(index) < mRedundantStateCalls.size());
+            *data = static_cast<GLint64>(mRedundantStateCalls[static_cast<StateCall>(index)]);
+            break;
         default:
             UNREACHABLE();
             break;
     }
 }
 
+GLint64 State::getStateCallTotal(GLenum pname) const
+{
+    const angle::PackedEnumMap<StateCall, uint64_t> &counts =
+        pname == GL_EFFECTIVE_STATE_CALLS_ANGLE ? mEffectiveStateCalls : mRedundantStateCalls;
+
+    uint64_t total = 0;
+    for (uint64_t count : counts)
+    {
+        total += count;
+    }
+    return static_cast<GLint64>(total);
+}
+
 void State::getBooleani_v(GLenum target, GLuint index, GLboolean *data)
 {
     switch (target)
@@ -2811,7 +2997,8 @@ angle::Result State::onProgramExecutableChange(const Context *context, Program *
     //  generated executable code will be installed as part of the current rendering state."
     ASSERT(program->isLinked());
 
-    mDirtyBits.set(DIRTY_BIT_PROGRAM_EXECUTABLE);
+    mProgramLinkSerial = program->getLinkSerial();
+    setDirtyBit(DIRTY_BIT_PROGRAM_EXECUTABLE);
 
     if (program->hasAnyDirtyBit())
     {
@@ -2879,7 +3066,7 @@ void State::setImageUnit(const Context *context,
     mImageUnits[unit].layer   = layer;
     mImageUnits[unit].access  = access;
     mImageUnits[unit].format  = format;
-    mDirtyBits.set(DIRTY_BIT_IMAGE_BINDINGS);
+    setDirtyBit(DIRTY_BIT_IMAGE_BINDINGS);
 
     onImageStateChange(context, unit);
 }
@@ -2934,7 +3121,17 @@ void State::onImageStateChange(const Context *context, size_t unit)
 void State::onUniformBufferStateChange(size_t uniformBufferIndex)
 {
     // This could be represented by a different dirty bit. Using the same one keeps it simple.
-    mDirtyBits.set(DIRTY_BIT_UNIFORM_BUFFER_BINDINGS);
+    setDirtyBit(DIRTY_BIT_UNIFORM_BUFFER_BINDINGS);
+}
+
+void State::onAtomicCounterBufferStateChange(size_t atomicCounterBufferIndex)
+{
+    setDirtyBit(DIRTY_BIT_ATOMIC_COUNTER_BUFFER_BINDING);
+}
+
+void State::onShaderStorageBufferStateChange(size_t shaderStorageBufferIndex)
+{
+    setDirtyBit(DIRTY_BIT_SHADER_STORAGE_BUFFER_BINDING);
 }
 
 AttributesMask State::getAndResetDirtyCurrentValues() const
@@ -62,6 +62,50 @@ using BoundBufferMap       = BufferBindingMap<BindingPointer<Buffer>>;
 using TextureBindingVector = std::vector<BindingPointer<Texture>>;
 using TextureBindingMap    = angle::PackedEnumMap<TextureType, TextureBindingVector>;
 
+// The calls counted by GL_ANGLE_state_call_statistics, in the order of the indices that the
+// extension queries them with.
+enum class StateCall : uint8_t
+{
+    ActiveTexture,
+    BindBuffer,
+    BindFramebuffer,
+    BindRenderbuffer,
+    BindSampler,
+    BindTexture,
+    BindVertexArray,
+    BlendColor,
+    BlendEquation,
+    BlendEquationSeparate,
+    BlendFunc,
+    BlendFuncSeparate,
+    ClearColor,
+    ClearDepthf,
+    ClearStencil,
+    ColorMask,
+    CullFace,
+    DepthFunc,
+    DepthMask,
+    DepthRangef,
+    Disable,
+    Enable,
+    FrontFace,
+    LineWidth,
+    PixelStorei,
+    PolygonOffset,
+    Scissor,
+    StencilFunc,
+    StencilFuncSeparate,
+    StencilMask,
+    StencilMaskSeparate,
+    StencilOp,
+    StencilOpSeparate,
+    UseProgram,
+    Viewport,
+
+    InvalidEnum,
+    EnumCount = InvalidEnum,
+};
+
 class State : angle::NonCopyable
 {
   public:
@@ -342,7 +386,11 @@ class State : angle::NonCopyable
     //// Typed buffer binding point manipulation ////
     ANGLE_INLINE void setBufferBinding(const Context *context, BufferBinding target, Buffer *buffer)
     {
-        (this->*(kBufferSetters[target]))(context, buffer);
+        if (getTargetBuffer(target) != buffer)
+        {
+            (this->*(kBufferSetters[target]))(context, buffer);
+            mStateChangeSerial++;
+        }
     }
 
     ANGLE_INLINE Buffer *getTargetBuffer(BufferBinding target) const
@@ -659,6 +707,8 @@ class State : angle::NonCopyable
     void onImageStateChange(const Context *context, size_t unit);
 
     void onUniformBufferStateChange(size_t uniformBufferIndex);
+    void onAtomicCounterBufferStateChange(size_t atomicCounterBufferIndex);
+    void onShaderStorageBufferStateChange(size_t shaderStorageBufferIndex);
 
     bool isCurrentTransformFeedback(const TransformFeedback *tf) const
     {
@@ -687,12 +737,31 @@ class State : angle::NonCopyable
     ProvokingVertexConvention getProvokingVertex() const { return mProvokingVertex; }
     void setProvokingVertex(ProvokingVertexConvention val)
     {
-        mDirtyBits.set(State::DIRTY_BIT_PROVOKING_VERTEX);
-        mProvokingVertex = val;
+        if (mProvokingVertex != val)
+        {
+            setDirtyBit(State::DIRTY_BIT_PROVOKING_VERTEX);
+            mProvokingVertex = val;
+        }
     }
 
     const OverlayType *getOverlay() const { return mOverlay; }
 
+    // GL_ANGLE_state_call_statistics.  The setters bump the change serial whenever they change
+    // the state, so a call that leaves the serial as it was is redundant.
+    uint64_t getStateChangeSerial() const { return mStateChangeSerial; }
+    void onStateCall(StateCall call, uint64_t serialBefore)
+    {
+        if (mStateChangeSerial == serialBefore)
+        {
+            mRedundantStateCalls[call]++;
+        }
+        else
+        {
+            mEffectiveStateCalls[call]++;
+        }
+    }
+    GLint64 getStateCallTotal(GLenum pname) const;
+
     // Not for general use.
     const BufferManager &getBufferManagerForCapture() const { return *mBufferManager; }
     const BoundBufferMap &getBoundBuffersForCapture() const { return mBoundBuffers; }
@@ -714,6 +783,12 @@ class State : angle::NonCopyable
   private:
     friend class Context;
 
+    void setDirtyBit(size_t dirtyBit)
+    {
+        mDirtyBits.set(dirtyBit);
+        mStateChangeSerial++;
+    }
+
     void unsetActiveTextures(ActiveTextureMask textureMask);
     void updateActiveTexture(const Context *context, size_t textureIndex, Texture *texture);
     void updateActiveTextureState(const Context *context,
@@ -829,6 +904,8 @@ class State : angle::NonCopyable
     Framebuffer *mDrawFramebuffer;
     BindingPointer<Renderbuffer> mRenderbuffer;
     Program *mProgram;
+    // The link serial of mProgram when its executable was last installed.
+    uint32_t mProgramLinkSerial;
     BindingPointer<ProgramPipeline> mProgramPipeline;
 
     // GL_ANGLE_provoking_vertex
@@ -926,6 +1003,27 @@ class State : angle::NonCopyable
 
     // The Overlay object, used by the backend to render the overlay.
     const OverlayType *mOverlay;
+
+    // GL_ANGLE_state_call_statistics
+    uint64_t mStateChangeSerial;
+    angle::PackedEnumMap<StateCall, uint64_t> mEffectiveStateCalls;
+    angle::PackedEnumMap<StateCall, uint64_t> mRedundantStateCalls;
+};
+
+// Counts a call in GL_ANGLE_state_call_statistics.  The call was redundant if none of the setters
+// it called changed the state.
+class ScopedStateCallCounter final : angle::NonCopyable
+{
+  public:
+    ScopedStateCallCounter(State *state, StateCall call)
+        : mState(state), mCall(call), mSerial(state->getStateChangeSerial())
+    {}
+    ~ScopedStateCallCounter() { mState->onStateCall(mCall, mSerial); }
+
+  private:
+    State *mState;
+    StateCall mCall;
+    uint64_t mSerial;
 };
 
 ANGLE_INLINE angle::Result State::syncDirtyObjects(const Context *context,
@@ -11,10 +11,11 @@
 #include "libANGLE/WorkerThread.h"
 
 #if (ANGLE_STD_ASYNC_WORKERS == ANGLE_ENABLED)
+#    include <algorithm>
+#    include <atomic>
 #    include <condition_variable>
-#    include <future>
+#    include <deque>
 #    include <mutex>
-#    include <queue>
 #    include <thread>
 #endif  // (ANGLE_STD_ASYNC_WORKERS == ANGLE_ENABLED)
 
@@ -54,14 +55,17 @@ bool SingleThreadedWaitableEvent::isReady()
 class SingleThreadedWorkerPool final : public WorkerThreadPool
 {
   public:
-    std::shared_ptr<WaitableEvent> postWorkerTask(std::shared_ptr<Closure> task) override;
+    std::shared_ptr<WaitableEvent> postWorkerTask(std::shared_ptr<Closure> task,
+                                                  TaskPriority priority) override;
     void setMaxThreads(size_t maxThreads) override;
+    size_t getMaxThreads() override;
     bool isAsync() override;
 };
 
 // SingleThreadedWorkerPool implementation.
 std::shared_ptr<WaitableEvent> SingleThreadedWorkerPool::postWorkerTask(
-    std::shared_ptr<Closure> task)
+    std::shared_ptr<Closure> task,
+    TaskPriority priority)
 {
     (*task)();
     return std::make_shared<SingleThreadedWaitableEvent>();
@@ -69,105 +73,237 @@ std::shared_ptr<WaitableEvent> SingleThreadedWorkerPool::postWorkerTask(
 
 void SingleThreadedWorkerPool::setMaxThreads(size_t maxThreads) {}
 
+size_t SingleThreadedWorkerPool::getMaxThreads()
+{
+    return 1;
+}
+
 bool SingleThreadedWorkerPool::isAsync()
 {
     return false;
 }
 
 #if (ANGLE_STD_ASYNC_WORKERS == ANGLE_ENABLED)
+namespace
+{
+constexpr size_t kPriorityCount = static_cast<size_t>(TaskPriority::EnumCount);
+
+// Once this many tasks are waiting for a worker, new tasks are run on the posting thread instead.
+// That throttles producers without the risk of deadlocking a task that posts to its own pool.
+constexpr size_t kMaxQueuedTasks = 1024;
+}  // anonymous namespace
+
 class AsyncWaitableEvent final : public WaitableEvent
 {
   public:
-    AsyncWaitableEvent() : mIsPending(true) {}
+    AsyncWaitableEvent() : mIsReady(false) {}
     ~AsyncWaitableEvent() override = default;
 
     void wait() override;
     bool isReady() override;
 
+    void markAsReady();
+
   private:
-    friend class AsyncWorkerPool;
-    void setFuture(std::future<void> &&future);
+    // Checked without the lock by isReady().  The mutex is only needed to sleep in wait().
+    std::atomic<bool> mIsReady;
 
-    // To block wait() when the task is stil in queue to be run.
-    // Also to protect the concurrent accesses from both main thread and
-    // background threads to the member fields.
     std::mutex mMutex;
-
-    bool mIsPending;
     std::condition_variable mCondition;
-    std::future<void> mFuture;
 };
 
-void AsyncWaitableEvent::setFuture(std::future<void> &&future)
-{
-    mFuture = std::move(future);
-}
-
 void AsyncWaitableEvent::wait()
 {
+    if (mIsReady.load(std::memory_order_acquire))
     {
-        std::unique_lock<std::mutex> lock(mMutex);
-        mCondition.wait(lock, [this] { return !mIsPending; });
+        return;
     }
 
-    ASSERT(mFuture.valid());
-    mFuture.wait();
+    std::unique_lock<std::mutex> lock(mMutex);
+    mCondition.wait(lock, [this] { return mIsReady.load(std::memory_order_acquire); });
 }
 
 bool AsyncWaitableEvent::isReady()
 {
-    std::lock_guard<std::mutex> lock(mMutex);
-    if (mIsPending)
+    return mIsReady.load(std::memory_order_acquire);
+}
+
+void AsyncWaitableEvent::markAsReady()
+{
     {
-        return false;
+        std::lock_guard<std::mutex> lock(mMutex);
+        mIsReady.store(true, std::memory_order_release);
     }
-    ASSERT(mFuture.valid());
-    return mFuture.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+    mCondition.notify_all();
 }
 
+// A pool of persistent worker threads.  Every worker owns a queue per priority, and posted tasks
+// are spread round-robin over the queues of the running workers.  A worker takes the oldest task
+// of the highest priority available, looking in its own queues first and stealing from the other
+// workers' queues otherwise.  Threads are started on demand up to the maximum count and are kept
+// alive until the pool is destroyed.
 class AsyncWorkerPool final : public WorkerThreadPool
 {
   public:
-    AsyncWorkerPool(size_t maxThreads) : mMaxThreads(maxThreads), mRunningThreads(0) {}
-    ~AsyncWorkerPool() override = default;
+    AsyncWorkerPool(size_t maxThreads);
+    ~AsyncWorkerPool() override;
 
-    std::shared_ptr<WaitableEvent> postWorkerTask(std::shared_ptr<Closure> task) override;
+    std::shared_ptr<WaitableEvent> postWorkerTask(std::shared_ptr<Closure> task,
+                                                  TaskPriority priority) override;
     void setMaxThreads(size_t maxThreads) override;
+    size_t getMaxThreads() override;
     bool isAsync() override;
 
   private:
-    void checkToRunPendingTasks();
+    struct Task
+    {
+        std::shared_ptr<Closure> closure;
+        std::shared_ptr<AsyncWaitableEvent> waitable;
+    };
 
-    // To protect the concurrent accesses from both main thread and background
-    // threads to the member fields.
-    std::mutex mMutex;
+    struct WorkerQueues
+    {
+        std::mutex mutex;
+        std::array<std::deque<Task>, kPriorityCount> queues;
+    };
+
+    // The state shared with the worker threads.  It outlives the pool, since the pool may be
+    // released from one of its own workers when a finished task drops the last reference to it.
+    struct State
+    {
+        std::mutex mutex;
+        std::condition_variable condition;
+
+        // Protected by |mutex|.
+        size_t maxThreads  = 0;
+        size_t queuedTasks = 0;
+        size_t idleThreads = 0;
+        size_t nextWorker  = 0;
+        bool terminate     = false;
+
+        // Allocated up front for the largest possible thread count, so the workers can look
+        // through all the queues without holding |mutex|.
+        std::vector<std::unique_ptr<WorkerQueues>> workers;
+    };
 
-    size_t mMaxThreads;
-    size_t mRunningThreads;
-    std::queue<std::pair<std::shared_ptr<AsyncWaitableEvent>, std::shared_ptr<Closure>>> mTaskQueue;
+    static void ThreadLoop(std::shared_ptr<State> state, size_t workerIndex);
+    static bool PopTask(State *state, size_t workerIndex, Task *taskOut);
+
+    void startThreadLocked();
+
+    std::shared_ptr<State> mState;
+
+    // Protected by |mState->mutex|.
+    std::vector<std::thread> mThreads;
 };
 
 // AsyncWorkerPool implementation.
-std::shared_ptr<WaitableEvent> AsyncWorkerPool::postWorkerTask(std::shared_ptr<Closure> task)
+AsyncWorkerPool::AsyncWorkerPool(size_t maxThreads) : mState(std::make_shared<State>())
 {
-    ASSERT(mMaxThreads > 0);
+    size_t threadLimit = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+    mState->workers.resize(threadLimit);
+    for (std::unique_ptr<WorkerQueues> &worker : mState->workers)
+    {
+        worker = std::make_unique<WorkerQueues>();
+    }
+    mState->maxThreads = std::min(std::max<size_t>(maxThreads, 1), threadLimit);
+}
 
+AsyncWorkerPool::~AsyncWorkerPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mState->mutex);
+        mState->terminate = true;
+    }
+    mState->condition.notify_all();
+
+    // Tasks that are still queued are run before the workers exit.
+    for (std::thread &thread : mThreads)
+    {
+        if (thread.get_id() == std::this_thread::get_id())
+        {
+            // The last reference to the pool was held by a task.  The worker that ran it only
+            // touches the shared state from now on, and exits by itself.
+            thread.detach();
+        }
+        else
+        {
+            thread.join();
+        }
+    }
+}
+
+std::shared_ptr<WaitableEvent> AsyncWorkerPool::postWorkerTask(std::shared_ptr<Closure> task,
+                                                               TaskPriority priority)
+{
     auto waitable = std::make_shared<AsyncWaitableEvent>();
+
+    bool wakeAllThreads = false;
     {
-        std::lock_guard<std::mutex> lock(mMutex);
-        mTaskQueue.push(std::make_pair(waitable, task));
+        std::lock_guard<std::mutex> lock(mState->mutex);
+        if (mState->queuedTasks < kMaxQueuedTasks)
+        {
+            if (mState->idleThreads == 0 && mThreads.size() < mState->maxThreads)
+            {
+                startThreadLocked();
+            }
+
+            size_t runningThreads = std::min(mThreads.size(), mState->maxThreads);
+            size_t workerIndex    = mState->nextWorker++ % runningThreads;
+
+            WorkerQueues *worker = mState->workers[workerIndex].get();
+            {
+                std::lock_guard<std::mutex> workerLock(worker->mutex);
+                worker->queues[static_cast<size_t>(priority)].push_back({task, waitable});
+            }
+            ++mState->queuedTasks;
+
+            // Threads above the maximum count sleep until it's raised, so waking a single thread
+            // could pick one of them.
+            wakeAllThreads = mThreads.size() > mState->maxThreads;
+            task.reset();
+        }
+    }
+
+    if (task)
+    {
+        (*task)();
+        waitable->markAsReady();
+        return waitable;
+    }
+
+    if (wakeAllThreads)
+    {
+        mState->condition.notify_all();
+    }
+    else
+    {
+        mState->condition.notify_one();
     }
-    checkToRunPendingTasks();
     return waitable;
 }
 
 void AsyncWorkerPool::setMaxThreads(size_t maxThreads)
 {
     {
-        std::lock_guard<std::mutex> lock(mMutex);
-        mMaxThreads = (maxThreads == 0xFFFFFFFF ? std::thread::hardware_concurrency() : maxThreads);
+        std::lock_guard<std::mutex> lock(mState->mutex);
+        size_t threadLimit = mState->workers.size();
+        mState->maxThreads =
+            (maxThreads == 0xFFFFFFFF ? threadLimit
+                                      : std::min(std::max<size_t>(maxThreads, 1), threadLimit));
+
+        while (mThreads.size() < mState->maxThreads && mThreads.size() < mState->queuedTasks)
+        {
+            startThreadLocked();
+        }
     }
-    checkToRunPendingTasks();
+    mState->condition.notify_all();
+}
+
+size_t AsyncWorkerPool::getMaxThreads()
+{
+    std::lock_guard<std::mutex> lock(mState->mutex);
+    return mState->maxThreads;
 }
 
 bool AsyncWorkerPool::isAsync()
@@ -175,35 +311,67 @@ bool AsyncWorkerPool::isAsync()
     return true;
 }
 
-void AsyncWorkerPool::checkToRunPendingTasks()
+void AsyncWorkerPool::startThreadLocked()
 {
-    std::lock_guard<std::mutex> lock(mMutex);
-    while (mRunningThreads < mMaxThreads && !mTaskQueue.empty())
-    {
-        auto task = mTaskQueue.front();
-        mTaskQueue.pop();
-        auto waitable = task.first;
-        auto closure  = task.second;
+    mThreads.emplace_back(&AsyncWorkerPool::ThreadLoop, mState, mThreads.size());
+}
 
-        auto future = std::async(std::launch::async, [closure, this] {
-            (*closure)();
+// static
+void AsyncWorkerPool::ThreadLoop(std::shared_ptr<State> state, size_t workerIndex)
+{
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(state->mutex);
+            ++state->idleThreads;
+            state->condition.wait(lock, [&state, workerIndex] {
+                return state->terminate ||
+                       (workerIndex < state->maxThreads && state->queuedTasks > 0);
+            });
+            --state->idleThreads;
+
+            if (state->queuedTasks == 0)
             {
-                std::lock_guard<std::mutex> lock(mMutex);
-                ASSERT(mRunningThreads != 0);
-                --mRunningThreads;
+                ASSERT(state->terminate);
+                return;
             }
-            checkToRunPendingTasks();
-        });
+            --state->queuedTasks;
+        }
 
-        ++mRunningThreads;
+        // A task was queued for every claim, but another worker may be holding the one this
+        // worker would have found.  It's only briefly out of reach, so try again.
+        Task task;
+        while (!PopTask(state.get(), workerIndex, &task))
+        {
+            std::this_thread::yield();
+        }
 
+        (*task.closure)();
+        task.waitable->markAsReady();
+    }
+}
+
+// static
+bool AsyncWorkerPool::PopTask(State *state, size_t workerIndex, Task *taskOut)
+{
+    const size_t workerCount = state->workers.size();
+    for (size_t priority = 0; priority < kPriorityCount; ++priority)
+    {
+        for (size_t offset = 0; offset < workerCount; ++offset)
         {
-            std::lock_guard<std::mutex> waitableLock(waitable->mMutex);
-            waitable->mIsPending = false;
-            waitable->setFuture(std::move(future));
+            WorkerQueues *worker = state->workers[(workerIndex + offset) % workerCount].get();
+
+            std::lock_guard<std::mutex> lock(worker->mutex);
+            std::deque<Task> &queue = worker->queues[priority];
+            if (!queue.empty())
+            {
+                *taskOut = std::move(queue.front());
+                queue.pop_front();
+                return true;
+            }
         }
-        waitable->mCondition.notify_all();
     }
+    return false;
 }
 #endif  // (ANGLE_STD_ASYNC_WORKERS == ANGLE_ENABLED)
 
@@ -229,9 +397,10 @@ std::shared_ptr<WorkerThreadPool> WorkerThreadPool::Create(bool multithreaded)
 // static
 std::shared_ptr<WaitableEvent> WorkerThreadPool::PostWorkerTask(
     std::shared_ptr<WorkerThreadPool> pool,
-    std::shared_ptr<Closure> task)
+    std::shared_ptr<Closure> task,
+    TaskPriority priority)
 {
-    std::shared_ptr<WaitableEvent> event = pool->postWorkerTask(task);
+    std::shared_ptr<WaitableEvent> event = pool->postWorkerTask(task, priority);
     if (event.get())
     {
         event->setWorkerThreadPool(pool);
@@ -23,6 +23,19 @@ namespace angle
 
 class WorkerThreadPool;
 
+// Determines the order in which queued tasks are picked up by the worker threads.
+enum class TaskPriority
+{
+    // Work the application is likely to block on first, such as program links.
+    High,
+    // Regular work, such as shader translation.
+    Normal,
+    // Background work no-one is waiting on, such as cache maintenance.
+    Low,
+
+    EnumCount
+};
+
 // A callback function with no return value and no arguments.
 class Closure
 {
@@ -76,17 +89,22 @@ class WorkerThreadPool : angle::NonCopyable
     virtual ~WorkerThreadPool();
 
     static std::shared_ptr<WorkerThreadPool> Create(bool multithreaded);
-    static std::shared_ptr<WaitableEvent> PostWorkerTask(std::shared_ptr<WorkerThreadPool> pool,
-                                                         std::shared_ptr<Closure> task);
+    static std::shared_ptr<WaitableEvent> PostWorkerTask(
+        std::shared_ptr<WorkerThreadPool> pool,
+        std::shared_ptr<Closure> task,
+        TaskPriority priority = TaskPriority::Normal);
 
     virtual void setMaxThreads(size_t maxThreads) = 0;
+    // The number of tasks that may run at the same time.
+    virtual size_t getMaxThreads() = 0;
 
     virtual bool isAsync() = 0;
 
   private:
     // Returns an event to wait on for the task to finish.
     // If the pool fails to create the task, returns null.
-    virtual std::shared_ptr<WaitableEvent> postWorkerTask(std::shared_ptr<Closure> task) = 0;
+    virtual std::shared_ptr<WaitableEvent> postWorkerTask(std::shared_ptr<Closure> task,
+                                                          TaskPriority priority) = 0;
 };
 
 }  // namespace angle
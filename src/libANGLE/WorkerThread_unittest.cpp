@@ -8,6 +8,10 @@
 
 #include <gtest/gtest.h>
 #include <array>
+#include <atomic>
+#include <future>
+#include <mutex>
+#include <vector>
 
 #include "libANGLE/WorkerThread.h"
 
@@ -49,4 +53,125 @@ TEST(WorkerPoolTest, SimpleTask)
     }
 }
 
+// Tests that queued tasks are run in priority order.
+TEST(WorkerPoolTest, Priorities)
+{
+    class BlockingTask : public Closure
+    {
+      public:
+        void operator()() override { release.get_future().wait(); }
+
+        std::promise<void> release;
+    };
+
+    class RecordingTask : public Closure
+    {
+      public:
+        RecordingTask(std::mutex *mutex, std::vector<TaskPriority> *order, TaskPriority priority)
+            : mMutex(mutex), mOrder(order), mPriority(priority)
+        {}
+
+        void operator()() override
+        {
+            std::lock_guard<std::mutex> lock(*mMutex);
+            mOrder->push_back(mPriority);
+        }
+
+      private:
+        std::mutex *mMutex;
+        std::vector<TaskPriority> *mOrder;
+        TaskPriority mPriority;
+    };
+
+    std::shared_ptr<WorkerThreadPool> pool = WorkerThreadPool::Create(true);
+    pool->setMaxThreads(1);
+
+    // Keep the only worker busy while the other tasks are queued.
+    auto blockingTask = std::make_shared<BlockingTask>();
+    std::shared_ptr<WaitableEvent> blockingEvent =
+        WorkerThreadPool::PostWorkerTask(pool, blockingTask);
+
+    std::mutex mutex;
+    std::vector<TaskPriority> order;
+    std::array<std::shared_ptr<WaitableEvent>, 3> waitables = {
+        {WorkerThreadPool::PostWorkerTask(
+             pool, std::make_shared<RecordingTask>(&mutex, &order, TaskPriority::Low),
+             TaskPriority::Low),
+         WorkerThreadPool::PostWorkerTask(
+             pool, std::make_shared<RecordingTask>(&mutex, &order, TaskPriority::Normal),
+             TaskPriority::Normal),
+         WorkerThreadPool::PostWorkerTask(
+             pool, std::make_shared<RecordingTask>(&mutex, &order, TaskPriority::High),
+             TaskPriority::High)}};
+
+    blockingTask->release.set_value();
+    blockingEvent->wait();
+    WaitableEvent::WaitMany(&waitables);
+
+    std::vector<TaskPriority> expected = {TaskPriority::High, TaskPriority::Normal,
+                                          TaskPriority::Low};
+    EXPECT_EQ(expected, order);
+}
+
+// Tests posting more tasks than the pool queues, so some of them run on the posting thread.
+TEST(WorkerPoolTest, ManyTasks)
+{
+    class CountingTask : public Closure
+    {
+      public:
+        CountingTask(std::atomic<int> *count) : mCount(count) {}
+
+        void operator()() override { ++(*mCount); }
+
+      private:
+        std::atomic<int> *mCount;
+    };
+
+    constexpr int kTaskCount = 5000;
+
+    std::shared_ptr<WorkerThreadPool> pool = WorkerThreadPool::Create(true);
+    std::atomic<int> count(0);
+    std::vector<std::shared_ptr<WaitableEvent>> waitables;
+    for (int taskIndex = 0; taskIndex < kTaskCount; ++taskIndex)
+    {
+        waitables.push_back(
+            WorkerThreadPool::PostWorkerTask(pool, std::make_shared<CountingTask>(&count)));
+    }
+
+    for (std::shared_ptr<WaitableEvent> &waitable : waitables)
+    {
+        waitable->wait();
+        EXPECT_TRUE(waitable->isReady());
+    }
+    EXPECT_EQ(kTaskCount, count.load());
+}
+
+// Tests that the pool can be released by the last task referencing it.
+TEST(WorkerPoolTest, ReleasedFromTask)
+{
+    class TestTask : public Closure
+    {
+      public:
+        void operator()() override
+        {
+            start.get_future().wait();
+            done.set_value();
+        }
+
+        std::promise<void> start;
+        std::promise<void> done;
+    };
+
+    auto task                  = std::make_shared<TestTask>();
+    std::future<void> finished = task->done.get_future();
+    {
+        std::shared_ptr<WorkerThreadPool> pool = WorkerThreadPool::Create(true);
+        WorkerThreadPool::PostWorkerTask(pool, task);
+    }
+
+    // The worker now holds the only reference to the pool.
+    task->start.set_value();
+    finished.wait();
+}
+
 }  // anonymous namespace
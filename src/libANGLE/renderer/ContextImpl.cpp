@@ -10,15 +10,124 @@
 #include "libANGLE/renderer/ContextImpl.h"
 
 #include "libANGLE/Context.h"
+#include "libANGLE/Context.inl.h"
 
 namespace rx
 {
+namespace
+{
+ANGLE_INLINE bool IsNoopDraw(gl::PrimitiveMode mode, GLsizei count, GLsizei instanceCount)
+{
+    return instanceCount == 0 || count < gl::kMinimumPrimitiveCounts[mode];
+}
+}  // anonymous namespace
+
 ContextImpl::ContextImpl(const gl::State &state, gl::ErrorSet *errorSet)
     : mState(state), mMemoryProgramCache(nullptr), mErrors(errorSet)
 {}
 
 ContextImpl::~ContextImpl() {}
 
+angle::Result ContextImpl::multiDrawArrays(const gl::Context *context,
+                                           gl::PrimitiveMode mode,
+                                           const GLint *firsts,
+                                           const GLsizei *counts,
+                                           GLsizei drawcount)
+{
+    gl::Program *programObject = mState.getLinkedProgram(context);
+    const bool hasDrawID       = programObject && programObject->hasDrawIDUniform();
+    for (GLsizei drawID = 0; drawID < drawcount; ++drawID)
+    {
+        if (IsNoopDraw(mode, counts[drawID], 1))
+        {
+            continue;
+        }
+        if (hasDrawID)
+        {
+            programObject->setDrawIDUniform(drawID);
+        }
+        ANGLE_TRY(drawArrays(context, mode, firsts[drawID], counts[drawID]));
+        gl::MarkTransformFeedbackBufferUsage(context, counts[drawID], 1);
+    }
+    return angle::Result::Continue;
+}
+
+angle::Result ContextImpl::multiDrawArraysInstanced(const gl::Context *context,
+                                                    gl::PrimitiveMode mode,
+                                                    const GLint *firsts,
+                                                    const GLsizei *counts,
+                                                    const GLsizei *instanceCounts,
+                                                    GLsizei drawcount)
+{
+    gl::Program *programObject = mState.getLinkedProgram(context);
+    const bool hasDrawID       = programObject && programObject->hasDrawIDUniform();
+    for (GLsizei drawID = 0; drawID < drawcount; ++drawID)
+    {
+        if (IsNoopDraw(mode, counts[drawID], instanceCounts[drawID]))
+        {
+            continue;
+        }
+        if (hasDrawID)
+        {
+            programObject->setDrawIDUniform(drawID);
+        }
+        ANGLE_TRY(drawArraysInstanced(context, mode, firsts[drawID], counts[drawID],
+                                      instanceCounts[drawID]));
+        gl::MarkTransformFeedbackBufferUsage(context, counts[drawID], instanceCounts[drawID]);
+    }
+    return angle::Result::Continue;
+}
+
+angle::Result ContextImpl::multiDrawElements(const gl::Context *context,
+                                             gl::PrimitiveMode mode,
+                                             const GLsizei *counts,
+                                             gl::DrawElementsType type,
+                                             const GLvoid *const *indices,
+                                             GLsizei drawcount)
+{
+    gl::Program *programObject = mState.getLinkedProgram(context);
+    const bool hasDrawID       = programObject && programObject->hasDrawIDUniform();
+    for (GLsizei drawID = 0; drawID < drawcount; ++drawID)
+    {
+        if (IsNoopDraw(mode, counts[drawID], 1))
+        {
+            continue;
+        }
+        if (hasDrawID)
+        {
+            programObject->setDrawIDUniform(drawID);
+        }
+        ANGLE_TRY(drawElements(context, mode, counts[drawID], type, indices[drawID]));
+    }
+    return angle::Result::Continue;
+}
+
+angle::Result ContextImpl::multiDrawElementsInstanced(const gl::Context *context,
+                                                      gl::PrimitiveMode mode,
+                                                      const GLsizei *counts,
+                                                      gl::DrawElementsType type,
+                                                      const GLvoid *const *indices,
+                                                      const GLsizei *instanceCounts,
+                                                      GLsizei drawcount)
+{
+    gl::Program *programObject = mState.getLinkedProgram(context);
+    const bool hasDrawID       = programObject && programObject->hasDrawIDUniform();
+    for (GLsizei drawID = 0; drawID < drawcount; ++drawID)
+    {
+        if (IsNoopDraw(mode, counts[drawID], instanceCounts[drawID]))
+        {
+            continue;
+        }
+        if (hasDrawID)
+        {
+            programObject->setDrawIDUniform(drawID);
+        }
+        ANGLE_TRY(drawElementsInstanced(context, mode, counts[drawID], type, indices[drawID],
+                                        instanceCounts[drawID]));
+    }
+    return angle::Result::Continue;
+}
+
 void ContextImpl::stencilFillPath(const gl::Path *path, GLenum fillMode, GLuint mask)
 {
     UNREACHABLE();
@@ -9,6 +9,7 @@
 #include "libANGLE/renderer/ShaderImpl.h"
 
 #include "libANGLE/Context.h"
+#include "libANGLE/MemoryShaderCache.h"
 
 namespace rx
 {
@@ -65,9 +66,12 @@ class WaitableCompileEventImpl final : public WaitableCompileEvent
 {
   public:
     WaitableCompileEventImpl(std::shared_ptr<angle::WaitableEvent> waitableEvent,
-                             std::shared_ptr<TranslateTask> translateTask)
+                             std::shared_ptr<TranslateTask> translateTask,
+                             const Optional<egl::BlobCache::Key> &shaderHash)
         : WaitableCompileEvent(waitableEvent), mTranslateTask(translateTask)
-    {}
+    {
+        mShaderHash = shaderHash;
+    }
 
     bool getResult() override { return mTranslateTask->getResult(); }
 
@@ -77,6 +81,44 @@ class WaitableCompileEventImpl final : public WaitableCompileEvent
     std::shared_ptr<TranslateTask> mTranslateTask;
 };
 
+// The translation was found in the shader cache.  The translate task is only run if the cached
+// translation turns out to be unusable.
+class WaitableCompileEventCached final : public WaitableCompileEvent
+{
+  public:
+    WaitableCompileEventCached(std::shared_ptr<TranslateTask> translateTask,
+                               const egl::BlobCache::Key &shaderHash,
+                               angle::MemoryBuffer &&translation)
+        : WaitableCompileEvent(std::make_shared<angle::WaitableEventDone>()),
+          mTranslateTask(translateTask),
+          mTranslation(std::move(translation)),
+          mTranslated(false)
+    {
+        mShaderHash = shaderHash;
+    }
+
+    bool getResult() override { return mTranslated ? mTranslateTask->getResult() : true; }
+
+    bool postTranslate(std::string *infoLog) override { return true; }
+
+    const angle::MemoryBuffer *getCachedTranslation() override
+    {
+        return mTranslated ? nullptr : &mTranslation;
+    }
+
+    void translateUncached() override
+    {
+        ASSERT(!mTranslated);
+        (*mTranslateTask)();
+        mTranslated = true;
+    }
+
+  private:
+    std::shared_ptr<TranslateTask> mTranslateTask;
+    angle::MemoryBuffer mTranslation;
+    bool mTranslated;
+};
+
 std::shared_ptr<WaitableCompileEvent> ShaderImpl::compileImpl(
     const gl::Context *context,
     gl::ShCompilerInstance *compilerInstance,
@@ -91,8 +133,28 @@ std::shared_ptr<WaitableCompileEvent> ShaderImpl::compileImpl(
     auto translateTask =
         std::make_shared<TranslateTask>(compilerInstance->getHandle(), compileOptions, source);
 
+    // The translation only depends on the translator's inputs here, so it can be looked up in and
+    // later stored to the shader cache.
+    Optional<egl::BlobCache::Key> shaderHash;
+    gl::MemoryShaderCache *shaderCache = context->getMemoryShaderCache();
+    if (shaderCache && shaderCache->isCachingEnabled())
+    {
+        egl::BlobCache::Key hash;
+        gl::MemoryShaderCache::ComputeHash(context, compilerInstance, source, compileOptions,
+                                           &hash);
+
+        angle::MemoryBuffer translation;
+        if (shaderCache->getShader(context, hash, &translation))
+        {
+            return std::make_shared<WaitableCompileEventCached>(translateTask, hash,
+                                                                std::move(translation));
+        }
+        shaderHash = hash;
+    }
+
     return std::make_shared<WaitableCompileEventImpl>(
-        angle::WorkerThreadPool::PostWorkerTask(workerThreadPool, translateTask), translateTask);
+        angle::WorkerThreadPool::PostWorkerTask(workerThreadPool, translateTask), translateTask,
+        shaderHash);
 }
 
 }  // namespace rx
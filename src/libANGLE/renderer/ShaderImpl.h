@@ -11,7 +11,10 @@
 
 #include <functional>
 
+#include "common/MemoryBuffer.h"
+#include "common/Optional.h"
 #include "common/angleutils.h"
+#include "libANGLE/BlobCache.h"
 #include "libANGLE/Shader.h"
 #include "libANGLE/WorkerThread.h"
 
@@ -40,9 +43,21 @@ class WaitableCompileEvent : public angle::WaitableEvent
 
     const std::string &getInfoLog();
 
+    // The key of the translation in the shader cache.  Only set if the translation doesn't depend
+    // on anything but the translator's output, so it can be cached.
+    const Optional<egl::BlobCache::Key> &getShaderHash() const { return mShaderHash; }
+
+    // The translation found in the shader cache, in which case the translator doesn't run.
+    virtual const angle::MemoryBuffer *getCachedTranslation() { return nullptr; }
+
+    // Runs the translator if the cached translation couldn't be loaded.  After this,
+    // getCachedTranslation() returns null and getResult() returns the result of the translation.
+    virtual void translateUncached() { UNREACHABLE(); }
+
   protected:
     std::shared_ptr<angle::WaitableEvent> mWaitableEvent;
     std::string mInfoLog;
+    Optional<egl::BlobCache::Key> mShaderHash;
 };
 
 class ShaderImpl : angle::NonCopyable
@@ -913,7 +913,8 @@ class ProgramD3D::LoadBinaryLinkEvent final : public LinkEvent
                         gl::BinaryInputStream *stream,
                         gl::InfoLog &infoLog)
         : mTask(std::make_shared<ProgramD3D::LoadBinaryTask>(program, stream, infoLog)),
-          mWaitableEvent(angle::WorkerThreadPool::PostWorkerTask(workerPool, mTask))
+          mWaitableEvent(angle::WorkerThreadPool::PostWorkerTask(workerPool, mTask,
+                                                                 angle::TaskPriority::High))
     {}
 
     angle::Result wait(const gl::Context *context) override
@@ -1757,12 +1758,12 @@ class ProgramD3D::GraphicsProgramLinkEvent final : public LinkEvent
           mVertexTask(vertexTask),
           mPixelTask(pixelTask),
           mGeometryTask(geometryTask),
-          mWaitEvents({{std::shared_ptr<WaitableEvent>(
-                            angle::WorkerThreadPool::PostWorkerTask(workerPool, mVertexTask)),
-                        std::shared_ptr<WaitableEvent>(
-                            angle::WorkerThreadPool::PostWorkerTask(workerPool, mPixelTask)),
-                        std::shared_ptr<WaitableEvent>(
-                            angle::WorkerThreadPool::PostWorkerTask(workerPool, mGeometryTask))}}),
+          mWaitEvents({{std::shared_ptr<WaitableEvent>(angle::WorkerThreadPool::PostWorkerTask(
+                            workerPool, mVertexTask, angle::TaskPriority::High)),
+                        std::shared_ptr<WaitableEvent>(angle::WorkerThreadPool::PostWorkerTask(
+                            workerPool, mPixelTask, angle::TaskPriority::High)),
+                        std::shared_ptr<WaitableEvent>(angle::WorkerThreadPool::PostWorkerTask(
+                            workerPool, mGeometryTask, angle::TaskPriority::High))}}),
           mUseGS(useGS),
           mVertexShader(vertexShader),
           mFragmentShader(fragmentShader)
@@ -1934,8 +1935,8 @@ std::unique_ptr<LinkEvent> ProgramD3D::compileComputeExecutable(const gl::Contex
     }
     else
     {
-        waitableEvent =
-            WorkerThreadPool::PostWorkerTask(context->getWorkerThreadPool(), computeTask);
+        waitableEvent = WorkerThreadPool::PostWorkerTask(context->getWorkerThreadPool(),
+                                                         computeTask, TaskPriority::High);
     }
 
     return std::make_unique<ComputeProgramLinkEvent>(infoLog, computeTask, waitableEvent);
@@ -65,9 +65,10 @@ angle::Result Image11::GenerateMipmap(const gl::Context *context,
 
     auto mipGenerationFunction =
         d3d11::Format::Get(src->getInternalFormat(), rendererCaps).format().mipGenerationFunction;
-    mipGenerationFunction(src->getWidth(), src->getHeight(), src->getDepth(), sourceData,
-                          srcMapped.RowPitch, srcMapped.DepthPitch, destData, destMapped.RowPitch,
-                          destMapped.DepthPitch);
+    GenerateMipInStripes(context->getWorkerThreadPool(), mipGenerationFunction, src->getWidth(),
+                         src->getHeight(), src->getDepth(), sourceData, srcMapped.RowPitch,
+                         srcMapped.DepthPitch, destData, destMapped.RowPitch,
+                         destMapped.DepthPitch);
 
     dest->markDirty();
 
@@ -290,7 +291,7 @@ angle::Result Image11::loadData(const gl::Context *context,
 
     const d3d11::Format &d3dFormatInfo =
         d3d11::Format::Get(mInternalFormat, mRenderer->getRenderer11DeviceCaps());
-    LoadImageFunction loadFunction = d3dFormatInfo.getLoadFunctions()(type).loadFunction;
+    LoadImageFunctionInfo loadFunctionInfo = d3dFormatInfo.getLoadFunctions()(type);
 
     D3D11_MAPPED_SUBRESOURCE mappedImage;
     ANGLE_TRY(map(context, D3D11_MAP_WRITE, &mappedImage));
@@ -298,9 +299,20 @@ angle::Result Image11::loadData(const gl::Context *context,
     uint8_t *offsetMappedData = (static_cast<uint8_t *>(mappedImage.pData) +
                                  (area.y * mappedImage.RowPitch + area.x * outputPixelSize +
                                   area.z * mappedImage.DepthPitch));
-    loadFunction(area.width, area.height, area.depth,
-                 static_cast<const uint8_t *>(input) + inputSkipBytes, inputRowPitch,
-                 inputDepthPitch, offsetMappedData, mappedImage.RowPitch, mappedImage.DepthPitch);
+    const uint8_t *offsetInput = static_cast<const uint8_t *>(input) + inputSkipBytes;
+    if (loadFunctionInfo.requiresConversion)
+    {
+        LoadImageInStripes(context->getWorkerThreadPool(), loadFunctionInfo.loadFunction,
+                           area.width, area.height, area.depth, offsetInput, inputRowPitch,
+                           inputDepthPitch, offsetMappedData, mappedImage.RowPitch,
+                           mappedImage.DepthPitch);
+    }
+    else
+    {
+        loadFunctionInfo.loadFunction(area.width, area.height, area.depth, offsetInput,
+                                      inputRowPitch, inputDepthPitch, offsetMappedData,
+                                      mappedImage.RowPitch, mappedImage.DepthPitch);
+    }
 
     unmap();
 
@@ -192,7 +192,8 @@ class ProgramGL::LinkEventGL final : public LinkEvent
                 PostLinkImplFunctor &&functor)
         : mLinkTask(linkTask),
           mWaitableEvent(std::shared_ptr<angle::WaitableEvent>(
-              angle::WorkerThreadPool::PostWorkerTask(workerPool, mLinkTask))),
+              angle::WorkerThreadPool::PostWorkerTask(workerPool, mLinkTask,
+                                                      angle::TaskPriority::High))),
           mPostLinkImplFunctor(functor)
     {}
 
@@ -929,63 +929,59 @@ constexpr gl::ShaderMap<EShLanguage> kShLanguageMap = {
     {gl::ShaderType::Compute, EShLangCompute},
 };
 
-angle::Result GetShaderSpirvCode(GlslangErrorCallback callback,
-                                 const gl::Caps &glCaps,
-                                 const gl::ShaderMap<std::string> &shaderSources,
-                                 gl::ShaderMap<std::vector<uint32_t>> *shaderCodeOut)
+angle::Result GetShaderSpirvCodeForStage(GlslangErrorCallback callback,
+                                         const TBuiltInResource &builtInResources,
+                                         gl::ShaderType shaderType,
+                                         const std::string &shaderSource,
+                                         std::vector<uint32_t> *shaderCodeOut)
 {
     // Enable SPIR-V and Vulkan rules when parsing GLSL
     EShMessages messages = static_cast<EShMessages>(EShMsgSpvRules | EShMsgVulkanRules);
 
-    TBuiltInResource builtInResources(glslang::DefaultTBuiltInResource);
-    GetBuiltInResourcesFromCaps(glCaps, &builtInResources);
-
-    glslang::TShader vertexShader(EShLangVertex);
-    glslang::TShader fragmentShader(EShLangFragment);
-    glslang::TShader geometryShader(EShLangGeometry);
-    glslang::TShader computeShader(EShLangCompute);
-
-    gl::ShaderMap<glslang::TShader *> shaders = {
-        {gl::ShaderType::Vertex, &vertexShader},
-        {gl::ShaderType::Fragment, &fragmentShader},
-        {gl::ShaderType::Geometry, &geometryShader},
-        {gl::ShaderType::Compute, &computeShader},
-    };
+    // Each stage is linked in its own program.  glslang doesn't do any cross-stage validation, so
+    // this is equivalent to linking the stages together, and lets them be compiled concurrently.
+    glslang::TShader shader(kShLanguageMap[shaderType]);
     glslang::TProgram program;
 
-    for (const gl::ShaderType shaderType : gl::AllShaderTypes())
-    {
-        if (shaderSources[shaderType].empty())
-        {
-            continue;
-        }
-
-        const char *shaderString = shaderSources[shaderType].c_str();
-        int shaderLength         = static_cast<int>(shaderSources[shaderType].size());
+    const char *shaderString = shaderSource.c_str();
+    int shaderLength         = static_cast<int>(shaderSource.size());
 
-        glslang::TShader *shader = shaders[shaderType];
-        shader->setStringsWithLengths(&shaderString, &shaderLength, 1);
-        shader->setEntryPoint("main");
+    shader.setStringsWithLengths(&shaderString, &shaderLength, 1);
+    shader.setEntryPoint("main");
 
-        bool result = shader->parse(&builtInResources, 450, ECoreProfile, false, false, messages);
-        if (!result)
-        {
-            ERR() << "Internal error parsing Vulkan shader corresponding to " << shaderType << ":\n"
-                  << shader->getInfoLog() << "\n"
-                  << shader->getInfoDebugLog() << "\n";
-            ANGLE_GLSLANG_CHECK(callback, false, GlslangError::InvalidShader);
-        }
-
-        program.addShader(shader);
+    bool result = shader.parse(&builtInResources, 450, ECoreProfile, false, false, messages);
+    if (!result)
+    {
+        ERR() << "Internal error parsing Vulkan shader corresponding to " << shaderType << ":\n"
+              << shader.getInfoLog() << "\n"
+              << shader.getInfoDebugLog() << "\n";
+        ANGLE_GLSLANG_CHECK(callback, false, GlslangError::InvalidShader);
     }
 
+    program.addShader(&shader);
+
     bool linkResult = program.link(messages);
     if (!linkResult)
     {
-        ERR() << "Internal error linking Vulkan shaders:\n" << program.getInfoLog() << "\n";
+        ERR() << "Internal error linking Vulkan shader corresponding to " << shaderType << ":\n"
+              << program.getInfoLog() << "\n";
         ANGLE_GLSLANG_CHECK(callback, false, GlslangError::InvalidShader);
     }
 
+    glslang::TIntermediate *intermediate = program.getIntermediate(kShLanguageMap[shaderType]);
+    glslang::GlslangToSpv(*intermediate, *shaderCodeOut);
+
+    return angle::Result::Continue;
+}
+
+angle::Result GetShaderSpirvCode(GlslangErrorCallback callback,
+                                 const gl::Caps &glCaps,
+                                 const gl::ShaderMap<std::string> &shaderSources,
+                                 gl::ShaderMap<std::vector<uint32_t>> *shaderCodeOut)
+{
+    TBuiltInResource builtInResources(glslang::DefaultTBuiltInResource);
+    GetBuiltInResourcesFromCaps(glCaps, &builtInResources);
+
     for (const gl::ShaderType shaderType : gl::AllShaderTypes())
     {
         if (shaderSources[shaderType].empty())
@@ -993,8 +989,9 @@ angle::Result GetShaderSpirvCode(GlslangErrorCallback callback,
             continue;
         }
 
-        glslang::TIntermediate *intermediate = program.getIntermediate(kShLanguageMap[shaderType]);
-        glslang::GlslangToSpv(*intermediate, (*shaderCodeOut)[shaderType]);
+        ANGLE_TRY(GetShaderSpirvCodeForStage(callback, builtInResources, shaderType,
+                                             shaderSources[shaderType],
+                                             &(*shaderCodeOut)[shaderType]));
     }
 
     return angle::Result::Continue;
@@ -1153,4 +1150,17 @@ angle::Result GlslangGetShaderSpirvCode(GlslangErrorCallback callback,
         return GetShaderSpirvCode(callback, glCaps, shaderSources, shaderCodeOut);
     }
 }
+
+angle::Result GlslangGetShaderSpirvCodeForStage(GlslangErrorCallback callback,
+                                                const gl::Caps &glCaps,
+                                                gl::ShaderType shaderType,
+                                                const std::string &shaderSource,
+                                                std::vector<uint32_t> *shaderCodeOut)
+{
+    TBuiltInResource builtInResources(glslang::DefaultTBuiltInResource);
+    GetBuiltInResourcesFromCaps(glCaps, &builtInResources);
+
+    return GetShaderSpirvCodeForStage(callback, builtInResources, shaderType, shaderSource,
+                                      shaderCodeOut);
+}
 }  // namespace rx
@@ -57,6 +57,14 @@ angle::Result GlslangGetShaderSpirvCode(GlslangErrorCallback callback,
                                         const gl::ShaderMap<std::string> &shaderSources,
                                         gl::ShaderMap<std::vector<uint32_t>> *shaderCodesOut);
 
+// Generate the SPIR-V of a single stage, without line raster emulation.  The stages of a program
+// don't depend on each other, so they can be compiled concurrently on different threads.
+angle::Result GlslangGetShaderSpirvCodeForStage(GlslangErrorCallback callback,
+                                                const gl::Caps &glCaps,
+                                                gl::ShaderType shaderType,
+                                                const std::string &shaderSource,
+                                                std::vector<uint32_t> *shaderCodeOut);
+
 }  // namespace rx
 
 #endif  // LIBANGLE_RENDERER_GLSLANG_WRAPPER_UTILS_H_
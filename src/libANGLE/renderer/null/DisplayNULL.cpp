@@ -209,6 +209,7 @@ void DisplayNULL::generateExtensions(egl::DisplayExtensions *outExtensions) cons
     outExtensions->createContextClientArrays          = true;
     outExtensions->programCacheControl                = true;
     outExtensions->robustResourceInitialization       = true;
+    outExtensions->createContextDeferredExecution     = true;
 }
 
 void DisplayNULL::generateCaps(egl::Caps *outCaps) const
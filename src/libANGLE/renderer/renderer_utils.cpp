@@ -15,6 +15,7 @@
 #include "libANGLE/AttributeMap.h"
 #include "libANGLE/Context.h"
 #include "libANGLE/Display.h"
+#include "libANGLE/WorkerThread.h"
 #include "libANGLE/formatutils.h"
 #include "libANGLE/renderer/ContextImpl.h"
 #include "libANGLE/renderer/Format.h"
@@ -22,6 +23,7 @@
 #include "platform/Feature.h"
 
 #include <string.h>
+#include <algorithm>
 #include "common/utilities.h"
 
 namespace rx
@@ -187,6 +189,133 @@ void SetFloatUniformMatrixFast(unsigned int arrayElementOffset,
     memcpy(targetData, valueData, matrixSize * count);
 }
 
+// Loads and mip levels smaller than this aren't worth handing to other threads.
+constexpr size_t kMinStripedLoadSize = 1024 * 1024;
+// Each stripe writes at least this much, to keep the cost of the tasks low compared to the work.
+constexpr size_t kMinLoadStripeSize = 256 * 1024;
+
+class LoadImageStripeTask final : public angle::Closure
+{
+  public:
+    LoadImageStripeTask(LoadImageFunction loadFunction,
+                        size_t width,
+                        size_t height,
+                        size_t depth,
+                        const uint8_t *input,
+                        size_t inputRowPitch,
+                        size_t inputDepthPitch,
+                        uint8_t *output,
+                        size_t outputRowPitch,
+                        size_t outputDepthPitch)
+        : mLoadFunction(loadFunction),
+          mWidth(width),
+          mHeight(height),
+          mDepth(depth),
+          mInput(input),
+          mInputRowPitch(inputRowPitch),
+          mInputDepthPitch(inputDepthPitch),
+          mOutput(output),
+          mOutputRowPitch(outputRowPitch),
+          mOutputDepthPitch(outputDepthPitch)
+    {}
+
+    void operator()() override
+    {
+        mLoadFunction(mWidth, mHeight, mDepth, mInput, mInputRowPitch, mInputDepthPitch, mOutput,
+                      mOutputRowPitch, mOutputDepthPitch);
+    }
+
+  private:
+    LoadImageFunction mLoadFunction;
+    size_t mWidth;
+    size_t mHeight;
+    size_t mDepth;
+    const uint8_t *mInput;
+    size_t mInputRowPitch;
+    size_t mInputDepthPitch;
+    uint8_t *mOutput;
+    size_t mOutputRowPitch;
+    size_t mOutputDepthPitch;
+};
+
+// Generates a stripe of a mip level, for each of |layerCount| layers.
+class GenerateMipStripeTask final : public angle::Closure
+{
+  public:
+    GenerateMipStripeTask(MipGenerationFunction mipGenerationFunction,
+                          size_t sourceWidth,
+                          size_t sourceHeight,
+                          size_t sourceDepth,
+                          size_t layerCount,
+                          const uint8_t *sourceData,
+                          size_t sourceRowPitch,
+                          size_t sourceDepthPitch,
+                          size_t sourceLayerPitch,
+                          uint8_t *destData,
+                          size_t destRowPitch,
+                          size_t destDepthPitch,
+                          size_t destLayerPitch)
+        : mMipGenerationFunction(mipGenerationFunction),
+          mSourceWidth(sourceWidth),
+          mSourceHeight(sourceHeight),
+          mSourceDepth(sourceDepth),
+          mLayerCount(layerCount),
+          mSourceData(sourceData),
+          mSourceRowPitch(sourceRowPitch),
+          mSourceDepthPitch(sourceDepthPitch),
+          mSourceLayerPitch(sourceLayerPitch),
+          mDestData(destData),
+          mDestRowPitch(destRowPitch),
+          mDestDepthPitch(destDepthPitch),
+          mDestLayerPitch(destLayerPitch)
+    {}
+
+    void operator()() override
+    {
+        for (size_t layer = 0; layer < mLayerCount; ++layer)
+        {
+            mMipGenerationFunction(mSourceWidth, mSourceHeight, mSourceDepth,
+                                   mSourceData + layer * mSourceLayerPitch, mSourceRowPitch,
+                                   mSourceDepthPitch, mDestData + layer * mDestLayerPitch,
+                                   mDestRowPitch, mDestDepthPitch);
+        }
+    }
+
+  private:
+    MipGenerationFunction mMipGenerationFunction;
+    size_t mSourceWidth;
+    size_t mSourceHeight;
+    size_t mSourceDepth;
+    size_t mLayerCount;
+    const uint8_t *mSourceData;
+    size_t mSourceRowPitch;
+    size_t mSourceDepthPitch;
+    size_t mSourceLayerPitch;
+    uint8_t *mDestData;
+    size_t mDestRowPitch;
+    size_t mDestDepthPitch;
+    size_t mDestLayerPitch;
+};
+
+// Runs the first task on the calling thread and the others on the worker threads, and returns
+// once they are all done.
+void RunTasksOnWorkerThreads(const std::shared_ptr<angle::WorkerThreadPool> &workerPool,
+                             const std::vector<std::shared_ptr<angle::Closure>> &tasks)
+{
+    std::vector<std::shared_ptr<angle::WaitableEvent>> waitEvents;
+    for (size_t task = 1; task < tasks.size(); ++task)
+    {
+        waitEvents.push_back(angle::WorkerThreadPool::PostWorkerTask(workerPool, tasks[task],
+                                                                     angle::TaskPriority::High));
+    }
+
+    (*tasks[0])();
+    for (const std::shared_ptr<angle::WaitableEvent> &waitEvent : waitEvents)
+    {
+        waitEvent->wait();
+    }
+}
+
 }  // anonymous namespace
 
 PackPixelsParams::PackPixelsParams()
@@ -301,6 +430,187 @@ PixelCopyFunction FastCopyFunctionMap::get(angle::FormatID formatID) const
     return nullptr;
 }
 
+void LoadImageInStripes(const std::shared_ptr<angle::WorkerThreadPool> &workerPool,
+                        LoadImageFunction loadFunction,
+                        size_t width,
+                        size_t height,
+                        size_t depth,
+                        const uint8_t *input,
+                        size_t inputRowPitch,
+                        size_t inputDepthPitch,
+                        uint8_t *output,
+                        size_t outputRowPitch,
+                        size_t outputDepthPitch)
+{
+    LoadImageInStripes(workerPool, loadFunction, width, height, depth, 1, 1, input, inputRowPitch,
+                       inputDepthPitch, output, outputRowPitch, outputDepthPitch);
+}
+
+void LoadImageInStripes(const std::shared_ptr<angle::WorkerThreadPool> &workerPool,
+                        LoadImageFunction loadFunction,
+                        size_t width,
+                        size_t height,
+                        size_t depth,
+                        size_t inputBlockHeight,
+                        size_t outputBlockHeight,
+                        const uint8_t *input,
+                        size_t inputRowPitch,
+                        size_t inputDepthPitch,
+                        uint8_t *output,
+                        size_t outputRowPitch,
+                        size_t outputDepthPitch)
+{
+    // Stripes of rows start at a row that begins a block of both the input and the output.
+    size_t rowsPerUnit = std::max(inputBlockHeight, outputBlockHeight);
+    ASSERT(rowsPerUnit % inputBlockHeight == 0 && rowsPerUnit % outputBlockHeight == 0);
+
+    // Layers are split when there are several of them, rows otherwise.
+    bool splitLayers  = depth > 1;
+    size_t units      = splitLayers ? depth : (height + rowsPerUnit - 1) / rowsPerUnit;
+    size_t outputRows = (height + outputBlockHeight - 1) / outputBlockHeight;
+    size_t outputSize = outputRowPitch * outputRows * depth;
+
+    size_t stripeCount = 1;
+    if (workerPool && workerPool->isAsync() && outputSize >= kMinStripedLoadSize)
+    {
+        // The calling thread loads a stripe too.
+        stripeCount = std::min({units, workerPool->getMaxThreads() + 1,
+                                outputSize / kMinLoadStripeSize});
+    }
+
+    if (stripeCount <= 1)
+    {
+        loadFunction(width, height, depth, input, inputRowPitch, inputDepthPitch, output,
+                     outputRowPitch, outputDepthPitch);
+        return;
+    }
+
+    size_t unitsPerStripe = (units + stripeCount - 1) / stripeCount;
+
+    std::vector<std::shared_ptr<angle::Closure>> stripes;
+    for (size_t firstUnit = 0; firstUnit < units; firstUnit += unitsPerStripe)
+    {
+        size_t stripeUnits = std::min(unitsPerStripe, units - firstUnit);
+
+        std::shared_ptr<LoadImageStripeTask> stripe;
+        if (splitLayers)
+        {
+            stripe = std::make_shared<LoadImageStripeTask>(
+                loadFunction, width, height, stripeUnits, input + firstUnit * inputDepthPitch,
+                inputRowPitch, inputDepthPitch, output + firstUnit * outputDepthPitch,
+                outputRowPitch, outputDepthPitch);
+        }
+        else
+        {
+            size_t firstRow     = firstUnit * rowsPerUnit;
+            size_t stripeRows   = std::min(stripeUnits * rowsPerUnit, height - firstRow);
+            size_t inputOffset  = (firstRow / inputBlockHeight) * inputRowPitch;
+            size_t outputOffset = (firstRow / outputBlockHeight) * outputRowPitch;
+            stripe              = std::make_shared<LoadImageStripeTask>(
+                loadFunction, width, stripeRows, depth, input + inputOffset, inputRowPitch,
+                inputDepthPitch, output + outputOffset, outputRowPitch, outputDepthPitch);
+        }
+        stripes.push_back(stripe);
+    }
+
+    RunTasksOnWorkerThreads(workerPool, stripes);
+}
+
+void GenerateMipInStripes(const std::shared_ptr<angle::WorkerThreadPool> &workerPool,
+                          MipGenerationFunction mipGenerationFunction,
+                          size_t sourceWidth,
+                          size_t sourceHeight,
+                          size_t sourceDepth,
+                          const uint8_t *sourceData,
+                          size_t sourceRowPitch,
+                          size_t sourceDepthPitch,
+                          uint8_t *destData,
+                          size_t destRowPitch,
+                          size_t destDepthPitch)
+{
+    // Slices of 3D images are split, rows otherwise.  Each destination row or slice is made from
+    // two of the source, so a single row or slice can't be split.
+    bool splitSlices  = sourceDepth > 1;
+    size_t units      = splitSlices ? sourceDepth / 2 : sourceHeight / 2;
+    size_t destHeight = std::max<size_t>(1, sourceHeight / 2);
+    size_t destSize   = destRowPitch * destHeight * std::max<size_t>(1, sourceDepth / 2);
+
+    size_t stripeCount = 1;
+    if (workerPool && workerPool->isAsync() && destSize >= kMinStripedLoadSize)
+    {
+        // The calling thread generates a stripe too.
+        stripeCount =
+            std::min({units, workerPool->getMaxThreads() + 1, destSize / kMinLoadStripeSize});
+    }
+
+    if (stripeCount <= 1)
+    {
+        mipGenerationFunction(sourceWidth, sourceHeight, sourceDepth, sourceData, sourceRowPitch,
+                              sourceDepthPitch, destData, destRowPitch, destDepthPitch);
+        return;
+    }
+
+    size_t unitsPerStripe = (units + stripeCount - 1) / stripeCount;
+    size_t sourceStride   = splitSlices ? sourceDepthPitch : sourceRowPitch;
+    size_t destStride     = splitSlices ? destDepthPitch : destRowPitch;
+
+    std::vector<std::shared_ptr<angle::Closure>> stripes;
+    for (size_t firstUnit = 0; firstUnit < units; firstUnit += unitsPerStripe)
+    {
+        size_t stripeUnits = std::min(unitsPerStripe, units - firstUnit);
+        stripes.push_back(std::make_shared<GenerateMipStripeTask>(
+            mipGenerationFunction, sourceWidth, splitSlices ? sourceHeight : stripeUnits * 2,
+            splitSlices ? stripeUnits * 2 : sourceDepth, 1,
+            sourceData + firstUnit * 2 * sourceStride, sourceRowPitch, sourceDepthPitch, 0,
+            destData + firstUnit * destStride, destRowPitch, destDepthPitch, 0));
+    }
+
+    RunTasksOnWorkerThreads(workerPool, stripes);
+}
+
+void GenerateMipLayers(const std::shared_ptr<angle::WorkerThreadPool> &workerPool,
+                       MipGenerationFunction mipGenerationFunction,
+                       size_t sourceWidth,
+                       size_t sourceHeight,
+                       size_t layerCount,
+                       const uint8_t *sourceData,
+                       size_t sourceRowPitch,
+                       size_t sourceLayerPitch,
+                       uint8_t *destData,
+                       size_t destRowPitch,
+                       size_t destLayerPitch)
+{
+    if (layerCount == 1)
+    {
+        GenerateMipInStripes(workerPool, mipGenerationFunction, sourceWidth, sourceHeight, 1,
+                             sourceData, sourceRowPitch, 0, destData, destRowPitch, 0);
+        return;
+    }
+
+    size_t destSize = destLayerPitch * layerCount;
+
+    size_t stripeCount = 1;
+    if (workerPool && workerPool->isAsync() && destSize >= kMinStripedLoadSize)
+    {
+        // The calling thread generates a stripe too.
+        stripeCount = std::min(
+            {layerCount, workerPool->getMaxThreads() + 1, destSize / kMinLoadStripeSize});
+    }
+    size_t layersPerStripe = (layerCount + stripeCount - 1) / stripeCount;
+
+    std::vector<std::shared_ptr<angle::Closure>> stripes;
+    for (size_t firstLayer = 0; firstLayer < layerCount; firstLayer += layersPerStripe)
+    {
+        stripes.push_back(std::make_shared<GenerateMipStripeTask>(
+            mipGenerationFunction, sourceWidth, sourceHeight, 1,
+            std::min(layersPerStripe, layerCount - firstLayer),
+            sourceData + firstLayer * sourceLayerPitch, sourceRowPitch, 0, sourceLayerPitch,
+            destData + firstLayer * destLayerPitch, destRowPitch, 0, destLayerPitch));
+    }
+
+    RunTasksOnWorkerThreads(workerPool, stripes);
+}
+
 bool ShouldUseDebugLayers(const egl::AttributeMap &attribs)
 {
     EGLAttrib debugSetting =
@@ -15,6 +15,7 @@
 #include <atomic>
 #include <limits>
 #include <map>
+#include <memory>
 
 #include "common/angleutils.h"
 #include "common/utilities.h"
@@ -25,6 +26,7 @@ namespace angle
 struct FeatureSetBase;
 struct Format;
 enum class FormatID;
+class WorkerThreadPool;
 }  // namespace angle
 
 namespace gl
@@ -210,6 +212,68 @@ struct LoadImageFunctionInfo
 
 using LoadFunctionMap = LoadImageFunctionInfo (*)(GLenum);
 
+// Calls |loadFunction| on stripes of rows, or of layers for 3D and array images, spread over the
+// worker threads, and returns once the whole image is loaded.  Small images are loaded on the
+// calling thread.
+void LoadImageInStripes(const std::shared_ptr<angle::WorkerThreadPool> &workerPool,
+                        LoadImageFunction loadFunction,
+                        size_t width,
+                        size_t height,
+                        size_t depth,
+                        const uint8_t *input,
+                        size_t inputRowPitch,
+                        size_t inputDepthPitch,
+                        uint8_t *output,
+                        size_t outputRowPitch,
+                        size_t outputDepthPitch);
+
+// Same as above for block compressed input or output, where each row of the input covers
+// |inputBlockHeight| rows of pixels and each row of the output |outputBlockHeight| rows.  Stripes
+// then start on block boundaries.
+void LoadImageInStripes(const std::shared_ptr<angle::WorkerThreadPool> &workerPool,
+                        LoadImageFunction loadFunction,
+                        size_t width,
+                        size_t height,
+                        size_t depth,
+                        size_t inputBlockHeight,
+                        size_t outputBlockHeight,
+                        const uint8_t *input,
+                        size_t inputRowPitch,
+                        size_t inputDepthPitch,
+                        uint8_t *output,
+                        size_t outputRowPitch,
+                        size_t outputDepthPitch);
+
+// Calls |mipGenerationFunction| on stripes of destination rows, or of slices for 3D images,
+// spread over the worker threads, and returns once the whole level is generated.  Small levels are
+// generated on the calling thread.
+void GenerateMipInStripes(const std::shared_ptr<angle::WorkerThreadPool> &workerPool,
+                          MipGenerationFunction mipGenerationFunction,
+                          size_t sourceWidth,
+                          size_t sourceHeight,
+                          size_t sourceDepth,
+                          const uint8_t *sourceData,
+                          size_t sourceRowPitch,
+                          size_t sourceDepthPitch,
+                          uint8_t *destData,
+                          size_t destRowPitch,
+                          size_t destDepthPitch);
+
+// Generates a level of each of |layerCount| 2D layers, like the faces of a cube map or the layers
+// of an array, from the level above.  Layers are spread over the worker threads, and a single
+// layer is split in stripes of rows instead.
+void GenerateMipLayers(const std::shared_ptr<angle::WorkerThreadPool> &workerPool,
+                       MipGenerationFunction mipGenerationFunction,
+                       size_t sourceWidth,
+                       size_t sourceHeight,
+                       size_t layerCount,
+                       const uint8_t *sourceData,
+                       size_t sourceRowPitch,
+                       size_t sourceLayerPitch,
+                       uint8_t *destData,
+                       size_t destRowPitch,
+                       size_t destLayerPitch);
+
 bool ShouldUseDebugLayers(const egl::AttributeMap &attribs);
 bool ShouldUseVirtualizedContexts(const egl::AttributeMap &attribs, bool defaultValue);
 
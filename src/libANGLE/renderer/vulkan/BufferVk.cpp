@@ -30,6 +30,44 @@ static_assert(gl::isPow2(kBufferSizeGranularity), "use as alignment, must be pow
 
 // Start with a fairly small buffer size. We can increase this dynamically as we convert more data.
 constexpr size_t kConvertedArrayBufferInitialSize = 1024 * 8;
+
+// We could potentially use multiple backing buffers for different usages.
+// For now keep a single buffer with all relevant usage flags.
+constexpr VkBufferUsageFlags kBufferUsageFlags =
+    VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT |
+    VK_BUFFER_USAGE_INDEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT |
+    VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT |
+    VK_BUFFER_USAGE_UNIFORM_TEXEL_BUFFER_BIT | VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT;
+
+// Assume host visible/coherent memory available.
+constexpr VkMemoryPropertyFlags kBufferMemoryPropertyFlags =
+    (VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+
+// A buffer that's updated while in use by the GPU this many times in a row is considered streamed.
+// Partial updates to streamed buffers are made to new memory as well, copying the rest of the
+// contents on the CPU.
+constexpr uint32_t kStreamingUpdateThreshold = 3;
+
+// The largest buffer whose contents are copied on the CPU for a partial streamed update.  Larger
+// buffers are updated through a GPU copy.
+constexpr VkDeviceSize kMaxStreamingCopySize = 64 * 1024;
+
+// The number of previous buffers kept for reuse by a streamed buffer, typically enough to cover
+// the frames the GPU is behind.
+constexpr size_t kMaxRetiredBackings = 3;
+
+VkBufferCreateInfo GetBufferCreateInfo(VkDeviceSize size)
+{
+    VkBufferCreateInfo createInfo    = {};
+    createInfo.sType                 = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    createInfo.flags                 = 0;
+    createInfo.size                  = size;
+    createInfo.usage                 = kBufferUsageFlags;
+    createInfo.sharingMode           = VK_SHARING_MODE_EXCLUSIVE;
+    createInfo.queueFamilyIndexCount = 0;
+    createInfo.pQueueFamilyIndices   = nullptr;
+    return createInfo;
+}
 }  // namespace
 
 // ConversionBuffer implementation.
@@ -65,7 +103,7 @@ BufferVk::VertexConversionBuffer::VertexConversionBuffer(VertexConversionBuffer
 BufferVk::VertexConversionBuffer::~VertexConversionBuffer() = default;
 
 // BufferVk implementation.
-BufferVk::BufferVk(const gl::BufferState &state) : BufferImpl(state) {}
+BufferVk::BufferVk(const gl::BufferState &state) : BufferImpl(state), mInUseUpdateCount(0) {}
 
 BufferVk::~BufferVk() {}
 
@@ -81,6 +119,13 @@ void BufferVk::release(ContextVk *contextVk)
     RendererVk *renderer = contextVk->getRenderer();
     mBuffer.release(renderer);
 
+    for (vk::BufferBacking &backing : mRetiredBackings)
+    {
+        backing.release(renderer);
+    }
+    mRetiredBackings.clear();
+    mInUseUpdateCount = 0;
+
     for (ConversionBuffer &buffer : mVertexConversionBuffers)
     {
         buffer.data.release(renderer);
@@ -100,33 +145,15 @@ angle::Result BufferVk::setData(const gl::Context *context,
         // Release and re-create the memory and buffer.
         release(contextVk);
 
-        // We could potentially use multiple backing buffers for different usages.
-        // For now keep a single buffer with all relevant usage flags.
-        const VkImageUsageFlags usageFlags =
-            VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT |
-            VK_BUFFER_USAGE_INDEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT |
-            VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT |
-            VK_BUFFER_USAGE_UNIFORM_TEXEL_BUFFER_BIT | VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT;
-
-        VkBufferCreateInfo createInfo    = {};
-        createInfo.sType                 = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
-        createInfo.flags                 = 0;
-        createInfo.size                  = roundUpPow2(size, kBufferSizeGranularity);
-        createInfo.usage                 = usageFlags;
-        createInfo.sharingMode           = VK_SHARING_MODE_EXCLUSIVE;
-        createInfo.queueFamilyIndexCount = 0;
-        createInfo.pQueueFamilyIndices   = nullptr;
-
-        // Assume host visible/coherent memory available.
-        const VkMemoryPropertyFlags memoryPropertyFlags =
-            (VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
-
-        ANGLE_TRY(mBuffer.init(contextVk, createInfo, memoryPropertyFlags));
+        VkBufferCreateInfo createInfo =
+            GetBufferCreateInfo(roundUpPow2(size, kBufferSizeGranularity));
+        ANGLE_TRY(mBuffer.init(contextVk, createInfo, kBufferMemoryPropertyFlags));
     }
 
     if (data && size > 0)
     {
-        ANGLE_TRY(setDataImpl(contextVk, static_cast<const uint8_t *>(data), size, 0));
+        // The previous contents are orphaned, so the buffer can be given new memory if in use.
+        ANGLE_TRY(setDataImpl(contextVk, static_cast<const uint8_t *>(data), size, 0, true));
     }
 
     return angle::Result::Continue;
@@ -140,8 +167,10 @@ angle::Result BufferVk::setSubData(const gl::Context *context,
 {
     ASSERT(mBuffer.valid());
 
-    ContextVk *contextVk = vk::GetImpl(context);
-    ANGLE_TRY(setDataImpl(contextVk, static_cast<const uint8_t *>(data), size, offset));
+    ContextVk *contextVk        = vk::GetImpl(context);
+    const bool replacesContents = offset == 0 && size >= static_cast<size_t>(mState.getSize());
+    ANGLE_TRY(setDataImpl(contextVk, static_cast<const uint8_t *>(data), size, offset,
+                          replacesContents));
 
     return angle::Result::Continue;
 }
@@ -193,7 +222,13 @@ angle::Result BufferVk::map(const gl::Context *context, GLenum access, void **ma
 {
     ASSERT(mBuffer.valid());
 
-    return mapImpl(vk::GetImpl(context), mapPtr);
+    ContextVk *contextVk = vk::GetImpl(context);
+
+    // Try not to wait for the GPU if the buffer is in use.  The mapping is write-only, but the
+    // contents are kept.
+    ANGLE_TRY(streamUpdate(contextVk, 0, 0, false));
+
+    return mapImpl(contextVk, mapPtr);
 }
 
 angle::Result BufferVk::mapRange(const gl::Context *context,
@@ -202,7 +237,21 @@ angle::Result BufferVk::mapRange(const gl::Context *context,
                                  GLbitfield access,
                                  void **mapPtr)
 {
-    return mapRangeImpl(vk::GetImpl(context), offset, length, access, mapPtr);
+    ContextVk *contextVk = vk::GetImpl(context);
+
+    // Try not to wait for the GPU if the buffer is in use and the mapping is write-only.  The
+    // contents are kept unless invalidated.
+    if ((access & (GL_MAP_UNSYNCHRONIZED_BIT | GL_MAP_READ_BIT)) == 0)
+    {
+        const bool invalidatesRange = (access & GL_MAP_INVALIDATE_RANGE_BIT) != 0;
+        const bool replacesContents =
+            (access & GL_MAP_INVALIDATE_BUFFER_BIT) != 0 ||
+            (invalidatesRange && offset == 0 && length >= static_cast<size_t>(mState.getSize()));
+        ANGLE_TRY(
+            streamUpdate(contextVk, offset, invalidatesRange ? length : 0, replacesContents));
+    }
+
+    return mapRangeImpl(contextVk, offset, length, access, mapPtr);
 }
 
 angle::Result BufferVk::mapImpl(ContextVk *contextVk, void **mapPtr)
@@ -232,8 +281,8 @@ angle::Result BufferVk::mapRangeImpl(ContextVk *contextVk,
         ASSERT(!mBuffer.isResourceInUse(contextVk));
     }
 
-    ANGLE_VK_TRY(contextVk, mBuffer.getDeviceMemory().map(contextVk->getDevice(), offset, length, 0,
-                                                          reinterpret_cast<uint8_t **>(mapPtr)));
+    ANGLE_VK_TRY(contextVk,
+                 mBuffer.getAllocation().map(offset, reinterpret_cast<uint8_t **>(mapPtr)));
     return angle::Result::Continue;
 }
 
@@ -252,7 +301,6 @@ void BufferVk::unmapImpl(ContextVk *contextVk)
 {
     ASSERT(mBuffer.valid());
 
-    mBuffer.getDeviceMemory().unmap(contextVk->getDevice());
     mBuffer.onExternalWrite(VK_ACCESS_HOST_WRITE_BIT);
 
     markConversionBuffersDirty();
@@ -284,24 +332,21 @@ angle::Result BufferVk::getIndexRange(const gl::Context *context,
     // TODO(jmadill): Consider keeping a shadow system memory copy in some cases.
     ASSERT(mBuffer.valid());
 
-    const GLuint &typeBytes = gl::GetDrawElementsTypeSize(type);
-
     uint8_t *mapPointer = nullptr;
-    ANGLE_VK_TRY(contextVk, mBuffer.getDeviceMemory().map(contextVk->getDevice(), offset,
-                                                          typeBytes * count, 0, &mapPointer));
+    ANGLE_VK_TRY(contextVk, mBuffer.getAllocation().map(offset, &mapPointer));
 
     *outRange = gl::ComputeIndexRange(type, mapPointer, count, primitiveRestartEnabled);
 
-    mBuffer.getDeviceMemory().unmap(contextVk->getDevice());
     return angle::Result::Continue;
 }
 
 angle::Result BufferVk::setDataImpl(ContextVk *contextVk,
                                     const uint8_t *data,
                                     size_t size,
-                                    size_t offset)
+                                    size_t offset,
+                                    bool replacesContents)
 {
-    VkDevice device = contextVk->getDevice();
+    ANGLE_TRY(streamUpdate(contextVk, offset, size, replacesContents));
 
     // Use map when available.
     if (mBuffer.isResourceInUse(contextVk))
@@ -311,12 +356,10 @@ angle::Result BufferVk::setDataImpl(ContextVk *contextVk,
                                      vk::StagingUsage::Write));
 
         uint8_t *mapPointer = nullptr;
-        ANGLE_VK_TRY(contextVk,
-                     stagingBuffer.getDeviceMemory().map(device, 0, size, 0, &mapPointer));
+        ANGLE_VK_TRY(contextVk, stagingBuffer.getAllocation().map(0, &mapPointer));
         ASSERT(mapPointer);
 
         memcpy(mapPointer, data, size);
-        stagingBuffer.getDeviceMemory().unmap(device);
 
         // Enqueue a copy command on the GPU.
         VkBufferCopy copyRegion = {0, offset, size};
@@ -329,13 +372,11 @@ angle::Result BufferVk::setDataImpl(ContextVk *contextVk,
     else
     {
         uint8_t *mapPointer = nullptr;
-        ANGLE_VK_TRY(contextVk,
-                     mBuffer.getDeviceMemory().map(device, offset, size, 0, &mapPointer));
+        ANGLE_VK_TRY(contextVk, mBuffer.getAllocation().map(offset, &mapPointer));
         ASSERT(mapPointer);
 
         memcpy(mapPointer, data, size);
 
-        mBuffer.getDeviceMemory().unmap(device);
         mBuffer.onExternalWrite(VK_ACCESS_HOST_WRITE_BIT);
     }
 
@@ -345,6 +386,92 @@ angle::Result BufferVk::setDataImpl(ContextVk *contextVk,
     return angle::Result::Continue;
 }
 
+angle::Result BufferVk::streamUpdate(ContextVk *contextVk,
+                                     VkDeviceSize offset,
+                                     VkDeviceSize size,
+                                     bool replacesContents)
+{
+    if (!mBuffer.isResourceInUse(contextVk))
+    {
+        mInUseUpdateCount = 0;
+        return angle::Result::Continue;
+    }
+
+    mInUseUpdateCount = std::min(mInUseUpdateCount + 1, kStreamingUpdateThreshold);
+
+    // Transform feedback buffers are not rebound during capture, so they keep their memory.
+    if (mState.isBoundForTransformFeedback())
+    {
+        return angle::Result::Continue;
+    }
+
+    // The contents outside the update need to be copied to the new memory, which can only be done
+    // on the CPU if the GPU doesn't write to the buffer.
+    if (!replacesContents &&
+        (mInUseUpdateCount < kStreamingUpdateThreshold ||
+         mBuffer.getSize() > kMaxStreamingCopySize || mBuffer.hasDeviceWrites()))
+    {
+        return angle::Result::Continue;
+    }
+
+    RendererVk *renderer = contextVk->getRenderer();
+
+    vk::BufferBacking backing;
+    ANGLE_TRY(acquireBacking(contextVk, &backing));
+
+    if (!replacesContents)
+    {
+        uint8_t *srcPointer = nullptr;
+        uint8_t *dstPointer = nullptr;
+        ANGLE_VK_TRY(contextVk, mBuffer.getAllocation().map(0, &srcPointer));
+        ANGLE_VK_TRY(contextVk, backing.allocation.map(0, &dstPointer));
+
+        // The updated range is left uninitialized.
+        VkDeviceSize bufferSize = mBuffer.getSize();
+        VkDeviceSize updateEnd  = std::min(offset + size, bufferSize);
+        memcpy(dstPointer, srcPointer, static_cast<size_t>(offset));
+        memcpy(dstPointer + updateEnd, srcPointer + updateEnd,
+               static_cast<size_t>(bufferSize - updateEnd));
+    }
+
+    // Commands already recorded keep using the previous memory.
+    mBuffer.swapBacking(renderer, &backing);
+    mBuffer.onExternalWrite(VK_ACCESS_HOST_WRITE_BIT);
+    retireBacking(renderer, std::move(backing));
+
+    // Every context that has the buffer bound needs to pick up the new VkBuffer.  Vertex arrays
+    // and uniform, storage and atomic counter buffer bindings observe the buffer.
+    onStateChange(angle::SubjectMessage::SubjectChanged);
+    renderer->onBufferStallAvoided();
+
+    return angle::Result::Continue;
+}
+
+angle::Result BufferVk::acquireBacking(ContextVk *contextVk, vk::BufferBacking *backingOut)
+{
+    // The oldest retired memory is the most likely to be done with.
+    if (!mRetiredBackings.empty() && !mRetiredBackings.front().isInUse(contextVk))
+    {
+        *backingOut = std::move(mRetiredBackings.front());
+        mRetiredBackings.erase(mRetiredBackings.begin());
+        return angle::Result::Continue;
+    }
+
+    return backingOut->init(contextVk, GetBufferCreateInfo(mBuffer.getSize()),
+                            kBufferMemoryPropertyFlags);
+}
+
+void BufferVk::retireBacking(RendererVk *renderer, vk::BufferBacking &&backing)
+{
+    if (mRetiredBackings.size() == kMaxRetiredBackings)
+    {
+        mRetiredBackings.front().release(renderer);
+        mRetiredBackings.erase(mRetiredBackings.begin());
+    }
+
+    mRetiredBackings.push_back(std::move(backing));
+}
+
 angle::Result BufferVk::copyToBuffer(ContextVk *contextVk,
                                      vk::BufferHelper *destBuffer,
                                      uint32_t copyCount,
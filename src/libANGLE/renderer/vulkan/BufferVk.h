@@ -116,7 +116,17 @@ class BufferVk : public BufferImpl
     angle::Result setDataImpl(ContextVk *contextVk,
                               const uint8_t *data,
                               size_t size,
-                              size_t offset);
+                              size_t offset,
+                              bool replacesContents);
+    // If the buffer is in use by the GPU, gives it new memory for an update where possible, so the
+    // update doesn't wait for the GPU or go through a GPU copy.  The update discards the contents
+    // of |size| bytes at |offset|, or of the whole buffer if |replacesContents|.
+    angle::Result streamUpdate(ContextVk *contextVk,
+                               VkDeviceSize offset,
+                               VkDeviceSize size,
+                               bool replacesContents);
+    angle::Result acquireBacking(ContextVk *contextVk, vk::BufferBacking *backingOut);
+    void retireBacking(RendererVk *renderer, vk::BufferBacking &&backing);
     void release(ContextVk *context);
     void markConversionBuffersDirty();
 
@@ -138,6 +148,13 @@ class BufferVk : public BufferImpl
 
     vk::BufferHelper mBuffer;
 
+    // Previous memory of mBuffer that may still be in use by the GPU, oldest first.  Recycled by
+    // streamUpdate once the GPU is done with it.
+    std::vector<vk::BufferBacking> mRetiredBackings;
+
+    // The number of updates in a row that found the buffer in use by the GPU.
+    uint32_t mInUseUpdateCount;
+
     // A cache of converted vertex data.
     std::vector<VertexConversionBuffer> mVertexConversionBuffers;
 };
@@ -100,6 +100,9 @@ constexpr size_t kDriverUniformsAllocatorPageSize = 4 * 1024;
 
 constexpr size_t kInFlightCommandsLimit = 100u;
 
+// Holds several hundred indirect draw commands per buffer.
+constexpr size_t kMultiDrawIndirectBufferSize = 16 * 1024;
+
 // Initially dumping the command graphs is disabled.
 constexpr bool kEnableCommandGraphDiagnostics = false;
 
@@ -610,6 +613,8 @@ void ContextVk::onDestroy(const gl::Context *context)
         defaultBuffer.destroy(device);
     }
 
+    mMultiDrawIndirectBuffer.destroy(device);
+
     for (vk::DynamicQueryPool &queryPool : mQueryPools)
     {
         queryPool.destroy(device);
@@ -684,6 +689,9 @@ angle::Result ContextVk::initialize()
         buffer.init(mRenderer, kVertexBufferUsage, 1, kDefaultBufferSize, true);
     }
 
+    mMultiDrawIndirectBuffer.init(mRenderer, VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT, sizeof(uint32_t),
+                                  kMultiDrawIndirectBufferSize, true);
+
     ANGLE_TRY(mCommandQueue.init(this));
 
     if (mRenderer->getFeatures().transientCommandBuffer.enabled)
@@ -1896,6 +1904,191 @@ angle::Result ContextVk::drawElementsIndirect(const gl::Context *context,
     return angle::Result::Continue;
 }
 
+bool ContextVk::canBatchMultiDraw(gl::PrimitiveMode mode, GLsizei drawcount) const
+{
+    // Programs that read gl_DrawID take the per-draw path: the translator emulates it with the
+    // angle_DrawID default uniform, which is set once per vkCmdDraw* and so can't vary between
+    // the commands of one indirect draw.
+    const gl::Program *program = mState.getProgram();
+
+    return drawcount > 1 && mRenderer->getPhysicalDeviceFeatures().multiDrawIndirect &&
+           static_cast<uint32_t>(drawcount) <=
+               mRenderer->getPhysicalDeviceProperties().limits.maxDrawIndirectCount &&
+           mode != gl::PrimitiveMode::LineLoop && (!program || !program->hasDrawIDUniform()) &&
+           !mVertexArray->getStreamingVertexAttribsMask().any() &&
+           !mState.isTransformFeedbackActiveUnpaused();
+}
+
+bool ContextVk::canBatchMultiDrawElements(gl::PrimitiveMode mode,
+                                          gl::DrawElementsType type,
+                                          const GLvoid *const *indices,
+                                          GLsizei drawcount) const
+{
+    // Client-side indices are copied per draw and byte indices are converted per draw.
+    if (!canBatchMultiDraw(mode, drawcount) || type == gl::DrawElementsType::UnsignedByte ||
+        !mVertexArray->getState().getElementArrayBuffer())
+    {
+        return false;
+    }
+
+    // The offsets become firstIndex, so they have to be a multiple of the index size.
+    const uintptr_t offsetMask = static_cast<uintptr_t>(gl::GetDrawElementsTypeSize(type) - 1);
+    for (GLsizei drawID = 0; drawID < drawcount; ++drawID)
+    {
+        if ((reinterpret_cast<uintptr_t>(indices[drawID]) & offsetMask) != 0)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+angle::Result ContextVk::multiDrawArrays(const gl::Context *context,
+                                         gl::PrimitiveMode mode,
+                                         const GLint *firsts,
+                                         const GLsizei *counts,
+                                         GLsizei drawcount)
+{
+    if (!canBatchMultiDraw(mode, drawcount))
+    {
+        return ContextImpl::multiDrawArrays(context, mode, firsts, counts, drawcount);
+    }
+
+    return multiDrawArraysIndirect(context, mode, firsts, counts, nullptr, drawcount);
+}
+
+angle::Result ContextVk::multiDrawArraysInstanced(const gl::Context *context,
+                                                  gl::PrimitiveMode mode,
+                                                  const GLint *firsts,
+                                                  const GLsizei *counts,
+                                                  const GLsizei *instanceCounts,
+                                                  GLsizei drawcount)
+{
+    if (!canBatchMultiDraw(mode, drawcount))
+    {
+        return ContextImpl::multiDrawArraysInstanced(context, mode, firsts, counts,
+                                                     instanceCounts, drawcount);
+    }
+
+    return multiDrawArraysIndirect(context, mode, firsts, counts, instanceCounts, drawcount);
+}
+
+angle::Result ContextVk::multiDrawElements(const gl::Context *context,
+                                           gl::PrimitiveMode mode,
+                                           const GLsizei *counts,
+                                           gl::DrawElementsType type,
+                                           const GLvoid *const *indices,
+                                           GLsizei drawcount)
+{
+    if (!canBatchMultiDrawElements(mode, type, indices, drawcount))
+    {
+        return ContextImpl::multiDrawElements(context, mode, counts, type, indices, drawcount);
+    }
+
+    return multiDrawElementsIndirect(context, mode, counts, type, indices, nullptr, drawcount);
+}
+
+angle::Result ContextVk::multiDrawElementsInstanced(const gl::Context *context,
+                                                    gl::PrimitiveMode mode,
+                                                    const GLsizei *counts,
+                                                    gl::DrawElementsType type,
+                                                    const GLvoid *const *indices,
+                                                    const GLsizei *instanceCounts,
+                                                    GLsizei drawcount)
+{
+    if (!canBatchMultiDrawElements(mode, type, indices, drawcount))
+    {
+        return ContextImpl::multiDrawElementsInstanced(context, mode, counts, type, indices,
+                                                       instanceCounts, drawcount);
+    }
+
+    return multiDrawElementsIndirect(context, mode, counts, type, indices, instanceCounts,
+                                     drawcount);
+}
+
+angle::Result ContextVk::multiDrawArraysIndirect(const gl::Context *context,
+                                                 gl::PrimitiveMode mode,
+                                                 const GLint *firsts,
+                                                 const GLsizei *counts,
+                                                 const GLsizei *instanceCountsOrNull,
+                                                 GLsizei drawcount)
+{
+    mMultiDrawIndirectBuffer.releaseInFlightBuffers(this);
+
+    VkDrawIndirectCommand *commands = nullptr;
+    VkDeviceSize indirectOffset     = 0;
+    ANGLE_TRY(mMultiDrawIndirectBuffer.allocate(
+        this, sizeof(VkDrawIndirectCommand) * static_cast<size_t>(drawcount),
+        reinterpret_cast<uint8_t **>(&commands), nullptr, &indirectOffset, nullptr));
+
+    // Sub-draws with too few vertices for a primitive draw nothing, so they needn't be skipped.
+    for (GLsizei drawID = 0; drawID < drawcount; ++drawID)
+    {
+        VkDrawIndirectCommand &command = commands[drawID];
+        command.vertexCount            = gl::GetClampedVertexCount<uint32_t>(counts[drawID]);
+        command.instanceCount =
+            instanceCountsOrNull ? static_cast<uint32_t>(instanceCountsOrNull[drawID]) : 1;
+        command.firstVertex   = static_cast<uint32_t>(firsts[drawID]);
+        command.firstInstance = 0;
+    }
+
+    ANGLE_TRY(mMultiDrawIndirectBuffer.flush(this));
+    vk::BufferHelper *indirectBuffer = mMultiDrawIndirectBuffer.getCurrentBuffer();
+
+    vk::CommandBuffer *commandBuffer = nullptr;
+    ANGLE_TRY(setupIndirectDraw(context, mode, mNonIndexedDirtyBitsMask, indirectBuffer,
+                                indirectOffset, &commandBuffer));
+    commandBuffer->drawIndirect(indirectBuffer->getBuffer(), indirectOffset,
+                                static_cast<uint32_t>(drawcount), sizeof(VkDrawIndirectCommand));
+    return angle::Result::Continue;
+}
+
+angle::Result ContextVk::multiDrawElementsIndirect(const gl::Context *context,
+                                                   gl::PrimitiveMode mode,
+                                                   const GLsizei *counts,
+                                                   gl::DrawElementsType type,
+                                                   const GLvoid *const *indices,
+                                                   const GLsizei *instanceCountsOrNull,
+                                                   GLsizei drawcount)
+{
+    mMultiDrawIndirectBuffer.releaseInFlightBuffers(this);
+
+    VkDrawIndexedIndirectCommand *commands = nullptr;
+    VkDeviceSize indirectOffset            = 0;
+    ANGLE_TRY(mMultiDrawIndirectBuffer.allocate(
+        this, sizeof(VkDrawIndexedIndirectCommand) * static_cast<size_t>(drawcount),
+        reinterpret_cast<uint8_t **>(&commands), nullptr, &indirectOffset, nullptr));
+
+    const uint32_t indexShift = gl::GetDrawElementsTypeShift(type);
+    for (GLsizei drawID = 0; drawID < drawcount; ++drawID)
+    {
+        VkDrawIndexedIndirectCommand &command = commands[drawID];
+        command.indexCount                    = static_cast<uint32_t>(counts[drawID]);
+        command.instanceCount =
+            instanceCountsOrNull ? static_cast<uint32_t>(instanceCountsOrNull[drawID]) : 1;
+        command.firstIndex =
+            static_cast<uint32_t>(reinterpret_cast<uintptr_t>(indices[drawID]) >> indexShift);
+        command.vertexOffset  = 0;
+        command.firstInstance = 0;
+    }
+
+    ANGLE_TRY(mMultiDrawIndirectBuffer.flush(this));
+    vk::BufferHelper *indirectBuffer = mMultiDrawIndirectBuffer.getCurrentBuffer();
+
+    vk::FramebufferHelper *framebuffer = mDrawFramebuffer->getFramebuffer();
+    indirectBuffer->onRead(this, framebuffer, VK_ACCESS_INDIRECT_COMMAND_READ_BIT);
+
+    // The index buffer is bound at offset zero and each sub-draw selects its indices with
+    // firstIndex.
+    vk::CommandBuffer *commandBuffer = nullptr;
+    ANGLE_TRY(setupIndexedDraw(context, mode, counts[0], 1, type, nullptr, &commandBuffer));
+    commandBuffer->drawIndexedIndirect(indirectBuffer->getBuffer(), indirectOffset,
+                                       static_cast<uint32_t>(drawcount),
+                                       sizeof(VkDrawIndexedIndirectCommand));
+    return angle::Result::Continue;
+}
+
 gl::GraphicsResetStatus ContextVk::getResetStatus()
 {
     if (mRenderer->isDeviceLost())
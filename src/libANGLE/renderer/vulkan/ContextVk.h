@@ -162,6 +162,31 @@ class ContextVk : public ContextImpl, public vk::Context, public vk::RenderPassO
                                        gl::DrawElementsType type,
                                        const void *indirect) override;
 
+    angle::Result multiDrawArrays(const gl::Context *context,
+                                  gl::PrimitiveMode mode,
+                                  const GLint *firsts,
+                                  const GLsizei *counts,
+                                  GLsizei drawcount) override;
+    angle::Result multiDrawArraysInstanced(const gl::Context *context,
+                                           gl::PrimitiveMode mode,
+                                           const GLint *firsts,
+                                           const GLsizei *counts,
+                                           const GLsizei *instanceCounts,
+                                           GLsizei drawcount) override;
+    angle::Result multiDrawElements(const gl::Context *context,
+                                    gl::PrimitiveMode mode,
+                                    const GLsizei *counts,
+                                    gl::DrawElementsType type,
+                                    const GLvoid *const *indices,
+                                    GLsizei drawcount) override;
+    angle::Result multiDrawElementsInstanced(const gl::Context *context,
+                                             gl::PrimitiveMode mode,
+                                             const GLsizei *counts,
+                                             gl::DrawElementsType type,
+                                             const GLvoid *const *indices,
+                                             const GLsizei *instanceCounts,
+                                             GLsizei drawcount) override;
+
     // Device loss
     gl::GraphicsResetStatus getResetStatus() override;
 
@@ -516,6 +541,28 @@ class ContextVk : public ContextImpl, public vk::Context, public vk::RenderPassO
                                            VkDeviceSize indirectBufferOffset,
                                            vk::CommandBuffer **commandBufferOut);
 
+    // Multi-draws are recorded as a single indirect draw when none of their sub-draws needs
+    // per-draw work: updating the gl_DrawID uniform, converting line loops or indices, streaming
+    // vertex attributes or offsetting emulated transform feedback.
+    bool canBatchMultiDraw(gl::PrimitiveMode mode, GLsizei drawcount) const;
+    bool canBatchMultiDrawElements(gl::PrimitiveMode mode,
+                                   gl::DrawElementsType type,
+                                   const GLvoid *const *indices,
+                                   GLsizei drawcount) const;
+    angle::Result multiDrawArraysIndirect(const gl::Context *context,
+                                          gl::PrimitiveMode mode,
+                                          const GLint *firsts,
+                                          const GLsizei *counts,
+                                          const GLsizei *instanceCountsOrNull,
+                                          GLsizei drawcount);
+    angle::Result multiDrawElementsIndirect(const gl::Context *context,
+                                            gl::PrimitiveMode mode,
+                                            const GLsizei *counts,
+                                            gl::DrawElementsType type,
+                                            const GLvoid *const *indices,
+                                            const GLsizei *instanceCountsOrNull,
+                                            GLsizei drawcount);
+
     angle::Result setupLineLoopIndexedIndirectDraw(const gl::Context *context,
                                                    gl::PrimitiveMode mode,
                                                    gl::DrawElementsType indexType,
@@ -727,6 +774,9 @@ class ContextVk : public ContextImpl, public vk::Context, public vk::RenderPassO
     gl::AttributesMask mDirtyDefaultAttribsMask;
     gl::AttribArray<vk::DynamicBuffer> mDefaultAttribBuffers;
 
+    // Indirect draw commands written for batched multi-draws.
+    vk::DynamicBuffer mMultiDrawIndirectBuffer;
+
     // We use a single pool for recording commands. We also keep a free list for pool recycling.
     vk::CommandPool mCommandPool;
     std::vector<vk::CommandPool> mCommandPoolFreeList;
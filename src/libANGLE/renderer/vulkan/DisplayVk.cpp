@@ -192,6 +192,10 @@ void DisplayVk::generateExtensions(egl::DisplayExtensions *outExtensions) const
     outExtensions->surfacelessContext = true;
 
     outExtensions->noConfigContext = true;
+
+    // The Vulkan backend doesn't need its contexts to be current on the thread that uses them, so
+    // GL calls can run on a worker thread.
+    outExtensions->createContextDeferredExecution = true;
 }
 
 void DisplayVk::generateCaps(egl::Caps *outCaps) const
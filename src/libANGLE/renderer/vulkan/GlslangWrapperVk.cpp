@@ -55,4 +55,15 @@ angle::Result GlslangWrapperVk::GetShaderCode(vk::Context *context,
         [context](GlslangError error) { return ErrorHandler(context, error); }, glCaps,
         enableLineRasterEmulation, shaderSources, shaderCodeOut);
 }
+
+// static
+angle::Result GlslangWrapperVk::GetShaderCodeForStage(const gl::Caps &glCaps,
+                                                      gl::ShaderType shaderType,
+                                                      const std::string &shaderSource,
+                                                      std::vector<uint32_t> *shaderCodeOut)
+{
+    return GlslangGetShaderSpirvCodeForStage(
+        [](GlslangError error) { return angle::Result::Stop; }, glCaps, shaderType, shaderSource,
+        shaderCodeOut);
+}
 }  // namespace rx
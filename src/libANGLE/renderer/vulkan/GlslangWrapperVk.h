@@ -29,6 +29,13 @@ class GlslangWrapperVk
                                        bool enableLineRasterEmulation,
                                        const gl::ShaderMap<std::string> &shaderSources,
                                        gl::ShaderMap<std::vector<uint32_t>> *shaderCodesOut);
+
+    // Doesn't need a context, so it can run on a worker thread.  Failures are only reported
+    // through the return value.
+    static angle::Result GetShaderCodeForStage(const gl::Caps &glCaps,
+                                               gl::ShaderType shaderType,
+                                               const std::string &shaderSource,
+                                               std::vector<uint32_t> *shaderCodeOut);
 };
 }  // namespace rx
 
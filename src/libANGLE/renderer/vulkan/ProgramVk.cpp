@@ -10,9 +10,11 @@
 #include "libANGLE/renderer/vulkan/ProgramVk.h"
 
 #include "common/debug.h"
+#include "common/third_party/xxhash/xxhash.h"
 #include "common/utilities.h"
 #include "libANGLE/Context.h"
 #include "libANGLE/ProgramLinkedResources.h"
+#include "libANGLE/WorkerThread.h"
 #include "libANGLE/renderer/glslang_wrapper_utils.h"
 #include "libANGLE/renderer/renderer_utils.h"
 #include "libANGLE/renderer/vulkan/BufferVk.h"
@@ -352,11 +354,42 @@ void WriteBufferDescriptorSetBinding(const gl::OffsetBindingPointer<gl::Buffer>
     ASSERT(writeInfoOut->pBufferInfo[0].buffer != VK_NULL_HANDLE);
 }
 
+// Appends a buffer binding to the shader resources desc and returns the bound buffer, if any.
+vk::BufferHelper *AppendBufferBindingToDesc(
+    const gl::OffsetBindingPointer<gl::Buffer> &bufferBinding,
+    vk::ShaderResourcesDescriptorDesc *desc)
+{
+    gl::Buffer *buffer = bufferBinding.get();
+    if (buffer == nullptr)
+    {
+        desc->appendBuffer(Serial(), 0, 0);
+        return nullptr;
+    }
+
+    vk::BufferHelper &bufferHelper = vk::GetImpl(buffer)->getBuffer();
+    desc->appendBuffer(bufferHelper.getSerial(), bufferBinding.getOffset(),
+                       bufferBinding.getSize());
+    return &bufferHelper;
+}
+
 class Std140BlockLayoutEncoderFactory : public gl::CustomBlockLayoutEncoderFactory
 {
   public:
     sh::BlockLayoutEncoder *makeEncoder() override { return new sh::Std140BlockEncoder(); }
 };
+
+uint64_t ComputePipelineLogKey(const gl::ShaderMap<std::string> &shaderSources)
+{
+    // Chain the hash of every stage through the seed.
+    uint64_t key = 0;
+    for (const std::string &shaderSource : shaderSources)
+    {
+        key = XXH64(shaderSource.data(), shaderSource.size(), key);
+    }
+
+    // A key of 0 disables recording in the pipeline log.
+    return key != 0 ? key : 1;
+}
 }  // anonymous namespace
 
 // ProgramVk::ShaderInfo implementation.
@@ -371,8 +404,17 @@ angle::Result ProgramVk::ShaderInfo::initShaders(ContextVk *contextVk,
     ASSERT(!valid());
 
     gl::ShaderMap<std::vector<uint32_t>> shaderCodes;
-    ANGLE_TRY(GlslangWrapperVk::GetShaderCode(
-        contextVk, contextVk->getCaps(), enableLineRasterEmulation, shaderSources, &shaderCodes));
+    if (mHasShaderCodes)
+    {
+        shaderCodes     = std::move(mShaderCodes);
+        mHasShaderCodes = false;
+    }
+    else
+    {
+        ANGLE_TRY(GlslangWrapperVk::GetShaderCode(contextVk, contextVk->getCaps(),
+                                                  enableLineRasterEmulation, shaderSources,
+                                                  &shaderCodes));
+    }
 
     for (const gl::ShaderType shaderType : gl::AllShaderTypes())
     {
@@ -417,8 +459,167 @@ void ProgramVk::ShaderInfo::release(ContextVk *contextVk)
     {
         shader.get().destroy(contextVk->getDevice());
     }
+
+    for (std::vector<uint32_t> &shaderCode : mShaderCodes)
+    {
+        shaderCode.clear();
+    }
+    mHasShaderCodes = false;
+}
+
+void ProgramVk::ShaderInfo::setShaderCode(gl::ShaderMap<std::vector<uint32_t>> &&shaderCodes)
+{
+    ASSERT(!valid());
+    mShaderCodes    = std::move(shaderCodes);
+    mHasShaderCodes = true;
 }
 
+// Generates the SPIR-V of a single stage on a worker thread.
+class ProgramVk::CompileShaderTask final : public angle::Closure
+{
+  public:
+    CompileShaderTask(std::shared_ptr<const gl::Caps> caps,
+                      gl::ShaderType shaderType,
+                      const std::string &shaderSource)
+        : mCaps(caps),
+          mShaderType(shaderType),
+          mShaderSource(shaderSource),
+          mResult(angle::Result::Continue)
+    {}
+
+    void operator()() override
+    {
+        mResult = GlslangWrapperVk::GetShaderCodeForStage(*mCaps, mShaderType, mShaderSource,
+                                                          &mShaderCode);
+    }
+
+    gl::ShaderType getShaderType() const { return mShaderType; }
+    angle::Result getResult() const { return mResult; }
+    std::vector<uint32_t> &getShaderCode() { return mShaderCode; }
+
+  private:
+    std::shared_ptr<const gl::Caps> mCaps;
+    gl::ShaderType mShaderType;
+    std::string mShaderSource;
+
+    angle::Result mResult;
+    std::vector<uint32_t> mShaderCode;
+};
+
+// Resolves the link once the SPIR-V of every stage is available.
+class ProgramVk::LinkEventVk final : public LinkEvent
+{
+  public:
+    LinkEventVk(ProgramVk *program,
+                std::vector<std::shared_ptr<CompileShaderTask>> &&compileTasks,
+                std::vector<std::shared_ptr<angle::WaitableEvent>> &&waitEvents)
+        : mProgram(program),
+          mCompileTasks(std::move(compileTasks)),
+          mWaitEvents(std::move(waitEvents))
+    {}
+
+    angle::Result wait(const gl::Context *context) override
+    {
+        ContextVk *contextVk = vk::GetImpl(context);
+
+        gl::ShaderMap<std::vector<uint32_t>> shaderCodes;
+        for (size_t taskIndex = 0; taskIndex < mCompileTasks.size(); ++taskIndex)
+        {
+            mWaitEvents[taskIndex]->wait();
+
+            CompileShaderTask *task = mCompileTasks[taskIndex].get();
+            ANGLE_VK_CHECK(contextVk, task->getResult() == angle::Result::Continue,
+                           VK_ERROR_INVALID_SHADER_NV);
+            shaderCodes[task->getShaderType()] = std::move(task->getShaderCode());
+        }
+
+        mProgram->mDefaultShaderInfo.setShaderCode(std::move(shaderCodes));
+        return mProgram->prewarmGraphicsPipelines(context);
+    }
+
+    bool isLinking() override
+    {
+        for (std::shared_ptr<angle::WaitableEvent> &waitEvent : mWaitEvents)
+        {
+            if (!waitEvent->isReady())
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+  private:
+    ProgramVk *mProgram;
+    std::vector<std::shared_ptr<CompileShaderTask>> mCompileTasks;
+    std::vector<std::shared_ptr<angle::WaitableEvent>> mWaitEvents;
+};
+
+// Creates a graphics pipeline recorded in the pipeline log on a worker thread.  The render pass
+// cache belongs to the context, so a compatible render pass is created just for the occasion.
+// Failures are not fatal; the pipeline is then created on demand, as usual.
+class ProgramVk::PrewarmPipelineTask final : public angle::Closure, public vk::Context
+{
+  public:
+    PrewarmPipelineTask(RendererVk *renderer,
+                        const vk::PipelineCache &pipelineCache,
+                        const vk::PipelineLayout &pipelineLayout,
+                        const gl::AttributesMask &activeAttribLocationsMask,
+                        const gl::ComponentTypeMask &programAttribsTypeMask,
+                        const vk::ShaderProgramHelper &shaderProgram,
+                        const vk::GraphicsPipelineDesc &desc)
+        : vk::Context(renderer),
+          mPipelineCache(pipelineCache),
+          mPipelineLayout(pipelineLayout),
+          mActiveAttribLocationsMask(activeAttribLocationsMask),
+          mProgramAttribsTypeMask(programAttribsTypeMask),
+          mVertexModule(shaderProgram.getShaderModule(gl::ShaderType::Vertex)),
+          mFragmentModule(shaderProgram.getShaderModule(gl::ShaderType::Fragment)),
+          mGeometryModule(shaderProgram.getShaderModule(gl::ShaderType::Geometry)),
+          mDesc(desc)
+    {}
+
+    void operator()() override
+    {
+        vk::RenderPass compatibleRenderPass;
+        if (vk::InitializeCompatibleRenderPass(this, mDesc.getRenderPassDesc(),
+                                               &compatibleRenderPass) != angle::Result::Continue)
+        {
+            return;
+        }
+
+        (void)mDesc.initializePipeline(this, mPipelineCache, compatibleRenderPass, mPipelineLayout,
+                                       mActiveAttribLocationsMask, mProgramAttribsTypeMask,
+                                       mVertexModule, mFragmentModule, mGeometryModule,
+                                       &mPipeline);
+
+        compatibleRenderPass.destroy(getDevice());
+    }
+
+    void handleError(VkResult result,
+                     const char *file,
+                     const char *function,
+                     unsigned int line) override
+    {
+        WARN() << "Failed to pre-warm graphics pipeline: " << VulkanResultString(result);
+    }
+
+    const vk::GraphicsPipelineDesc &getDesc() const { return mDesc; }
+    vk::Pipeline &getPipeline() { return mPipeline; }
+
+  private:
+    const vk::PipelineCache &mPipelineCache;
+    const vk::PipelineLayout &mPipelineLayout;
+    gl::AttributesMask mActiveAttribLocationsMask;
+    gl::ComponentTypeMask mProgramAttribsTypeMask;
+    const vk::ShaderModule *mVertexModule;
+    const vk::ShaderModule *mFragmentModule;
+    const vk::ShaderModule *mGeometryModule;
+    vk::GraphicsPipelineDesc mDesc;
+
+    vk::Pipeline mPipeline;
+};
+
 // ProgramVk implementation.
 ProgramVk::DefaultUniformBlock::DefaultUniformBlock() {}
 
@@ -427,6 +628,7 @@ ProgramVk::DefaultUniformBlock::~DefaultUniformBlock() = default;
 ProgramVk::ProgramVk(const gl::ProgramState &state)
     : ProgramImpl(state),
       mDynamicBufferOffsets{},
+      mPipelineLogKey(0),
       mStorageBlockBindingsOffset(0),
       mAtomicCounterBufferBindingsOffset(0),
       mImageBindingsOffset(0)
@@ -442,6 +644,9 @@ void ProgramVk::destroy(const gl::Context *context)
 
 void ProgramVk::reset(ContextVk *contextVk)
 {
+    // The pre-warm tasks reference the pipeline layout and the shader modules.
+    discardPrewarmedPipelines(contextVk);
+
     for (auto &descriptorSetLayout : mDescriptorSetLayouts)
     {
         descriptorSetLayout.reset();
@@ -474,6 +679,7 @@ void ProgramVk::reset(ContextVk *contextVk)
     }
 
     mTextureDescriptorsCache.clear();
+    mShaderResourcesDescriptorsCache.clear();
     mDescriptorBuffersCache.clear();
 }
 
@@ -518,7 +724,13 @@ std::unique_ptr<rx::LinkEvent> ProgramVk::load(const gl::Context *context,
         return std::make_unique<LinkEventDone>(status);
     }
 
-    return std::make_unique<LinkEventDone>(linkImpl(context, infoLog));
+    status = linkImpl(context, infoLog);
+    if (status != angle::Result::Continue)
+    {
+        return std::make_unique<LinkEventDone>(status);
+    }
+
+    return compileShaders(context);
 }
 
 void ProgramVk::save(const gl::Context *context, gl::BinaryOutputStream *stream)
@@ -577,9 +789,138 @@ std::unique_ptr<LinkEvent> ProgramVk::link(const gl::Context *context,
         return std::make_unique<LinkEventDone>(status);
     }
 
-    // TODO(jie.a.chen@intel.com): Parallelize linking.
-    // http://crbug.com/849576
-    return std::make_unique<LinkEventDone>(linkImpl(context, infoLog));
+    status = linkImpl(context, infoLog);
+    if (status != angle::Result::Continue)
+    {
+        return std::make_unique<LinkEventDone>(status);
+    }
+
+    return compileShaders(context);
+}
+
+std::unique_ptr<LinkEvent> ProgramVk::compileShaders(const gl::Context *context)
+{
+    ContextVk *contextVk = vk::GetImpl(context);
+
+    // Only the pipelines of the default variant are recorded and pre-warmed.
+    mPipelineLogKey = ComputePipelineLogKey(mShaderSources);
+    mDefaultShaderInfo.getShaderProgram().setGraphicsPipelineLogKey(mPipelineLogKey);
+
+    // Only the default variant is compiled ahead of time.  The line raster emulation variant is
+    // rarely needed, so it's still compiled on first use.
+    auto caps = std::make_shared<const gl::Caps>(contextVk->getCaps());
+
+    std::vector<std::shared_ptr<CompileShaderTask>> compileTasks;
+    std::vector<std::shared_ptr<angle::WaitableEvent>> waitEvents;
+    for (const gl::ShaderType shaderType : gl::AllShaderTypes())
+    {
+        if (mShaderSources[shaderType].empty())
+        {
+            continue;
+        }
+
+        auto compileTask =
+            std::make_shared<CompileShaderTask>(caps, shaderType, mShaderSources[shaderType]);
+        waitEvents.push_back(angle::WorkerThreadPool::PostWorkerTask(
+            context->getWorkerThreadPool(), compileTask, angle::TaskPriority::High));
+        compileTasks.push_back(compileTask);
+    }
+
+    return std::make_unique<LinkEventVk>(this, std::move(compileTasks), std::move(waitEvents));
+}
+
+angle::Result ProgramVk::prewarmGraphicsPipelines(const gl::Context *context)
+{
+    ContextVk *contextVk = vk::GetImpl(context);
+    RendererVk *renderer = contextVk->getRenderer();
+
+    if (!renderer->getFeatures().preWarmGraphicsPipelines.enabled)
+    {
+        return angle::Result::Continue;
+    }
+
+    std::vector<vk::GraphicsPipelineDesc> descs;
+    renderer->getGraphicsPipelineLog().getPipelineDescs(mPipelineLogKey, &descs);
+    if (descs.empty())
+    {
+        return angle::Result::Continue;
+    }
+
+    // The shader modules would otherwise only be created on first draw.
+    vk::ShaderProgramHelper *shaderProgram = nullptr;
+    ANGLE_TRY(initShaders(contextVk, false, &mDefaultShaderInfo, &shaderProgram));
+    if (!shaderProgram->isGraphicsProgram())
+    {
+        return angle::Result::Continue;
+    }
+
+    vk::PipelineCache *pipelineCache = nullptr;
+    ANGLE_TRY(renderer->getPipelineCache(&pipelineCache));
+
+    for (const vk::GraphicsPipelineDesc &desc : descs)
+    {
+        auto prewarmTask = std::make_shared<PrewarmPipelineTask>(
+            renderer, *pipelineCache, mPipelineLayout.get(),
+            mState.getNonBuiltinAttribLocationsMask(), mState.getAttributesTypeMask(),
+            *shaderProgram, desc);
+        mPrewarmWaitEvents.push_back(angle::WorkerThreadPool::PostWorkerTask(
+            context->getWorkerThreadPool(), prewarmTask, angle::TaskPriority::Low));
+        mPrewarmTasks.push_back(prewarmTask);
+    }
+
+    return angle::Result::Continue;
+}
+
+void ProgramVk::collectPrewarmedPipelines(ContextVk *contextVk,
+                                          const vk::GraphicsPipelineDesc &neededDesc)
+{
+    vk::ShaderProgramHelper &shaderProgram = mDefaultShaderInfo.getShaderProgram();
+
+    size_t pendingCount = 0;
+    for (size_t taskIndex = 0; taskIndex < mPrewarmTasks.size(); ++taskIndex)
+    {
+        PrewarmPipelineTask *task = mPrewarmTasks[taskIndex].get();
+
+        // Rather than creating the pipeline a second time, wait for the worker that's on it.
+        if (task->getDesc() == neededDesc)
+        {
+            mPrewarmWaitEvents[taskIndex]->wait();
+        }
+
+        if (!mPrewarmWaitEvents[taskIndex]->isReady())
+        {
+            if (pendingCount != taskIndex)
+            {
+                mPrewarmTasks[pendingCount]      = std::move(mPrewarmTasks[taskIndex]);
+                mPrewarmWaitEvents[pendingCount] = std::move(mPrewarmWaitEvents[taskIndex]);
+            }
+            ++pendingCount;
+            continue;
+        }
+
+        if (task->getPipeline().valid())
+        {
+            shaderProgram.populatePrewarmedGraphicsPipeline(contextVk, task->getDesc(),
+                                                            std::move(task->getPipeline()));
+        }
+    }
+
+    mPrewarmTasks.resize(pendingCount);
+    mPrewarmWaitEvents.resize(pendingCount);
+}
+
+void ProgramVk::discardPrewarmedPipelines(ContextVk *contextVk)
+{
+    for (size_t taskIndex = 0; taskIndex < mPrewarmTasks.size(); ++taskIndex)
+    {
+        mPrewarmWaitEvents[taskIndex]->wait();
+
+        // These pipelines were never used, so they can be destroyed right away.
+        mPrewarmTasks[taskIndex]->getPipeline().destroy(contextVk->getDevice());
+    }
+
+    mPrewarmTasks.clear();
+    mPrewarmWaitEvents.clear();
 }
 
 angle::Result ProgramVk::linkImpl(const gl::Context *glContext, gl::InfoLog &infoLog)
@@ -1273,7 +1614,6 @@ void ProgramVk::updateDefaultUniformsDescriptorSet(ContextVk *contextVk)
 }
 
 void ProgramVk::updateBuffersDescriptorSet(ContextVk *contextVk,
-                                           vk::CommandGraphResource *recorder,
                                            const std::vector<gl::InterfaceBlock> &blocks,
                                            VkDescriptorType descriptorType)
 {
@@ -1333,19 +1673,6 @@ void ProgramVk::updateBuffersDescriptorSet(ContextVk *contextVk,
         WriteBufferDescriptorSetBinding(bufferBinding, maxBlockSize, descriptorSet, descriptorType,
                                         binding, arrayElement, 0, &bufferInfo, &writeInfo);
 
-        BufferVk *bufferVk             = vk::GetImpl(bufferBinding.get());
-        vk::BufferHelper &bufferHelper = bufferVk->getBuffer();
-
-        if (isStorageBuffer)
-        {
-            bufferHelper.onWrite(contextVk, recorder, VK_ACCESS_SHADER_READ_BIT,
-                                 VK_ACCESS_SHADER_WRITE_BIT);
-        }
-        else
-        {
-            bufferHelper.onRead(contextVk, recorder, VK_ACCESS_UNIFORM_READ_BIT);
-        }
-
         ++writeCount;
     }
 
@@ -1354,8 +1681,7 @@ void ProgramVk::updateBuffersDescriptorSet(ContextVk *contextVk,
     vkUpdateDescriptorSets(device, writeCount, writeDescriptorInfo.data(), 0, nullptr);
 }
 
-void ProgramVk::updateAtomicCounterBuffersDescriptorSet(ContextVk *contextVk,
-                                                        vk::CommandGraphResource *recorder)
+void ProgramVk::updateAtomicCounterBuffersDescriptorSet(ContextVk *contextVk)
 {
     const gl::State &glState = contextVk->getState();
     const std::vector<gl::AtomicCounterBuffer> &atomicCounterBuffers =
@@ -1398,17 +1724,10 @@ void ProgramVk::updateAtomicCounterBuffersDescriptorSet(ContextVk *contextVk,
                                         VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, bindingStart, binding,
                                         requiredOffsetAlignment, &bufferInfo, &writeInfo);
 
-        BufferVk *bufferVk             = vk::GetImpl(bufferBinding.get());
-        vk::BufferHelper &bufferHelper = bufferVk->getBuffer();
-
-        bufferHelper.onWrite(contextVk, recorder, VK_ACCESS_SHADER_READ_BIT,
-                             VK_ACCESS_SHADER_WRITE_BIT);
-
         writtenBindings.set(binding);
     }
 
     // Bind the empty buffer to every array slot that's unused.
-    mEmptyBuffer.onGraphAccess(contextVk->getCommandGraph());
     for (size_t binding : ~writtenBindings)
     {
         VkDescriptorBufferInfo &bufferInfo = descriptorBufferInfo[binding];
@@ -1436,8 +1755,7 @@ void ProgramVk::updateAtomicCounterBuffersDescriptorSet(ContextVk *contextVk,
                            writeDescriptorInfo.data(), 0, nullptr);
 }
 
-angle::Result ProgramVk::updateImagesDescriptorSet(ContextVk *contextVk,
-                                                   vk::CommandGraphResource *recorder)
+angle::Result ProgramVk::updateImagesDescriptorSet(ContextVk *contextVk)
 {
     const gl::State &glState                           = contextVk->getState();
     const std::vector<gl::ImageBinding> &imageBindings = mState.getImageBindings();
@@ -1511,17 +1829,108 @@ angle::Result ProgramVk::updateImagesDescriptorSet(ContextVk *contextVk,
     return angle::Result::Continue;
 }
 
+void ProgramVk::getShaderResourcesDescriptorDesc(ContextVk *contextVk,
+                                                 vk::CommandGraphResource *recorder,
+                                                 vk::ShaderResourcesDescriptorDesc *descOut)
+{
+    const gl::State &glState = contextVk->getState();
+
+    descOut->reset();
+
+    for (const gl::InterfaceBlock &block : mState.getUniformBlocks())
+    {
+        vk::BufferHelper *bufferHelper =
+            AppendBufferBindingToDesc(glState.getIndexedUniformBuffer(block.binding), descOut);
+        if (bufferHelper)
+        {
+            bufferHelper->onRead(contextVk, recorder, VK_ACCESS_UNIFORM_READ_BIT);
+        }
+    }
+
+    for (const gl::InterfaceBlock &block : mState.getShaderStorageBlocks())
+    {
+        vk::BufferHelper *bufferHelper = AppendBufferBindingToDesc(
+            glState.getIndexedShaderStorageBuffer(block.binding), descOut);
+        if (bufferHelper)
+        {
+            bufferHelper->onWrite(contextVk, recorder, VK_ACCESS_SHADER_READ_BIT,
+                                  VK_ACCESS_SHADER_WRITE_BIT);
+        }
+    }
+
+    const std::vector<gl::AtomicCounterBuffer> &atomicCounterBuffers =
+        mState.getAtomicCounterBuffers();
+    for (const gl::AtomicCounterBuffer &atomicCounterBuffer : atomicCounterBuffers)
+    {
+        vk::BufferHelper *bufferHelper = AppendBufferBindingToDesc(
+            glState.getIndexedAtomicCounterBuffer(atomicCounterBuffer.binding), descOut);
+        if (bufferHelper)
+        {
+            bufferHelper->onWrite(contextVk, recorder, VK_ACCESS_SHADER_READ_BIT,
+                                  VK_ACCESS_SHADER_WRITE_BIT);
+        }
+    }
+    if (!atomicCounterBuffers.empty())
+    {
+        // The empty buffer is bound to the unused atomic counter buffer array slots.
+        mEmptyBuffer.onGraphAccess(contextVk->getCommandGraph());
+    }
+
+    const gl::ActiveTextureArray<TextureVk *> &activeImages = contextVk->getActiveImages();
+    for (const gl::ImageBinding &imageBinding : mState.getImageBindings())
+    {
+        for (GLuint imageUnit : imageBinding.boundImageUnits)
+        {
+            const gl::ImageUnit &binding = glState.getImageUnit(imageUnit);
+            TextureVk *textureVk         = activeImages[imageUnit];
+
+            descOut->appendImage(textureVk->getSerial(), static_cast<uint32_t>(binding.level),
+                                 static_cast<uint32_t>(binding.layer), binding.layered == GL_TRUE,
+                                 textureVk->getImage().getCurrentLayout());
+        }
+    }
+}
+
 angle::Result ProgramVk::updateShaderResourcesDescriptorSet(ContextVk *contextVk,
                                                             vk::CommandGraphResource *recorder)
 {
-    ANGLE_TRY(allocateDescriptorSet(contextVk, kShaderResourceDescriptorSetIndex));
+    RendererVk *renderer = contextVk->getRenderer();
+
+    // The graph dependencies are recorded whether or not the descriptor set is found in the cache.
+    vk::ShaderResourcesDescriptorDesc shaderResourcesDesc;
+    getShaderResourcesDescriptorDesc(contextVk, recorder, &shaderResourcesDesc);
+
+    auto iter = mShaderResourcesDescriptorsCache.find(shaderResourcesDesc);
+    if (iter != mShaderResourcesDescriptorsCache.end())
+    {
+        mDescriptorSets[kShaderResourceDescriptorSetIndex] = iter->second;
+        renderer->onDescriptorSetCacheHit();
+        return angle::Result::Continue;
+    }
 
-    updateBuffersDescriptorSet(contextVk, recorder, mState.getUniformBlocks(),
+    renderer->onDescriptorSetCacheMiss();
+
+    bool newPoolAllocated;
+    ANGLE_TRY(allocateDescriptorSetAndGetInfo(contextVk, kShaderResourceDescriptorSetIndex,
+                                              &newPoolAllocated));
+
+    // Clear descriptor set cache. It may no longer be valid.
+    if (newPoolAllocated)
+    {
+        mShaderResourcesDescriptorsCache.clear();
+    }
+
+    updateBuffersDescriptorSet(contextVk, mState.getUniformBlocks(),
                                VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER);
-    updateBuffersDescriptorSet(contextVk, recorder, mState.getShaderStorageBlocks(),
+    updateBuffersDescriptorSet(contextVk, mState.getShaderStorageBlocks(),
                                VK_DESCRIPTOR_TYPE_STORAGE_BUFFER);
-    updateAtomicCounterBuffersDescriptorSet(contextVk, recorder);
-    return updateImagesDescriptorSet(contextVk, recorder);
+    updateAtomicCounterBuffersDescriptorSet(contextVk);
+    ANGLE_TRY(updateImagesDescriptorSet(contextVk));
+
+    mShaderResourcesDescriptorsCache.emplace(shaderResourcesDesc,
+                                             mDescriptorSets[kShaderResourceDescriptorSetIndex]);
+
+    return angle::Result::Continue;
 }
 
 angle::Result ProgramVk::updateTransformFeedbackDescriptorSet(ContextVk *contextVk,
@@ -1579,9 +1988,12 @@ angle::Result ProgramVk::updateTexturesDescriptorSet(ContextVk *contextVk)
     if (iter != mTextureDescriptorsCache.end())
     {
         mDescriptorSets[kTextureDescriptorSetIndex] = iter->second;
+        contextVk->getRenderer()->onDescriptorSetCacheHit();
         return angle::Result::Continue;
     }
 
+    contextVk->getRenderer()->onDescriptorSetCacheMiss();
+
     ASSERT(hasTextures());
     bool newPoolAllocated;
     ANGLE_TRY(
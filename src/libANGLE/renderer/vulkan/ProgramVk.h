@@ -19,6 +19,11 @@
 #include "libANGLE/renderer/vulkan/TransformFeedbackVk.h"
 #include "libANGLE/renderer/vulkan/vk_helpers.h"
 
+namespace angle
+{
+class WaitableEvent;
+}  // namespace angle
+
 namespace rx
 {
 ANGLE_INLINE bool UseLineRaster(const ContextVk *contextVk, gl::PrimitiveMode mode)
@@ -141,6 +146,10 @@ class ProgramVk : public ProgramImpl
         vk::ShaderProgramHelper *shaderProgram;
         ANGLE_TRY(initGraphicsShaders(contextVk, mode, &shaderProgram));
         ASSERT(shaderProgram->isGraphicsProgram());
+        if (ANGLE_UNLIKELY(!mPrewarmTasks.empty()))
+        {
+            collectPrewarmedPipelines(contextVk, desc);
+        }
         RendererVk *renderer             = contextVk->getRenderer();
         vk::PipelineCache *pipelineCache = nullptr;
         ANGLE_TRY(renderer->getPipelineCache(&pipelineCache));
@@ -186,13 +195,14 @@ class ProgramVk : public ProgramImpl
     void updateDefaultUniformsDescriptorSet(ContextVk *contextVk);
     void updateTransformFeedbackDescriptorSetImpl(ContextVk *contextVk);
     void updateBuffersDescriptorSet(ContextVk *contextVk,
-                                    vk::CommandGraphResource *recorder,
                                     const std::vector<gl::InterfaceBlock> &blocks,
                                     VkDescriptorType descriptorType);
-    void updateAtomicCounterBuffersDescriptorSet(ContextVk *contextVk,
-                                                 vk::CommandGraphResource *recorder);
-    angle::Result updateImagesDescriptorSet(ContextVk *contextVk,
-                                            vk::CommandGraphResource *recorder);
+    void updateAtomicCounterBuffersDescriptorSet(ContextVk *contextVk);
+    angle::Result updateImagesDescriptorSet(ContextVk *contextVk);
+    // Builds the desc of the bound shader resources and records their graph dependencies.
+    void getShaderResourcesDescriptorDesc(ContextVk *contextVk,
+                                          vk::CommandGraphResource *recorder,
+                                          vk::ShaderResourcesDescriptorDesc *descOut);
 
     template <class T>
     void getUniformImpl(GLint location, T *v, GLenum entryPointType) const;
@@ -202,6 +212,22 @@ class ProgramVk : public ProgramImpl
     angle::Result linkImpl(const gl::Context *glContext, gl::InfoLog &infoLog);
     void linkResources(const gl::ProgramLinkedResources &resources);
 
+    // Posts the SPIR-V generation of every stage to the worker threads.  The returned event
+    // resolves once all of them are done.
+    class CompileShaderTask;
+    class LinkEventVk;
+    std::unique_ptr<LinkEvent> compileShaders(const gl::Context *context);
+
+    // Posts the creation of the graphics pipelines this program used in previous runs, as
+    // recorded in the renderer's pipeline log, to the worker threads.  The pipelines are added to
+    // the pipeline cache of the default variant once ready.
+    class PrewarmPipelineTask;
+    angle::Result prewarmGraphicsPipelines(const gl::Context *context);
+    // Takes the pipelines that are ready.  If |neededDesc| is still being created, waits for it.
+    void collectPrewarmedPipelines(ContextVk *contextVk,
+                                   const vk::GraphicsPipelineDesc &neededDesc);
+    void discardPrewarmedPipelines(ContextVk *contextVk);
+
     void updateBindingOffsets();
     uint32_t getUniformBlockBindingsOffset() const { return 0; }
     uint32_t getStorageBlockBindingsOffset() const { return mStorageBlockBindingsOffset; }
@@ -285,6 +311,8 @@ class ProgramVk : public ProgramImpl
     std::vector<vk::BufferHelper *> mDescriptorBuffersCache;
 
     std::unordered_map<vk::TextureDescriptorDesc, VkDescriptorSet> mTextureDescriptorsCache;
+    std::unordered_map<vk::ShaderResourcesDescriptorDesc, VkDescriptorSet>
+        mShaderResourcesDescriptorsCache;
 
     // We keep a reference to the pipeline and descriptor set layouts. This ensures they don't get
     // deleted while this program is in use.
@@ -306,6 +334,9 @@ class ProgramVk : public ProgramImpl
                                   bool enableLineRasterEmulation);
         void release(ContextVk *contextVk);
 
+        // Provide SPIR-V generated ahead of time, so initShaders doesn't have to run glslang.
+        void setShaderCode(gl::ShaderMap<std::vector<uint32_t>> &&shaderCodes);
+
         ANGLE_INLINE bool valid() const
         {
             return mShaders[gl::ShaderType::Vertex].get().valid() ||
@@ -317,6 +348,10 @@ class ProgramVk : public ProgramImpl
       private:
         vk::ShaderProgramHelper mProgramHelper;
         gl::ShaderMap<vk::RefCounted<vk::ShaderAndSerial>> mShaders;
+
+        // Only kept until the shader modules are created.
+        gl::ShaderMap<std::vector<uint32_t>> mShaderCodes;
+        bool mHasShaderCodes = false;
     };
 
     ShaderInfo mDefaultShaderInfo;
@@ -325,6 +360,11 @@ class ProgramVk : public ProgramImpl
     // We keep the translated linked shader sources to use with shader draw call patching.
     gl::ShaderMap<std::string> mShaderSources;
 
+    // Hash of mShaderSources, identifying the program in the pipeline log.
+    uint64_t mPipelineLogKey;
+    std::vector<std::shared_ptr<PrewarmPipelineTask>> mPrewarmTasks;
+    std::vector<std::shared_ptr<angle::WaitableEvent>> mPrewarmWaitEvents;
+
     // In their descriptor set, uniform buffers are placed first, then storage buffers, then atomic
     // counter buffers and then images.  These cached values contain the offsets where storage
     // buffer, atomic counter buffer and image bindings start.
@@ -17,6 +17,7 @@
 #include "common/debug.h"
 #include "common/platform.h"
 #include "common/system_utils.h"
+#include "common/version.h"
 #include "libANGLE/Context.h"
 #include "libANGLE/Display.h"
 #include "libANGLE/renderer/driver_utils.h"
@@ -544,7 +545,12 @@ RendererVk::RendererVk()
       mDeviceLost(false),
       mPipelineCacheVkUpdateTimeout(kPipelineCacheVkUpdatePeriod),
       mPipelineCacheDirty(false),
-      mPipelineCacheInitialized(false)
+      mPipelineCacheInitialized(false),
+      mOnDemandGraphicsPipelineCount(0),
+      mPrewarmedGraphicsPipelineHitCount(0),
+      mBufferStallsAvoidedCount(0),
+      mDescriptorSetCacheHitCount(0),
+      mDescriptorSetCacheMissCount(0)
 {
     mPhysicalDeviceSubgroupProperties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBGROUP_PROPERTIES;
 
@@ -567,12 +573,20 @@ void RendererVk::onDestroy(vk::Context *context)
     mPipelineLayoutCache.destroy(mDevice);
     mDescriptorSetLayoutCache.destroy(mDevice);
 
+    // The periodic sync at swap time may have missed the latest pipelines.  Make sure they reach
+    // the blob cache, which may persist them to disk.
+    if (mPipelineCache.valid() && mPipelineCacheDirty)
+    {
+        (void)writePipelineCacheToBlobCache(vk::GetImpl(mDisplay));
+    }
     mPipelineCache.destroy(mDevice);
+    writeGraphicsPipelineLogToBlobCache(vk::GetImpl(mDisplay));
 
     GlslangRelease();
 
     if (mDevice)
     {
+        mMemoryAllocator.destroy();
         vkDestroyDevice(mDevice, nullptr);
         mDevice = VK_NULL_HANDLE;
     }
@@ -862,6 +876,10 @@ angle::Result RendererVk::initialize(DisplayVk *displayVk,
 
     ANGLE_VK_CHECK(displayVk, graphicsQueueFamilyCount > 0, VK_ERROR_INITIALIZATION_FAILED);
 
+    // Store the physical device memory properties so we can find the right memory pools.  This
+    // has to happen before the device is created, which sets up the memory allocator.
+    mMemoryProperties.init(mPhysicalDevice);
+
     // If only one queue family, go ahead and initialize the device. If there is more than one
     // queue, we'll have to wait until we see a WindowSurface to know which supports present.
     if (graphicsQueueFamilyCount == 1)
@@ -869,9 +887,6 @@ angle::Result RendererVk::initialize(DisplayVk *displayVk,
         ANGLE_TRY(initializeDevice(displayVk, firstGraphicsQueueFamily));
     }
 
-    // Store the physical device memory properties so we can find the right memory pools.
-    mMemoryProperties.init(mPhysicalDevice);
-
     GlslangInitialize();
 
     // Initialize the format table.
@@ -1004,7 +1019,7 @@ angle::Result RendererVk::initializeDevice(DisplayVk *displayVk, uint32_t queueF
                            &mProvokingVertexFeatures);
     }
 
-    initFeatures(deviceExtensionNames);
+    initFeatures(displayVk, deviceExtensionNames);
     OverrideFeaturesWithDisplayState(&mFeatures, displayVk->getState());
     mFeaturesInitialized = true;
 
@@ -1071,7 +1086,8 @@ angle::Result RendererVk::initializeDevice(DisplayVk *displayVk, uint32_t queueF
         mPhysicalDeviceFeatures.vertexPipelineStoresAndAtomics;
     enabledFeatures.features.fragmentStoresAndAtomics =
         mPhysicalDeviceFeatures.fragmentStoresAndAtomics;
-    enabledFeatures.features.geometryShader = mPhysicalDeviceFeatures.geometryShader;
+    enabledFeatures.features.geometryShader    = mPhysicalDeviceFeatures.geometryShader;
+    enabledFeatures.features.multiDrawIndirect = mPhysicalDeviceFeatures.multiDrawIndirect;
     if (!vk::CommandBuffer::ExecutesInline())
     {
         enabledFeatures.features.inheritedQueries = mPhysicalDeviceFeatures.inheritedQueries;
@@ -1132,10 +1148,17 @@ angle::Result RendererVk::initializeDevice(DisplayVk *displayVk, uint32_t queueF
 
     vkGetDeviceQueue(mDevice, mCurrentQueueFamilyIndex, 0, &mQueue);
 
+    mMemoryAllocator.init(std::make_unique<vk::DeviceMemoryBackend>(mDevice),
+                          mMemoryProperties.getProperties(),
+                          mPhysicalDeviceProperties.limits.nonCoherentAtomSize,
+                          vk::MemoryAllocator::kDefaultBlockSize);
+
     // Initialize the vulkan pipeline cache.
     bool success = false;
     ANGLE_TRY(initPipelineCache(displayVk, &mPipelineCache, &success));
 
+    initGraphicsPipelineLog(displayVk);
+
     return angle::Result::Continue;
 }
 
@@ -1307,7 +1330,7 @@ gl::Version RendererVk::getMaxConformantESVersion() const
     return std::min(getMaxSupportedESVersion(), gl::Version(2, 0));
 }
 
-void RendererVk::initFeatures(const ExtensionNameList &deviceExtensionNames)
+void RendererVk::initFeatures(DisplayVk *displayVk, const ExtensionNameList &deviceExtensionNames)
 {
     bool isAMD      = IsAMD(mPhysicalDeviceProperties.vendorID);
     bool isIntel    = IsIntel(mPhysicalDeviceProperties.vendorID);
@@ -1415,6 +1438,13 @@ void RendererVk::initFeatures(const ExtensionNameList &deviceExtensionNames)
         IsPixel2(mPhysicalDeviceProperties.vendorID, mPhysicalDeviceProperties.deviceID) ||
             IsPixel1XL(mPhysicalDeviceProperties.vendorID, mPhysicalDeviceProperties.deviceID));
 
+    // The pipeline log is only read back when the display is initialized, so it's only useful if it
+    // persists from one run to the next.  Application blob cache callbacks can only be set later.
+    ANGLE_FEATURE_CONDITION((&mFeatures), preWarmGraphicsPipelines,
+                            displayVk->getBlobCache()->getDiskStore() != nullptr);
+
+    ANGLE_FEATURE_CONDITION((&mFeatures), transcodeEtcWithCompute, true);
+
     angle::PlatformMethods *platform = ANGLEPlatformCurrent();
     platform->overrideFeaturesVk(platform, &mFeatures);
 }
@@ -1460,6 +1490,50 @@ angle::Result RendererVk::initPipelineCache(DisplayVk *display,
     return angle::Result::Continue;
 }
 
+void RendererVk::initGraphicsPipelineLog(DisplayVk *displayVk)
+{
+    if (!mFeatures.preWarmGraphicsPipelines.enabled)
+    {
+        return;
+    }
+
+    // The log contains raw GraphicsPipelineDescs, whose layout may change from one ANGLE version to
+    // another.
+    std::ostringstream hashStream("ANGLE Pipeline Log: ", std::ios_base::ate);
+    hashStream << ANGLE_COMMIT_HASH;
+    for (const uint32_t c : mPhysicalDeviceProperties.pipelineCacheUUID)
+    {
+        hashStream << std::hex << c;
+    }
+    hashStream << std::hex << mPhysicalDeviceProperties.vendorID;
+    hashStream << std::hex << mPhysicalDeviceProperties.deviceID;
+
+    const std::string &hashString = hashStream.str();
+    angle::base::SHA1HashBytes(reinterpret_cast<const unsigned char *>(hashString.c_str()),
+                               hashString.length(), mGraphicsPipelineLogBlobKey.data());
+
+    egl::BlobCache::Value logData;
+    if (displayVk->getBlobCache()->get(displayVk->getScratchBuffer(), mGraphicsPipelineLogBlobKey,
+                                       &logData))
+    {
+        mGraphicsPipelineLog.deserialize(logData.data(), logData.size());
+    }
+}
+
+void RendererVk::writeGraphicsPipelineLogToBlobCache(DisplayVk *displayVk)
+{
+    if (!mFeatures.preWarmGraphicsPipelines.enabled)
+    {
+        return;
+    }
+
+    angle::MemoryBuffer logData;
+    if (mGraphicsPipelineLog.serialize(&logData))
+    {
+        displayVk->getBlobCache()->putApplication(mGraphicsPipelineLogBlobKey, logData);
+    }
+}
+
 angle::Result RendererVk::getPipelineCache(vk::PipelineCache **pipelineCache)
 {
     if (mPipelineCacheInitialized)
@@ -1553,6 +1627,12 @@ angle::Result RendererVk::syncPipelineCacheVk(DisplayVk *displayVk)
 
     mPipelineCacheVkUpdateTimeout = kPipelineCacheVkUpdatePeriod;
 
+    writeGraphicsPipelineLogToBlobCache(displayVk);
+    return writePipelineCacheToBlobCache(displayVk);
+}
+
+angle::Result RendererVk::writePipelineCacheToBlobCache(DisplayVk *displayVk)
+{
     size_t pipelineCacheSize = 0;
     ANGLE_TRY(getPipelineCacheSize(displayVk, &pipelineCacheSize));
 
@@ -1601,6 +1681,11 @@ Serial RendererVk::issueShaderSerial()
     return mShaderSerialFactory.generate();
 }
 
+Serial RendererVk::issueBufferSerial()
+{
+    return mBufferSerialFactory.generate();
+}
+
 // These functions look at the mandatory format for support, and fallback to querying the device (if
 // necessary) to test the availability of the bits.
 bool RendererVk::hasLinearImageFormatFeatureBits(VkFormat format,
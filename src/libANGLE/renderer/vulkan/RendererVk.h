@@ -11,6 +11,7 @@
 #define LIBANGLE_RENDERER_VULKAN_RENDERERVK_H_
 
 #include <vulkan/vulkan.h>
+#include <atomic>
 #include <memory>
 #include <mutex>
 #include "vk_ext_provoking_vertex.h"
@@ -107,6 +108,7 @@ class RendererVk : angle::NonCopyable
     uint32_t getQueueFamilyIndex() const { return mCurrentQueueFamilyIndex; }
 
     const vk::MemoryProperties &getMemoryProperties() const { return mMemoryProperties; }
+    vk::MemoryAllocator &getMemoryAllocator() { return mMemoryAllocator; }
 
     // TODO(jmadill): We could pass angle::FormatID here.
     const vk::Format &getFormat(GLenum internalFormat) const
@@ -133,6 +135,7 @@ class RendererVk : angle::NonCopyable
 
     // Issues a new serial for linked shader modules. Used in the pipeline cache.
     Serial issueShaderSerial();
+    Serial issueBufferSerial();
 
     const angle::FeaturesVk &getFeatures() const
     {
@@ -194,6 +197,29 @@ class RendererVk : angle::NonCopyable
     angle::Result getPipelineCache(vk::PipelineCache **pipelineCache);
     void onNewGraphicsPipeline() { mPipelineCacheDirty = true; }
 
+    GraphicsPipelineLog &getGraphicsPipelineLog() { return mGraphicsPipelineLog; }
+
+    // Statistics on graphics pipeline pre-warming, for the debug overlay.
+    void onGraphicsPipelineCreatedOnDemand() { ++mOnDemandGraphicsPipelineCount; }
+    void onPrewarmedGraphicsPipelineUsed() { ++mPrewarmedGraphicsPipelineHitCount; }
+    uint32_t getOnDemandGraphicsPipelineCount() const { return mOnDemandGraphicsPipelineCount; }
+    uint32_t getPrewarmedGraphicsPipelineHitCount() const
+    {
+        return mPrewarmedGraphicsPipelineHitCount;
+    }
+
+    // Number of buffer updates that were streamed through new memory instead of waiting for the
+    // GPU or copying on the GPU, for the debug overlay.
+    void onBufferStallAvoided() { ++mBufferStallsAvoidedCount; }
+    uint32_t getBufferStallsAvoidedCount() const { return mBufferStallsAvoidedCount; }
+
+    // Number of descriptor set updates that reused a cached descriptor set and that had to write a
+    // new one, for the debug overlay.
+    void onDescriptorSetCacheHit() { ++mDescriptorSetCacheHitCount; }
+    void onDescriptorSetCacheMiss() { ++mDescriptorSetCacheMissCount; }
+    uint32_t getDescriptorSetCacheHitCount() const { return mDescriptorSetCacheHitCount; }
+    uint32_t getDescriptorSetCacheMissCount() const { return mDescriptorSetCacheMissCount; }
+
     void onNewValidationMessage(const std::string &message);
     std::string getAndClearLastValidationMessage(uint32_t *countSinceLastClear);
 
@@ -213,11 +239,14 @@ class RendererVk : angle::NonCopyable
     angle::Result initializeDevice(DisplayVk *displayVk, uint32_t queueFamilyIndex);
     void ensureCapsInitialized() const;
 
-    void initFeatures(const ExtensionNameList &extensions);
+    void initFeatures(DisplayVk *displayVk, const ExtensionNameList &extensions);
     void initPipelineCacheVkKey();
+    angle::Result writePipelineCacheToBlobCache(DisplayVk *displayVk);
     angle::Result initPipelineCache(DisplayVk *display,
                                     vk::PipelineCache *pipelineCache,
                                     bool *success);
+    void initGraphicsPipelineLog(DisplayVk *displayVk);
+    void writeGraphicsPipelineLogToBlobCache(DisplayVk *displayVk);
 
     template <VkFormatFeatureFlags VkFormatProperties::*features>
     VkFormatFeatureFlags getFormatFeatureBits(VkFormat format,
@@ -257,6 +286,7 @@ class RendererVk : angle::NonCopyable
     VkDevice mDevice;
     AtomicSerialFactory mQueueSerialFactory;
     AtomicSerialFactory mShaderSerialFactory;
+    AtomicSerialFactory mBufferSerialFactory;
 
     Serial mLastCompletedQueueSerial;
     Serial mLastSubmittedQueueSerial;
@@ -270,6 +300,7 @@ class RendererVk : angle::NonCopyable
     vk::SharedGarbageList mSharedGarbage;
 
     vk::MemoryProperties mMemoryProperties;
+    vk::MemoryAllocator mMemoryAllocator;
     vk::FormatTable mFormatTable;
 
     // All access to the pipeline cache is done through EGL objects so it is thread safe to not use
@@ -280,6 +311,16 @@ class RendererVk : angle::NonCopyable
     bool mPipelineCacheDirty;
     bool mPipelineCacheInitialized;
 
+    // The graphics pipelines created by each program, persisted in the blob cache next to the
+    // pipeline cache.
+    GraphicsPipelineLog mGraphicsPipelineLog;
+    egl::BlobCache::Key mGraphicsPipelineLogBlobKey;
+    std::atomic<uint32_t> mOnDemandGraphicsPipelineCount;
+    std::atomic<uint32_t> mPrewarmedGraphicsPipelineHitCount;
+    std::atomic<uint32_t> mBufferStallsAvoidedCount;
+    std::atomic<uint32_t> mDescriptorSetCacheHitCount;
+    std::atomic<uint32_t> mDescriptorSetCacheMissCount;
+
     // A cache of VkFormatProperties as queried from the device over time.
     std::array<VkFormatProperties, vk::kNumVkFormats> mFormatProperties;
 
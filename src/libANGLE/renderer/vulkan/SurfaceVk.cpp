@@ -1390,6 +1390,36 @@ angle::Result WindowSurfaceVk::updateAndDrawOverlay(ContextVk *contextVk,
             ->add(validationMessageCount);
     }
 
+    overlay->getCountWidget(gl::WidgetId::VulkanPrewarmedPipelineHits)->reset();
+    overlay->getCountWidget(gl::WidgetId::VulkanPrewarmedPipelineHits)
+        ->add(rendererVk->getPrewarmedGraphicsPipelineHitCount());
+    overlay->getCountWidget(gl::WidgetId::VulkanOnDemandPipelineCreations)->reset();
+    overlay->getCountWidget(gl::WidgetId::VulkanOnDemandPipelineCreations)
+        ->add(rendererVk->getOnDemandGraphicsPipelineCount());
+
+    constexpr VkDeviceSize kMegabyte           = 1024 * 1024;
+    const vk::MemoryAllocatorStats memoryStats = rendererVk->getMemoryAllocator().getStats();
+    overlay->getCountWidget(gl::WidgetId::VulkanDeviceMemoryAllocations)->reset();
+    overlay->getCountWidget(gl::WidgetId::VulkanDeviceMemoryAllocations)
+        ->add(memoryStats.deviceMemoryCount);
+
+    std::ostringstream memoryUsage;
+    memoryUsage << memoryStats.subAllocatedBytes / kMegabyte << "/"
+                << memoryStats.blockBytes / kMegabyte << " MB in " << memoryStats.blockCount
+                << " blocks, " << memoryStats.dedicatedBytes / kMegabyte << " MB dedicated";
+    overlay->getTextWidget(gl::WidgetId::VulkanDeviceMemoryUsage)->set(memoryUsage.str());
+
+    overlay->getCountWidget(gl::WidgetId::VulkanBufferStallsAvoided)->reset();
+    overlay->getCountWidget(gl::WidgetId::VulkanBufferStallsAvoided)
+        ->add(rendererVk->getBufferStallsAvoidedCount());
+
+    overlay->getCountWidget(gl::WidgetId::VulkanDescriptorSetCacheHits)->reset();
+    overlay->getCountWidget(gl::WidgetId::VulkanDescriptorSetCacheHits)
+        ->add(rendererVk->getDescriptorSetCacheHitCount());
+    overlay->getCountWidget(gl::WidgetId::VulkanDescriptorSetCacheMisses)->reset();
+    overlay->getCountWidget(gl::WidgetId::VulkanDescriptorSetCacheMisses)
+        ->add(rendererVk->getDescriptorSetCacheMissCount());
+
     // Draw overlay
     const vk::ImageView *imageView = nullptr;
     ANGLE_TRY(
@@ -231,7 +231,7 @@ angle::Result TextureVk::setSubImageImpl(const gl::Context *context,
             static_cast<const uint8_t *>(mapPtr) + reinterpret_cast<ptrdiff_t>(pixels);
 
         ANGLE_TRY(mImage->stageSubresourceUpdate(
-            contextVk, getNativeImageIndex(index), gl::Extents(area.width, area.height, area.depth),
+            context, getNativeImageIndex(index), gl::Extents(area.width, area.height, area.depth),
             gl::Offset(area.x, area.y, area.z), formatInfo, unpack, type, source, vkFormat));
 
         unpackBufferVk->unmapImpl(contextVk);
@@ -241,7 +241,7 @@ angle::Result TextureVk::setSubImageImpl(const gl::Context *context,
     else if (pixels)
     {
         ANGLE_TRY(mImage->stageSubresourceUpdate(
-            contextVk, getNativeImageIndex(index), gl::Extents(area.width, area.height, area.depth),
+            context, getNativeImageIndex(index), gl::Extents(area.width, area.height, area.depth),
             gl::Offset(area.x, area.y, area.z), formatInfo, unpack, type, pixels, vkFormat));
         onStagingBufferChange();
     }
@@ -984,20 +984,14 @@ angle::Result TextureVk::generateMipmapsWithCPU(const gl::Context *context)
 
     const angle::Format &angleFormat = mImage->getFormat().actualImageFormat();
     GLuint sourceRowPitch            = baseLevelExtents.width * angleFormat.pixelBytes;
-    size_t baseLevelAllocationSize   = sourceRowPitch * baseLevelExtents.height;
 
     // We now have the base level available to be manipulated in the imageData pointer. Generate all
-    // the missing mipmaps with the slow path. For each layer, use the copied data to generate all
-    // the mips.
-    for (GLuint layer = 0; layer < imageLayerCount; layer++)
-    {
-        size_t bufferOffset = layer * baseLevelAllocationSize;
-
-        ANGLE_TRY(generateMipmapLevelsWithCPU(
-            contextVk, angleFormat, layer, mState.getEffectiveBaseLevel() + 1,
-            mState.getMipmapMaxLevel(), baseLevelExtents.width, baseLevelExtents.height,
-            sourceRowPitch, imageData + bufferOffset));
-    }
+    // the missing mipmaps with the slow path. The layers are packed one after the other, and each
+    // level is generated for all of them at once.
+    ANGLE_TRY(generateMipmapLevelsWithCPU(context, angleFormat, imageLayerCount,
+                                          mState.getEffectiveBaseLevel() + 1,
+                                          mState.getMipmapMaxLevel(), baseLevelExtents.width,
+                                          baseLevelExtents.height, sourceRowPitch, imageData));
 
     vk::CommandBuffer *commandBuffer = nullptr;
     ANGLE_TRY(mImage->recordCommands(contextVk, &commandBuffer));
@@ -1653,9 +1647,9 @@ uint32_t TextureVk::getMaxLevelCount() const
     return mState.getMipmapMaxLevel() + 1;
 }
 
-angle::Result TextureVk::generateMipmapLevelsWithCPU(ContextVk *contextVk,
+angle::Result TextureVk::generateMipmapLevelsWithCPU(const gl::Context *context,
                                                      const angle::Format &sourceFormat,
-                                                     GLuint layer,
+                                                     GLuint layerCount,
                                                      GLuint firstMipLevel,
                                                      GLuint maxMipLevel,
                                                      const size_t sourceWidth,
@@ -1663,6 +1657,8 @@ angle::Result TextureVk::generateMipmapLevelsWithCPU(ContextVk *contextVk,
                                                      const size_t sourceRowPitch,
                                                      uint8_t *sourceData)
 {
+    ContextVk *contextVk = vk::GetImpl(context);
+
     size_t previousLevelWidth    = sourceWidth;
     size_t previousLevelHeight   = sourceHeight;
     uint8_t *previousLevelData   = sourceData;
@@ -1678,19 +1674,22 @@ angle::Result TextureVk::generateMipmapLevelsWithCPU(ContextVk *contextVk,
         uint8_t *destData   = nullptr;
         size_t destRowPitch = mipWidth * sourceFormat.pixelBytes;
 
-        size_t mipAllocationSize = destRowPitch * mipHeight;
+        size_t mipAllocationSize = destRowPitch * mipHeight * layerCount;
         gl::Extents mipLevelExtents(static_cast<int>(mipWidth), static_cast<int>(mipHeight), 1);
 
+        // All the layers share one allocation.  Generating a level before staging the next one
+        // also makes sure the level is written before the staging buffer flushes it.
         ANGLE_TRY(mImage->stageSubresourceUpdateAndGetData(
             contextVk, mipAllocationSize,
-            gl::ImageIndex::MakeFromType(mState.getType(), currentMipLevel, layer), mipLevelExtents,
-            gl::Offset(), &destData));
+            gl::ImageIndex::MakeFromType(mState.getType(), currentMipLevel, 0, layerCount),
+            mipLevelExtents, gl::Offset(), &destData));
         onStagingBufferChange();
 
-        // Generate the mipmap into that new buffer
-        sourceFormat.mipGenerationFunction(previousLevelWidth, previousLevelHeight, 1,
-                                           previousLevelData, previousLevelRowPitch, 0, destData,
-                                           destRowPitch, 0);
+        // Generate the mipmap into that new buffer, with the layers spread over the worker threads
+        GenerateMipLayers(context->getWorkerThreadPool(), sourceFormat.mipGenerationFunction,
+                          previousLevelWidth, previousLevelHeight, layerCount, previousLevelData,
+                          previousLevelRowPitch, previousLevelRowPitch * previousLevelHeight,
+                          destData, destRowPitch, destRowPitch * mipHeight);
 
         // Swap for the next iteration
         previousLevelWidth    = mipWidth;
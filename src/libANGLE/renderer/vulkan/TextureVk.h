@@ -258,9 +258,9 @@ class TextureVk : public TextureImpl
 
     angle::Result generateMipmapsWithCPU(const gl::Context *context);
 
-    angle::Result generateMipmapLevelsWithCPU(ContextVk *contextVk,
+    angle::Result generateMipmapLevelsWithCPU(const gl::Context *context,
                                               const angle::Format &sourceFormat,
-                                              GLuint layer,
+                                              GLuint layerCount,
                                               GLuint firstMipLevel,
                                               GLuint maxMipLevel,
                                               size_t sourceWidth,
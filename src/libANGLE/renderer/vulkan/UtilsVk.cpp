@@ -19,6 +19,7 @@ namespace rx
 
 namespace BufferUtils_comp                = vk::InternalShader::BufferUtils_comp;
 namespace ConvertVertex_comp              = vk::InternalShader::ConvertVertex_comp;
+namespace EtcToRgba8_comp                 = vk::InternalShader::EtcToRgba8_comp;
 namespace ImageClear_frag                 = vk::InternalShader::ImageClear_frag;
 namespace ImageCopy_frag                  = vk::InternalShader::ImageCopy_frag;
 namespace BlitResolve_frag                = vk::InternalShader::BlitResolve_frag;
@@ -35,6 +36,8 @@ constexpr uint32_t kBufferClearOutputBinding                 = 0;
 constexpr uint32_t kConvertIndexDestinationBinding           = 0;
 constexpr uint32_t kConvertVertexDestinationBinding          = 0;
 constexpr uint32_t kConvertVertexSourceBinding               = 1;
+constexpr uint32_t kEtcToRgba8DestinationBinding             = 0;
+constexpr uint32_t kEtcToRgba8SourceBinding                  = 1;
 constexpr uint32_t kImageCopySourceBinding                   = 0;
 constexpr uint32_t kBlitResolveColorOrDepthBinding           = 0;
 constexpr uint32_t kBlitResolveStencilBinding                = 1;
@@ -343,6 +346,29 @@ uint32_t GetFormatDefaultChannelMask(const vk::Format &format)
     return mask;
 }
 
+bool GetEtcToRgba8Flags(GLenum compressedFormat, uint32_t *flagsOut)
+{
+    switch (compressedFormat)
+    {
+        // ETC1 is a subset of ETC2 RGB8, and sRGB is only a matter of how the image is sampled.
+        case GL_ETC1_RGB8_OES:
+        case GL_COMPRESSED_RGB8_ETC2:
+        case GL_COMPRESSED_SRGB8_ETC2:
+            *flagsOut = EtcToRgba8_comp::kETC2RGB8;
+            return true;
+        case GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_ETC2:
+        case GL_COMPRESSED_SRGB8_PUNCHTHROUGH_ALPHA1_ETC2:
+            *flagsOut = EtcToRgba8_comp::kETC2RGB8A1;
+            return true;
+        case GL_COMPRESSED_RGBA8_ETC2_EAC:
+        case GL_COMPRESSED_SRGB8_ALPHA8_ETC2_EAC:
+            *flagsOut = EtcToRgba8_comp::kETC2RGBA8;
+            return true;
+        default:
+            return false;
+    }
+}
+
 // Calculate the transformation offset for blit/resolve.  See BlitResolve.frag for details on how
 // these values are derived.
 void CalculateBlitOffset(const UtilsVk::BlitResolveParameters &params, float offset[2])
@@ -405,6 +431,10 @@ void UtilsVk::destroy(VkDevice device)
     {
         program.destroy(device);
     }
+    for (vk::ShaderProgramHelper &program : mEtcToRgba8Programs)
+    {
+        program.destroy(device);
+    }
     mImageClearProgramVSOnly.destroy(device);
     for (vk::ShaderProgramHelper &program : mImageClearProgram)
     {
@@ -588,6 +618,22 @@ angle::Result UtilsVk::ensureConvertVertexResourcesInitialized(ContextVk *contex
                                       ArraySize(setSizes), sizeof(ConvertVertexShaderParams));
 }
 
+angle::Result UtilsVk::ensureTranscodeEtcResourcesInitialized(ContextVk *contextVk)
+{
+    if (mPipelineLayouts[Function::TranscodeEtcToRgba8].valid())
+    {
+        return angle::Result::Continue;
+    }
+
+    VkDescriptorPoolSize setSizes[2] = {
+        {VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1},
+        {VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1},
+    };
+
+    return ensureResourcesInitialized(contextVk, Function::TranscodeEtcToRgba8, setSizes,
+                                      ArraySize(setSizes), sizeof(EtcToRgba8ShaderParams));
+}
+
 angle::Result UtilsVk::ensureImageClearResourcesInitialized(ContextVk *contextVk)
 {
     if (mPipelineLayouts[Function::ImageClear].valid())
@@ -1188,6 +1234,88 @@ angle::Result UtilsVk::convertVertexBuffer(ContextVk *contextVk,
     return angle::Result::Continue;
 }
 
+bool UtilsVk::IsTranscodeEtcSupported(GLenum compressedFormat)
+{
+    uint32_t flags;
+    return GetEtcToRgba8Flags(compressedFormat, &flags);
+}
+
+angle::Result UtilsVk::transcodeEtcToRgba8(ContextVk *contextVk,
+                                           vk::BufferHelper *dest,
+                                           vk::BufferHelper *src,
+                                           const TranscodeEtcParameters &params)
+{
+    ANGLE_TRY(ensureTranscodeEtcResourcesInitialized(contextVk));
+
+    uint32_t flags = 0;
+    if (!GetEtcToRgba8Flags(params.compressedFormat, &flags))
+    {
+        UNREACHABLE();
+    }
+
+    // The blocks are 8 or 16 bytes and the texels 4 bytes, so the shader indexes the buffers in
+    // words.
+    ASSERT(params.srcOffset % 4 == 0 && params.destOffset % 4 == 0);
+
+    vk::CommandBuffer *commandBuffer;
+
+    // The compressed blocks are typically staged in the same buffer as the decoded texels.
+    if (src == dest)
+    {
+        dest->onSelfReadWrite(contextVk, VK_ACCESS_SHADER_READ_BIT, VK_ACCESS_SHADER_WRITE_BIT);
+        ANGLE_TRY(dest->recordCommands(contextVk, &commandBuffer));
+    }
+    else
+    {
+        ANGLE_TRY(dest->recordCommands(contextVk, &commandBuffer));
+        src->onReadByBuffer(contextVk, dest, VK_ACCESS_SHADER_READ_BIT,
+                            VK_ACCESS_SHADER_WRITE_BIT);
+    }
+
+    EtcToRgba8ShaderParams shaderParams;
+    shaderParams.srcOffset  = static_cast<uint32_t>(params.srcOffset / 4);
+    shaderParams.destOffset = static_cast<uint32_t>(params.destOffset / 4);
+    shaderParams.blocksWide = params.blocksWide;
+    shaderParams.blockRows  = params.blockRows;
+
+    VkDescriptorSet descriptorSet;
+    vk::RefCountedDescriptorPoolBinding descriptorPoolBinding;
+    ANGLE_TRY(allocateDescriptorSet(contextVk, Function::TranscodeEtcToRgba8,
+                                    &descriptorPoolBinding, &descriptorSet));
+
+    VkWriteDescriptorSet writeInfo    = {};
+    VkDescriptorBufferInfo buffers[2] = {
+        {dest->getBuffer().getHandle(), 0, VK_WHOLE_SIZE},
+        {src->getBuffer().getHandle(), 0, VK_WHOLE_SIZE},
+    };
+    static_assert(kEtcToRgba8DestinationBinding + 1 == kEtcToRgba8SourceBinding,
+                  "Update write info");
+
+    writeInfo.sType           = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+    writeInfo.dstSet          = descriptorSet;
+    writeInfo.dstBinding      = kEtcToRgba8DestinationBinding;
+    writeInfo.descriptorCount = 2;
+    writeInfo.descriptorType  = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+    writeInfo.pBufferInfo     = buffers;
+
+    vkUpdateDescriptorSets(contextVk->getDevice(), 1, &writeInfo, 0, nullptr);
+
+    vk::RefCounted<vk::ShaderAndSerial> *shader = nullptr;
+    ANGLE_TRY(contextVk->getShaderLibrary().getEtcToRgba8_comp(contextVk, flags, &shader));
+
+    ANGLE_TRY(setupProgram(contextVk, Function::TranscodeEtcToRgba8, shader, nullptr,
+                           &mEtcToRgba8Programs[flags], nullptr, descriptorSet, &shaderParams,
+                           sizeof(shaderParams), commandBuffer));
+
+    // Each invocation decodes one block, in 8x8 workgroups.
+    commandBuffer->dispatch(UnsignedCeilDivide(params.blocksWide, 8),
+                            UnsignedCeilDivide(params.blockRows, 8), 1);
+
+    descriptorPoolBinding.reset();
+
+    return angle::Result::Continue;
+}
+
 angle::Result UtilsVk::startRenderPass(ContextVk *contextVk,
                                        vk::ImageHelper *image,
                                        const vk::ImageView *imageView,
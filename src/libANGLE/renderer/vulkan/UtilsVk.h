@@ -20,6 +20,8 @@
 //    - Depth/Stencil blit/resolve: Used by FramebufferVk::blit() to implement blit or multisample
 //      resolve on depth/stencil images.
 //    - Overlay Cull/Draw: Used by OverlayVk to efficiently draw a UI for debugging.
+//    - ETC transcode: Used by vk::ImageHelper::stageSubresourceUpdate() to decode large uploads to
+//      ETC textures that are emulated with RGBA8.
 //    - Mipmap generation: Not yet implemented
 //
 
@@ -87,6 +89,17 @@ class UtilsVk : angle::NonCopyable
         size_t destOffset;
     };
 
+    struct TranscodeEtcParameters
+    {
+        // The compressed format of the source blocks.
+        GLenum compressedFormat;
+        size_t srcOffset;
+        size_t destOffset;
+        // The size of the image in blocks.  The rows of blocks of all slices are counted together.
+        uint32_t blocksWide;
+        uint32_t blockRows;
+    };
+
     struct ClearFramebufferParameters
     {
         // Satisfy chromium-style with a constructor that does what = {} was already doing in a
@@ -188,6 +201,14 @@ class UtilsVk : angle::NonCopyable
                                       vk::BufferHelper *src,
                                       const ConvertVertexParameters &params);
 
+    // Whether transcodeEtcToRgba8 can decode the given compressed format.
+    static bool IsTranscodeEtcSupported(GLenum compressedFormat);
+    // Decodes the ETC blocks in |src| to RGBA8 texels in |dest|, padded to whole blocks.
+    angle::Result transcodeEtcToRgba8(ContextVk *contextVk,
+                                      vk::BufferHelper *dest,
+                                      vk::BufferHelper *src,
+                                      const TranscodeEtcParameters &params);
+
     angle::Result clearFramebuffer(ContextVk *contextVk,
                                    FramebufferVk *framebuffer,
                                    const ClearFramebufferParameters &params);
@@ -298,6 +319,15 @@ class UtilsVk : angle::NonCopyable
         uint32_t Ed             = 0;
     };
 
+    struct EtcToRgba8ShaderParams
+    {
+        // Structure matching PushConstants in EtcToRgba8.comp
+        uint32_t srcOffset  = 0;
+        uint32_t destOffset = 0;
+        uint32_t blocksWide = 0;
+        uint32_t blockRows  = 0;
+    };
+
     struct ImageClearShaderParams
     {
         // Structure matching PushConstants in ImageClear.frag
@@ -382,9 +412,10 @@ class UtilsVk : angle::NonCopyable
         ConvertIndexIndirectBuffer = 9,
         ConvertIndexIndirectLineLoopBuffer = 10,
         ConvertIndirectLineLoopBuffer      = 11,
+        TranscodeEtcToRgba8                = 12,
 
-        InvalidEnum = 12,
-        EnumCount   = 12,
+        InvalidEnum = 13,
+        EnumCount   = 13,
     };
 
     // Common function that creates the pipeline for the specified function, binds it and prepares
@@ -422,6 +453,7 @@ class UtilsVk : angle::NonCopyable
     angle::Result ensureConvertIndexIndirectLineLoopResourcesInitialized(ContextVk *contextVk);
     angle::Result ensureConvertIndirectLineLoopResourcesInitialized(ContextVk *contextVk);
     angle::Result ensureConvertVertexResourcesInitialized(ContextVk *contextVk);
+    angle::Result ensureTranscodeEtcResourcesInitialized(ContextVk *contextVk);
     angle::Result ensureImageClearResourcesInitialized(ContextVk *contextVk);
     angle::Result ensureImageCopyResourcesInitialized(ContextVk *contextVk);
     angle::Result ensureBlitResolveResourcesInitialized(ContextVk *contextVk);
@@ -465,6 +497,7 @@ class UtilsVk : angle::NonCopyable
         [vk::InternalShader::ConvertIndirectLineLoop_comp::kArrayLen];
     vk::ShaderProgramHelper
         mConvertVertexPrograms[vk::InternalShader::ConvertVertex_comp::kArrayLen];
+    vk::ShaderProgramHelper mEtcToRgba8Programs[vk::InternalShader::EtcToRgba8_comp::kArrayLen];
     vk::ShaderProgramHelper mImageClearProgramVSOnly;
     vk::ShaderProgramHelper mImageClearProgram[vk::InternalShader::ImageClear_frag::kArrayLen];
     vk::ShaderProgramHelper mImageCopyPrograms[vk::InternalShader::ImageCopy_frag::kArrayLen];
@@ -11,6 +11,7 @@
 #include "libANGLE/renderer/vulkan/vk_cache_utils.h"
 
 #include "common/aligned_memory.h"
+#include "common/third_party/xxhash/xxhash.h"
 #include "libANGLE/BlobCache.h"
 #include "libANGLE/VertexAttribute.h"
 #include "libANGLE/renderer/vulkan/FramebufferVk.h"
@@ -20,6 +21,7 @@
 #include "libANGLE/renderer/vulkan/vk_format_utils.h"
 #include "libANGLE/renderer/vulkan/vk_helpers.h"
 
+#include <algorithm>
 #include <type_traits>
 
 namespace rx
@@ -461,6 +463,15 @@ bool operator==(const RenderPassDesc &lhs, const RenderPassDesc &rhs)
     return (memcmp(&lhs, &rhs, sizeof(RenderPassDesc)) == 0);
 }
 
+angle::Result InitializeCompatibleRenderPass(Context *context,
+                                             const RenderPassDesc &desc,
+                                             RenderPass *renderPassOut)
+{
+    AttachmentOpsArray ops;
+    ops.initDummyOps(desc);
+    return InitializeRenderPassFromDesc(context, desc, ops, renderPassOut);
+}
+
 // GraphicsPipelineDesc implementation.
 // Use aligned allocation and free so we can use the alignas keyword.
 void *GraphicsPipelineDesc::operator new(std::size_t size)
@@ -608,7 +619,7 @@ void GraphicsPipelineDesc::initDefaults()
 }
 
 angle::Result GraphicsPipelineDesc::initializePipeline(
-    ContextVk *contextVk,
+    Context *context,
     const vk::PipelineCache &pipelineCacheVk,
     const RenderPass &compatibleRenderPass,
     const PipelineLayout &pipelineLayout,
@@ -699,7 +710,7 @@ angle::Result GraphicsPipelineDesc::initializePipeline(
 
         // Get the corresponding VkFormat for the attrib's format.
         angle::FormatID formatID         = static_cast<angle::FormatID>(packedAttrib.format);
-        const vk::Format &format         = contextVk->getRenderer()->getFormat(formatID);
+        const vk::Format &format         = context->getRenderer()->getFormat(formatID);
         const angle::Format &angleFormat = format.intendedFormat();
         VkFormat vkFormat                = format.vkBufferFormat;
 
@@ -795,7 +806,7 @@ angle::Result GraphicsPipelineDesc::initializePipeline(
     VkPipelineRasterizationLineStateCreateInfoEXT rasterLineState = {};
     rasterLineState.sType = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_LINE_STATE_CREATE_INFO_EXT;
     // Always enable Bresenham line rasterization if available.
-    if (contextVk->getFeatures().bresenhamLineRasterization.enabled)
+    if (context->getRenderer()->getFeatures().bresenhamLineRasterization.enabled)
     {
         rasterLineState.lineRasterizationMode = VK_LINE_RASTERIZATION_MODE_BRESENHAM_EXT;
         *pNextPtr                             = &rasterLineState;
@@ -806,7 +817,7 @@ angle::Result GraphicsPipelineDesc::initializePipeline(
     provokingVertexState.sType =
         VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_PROVOKING_VERTEX_STATE_CREATE_INFO_EXT;
     // Always set provoking vertex mode to last if available.
-    if (contextVk->getFeatures().provokingVertex.enabled)
+    if (context->getRenderer()->getFeatures().provokingVertex.enabled)
     {
         provokingVertexState.provokingVertexMode = VK_PROVOKING_VERTEX_MODE_LAST_VERTEX_EXT;
         *pNextPtr                                = &provokingVertexState;
@@ -894,8 +905,8 @@ angle::Result GraphicsPipelineDesc::initializePipeline(
     createInfo.basePipelineHandle  = VK_NULL_HANDLE;
     createInfo.basePipelineIndex   = 0;
 
-    ANGLE_VK_TRY(contextVk,
-                 pipelineOut->initGraphics(contextVk->getDevice(), createInfo, pipelineCacheVk));
+    ANGLE_VK_TRY(context,
+                 pipelineOut->initGraphics(context->getDevice(), createInfo, pipelineCacheVk));
     return angle::Result::Continue;
 }
 
@@ -1414,6 +1425,29 @@ void AttachmentOpsArray::initDummyOp(size_t index,
     SetBitField(ops.stencilStoreOp, VK_ATTACHMENT_STORE_OP_DONT_CARE);
 }
 
+void AttachmentOpsArray::initDummyOps(const RenderPassDesc &desc)
+{
+    uint32_t colorAttachmentCount = 0;
+    for (uint32_t colorIndexGL = 0; colorIndexGL < desc.colorAttachmentRange(); ++colorIndexGL)
+    {
+        if (!desc.isColorAttachmentEnabled(colorIndexGL))
+        {
+            continue;
+        }
+
+        uint32_t colorIndexVk = colorAttachmentCount++;
+        initDummyOp(colorIndexVk, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,
+                    VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL);
+    }
+
+    if (desc.hasDepthStencilAttachment())
+    {
+        uint32_t depthStencilIndexVk = colorAttachmentCount;
+        initDummyOp(depthStencilIndexVk, VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL,
+                    VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL);
+    }
+}
+
 void AttachmentOpsArray::initWithLoadStore(size_t index,
                                            VkImageLayout initialLayout,
                                            VkImageLayout finalLayout)
@@ -1605,6 +1639,48 @@ bool TextureDescriptorDesc::operator==(const TextureDescriptorDesc &other) const
     return memcmp(mSerials.data(), other.mSerials.data(), sizeof(TexUnitSerials) * mMaxIndex) == 0;
 }
 
+ShaderResourcesDescriptorDesc::ShaderResourcesDescriptorDesc()  = default;
+ShaderResourcesDescriptorDesc::~ShaderResourcesDescriptorDesc() = default;
+ShaderResourcesDescriptorDesc::ShaderResourcesDescriptorDesc(
+    const ShaderResourcesDescriptorDesc &other) = default;
+ShaderResourcesDescriptorDesc &ShaderResourcesDescriptorDesc::operator=(
+    const ShaderResourcesDescriptorDesc &other) = default;
+
+void ShaderResourcesDescriptorDesc::appendBuffer(Serial bufferSerial,
+                                                 VkDeviceSize offset,
+                                                 VkDeviceSize size)
+{
+    mPayload.push_back(bufferSerial.getValue());
+    mPayload.push_back(offset);
+    mPayload.push_back(size);
+}
+
+void ShaderResourcesDescriptorDesc::appendImage(Serial textureSerial,
+                                                uint32_t level,
+                                                uint32_t layer,
+                                                bool layered,
+                                                VkImageLayout layout)
+{
+    mPayload.push_back(textureSerial.getValue());
+    mPayload.push_back((static_cast<uint64_t>(level) << 32) | layer);
+    mPayload.push_back((static_cast<uint64_t>(layout) << 1) | (layered ? 1 : 0));
+}
+
+size_t ShaderResourcesDescriptorDesc::hash() const
+{
+    return angle::ComputeGenericHash(mPayload.data(), sizeof(uint64_t) * mPayload.size());
+}
+
+void ShaderResourcesDescriptorDesc::reset()
+{
+    mPayload.clear();
+}
+
+bool ShaderResourcesDescriptorDesc::operator==(const ShaderResourcesDescriptorDesc &other) const
+{
+    return mPayload == other.mPayload;
+}
+
 }  // namespace vk
 
 // RenderPassCache implementation.
@@ -1637,26 +1713,7 @@ angle::Result RenderPassCache::addRenderPass(ContextVk *contextVk,
     //
     // It would be nice to pre-populate the cache in the Renderer so we rarely miss here.
     vk::AttachmentOpsArray ops;
-
-    uint32_t colorAttachmentCount = 0;
-    for (uint32_t colorIndexGL = 0; colorIndexGL < desc.colorAttachmentRange(); ++colorIndexGL)
-    {
-        if (!desc.isColorAttachmentEnabled(colorIndexGL))
-        {
-            continue;
-        }
-
-        uint32_t colorIndexVk = colorAttachmentCount++;
-        ops.initDummyOp(colorIndexVk, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,
-                        VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL);
-    }
-
-    if (desc.hasDepthStencilAttachment())
-    {
-        uint32_t depthStencilIndexVk = colorAttachmentCount;
-        ops.initDummyOp(depthStencilIndexVk, VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL,
-                        VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL);
-    }
+    ops.initDummyOps(desc);
 
     return getRenderPassWithOps(contextVk, serial, desc, ops, renderPassOut);
 }
@@ -1750,11 +1807,18 @@ angle::Result GraphicsPipelineCache::insertPipeline(
     // This "if" is left here for the benefit of VulkanPipelineCachePerfTest.
     if (contextVk != nullptr)
     {
-        contextVk->getRenderer()->onNewGraphicsPipeline();
+        RendererVk *renderer = contextVk->getRenderer();
+        renderer->onNewGraphicsPipeline();
         ANGLE_TRY(desc.initializePipeline(contextVk, pipelineCacheVk, compatibleRenderPass,
                                           pipelineLayout, activeAttribLocationsMask,
                                           programAttribsTypeMask, vertexModule, fragmentModule,
                                           geometryModule, &newPipeline));
+
+        if (mPipelineLogKey != 0)
+        {
+            renderer->onGraphicsPipelineCreatedOnDemand();
+            renderer->getGraphicsPipelineLog().record(mPipelineLogKey, desc);
+        }
     }
 
     // The Serial will be updated outside of this query.
@@ -1776,6 +1840,164 @@ void GraphicsPipelineCache::populate(const vk::GraphicsPipelineDesc &desc, vk::P
     mPayload.emplace(desc, std::move(pipeline));
 }
 
+void GraphicsPipelineCache::populatePrewarmed(ContextVk *contextVk,
+                                              const vk::GraphicsPipelineDesc &desc,
+                                              vk::Pipeline &&pipeline)
+{
+    auto item = mPayload.find(desc);
+    if (item != mPayload.end())
+    {
+        contextVk->addGarbage(&pipeline);
+        return;
+    }
+
+    contextVk->getRenderer()->onNewGraphicsPipeline();
+
+    auto insertedItem = mPayload.emplace(desc, std::move(pipeline));
+    insertedItem.first->second.setPrewarmed(true);
+}
+
+void GraphicsPipelineCache::onPrewarmedPipelineUsed(ContextVk *contextVk,
+                                                    vk::PipelineHelper *pipeline)
+{
+    pipeline->setPrewarmed(false);
+
+    // VulkanPipelineCachePerfTest doesn't provide a context, but doesn't prewarm either.
+    ASSERT(contextVk != nullptr);
+    contextVk->getRenderer()->onPrewarmedGraphicsPipelineUsed();
+}
+
+// GraphicsPipelineLog implementation.
+namespace
+{
+constexpr uint32_t kGraphicsPipelineLogMagic   = 0x4C504E41;  // "ANPL"
+constexpr uint32_t kGraphicsPipelineLogVersion = 1;
+// Keeps the blob reasonably small.  Pipelines past this limit are simply not pre-warmed.
+constexpr size_t kMaxGraphicsPipelineLogSize = 2048;
+constexpr size_t kGraphicsPipelineLogRecordSize =
+    sizeof(uint64_t) + vk::kGraphicsPipelineDescSize;
+
+struct GraphicsPipelineLogHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t descSize;
+    uint32_t recordCount;
+    uint64_t checksum;
+};
+}  // anonymous namespace
+
+GraphicsPipelineLog::GraphicsPipelineLog() : mPipelineCount(0), mDirty(false) {}
+
+GraphicsPipelineLog::~GraphicsPipelineLog() = default;
+
+void GraphicsPipelineLog::deserialize(const uint8_t *data, size_t size)
+{
+    GraphicsPipelineLogHeader header;
+    if (size < sizeof(header))
+    {
+        return;
+    }
+    memcpy(&header, data, sizeof(header));
+
+    const uint8_t *records = data + sizeof(header);
+    size_t recordsSize     = size - sizeof(header);
+
+    if (header.magic != kGraphicsPipelineLogMagic ||
+        header.version != kGraphicsPipelineLogVersion ||
+        header.descSize != vk::kGraphicsPipelineDescSize ||
+        header.recordCount > kMaxGraphicsPipelineLogSize ||
+        recordsSize != header.recordCount * kGraphicsPipelineLogRecordSize ||
+        header.checksum != XXH64(records, recordsSize, kGraphicsPipelineLogMagic))
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    for (uint32_t recordIndex = 0; recordIndex < header.recordCount; ++recordIndex)
+    {
+        const uint8_t *record = records + recordIndex * kGraphicsPipelineLogRecordSize;
+
+        uint64_t programKey = 0;
+        vk::GraphicsPipelineDesc desc;
+        memcpy(&programKey, record, sizeof(programKey));
+        memcpy(&desc, record + sizeof(programKey), vk::kGraphicsPipelineDescSize);
+
+        mPipelines[programKey].push_back(desc);
+    }
+    mPipelineCount += header.recordCount;
+}
+
+bool GraphicsPipelineLog::serialize(angle::MemoryBuffer *dataOut)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    if (!mDirty)
+    {
+        return false;
+    }
+
+    if (!dataOut->resize(sizeof(GraphicsPipelineLogHeader) +
+                         mPipelineCount * kGraphicsPipelineLogRecordSize))
+    {
+        return false;
+    }
+
+    uint8_t *records = dataOut->data() + sizeof(GraphicsPipelineLogHeader);
+    uint8_t *record  = records;
+    for (const auto &programPipelines : mPipelines)
+    {
+        for (const vk::GraphicsPipelineDesc &desc : programPipelines.second)
+        {
+            memcpy(record, &programPipelines.first, sizeof(uint64_t));
+            memcpy(record + sizeof(uint64_t), &desc, vk::kGraphicsPipelineDescSize);
+            record += kGraphicsPipelineLogRecordSize;
+        }
+    }
+
+    size_t recordsSize = mPipelineCount * kGraphicsPipelineLogRecordSize;
+
+    GraphicsPipelineLogHeader header;
+    header.magic       = kGraphicsPipelineLogMagic;
+    header.version     = kGraphicsPipelineLogVersion;
+    header.descSize    = static_cast<uint32_t>(vk::kGraphicsPipelineDescSize);
+    header.recordCount = static_cast<uint32_t>(mPipelineCount);
+    header.checksum    = XXH64(records, recordsSize, kGraphicsPipelineLogMagic);
+    memcpy(dataOut->data(), &header, sizeof(header));
+
+    mDirty = false;
+    return true;
+}
+
+void GraphicsPipelineLog::record(uint64_t programKey, const vk::GraphicsPipelineDesc &desc)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    if (mPipelineCount >= kMaxGraphicsPipelineLogSize)
+    {
+        return;
+    }
+
+    std::vector<vk::GraphicsPipelineDesc> &descs = mPipelines[programKey];
+    if (std::find(descs.begin(), descs.end(), desc) != descs.end())
+    {
+        return;
+    }
+
+    descs.push_back(desc);
+    ++mPipelineCount;
+    mDirty = true;
+}
+
+void GraphicsPipelineLog::getPipelineDescs(uint64_t programKey,
+                                           std::vector<vk::GraphicsPipelineDesc> *descsOut) const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    auto iter = mPipelines.find(programKey);
+    if (iter != mPipelines.end())
+    {
+        *descsOut = iter->second;
+    }
+}
+
 // DescriptorSetLayoutCache implementation.
 DescriptorSetLayoutCache::DescriptorSetLayoutCache() = default;
 
@@ -11,8 +11,12 @@
 #ifndef LIBANGLE_RENDERER_VULKAN_VK_CACHE_UTILS_H_
 #define LIBANGLE_RENDERER_VULKAN_VK_CACHE_UTILS_H_
 
+#include <mutex>
+
 #include "common/Color.h"
+#include "common/FastVector.h"
 #include "common/FixedVector.h"
+#include "common/MemoryBuffer.h"
 #include "libANGLE/renderer/vulkan/vk_utils.h"
 
 namespace rx
@@ -148,6 +152,8 @@ class AttachmentOpsArray final
 
     // Initializes an attachment op with whatever values. Used for compatible RenderPass checks.
     void initDummyOp(size_t index, VkImageLayout initialLayout, VkImageLayout finalLayout);
+    // Initializes dummy ops for every attachment of |desc|.
+    void initDummyOps(const RenderPassDesc &desc);
     // Initialize an attachment op with all load and store operations.
     void initWithLoadStore(size_t index, VkImageLayout initialLayout, VkImageLayout finalLayout);
 
@@ -161,6 +167,12 @@ bool operator==(const AttachmentOpsArray &lhs, const AttachmentOpsArray &rhs);
 
 static_assert(sizeof(AttachmentOpsArray) == 20, "Size check failed");
 
+// Creates a render pass compatible with |desc| without going through RenderPassCache.  The cache
+// belongs to a context, so this is used when creating pipelines on a worker thread.
+angle::Result InitializeCompatibleRenderPass(Context *context,
+                                             const RenderPassDesc &desc,
+                                             RenderPass *renderPassOut);
+
 struct PackedAttribDesc final
 {
     uint8_t format;
@@ -354,7 +366,8 @@ class GraphicsPipelineDesc final
         return reinterpret_cast<const T *>(this);
     }
 
-    angle::Result initializePipeline(ContextVk *contextVk,
+    // Only uses the renderer through |context|, so it can be called from a worker thread.
+    angle::Result initializePipeline(Context *context,
                                      const vk::PipelineCache &pipelineCacheVk,
                                      const RenderPass &compatibleRenderPass,
                                      const PipelineLayout &pipelineLayout,
@@ -678,10 +691,16 @@ class PipelineHelper final : angle::NonCopyable
                        const GraphicsPipelineDesc *desc,
                        PipelineHelper *pipeline);
 
+    // Set on pipelines that were created ahead of time from the pipeline log, until their first
+    // use.
+    void setPrewarmed(bool prewarmed) { mPrewarmed = prewarmed; }
+    bool isPrewarmed() const { return mPrewarmed; }
+
   private:
     std::vector<GraphicsPipelineTransition> mTransitions;
     Serial mSerial;
     Pipeline mPipeline;
+    bool mPrewarmed = false;
 };
 
 ANGLE_INLINE PipelineHelper::PipelineHelper(Pipeline &&pipeline) : mPipeline(std::move(pipeline)) {}
@@ -713,6 +732,36 @@ class TextureDescriptorDesc
     };
     gl::ActiveTextureArray<TexUnitSerials> mSerials;
 };
+
+// The content of a shader resources descriptor set: the buffers bound to the uniform blocks,
+// storage blocks and atomic counter buffers, and the images bound to the image uniforms.  Buffers
+// and images are identified by serials that change when the underlying Vulkan objects do, so a
+// descriptor set written for a desc can be reused for as long as the desc is unchanged.
+class ShaderResourcesDescriptorDesc
+{
+  public:
+    ShaderResourcesDescriptorDesc();
+    ~ShaderResourcesDescriptorDesc();
+
+    ShaderResourcesDescriptorDesc(const ShaderResourcesDescriptorDesc &other);
+    ShaderResourcesDescriptorDesc &operator=(const ShaderResourcesDescriptorDesc &other);
+
+    // An unbound buffer is appended with an invalid serial.
+    void appendBuffer(Serial bufferSerial, VkDeviceSize offset, VkDeviceSize size);
+    void appendImage(Serial textureSerial,
+                     uint32_t level,
+                     uint32_t layer,
+                     bool layered,
+                     VkImageLayout layout);
+
+    size_t hash() const;
+    void reset();
+
+    bool operator==(const ShaderResourcesDescriptorDesc &other) const;
+
+  private:
+    angle::FastVector<uint64_t, 16> mPayload;
+};
 }  // namespace vk
 }  // namespace rx
 
@@ -754,6 +803,12 @@ struct hash<rx::vk::TextureDescriptorDesc>
 {
     size_t operator()(const rx::vk::TextureDescriptorDesc &key) const { return key.hash(); }
 };
+
+template <>
+struct hash<rx::vk::ShaderResourcesDescriptorDesc>
+{
+    size_t operator()(const rx::vk::ShaderResourcesDescriptorDesc &key) const { return key.hash(); }
+};
 }  // namespace std
 
 namespace rx
@@ -819,6 +874,16 @@ class GraphicsPipelineCache final : angle::NonCopyable
 
     void populate(const vk::GraphicsPipelineDesc &desc, vk::Pipeline &&pipeline);
 
+    // Adds a pipeline created ahead of time from the pipeline log.  If the pipeline was created on
+    // demand in the meantime, the new one is discarded.
+    void populatePrewarmed(ContextVk *contextVk,
+                           const vk::GraphicsPipelineDesc &desc,
+                           vk::Pipeline &&pipeline);
+
+    // Pipelines created on demand are recorded in the renderer's pipeline log under this key.  No
+    // recording is done if the key is 0, which is the case for internal shaders.
+    void setPipelineLogKey(uint64_t key) { mPipelineLogKey = key; }
+
     ANGLE_INLINE angle::Result getPipeline(ContextVk *contextVk,
                                            const vk::PipelineCache &pipelineCacheVk,
                                            const vk::RenderPass &compatibleRenderPass,
@@ -835,6 +900,11 @@ class GraphicsPipelineCache final : angle::NonCopyable
         auto item = mPayload.find(desc);
         if (item != mPayload.end())
         {
+            if (ANGLE_UNLIKELY(item->second.isPrewarmed()))
+            {
+                onPrewarmedPipelineUsed(contextVk, &item->second);
+            }
+
             *descPtrOut  = &item->first;
             *pipelineOut = &item->second;
             return angle::Result::Continue;
@@ -858,8 +928,38 @@ class GraphicsPipelineCache final : angle::NonCopyable
                                  const vk::GraphicsPipelineDesc &desc,
                                  const vk::GraphicsPipelineDesc **descPtrOut,
                                  vk::PipelineHelper **pipelineOut);
+    void onPrewarmedPipelineUsed(ContextVk *contextVk, vk::PipelineHelper *pipeline);
 
     std::unordered_map<vk::GraphicsPipelineDesc, vk::PipelineHelper> mPayload;
+    uint64_t mPipelineLogKey = 0;
+};
+
+// Records which graphics pipelines were created for each program, keyed by a hash of the program's
+// shader sources.  The log is persisted in the blob cache, so on the next run the pipelines a
+// program needs can be created on worker threads as soon as the program is linked, instead of on
+// first draw.  Access is synchronized, as the log is shared by all contexts of the renderer.
+class GraphicsPipelineLog final : angle::NonCopyable
+{
+  public:
+    GraphicsPipelineLog();
+    ~GraphicsPipelineLog();
+
+    // Loads the contents of a blob previously produced by serialize().  Blobs that don't validate
+    // are ignored.
+    void deserialize(const uint8_t *data, size_t size);
+
+    // Returns false if there's nothing new to write out since the last call.
+    bool serialize(angle::MemoryBuffer *dataOut);
+
+    void record(uint64_t programKey, const vk::GraphicsPipelineDesc &desc);
+    void getPipelineDescs(uint64_t programKey,
+                          std::vector<vk::GraphicsPipelineDesc> *descsOut) const;
+
+  private:
+    mutable std::mutex mMutex;
+    std::unordered_map<uint64_t, std::vector<vk::GraphicsPipelineDesc>> mPipelines;
+    size_t mPipelineCount;
+    bool mDirty;
 };
 
 class DescriptorSetLayoutCache final : angle::NonCopyable
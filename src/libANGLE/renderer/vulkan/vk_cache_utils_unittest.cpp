@@ -0,0 +1,95 @@
+//
+// Copyright 2019 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// vk_cache_utils_unittest.cpp: Unit tests for the Vulkan cache utilities that don't need a
+//   device.
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "libANGLE/renderer/vulkan/vk_cache_utils.h"
+
+namespace rx
+{
+namespace
+{
+constexpr uint64_t kProgramKey1 = 0x0123456789ABCDEFull;
+constexpr uint64_t kProgramKey2 = 0xFEDCBA9876543210ull;
+
+class GraphicsPipelineLogTest : public testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        mDescA.initDefaults();
+
+        mDescB.initDefaults();
+        mDescB.setCullMode(VK_CULL_MODE_BACK_BIT);
+
+        mDescC.initDefaults();
+        mDescC.setRasterizationSamples(4);
+    }
+
+    // Records three pipelines for two programs and serializes them.
+    void serializeLog(angle::MemoryBuffer *blobOut)
+    {
+        GraphicsPipelineLog log;
+        log.record(kProgramKey1, mDescA);
+        log.record(kProgramKey1, mDescB);
+        log.record(kProgramKey2, mDescC);
+        ASSERT_TRUE(log.serialize(blobOut));
+    }
+
+    vk::GraphicsPipelineDesc mDescA;
+    vk::GraphicsPipelineDesc mDescB;
+    vk::GraphicsPipelineDesc mDescC;
+};
+
+// Tests that the pipelines recorded for each program survive serialization.
+TEST_F(GraphicsPipelineLogTest, RoundTrip)
+{
+    angle::MemoryBuffer blob;
+    serializeLog(&blob);
+
+    GraphicsPipelineLog log;
+    log.deserialize(blob.data(), blob.size());
+
+    std::vector<vk::GraphicsPipelineDesc> descs;
+    log.getPipelineDescs(kProgramKey1, &descs);
+    ASSERT_EQ(2u, descs.size());
+    EXPECT_TRUE(descs[0] == mDescA);
+    EXPECT_TRUE(descs[1] == mDescB);
+
+    descs.clear();
+    log.getPipelineDescs(kProgramKey2, &descs);
+    ASSERT_EQ(1u, descs.size());
+    EXPECT_TRUE(descs[0] == mDescC);
+
+    // Nothing new was recorded since the log was loaded, so there's nothing to write out.
+    angle::MemoryBuffer unchangedBlob;
+    EXPECT_FALSE(log.serialize(&unchangedBlob));
+}
+
+// Tests that a truncated blob is ignored rather than partially loaded.
+TEST_F(GraphicsPipelineLogTest, TruncatedInput)
+{
+    angle::MemoryBuffer blob;
+    serializeLog(&blob);
+
+    for (size_t size : {static_cast<size_t>(0), static_cast<size_t>(8), blob.size() / 2,
+                        blob.size() - 1})
+    {
+        GraphicsPipelineLog log;
+        log.deserialize(blob.data(), size);
+
+        std::vector<vk::GraphicsPipelineDesc> descs;
+        log.getPipelineDescs(kProgramKey1, &descs);
+        log.getPipelineDescs(kProgramKey2, &descs);
+        EXPECT_TRUE(descs.empty()) << "size " << size;
+    }
+}
+}  // anonymous namespace
+}  // namespace rx
@@ -47,6 +47,10 @@ constexpr int kLineLoopDynamicIndirectBufferInitialSize = sizeof(VkDrawIndirectC
 // This is an arbitrary max. We can change this later if necessary.
 constexpr uint32_t kDefaultDescriptorPoolMaxSets = 128;
 
+// Uploads to emulated ETC textures that decode to at least this many bytes, i.e. 256x256 texels,
+// are decoded with a compute shader.  Smaller ones aren't worth the dispatch.
+constexpr size_t kTranscodeEtcWithComputeMinSize = 256 * 256 * 4;
+
 struct ImageMemoryBarrierData
 {
     // The Vk layout corresponding to the ImageLayout key.
@@ -1394,6 +1398,69 @@ void LineLoopHelper::Draw(uint32_t count, CommandBuffer *commandBuffer)
     commandBuffer->drawIndexed(count);
 }
 
+// BufferBacking implementation.
+BufferBacking::BufferBacking() : memoryPropertyFlags(0), size(0) {}
+
+BufferBacking::BufferBacking(BufferBacking &&other)
+    : use(std::move(other.use)),
+      buffer(std::move(other.buffer)),
+      allocation(std::move(other.allocation)),
+      memoryPropertyFlags(other.memoryPropertyFlags),
+      size(other.size)
+{}
+
+BufferBacking &BufferBacking::operator=(BufferBacking &&other)
+{
+    ASSERT(!valid());
+    use                 = std::move(other.use);
+    buffer              = std::move(other.buffer);
+    allocation          = std::move(other.allocation);
+    memoryPropertyFlags = other.memoryPropertyFlags;
+    size                = other.size;
+    return *this;
+}
+
+BufferBacking::~BufferBacking() = default;
+
+angle::Result BufferBacking::init(ContextVk *contextVk,
+                                  const VkBufferCreateInfo &createInfo,
+                                  VkMemoryPropertyFlags requestedMemoryPropertyFlags)
+{
+    ASSERT(!valid());
+
+    size = createInfo.size;
+    ANGLE_VK_TRY(contextVk, buffer.init(contextVk->getDevice(), createInfo));
+    ANGLE_TRY(AllocateBufferMemory(contextVk, requestedMemoryPropertyFlags, &memoryPropertyFlags,
+                                   nullptr, &buffer, &allocation));
+    use.init();
+
+    return angle::Result::Continue;
+}
+
+void BufferBacking::destroy(VkDevice device)
+{
+    buffer.destroy(device);
+    allocation.destroy(device);
+    if (use.valid())
+    {
+        use.release();
+    }
+}
+
+void BufferBacking::release(RendererVk *renderer)
+{
+    ASSERT(use.valid());
+
+    std::vector<GarbageObject> garbage;
+    CollectGarbage(&garbage, &buffer, &allocation);
+    renderer->collectGarbage(std::move(use), std::move(garbage));
+}
+
+bool BufferBacking::isInUse(ContextVk *contextVk) const
+{
+    return use.isCurrentlyInGraph() || contextVk->isSerialInUse(use.getSerial());
+}
+
 // BufferHelper implementation.
 BufferHelper::BufferHelper()
     : CommandGraphResource(CommandGraphResourceType::Buffer),
@@ -1411,7 +1478,6 @@ angle::Result BufferHelper::init(ContextVk *contextVk,
                                  const VkBufferCreateInfo &createInfo,
                                  VkMemoryPropertyFlags memoryPropertyFlags)
 {
-    // TODO: Remove with anglebug.com/2162: Vulkan: Implement device memory sub-allocation
     // Check if we have too many resources allocated already and need to free some before allocating
     // more and (possibly) exceeding the device's limits.
     if (contextVk->shouldFlush())
@@ -1419,30 +1485,71 @@ angle::Result BufferHelper::init(ContextVk *contextVk,
         ANGLE_TRY(contextVk->flushImpl(nullptr));
     }
 
-    mSize = createInfo.size;
+    mSize   = createInfo.size;
+    mSerial = contextVk->getRenderer()->issueBufferSerial();
     ANGLE_VK_TRY(contextVk, mBuffer.init(contextVk->getDevice(), createInfo));
     return AllocateBufferMemory(contextVk, memoryPropertyFlags, &mMemoryPropertyFlags, nullptr,
-                                &mBuffer, &mDeviceMemory);
+                                &mBuffer, &mAllocation);
 }
 
 void BufferHelper::destroy(VkDevice device)
 {
     unmap(device);
     mSize       = 0;
+    mSerial     = Serial();
     mViewFormat = nullptr;
 
     mBuffer.destroy(device);
     mBufferView.destroy(device);
-    mDeviceMemory.destroy(device);
+    mAllocation.destroy(device);
 }
 
 void BufferHelper::release(RendererVk *renderer)
 {
     unmap(renderer->getDevice());
     mSize       = 0;
+    mSerial     = Serial();
     mViewFormat = nullptr;
 
-    renderer->collectGarbageAndReinit(&mUse, &mBuffer, &mBufferView, &mDeviceMemory);
+    renderer->collectGarbageAndReinit(&mUse, &mBuffer, &mBufferView, &mAllocation);
+}
+
+void BufferHelper::swapBacking(RendererVk *renderer, BufferBacking *backing)
+{
+    ASSERT(valid() && backing->valid());
+    ASSERT(backing->size == mSize);
+
+    if (mBufferView.valid())
+    {
+        // The view goes to the garbage with a use of its own, as the buffer's goes with the buffer.
+        SharedResourceUse viewUse;
+        viewUse.set(mUse);
+
+        std::vector<GarbageObject> garbage;
+        CollectGarbage(&garbage, &mBufferView);
+        renderer->collectGarbage(std::move(viewUse), std::move(garbage));
+        mViewFormat = nullptr;
+    }
+
+    unmap(renderer->getDevice());
+
+    // Wrapped objects can only be moved into empty ones, so exchange through a temporary.
+    Buffer previousBuffer = std::move(mBuffer);
+    mBuffer               = std::move(backing->buffer);
+    backing->buffer       = std::move(previousBuffer);
+
+    Allocation previousAllocation = std::move(mAllocation);
+    mAllocation                   = std::move(backing->allocation);
+    backing->allocation           = std::move(previousAllocation);
+
+    std::swap(mUse, backing->use);
+    std::swap(mMemoryPropertyFlags, backing->memoryPropertyFlags);
+    mSerial = renderer->issueBufferSerial();
+
+    // The new buffer isn't used by any recorded command.  Since its use isn't in the graph, the
+    // dependencies on the nodes that used the previous buffer are dropped on next access.
+    mCurrentWriteAccess = 0;
+    mCurrentReadAccess  = 0;
 }
 
 bool BufferHelper::needsOnWriteBarrier(VkAccessFlags readAccessType,
@@ -1536,17 +1643,14 @@ angle::Result BufferHelper::initBufferView(ContextVk *contextVk, const Format &f
 
 angle::Result BufferHelper::mapImpl(ContextVk *contextVk)
 {
-    ANGLE_VK_TRY(contextVk, mDeviceMemory.map(contextVk->getDevice(), 0, mSize, 0, &mMappedMemory));
+    ANGLE_VK_TRY(contextVk, mAllocation.map(0, &mMappedMemory));
     return angle::Result::Continue;
 }
 
 void BufferHelper::unmap(VkDevice device)
 {
-    if (mMappedMemory)
-    {
-        mDeviceMemory.unmap(device);
-        mMappedMemory = nullptr;
-    }
+    // The allocation keeps host-visible memory mapped until it's freed.
+    mMappedMemory = nullptr;
 }
 
 angle::Result BufferHelper::flush(ContextVk *contextVk, VkDeviceSize offset, VkDeviceSize size)
@@ -1555,12 +1659,7 @@ angle::Result BufferHelper::flush(ContextVk *contextVk, VkDeviceSize offset, VkD
     bool hostCoherent = mMemoryPropertyFlags & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
     if (hostVisible && !hostCoherent)
     {
-        VkMappedMemoryRange range = {};
-        range.sType               = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
-        range.memory              = mDeviceMemory.getHandle();
-        range.offset              = offset;
-        range.size                = size;
-        ANGLE_VK_TRY(contextVk, vkFlushMappedMemoryRanges(contextVk->getDevice(), 1, &range));
+        ANGLE_VK_TRY(contextVk, mAllocation.flush(offset, size));
     }
     return angle::Result::Continue;
 }
@@ -1571,12 +1670,7 @@ angle::Result BufferHelper::invalidate(ContextVk *contextVk, VkDeviceSize offset
     bool hostCoherent = mMemoryPropertyFlags & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
     if (hostVisible && !hostCoherent)
     {
-        VkMappedMemoryRange range = {};
-        range.sType               = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
-        range.memory              = mDeviceMemory.getHandle();
-        range.offset              = offset;
-        range.size                = size;
-        ANGLE_VK_TRY(contextVk, vkInvalidateMappedMemoryRanges(contextVk->getDevice(), 1, &range));
+        ANGLE_VK_TRY(contextVk, mAllocation.invalidate(offset, size));
     }
     return angle::Result::Continue;
 }
@@ -1597,7 +1691,7 @@ ImageHelper::ImageHelper()
 ImageHelper::ImageHelper(ImageHelper &&other)
     : CommandGraphResource(CommandGraphResourceType::Image),
       mImage(std::move(other.mImage)),
-      mDeviceMemory(std::move(other.mDeviceMemory)),
+      mAllocation(std::move(other.mAllocation)),
       mExtents(other.mExtents),
       mFormat(other.mFormat),
       mSamples(other.mSamples),
@@ -1704,7 +1798,7 @@ angle::Result ImageHelper::initExternal(Context *context,
 
 void ImageHelper::releaseImage(RendererVk *renderer)
 {
-    renderer->collectGarbageAndReinit(&mUse, &mImage, &mDeviceMemory);
+    renderer->collectGarbageAndReinit(&mUse, &mImage, &mAllocation);
 }
 
 void ImageHelper::releaseStagingBuffer(RendererVk *renderer)
@@ -1727,8 +1821,7 @@ angle::Result ImageHelper::initMemory(Context *context,
                                       const MemoryProperties &memoryProperties,
                                       VkMemoryPropertyFlags flags)
 {
-    // TODO(jmadill): Memory sub-allocation. http://anglebug.com/2162
-    ANGLE_TRY(AllocateImageMemory(context, flags, nullptr, &mImage, &mDeviceMemory));
+    ANGLE_TRY(AllocateImageMemory(context, flags, nullptr, &mImage, &mAllocation));
     mCurrentQueueFamilyIndex = context->getRenderer()->getQueueFamilyIndex();
     return angle::Result::Continue;
 }
@@ -1741,9 +1834,9 @@ angle::Result ImageHelper::initExternalMemory(Context *context,
 
                                               VkMemoryPropertyFlags flags)
 {
-    // TODO(jmadill): Memory sub-allocation. http://anglebug.com/2162
+    // External memory is imported into a dedicated allocation.
     ANGLE_TRY(AllocateImageMemoryWithRequirements(context, flags, memoryRequirements,
-                                                  extraAllocationInfo, &mImage, &mDeviceMemory));
+                                                  extraAllocationInfo, &mImage, &mAllocation));
     mCurrentQueueFamilyIndex = currentQueueFamilyIndex;
     return angle::Result::Continue;
 }
@@ -1803,7 +1896,7 @@ angle::Result ImageHelper::initLayerImageView(Context *context,
 void ImageHelper::destroy(VkDevice device)
 {
     mImage.destroy(device);
-    mDeviceMemory.destroy(device);
+    mAllocation.destroy(device);
     mStagingBuffer.destroy(device);
     mCurrentLayout = ImageLayout::Undefined;
     mLayerCount    = 0;
@@ -2202,7 +2295,7 @@ void ImageHelper::removeStagedUpdates(ContextVk *contextVk, const gl::ImageIndex
     }
 }
 
-angle::Result ImageHelper::stageSubresourceUpdate(ContextVk *contextVk,
+angle::Result ImageHelper::stageSubresourceUpdate(const gl::Context *context,
                                                   const gl::ImageIndex &index,
                                                   const gl::Extents &glExtents,
                                                   const gl::Offset &offset,
@@ -2212,6 +2305,8 @@ angle::Result ImageHelper::stageSubresourceUpdate(ContextVk *contextVk,
                                                   const uint8_t *pixels,
                                                   const Format &vkFormat)
 {
+    ContextVk *contextVk = GetImpl(context);
+
     GLuint inputRowPitch = 0;
     ANGLE_VK_CHECK_MATH(contextVk,
                         formatInfo.computeRowPitch(type, glExtents.width, unpack.alignment,
@@ -2327,6 +2422,30 @@ angle::Result ImageHelper::stageSubresourceUpdate(ContextVk *contextVk,
         }
     }
 
+    // Large uploads to ETC textures that are emulated with RGBA8 are decoded with a compute
+    // shader, so only the compressed blocks are copied here.  They are staged after the decoded
+    // texels, which are padded to whole blocks.
+    size_t compressedRowPitch = 0;
+    if (loadFunctionInfo.requiresConversion && formatInfo.compressed && !storageFormat.isBlock &&
+        allocationSize >= kTranscodeEtcWithComputeMinSize &&
+        contextVk->getRenderer()->getFeatures().transcodeEtcWithCompute.enabled &&
+        UtilsVk::IsTranscodeEtcSupported(formatInfo.internalFormat))
+    {
+        ASSERT(storageFormat.pixelBytes == 4 && stencilAllocationSize == 0);
+
+        bufferRowLength   = roundUp<uint32_t>(glExtents.width, formatInfo.compressedBlockWidth);
+        bufferImageHeight = roundUp<uint32_t>(glExtents.height, formatInfo.compressedBlockHeight);
+        outputDepthPitch  = bufferRowLength * bufferImageHeight * storageFormat.pixelBytes;
+
+        // For compressed formats, pixelBytes is the size of a block.
+        compressedRowPitch =
+            (bufferRowLength / formatInfo.compressedBlockWidth) * formatInfo.pixelBytes;
+        size_t compressedDepthPitch =
+            compressedRowPitch * (bufferImageHeight / formatInfo.compressedBlockHeight);
+
+        allocationSize = (outputDepthPitch + compressedDepthPitch) * glExtents.depth;
+    }
+
     VkBuffer bufferHandle = VK_NULL_HANDLE;
 
     uint8_t *stagingPointer    = nullptr;
@@ -2336,9 +2455,53 @@ angle::Result ImageHelper::stageSubresourceUpdate(ContextVk *contextVk,
 
     const uint8_t *source = pixels + static_cast<ptrdiff_t>(inputSkipBytes);
 
-    loadFunctionInfo.loadFunction(glExtents.width, glExtents.height, glExtents.depth, source,
-                                  inputRowPitch, inputDepthPitch, stagingPointer, outputRowPitch,
-                                  outputDepthPitch);
+    if (compressedRowPitch > 0)
+    {
+        const uint32_t blocksHigh     = bufferImageHeight / formatInfo.compressedBlockHeight;
+        const size_t compressedOffset = outputDepthPitch * glExtents.depth;
+
+        uint8_t *compressedPointer = stagingPointer + compressedOffset;
+        for (GLint z = 0; z < glExtents.depth; ++z)
+        {
+            for (uint32_t blockRow = 0; blockRow < blocksHigh; ++blockRow)
+            {
+                memcpy(compressedPointer, source + z * inputDepthPitch + blockRow * inputRowPitch,
+                       compressedRowPitch);
+                compressedPointer += compressedRowPitch;
+            }
+        }
+
+        // The shader reads the blocks before the staged updates are flushed.
+        ANGLE_TRY(mStagingBuffer.flush(contextVk));
+
+        UtilsVk::TranscodeEtcParameters params;
+        params.compressedFormat = formatInfo.internalFormat;
+        params.srcOffset        = stagingOffset + compressedOffset;
+        params.destOffset       = stagingOffset;
+        params.blocksWide       = bufferRowLength / formatInfo.compressedBlockWidth;
+        params.blockRows        = blocksHigh * glExtents.depth;
+
+        BufferHelper *stagingBuffer = mStagingBuffer.getCurrentBuffer();
+        ANGLE_TRY(contextVk->getUtils().transcodeEtcToRgba8(contextVk, stagingBuffer,
+                                                            stagingBuffer, params));
+    }
+    else if (loadFunctionInfo.requiresConversion)
+    {
+        // Compressed data, such as ETC textures decoded on upload, is split at block rows.
+        size_t inputBlockHeight = formatInfo.compressed ? formatInfo.compressedBlockHeight : 1;
+        size_t outputBlockHeight =
+            storageFormat.isBlock ? vkFormat.getInternalFormatInfo(type).compressedBlockHeight : 1;
+        LoadImageInStripes(context->getWorkerThreadPool(), loadFunctionInfo.loadFunction,
+                           glExtents.width, glExtents.height, glExtents.depth, inputBlockHeight,
+                           outputBlockHeight, source, inputRowPitch, inputDepthPitch,
+                           stagingPointer, outputRowPitch, outputDepthPitch);
+    }
+    else
+    {
+        loadFunctionInfo.loadFunction(glExtents.width, glExtents.height, glExtents.depth, source,
+                                      inputRowPitch, inputDepthPitch, stagingPointer,
+                                      outputRowPitch, outputDepthPitch);
+    }
 
     VkBufferImageCopy copy         = {};
     VkImageAspectFlags aspectFlags = GetFormatAspectFlags(vkFormat.actualImageFormat());
@@ -2802,7 +2965,9 @@ angle::Result ImageHelper::flushStagedUpdates(ContextVk *contextVk,
 
             BufferHelper *currentBuffer = bufferUpdate.bufferHelper;
             ASSERT(currentBuffer && currentBuffer->valid());
-            currentBuffer->onGraphAccess(contextVk->getCommandGraph());
+            // The buffer may have been written by a compute shader, e.g. when decoding ETC
+            // textures, which the copy must wait for.
+            currentBuffer->onRead(contextVk, this, VK_ACCESS_TRANSFER_READ_BIT);
 
             commandBuffer->copyBufferToImage(currentBuffer->getBuffer().getHandle(), mImage,
                                              getCurrentLayout(), 1, &update.buffer.copyRegion);
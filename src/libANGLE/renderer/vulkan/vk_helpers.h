@@ -31,8 +31,10 @@ constexpr size_t kVertexBufferAlignment   = 4;
 constexpr size_t kIndexBufferAlignment    = 4;
 constexpr size_t kIndirectBufferAlignment = 4;
 
-constexpr VkBufferUsageFlags kStagingBufferFlags =
-    VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+// Staged ETC texture data may be decoded by a compute shader, see UtilsVk::transcodeEtcToRgba8.
+constexpr VkBufferUsageFlags kStagingBufferFlags = VK_BUFFER_USAGE_TRANSFER_SRC_BIT |
+                                                   VK_BUFFER_USAGE_TRANSFER_DST_BIT |
+                                                   VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
 constexpr size_t kStagingBufferSize = 1024 * 16;
 
 struct TextureUnit final
@@ -456,6 +458,32 @@ class LineLoopHelper final : angle::NonCopyable
 
 class FramebufferHelper;
 
+// A buffer and its memory taken out of a BufferHelper, along with the tracking of the GPU's use of
+// them.  BufferVk keeps a few of these to stream updates to a buffer that's in use through new
+// memory rather than waiting for the GPU.
+struct BufferBacking final : angle::NonCopyable
+{
+    BufferBacking();
+    BufferBacking(BufferBacking &&other);
+    BufferBacking &operator=(BufferBacking &&other);
+    ~BufferBacking();
+
+    angle::Result init(ContextVk *contextVk,
+                       const VkBufferCreateInfo &createInfo,
+                       VkMemoryPropertyFlags requestedMemoryPropertyFlags);
+    void destroy(VkDevice device);
+    void release(RendererVk *renderer);
+
+    bool valid() const { return buffer.valid(); }
+    bool isInUse(ContextVk *contextVk) const;
+
+    SharedResourceUse use;
+    Buffer buffer;
+    Allocation allocation;
+    VkMemoryPropertyFlags memoryPropertyFlags;
+    VkDeviceSize size;
+};
+
 class BufferHelper final : public CommandGraphResource
 {
   public:
@@ -469,11 +497,21 @@ class BufferHelper final : public CommandGraphResource
 
     void release(RendererVk *renderer);
 
+    // Exchanges the buffer and its memory with |backing|, which must be of the same size and not
+    // in use by the GPU.  Commands already recorded keep using the previous buffer, which is
+    // returned in |backing| with its use so it can be recycled once the GPU is done with it.  The
+    // buffer view, if any, is released.
+    void swapBacking(RendererVk *renderer, BufferBacking *backing);
+
     bool valid() const { return mBuffer.valid(); }
     const Buffer &getBuffer() const { return mBuffer; }
-    const DeviceMemory &getDeviceMemory() const { return mDeviceMemory; }
+    const Allocation &getAllocation() const { return mAllocation; }
     VkDeviceSize getSize() const { return mSize; }
 
+    // Identifies the VkBuffer.  A new serial is issued whenever the buffer is created or its
+    // backing is swapped, which invalidates descriptor sets cached for the previous one.
+    Serial getSerial() const { return mSerial; }
+
     // Helpers for setting the graph dependencies *and* setting the appropriate barrier.  These are
     // made for dependencies to non-buffer resources, as only one of two resources participating in
     // the dependency would require a memory barrier.  Note that onWrite takes read access flags
@@ -519,6 +557,10 @@ class BufferHelper final : public CommandGraphResource
     // graph resource to create a dependency to.
     void onExternalWrite(VkAccessFlags writeAccessType) { mCurrentWriteAccess |= writeAccessType; }
 
+    // Returns true if writes by the GPU are tracked for the buffer, in which case its memory may
+    // not hold the latest contents until the GPU is done with it.
+    bool hasDeviceWrites() const { return (mCurrentWriteAccess & ~VK_ACCESS_HOST_WRITE_BIT) != 0; }
+
     // Also implicitly sets up the correct barriers.
     angle::Result copyFromBuffer(ContextVk *contextVk,
                                  const Buffer &buffer,
@@ -593,11 +635,12 @@ class BufferHelper final : public CommandGraphResource
     // Vulkan objects.
     Buffer mBuffer;
     BufferView mBufferView;
-    DeviceMemory mDeviceMemory;
+    Allocation mAllocation;
 
     // Cached properties.
     VkMemoryPropertyFlags mMemoryPropertyFlags;
     VkDeviceSize mSize;
+    Serial mSerial;
     uint8_t *mMappedMemory;
     const Format *mViewFormat;
 
@@ -740,7 +783,7 @@ class ImageHelper final : public CommandGraphResource
     void resetImageWeakReference();
 
     const Image &getImage() const { return mImage; }
-    const DeviceMemory &getDeviceMemory() const { return mDeviceMemory; }
+    const Allocation &getAllocation() const { return mAllocation; }
 
     const VkExtent3D &getExtents() const { return mExtents; }
     uint32_t getLayerCount() const { return mLayerCount; }
@@ -781,7 +824,7 @@ class ImageHelper final : public CommandGraphResource
     // Data staging
     void removeStagedUpdates(ContextVk *contextVk, const gl::ImageIndex &index);
 
-    angle::Result stageSubresourceUpdate(ContextVk *contextVk,
+    angle::Result stageSubresourceUpdate(const gl::Context *context,
                                          const gl::ImageIndex &index,
                                          const gl::Extents &glExtents,
                                          const gl::Offset &offset,
@@ -999,7 +1042,7 @@ class ImageHelper final : public CommandGraphResource
 
     // Vulkan objects.
     Image mImage;
-    DeviceMemory mDeviceMemory;
+    Allocation mAllocation;
 
     // Image properties.
     VkExtent3D mExtents;
@@ -1167,6 +1210,20 @@ class ShaderProgramHelper : angle::NonCopyable
 
     void setShader(gl::ShaderType shaderType, RefCounted<ShaderAndSerial> *shader);
 
+    // Returns nullptr if the program doesn't have a shader of this type.
+    const ShaderModule *getShaderModule(gl::ShaderType shaderType) const
+    {
+        return mShaders[shaderType].valid() ? &mShaders[shaderType].get().get() : nullptr;
+    }
+
+    void setGraphicsPipelineLogKey(uint64_t key) { mGraphicsPipelines.setPipelineLogKey(key); }
+    void populatePrewarmedGraphicsPipeline(ContextVk *contextVk,
+                                           const GraphicsPipelineDesc &desc,
+                                           Pipeline &&pipeline)
+    {
+        mGraphicsPipelines.populatePrewarmed(contextVk, desc, std::move(pipeline));
+    }
+
     // For getting a Pipeline and from the pipeline cache.
     ANGLE_INLINE angle::Result getGraphicsPipeline(
         ContextVk *contextVk,
@@ -1186,13 +1243,9 @@ class ShaderProgramHelper : angle::NonCopyable
                                                            pipelineDesc.getRenderPassDesc(),
                                                            &compatibleRenderPass));
 
-        ShaderModule *vertexShader   = &mShaders[gl::ShaderType::Vertex].get().get();
-        ShaderModule *fragmentShader = mShaders[gl::ShaderType::Fragment].valid()
-                                           ? &mShaders[gl::ShaderType::Fragment].get().get()
-                                           : nullptr;
-        ShaderModule *geometryShader = mShaders[gl::ShaderType::Geometry].valid()
-                                           ? &mShaders[gl::ShaderType::Geometry].get().get()
-                                           : nullptr;
+        const ShaderModule *vertexShader   = getShaderModule(gl::ShaderType::Vertex);
+        const ShaderModule *fragmentShader = getShaderModule(gl::ShaderType::Fragment);
+        const ShaderModule *geometryShader = getShaderModule(gl::ShaderType::Geometry);
 
         return mGraphicsPipelines.getPipeline(
             contextVk, pipelineCache, *compatibleRenderPass, pipelineLayout,
@@ -107,6 +107,9 @@ namespace
 #include "libANGLE/renderer/vulkan/shaders/gen/ConvertVertex.comp.00000029.inc"
 #include "libANGLE/renderer/vulkan/shaders/gen/ConvertVertex.comp.0000002A.inc"
 #include "libANGLE/renderer/vulkan/shaders/gen/ConvertVertex.comp.0000002B.inc"
+#include "libANGLE/renderer/vulkan/shaders/gen/EtcToRgba8.comp.00000000.inc"
+#include "libANGLE/renderer/vulkan/shaders/gen/EtcToRgba8.comp.00000001.inc"
+#include "libANGLE/renderer/vulkan/shaders/gen/EtcToRgba8.comp.00000002.inc"
 #include "libANGLE/renderer/vulkan/shaders/gen/FullScreenQuad.vert.00000000.inc"
 #include "libANGLE/renderer/vulkan/shaders/gen/ImageClear.frag.00000000.inc"
 #include "libANGLE/renderer/vulkan/shaders/gen/ImageClear.frag.00000001.inc"
@@ -273,6 +276,11 @@ constexpr ShaderBlob kConvertVertex_comp_shaders[] = {
     {kConvertVertex_comp_0000002A, sizeof(kConvertVertex_comp_0000002A)},
     {kConvertVertex_comp_0000002B, sizeof(kConvertVertex_comp_0000002B)},
 };
+constexpr ShaderBlob kEtcToRgba8_comp_shaders[] = {
+    {kEtcToRgba8_comp_00000000, sizeof(kEtcToRgba8_comp_00000000)},
+    {kEtcToRgba8_comp_00000001, sizeof(kEtcToRgba8_comp_00000001)},
+    {kEtcToRgba8_comp_00000002, sizeof(kEtcToRgba8_comp_00000002)},
+};
 constexpr ShaderBlob kFullScreenQuad_vert_shaders[] = {
     {kFullScreenQuad_vert_00000000, sizeof(kFullScreenQuad_vert_00000000)},
 };
@@ -397,6 +405,10 @@ void ShaderLibrary::destroy(VkDevice device)
     {
         shader.get().destroy(device);
     }
+    for (RefCounted<ShaderAndSerial> &shader : mEtcToRgba8_comp_shaders)
+    {
+        shader.get().destroy(device);
+    }
     for (RefCounted<ShaderAndSerial> &shader : mFullScreenQuad_vert_shaders)
     {
         shader.get().destroy(device);
@@ -481,6 +493,14 @@ angle::Result ShaderLibrary::getConvertVertex_comp(Context *context,
                      ArraySize(kConvertVertex_comp_shaders), shaderFlags, shaderOut);
 }
 
+angle::Result ShaderLibrary::getEtcToRgba8_comp(Context *context,
+                                                uint32_t shaderFlags,
+                                                RefCounted<ShaderAndSerial> **shaderOut)
+{
+    return GetShader(context, mEtcToRgba8_comp_shaders, kEtcToRgba8_comp_shaders,
+                     ArraySize(kEtcToRgba8_comp_shaders), shaderFlags, shaderOut);
+}
+
 angle::Result ShaderLibrary::getFullScreenQuad_vert(Context *context,
                                                     uint32_t shaderFlags,
                                                     RefCounted<ShaderAndSerial> **shaderOut)
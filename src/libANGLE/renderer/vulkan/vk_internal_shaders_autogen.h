@@ -126,6 +126,17 @@ enum Conversion
 constexpr size_t kArrayLen = 0x0000002C;
 }  // namespace ConvertVertex_comp
 
+namespace EtcToRgba8_comp
+{
+enum Format
+{
+    kETC2RGB8   = 0x00000000,
+    kETC2RGB8A1 = 0x00000001,
+    kETC2RGBA8  = 0x00000002,
+};
+constexpr size_t kArrayLen = 0x00000003;
+}  // namespace EtcToRgba8_comp
+
 namespace FullScreenQuad_vert
 {
 constexpr size_t kArrayLen = 0x00000001;
@@ -231,6 +242,9 @@ class ShaderLibrary final : angle::NonCopyable
     angle::Result getConvertVertex_comp(Context *context,
                                         uint32_t shaderFlags,
                                         RefCounted<ShaderAndSerial> **shaderOut);
+    angle::Result getEtcToRgba8_comp(Context *context,
+                                     uint32_t shaderFlags,
+                                     RefCounted<ShaderAndSerial> **shaderOut);
     angle::Result getFullScreenQuad_vert(Context *context,
                                          uint32_t shaderFlags,
                                          RefCounted<ShaderAndSerial> **shaderOut);
@@ -262,6 +276,8 @@ class ShaderLibrary final : angle::NonCopyable
         [InternalShader::ConvertIndirectLineLoop_comp::kArrayLen];
     RefCounted<ShaderAndSerial>
         mConvertVertex_comp_shaders[InternalShader::ConvertVertex_comp::kArrayLen];
+    RefCounted<ShaderAndSerial>
+        mEtcToRgba8_comp_shaders[InternalShader::EtcToRgba8_comp::kArrayLen];
     RefCounted<ShaderAndSerial>
         mFullScreenQuad_vert_shaders[InternalShader::FullScreenQuad_vert::kArrayLen];
     RefCounted<ShaderAndSerial>
@@ -0,0 +1,542 @@
+//
+// Copyright 2019 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// vk_memory_allocator:
+//    Sub-allocates buffer and image memory out of large VkDeviceMemory blocks.
+//
+
+#include "libANGLE/renderer/vulkan/vk_memory_allocator.h"
+
+#include <algorithm>
+
+#include "common/debug.h"
+#include "common/mathutil.h"
+
+namespace rx
+{
+namespace vk
+{
+namespace
+{
+size_t GetBlockListIndex(uint32_t memoryTypeIndex, MemoryResourceType resourceType)
+{
+    return memoryTypeIndex * static_cast<size_t>(MemoryResourceType::EnumCount) +
+           static_cast<size_t>(resourceType);
+}
+
+VkDeviceSize RoundDownPow2(VkDeviceSize value)
+{
+    ASSERT(value > 0);
+    VkDeviceSize result = 1;
+    while (result <= value / 2)
+    {
+        result *= 2;
+    }
+    return result;
+}
+}  // anonymous namespace
+
+// DeviceMemoryBackend implementation.
+DeviceMemoryBackend::DeviceMemoryBackend(VkDevice device) : mDevice(device) {}
+
+DeviceMemoryBackend::~DeviceMemoryBackend() = default;
+
+VkResult DeviceMemoryBackend::allocate(const VkMemoryAllocateInfo &allocInfo,
+                                       VkDeviceMemory *memoryOut)
+{
+    return vkAllocateMemory(mDevice, &allocInfo, nullptr, memoryOut);
+}
+
+void DeviceMemoryBackend::free(VkDeviceMemory memory)
+{
+    vkFreeMemory(mDevice, memory, nullptr);
+}
+
+VkResult DeviceMemoryBackend::map(VkDeviceMemory memory, uint8_t **mapPointerOut)
+{
+    return vkMapMemory(mDevice, memory, 0, VK_WHOLE_SIZE, 0,
+                       reinterpret_cast<void **>(mapPointerOut));
+}
+
+VkResult DeviceMemoryBackend::flush(const VkMappedMemoryRange &range)
+{
+    return vkFlushMappedMemoryRanges(mDevice, 1, &range);
+}
+
+VkResult DeviceMemoryBackend::invalidate(const VkMappedMemoryRange &range)
+{
+    return vkInvalidateMappedMemoryRanges(mDevice, 1, &range);
+}
+
+// Allocation implementation.
+void Allocation::destroy(VkDevice device)
+{
+    if (valid())
+    {
+        DestroyHandle(mHandle);
+        mHandle = VK_NULL_HANDLE;
+    }
+}
+
+// static
+void Allocation::DestroyHandle(AllocationRecord *handle)
+{
+    ASSERT(handle != nullptr);
+    handle->allocator->free(handle);
+}
+
+VkResult Allocation::map(VkDeviceSize offset, uint8_t **mapPointer) const
+{
+    ASSERT(valid() && offset <= mHandle->size);
+    uint8_t *allocationPointer = nullptr;
+    VkResult result            = mHandle->allocator->map(mHandle, &allocationPointer);
+    if (result == VK_SUCCESS)
+    {
+        *mapPointer = allocationPointer + offset;
+    }
+    return result;
+}
+
+VkResult Allocation::flush(VkDeviceSize offset, VkDeviceSize size) const
+{
+    ASSERT(valid());
+    VkMappedMemoryRange range = {};
+    mHandle->allocator->getMappedRange(mHandle, offset, size, &range);
+    return mHandle->allocator->mBackend->flush(range);
+}
+
+VkResult Allocation::invalidate(VkDeviceSize offset, VkDeviceSize size) const
+{
+    ASSERT(valid());
+    VkMappedMemoryRange range = {};
+    mHandle->allocator->getMappedRange(mHandle, offset, size, &range);
+    return mHandle->allocator->mBackend->invalidate(range);
+}
+
+// MemoryBlock implementation.
+MemoryBlock::MemoryBlock(VkDeviceMemory memory, VkDeviceSize size, VkDeviceSize minAllocationSize)
+    : mMemory(memory),
+      mSize(size),
+      mMinAllocationSize(minAllocationSize),
+      mMaxOrder(0),
+      mUsedSize(0),
+      mMappedMemory(nullptr)
+{
+    ASSERT(gl::isPow2(size) && gl::isPow2(minAllocationSize) && size >= minAllocationSize);
+    while (getOrderSize(mMaxOrder) < size)
+    {
+        ++mMaxOrder;
+    }
+
+    mFreeChunks.resize(mMaxOrder + 1);
+    mFreeChunks[mMaxOrder].insert(0);
+}
+
+MemoryBlock::~MemoryBlock() = default;
+
+size_t MemoryBlock::getOrder(VkDeviceSize size) const
+{
+    size_t order = 0;
+    while (getOrderSize(order) < size)
+    {
+        ++order;
+    }
+    return order;
+}
+
+bool MemoryBlock::allocate(VkDeviceSize size,
+                           VkDeviceSize *offsetOut,
+                           VkDeviceSize *allocatedSizeOut)
+{
+    if (size > mSize)
+    {
+        return false;
+    }
+
+    size_t order = getOrder(size);
+
+    // Find the smallest free chunk that fits.
+    size_t chunkOrder = order;
+    while (chunkOrder <= mMaxOrder && mFreeChunks[chunkOrder].empty())
+    {
+        ++chunkOrder;
+    }
+    if (chunkOrder > mMaxOrder)
+    {
+        return false;
+    }
+
+    auto chunk          = mFreeChunks[chunkOrder].begin();
+    VkDeviceSize offset = *chunk;
+    mFreeChunks[chunkOrder].erase(chunk);
+
+    // Split it until it's the requested size, returning the upper halves to the free lists.
+    while (chunkOrder > order)
+    {
+        --chunkOrder;
+        mFreeChunks[chunkOrder].insert(offset + getOrderSize(chunkOrder));
+    }
+
+    mAllocatedOrders[offset] = static_cast<uint8_t>(order);
+    mUsedSize += getOrderSize(order);
+
+    *offsetOut        = offset;
+    *allocatedSizeOut = getOrderSize(order);
+    return true;
+}
+
+VkDeviceSize MemoryBlock::free(VkDeviceSize offset)
+{
+    auto allocated = mAllocatedOrders.find(offset);
+    ASSERT(allocated != mAllocatedOrders.end());
+
+    size_t order = allocated->second;
+    mAllocatedOrders.erase(allocated);
+
+    VkDeviceSize freedSize = getOrderSize(order);
+    mUsedSize -= freedSize;
+
+    // Merge with the buddy chunk for as long as it's free too.
+    while (order < mMaxOrder)
+    {
+        VkDeviceSize buddyOffset = offset ^ getOrderSize(order);
+        auto buddy               = mFreeChunks[order].find(buddyOffset);
+        if (buddy == mFreeChunks[order].end())
+        {
+            break;
+        }
+
+        mFreeChunks[order].erase(buddy);
+        offset = std::min(offset, buddyOffset);
+        ++order;
+    }
+
+    mFreeChunks[order].insert(offset);
+    return freedSize;
+}
+
+VkDeviceSize MemoryBlock::getLargestFreeSize() const
+{
+    for (size_t order = mMaxOrder + 1; order > 0; --order)
+    {
+        if (!mFreeChunks[order - 1].empty())
+        {
+            return getOrderSize(order - 1);
+        }
+    }
+    return 0;
+}
+
+// MemoryAllocator implementation.
+constexpr VkDeviceSize MemoryAllocator::kMinAllocationSize;
+constexpr VkDeviceSize MemoryAllocator::kDefaultBlockSize;
+constexpr VkDeviceSize MemoryAllocator::kSmallHeapBlockRatio;
+
+MemoryAllocator::MemoryAllocator()
+    : mMemoryProperties{}, mNonCoherentAtomSize(1), mBlockSizes{}, mStats{}
+{}
+
+MemoryAllocator::~MemoryAllocator()
+{
+    ASSERT(!mBackend);
+}
+
+void MemoryAllocator::init(std::unique_ptr<MemoryAllocatorBackend> &&backend,
+                           const VkPhysicalDeviceMemoryProperties &memoryProperties,
+                           VkDeviceSize nonCoherentAtomSize,
+                           VkDeviceSize preferredBlockSize)
+{
+    ASSERT(!mBackend && gl::isPow2(preferredBlockSize));
+    // Chunks must be aligned to nonCoherentAtomSize so flushes of one allocation never need to
+    // touch its neighbours.  The spec caps the atom size at 256.
+    ASSERT(nonCoherentAtomSize <= kMinAllocationSize);
+
+    mBackend             = std::move(backend);
+    mMemoryProperties    = memoryProperties;
+    mNonCoherentAtomSize = std::max<VkDeviceSize>(nonCoherentAtomSize, 1);
+
+    for (uint32_t typeIndex = 0; typeIndex < mMemoryProperties.memoryTypeCount; ++typeIndex)
+    {
+        const VkMemoryType &memoryType = mMemoryProperties.memoryTypes[typeIndex];
+        VkDeviceSize heapSize          = mMemoryProperties.memoryHeaps[memoryType.heapIndex].size;
+
+        VkDeviceSize blockSize = preferredBlockSize;
+        if (heapSize / kSmallHeapBlockRatio < blockSize)
+        {
+            blockSize = std::max(heapSize / kSmallHeapBlockRatio, kMinAllocationSize);
+            blockSize = RoundDownPow2(blockSize);
+        }
+        mBlockSizes[typeIndex] = blockSize;
+    }
+}
+
+void MemoryAllocator::destroy()
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    ASSERT(mStats.subAllocationCount == 0 && mStats.dedicatedAllocationCount == 0);
+    for (BlockList &blocks : mBlockLists)
+    {
+        for (std::unique_ptr<MemoryBlock> &block : blocks)
+        {
+            mBackend->free(block->getMemory());
+        }
+        blocks.clear();
+    }
+
+    mBackend.reset();
+    mStats = {};
+}
+
+VkResult MemoryAllocator::allocate(uint32_t memoryTypeIndex,
+                                   MemoryResourceType resourceType,
+                                   const VkMemoryRequirements &memoryRequirements,
+                                   const void *extraAllocationInfo,
+                                   Allocation *allocationOut)
+{
+    ASSERT(mBackend && memoryTypeIndex < mMemoryProperties.memoryTypeCount);
+    ASSERT(!allocationOut->valid());
+
+    std::unique_ptr<AllocationRecord> record(new AllocationRecord());
+    record->allocator = this;
+
+    // Power-of-two chunks are naturally aligned, so the alignment is met by rounding the size
+    // up to it.
+    VkDeviceSize blockSize = mBlockSizes[memoryTypeIndex];
+    VkDeviceSize size      = std::max(memoryRequirements.size, memoryRequirements.alignment);
+
+    VkResult result = VK_SUCCESS;
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        if (extraAllocationInfo != nullptr || size > blockSize / 2)
+        {
+            result = allocateDedicated(memoryTypeIndex, memoryRequirements, extraAllocationInfo,
+                                       record.get());
+        }
+        else
+        {
+            result = allocateFromBlocks(memoryTypeIndex, resourceType, size, record.get());
+        }
+    }
+
+    if (result == VK_SUCCESS)
+    {
+        allocationOut->mHandle = record.release();
+    }
+    return result;
+}
+
+VkResult MemoryAllocator::allocateDedicated(uint32_t memoryTypeIndex,
+                                            const VkMemoryRequirements &memoryRequirements,
+                                            const void *extraAllocationInfo,
+                                            AllocationRecord *record)
+{
+    VkMemoryAllocateInfo allocInfo = {};
+    allocInfo.sType                = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    allocInfo.pNext                = extraAllocationInfo;
+    allocInfo.memoryTypeIndex      = memoryTypeIndex;
+    allocInfo.allocationSize       = memoryRequirements.size;
+
+    VkResult result = mBackend->allocate(allocInfo, &record->memory);
+    if (result != VK_SUCCESS)
+    {
+        return result;
+    }
+
+    record->block          = nullptr;
+    record->blockListIndex = 0;
+    record->offset         = 0;
+    record->size           = memoryRequirements.size;
+    record->mappedMemory   = nullptr;
+
+    mStats.deviceMemoryCount++;
+    mStats.dedicatedAllocationCount++;
+    mStats.dedicatedBytes += record->size;
+    return VK_SUCCESS;
+}
+
+VkResult MemoryAllocator::allocateFromBlocks(uint32_t memoryTypeIndex,
+                                             MemoryResourceType resourceType,
+                                             VkDeviceSize size,
+                                             AllocationRecord *record)
+{
+    size = std::max(size, kMinAllocationSize);
+
+    size_t blockListIndex  = GetBlockListIndex(memoryTypeIndex, resourceType);
+    BlockList &blocks      = mBlockLists[blockListIndex];
+    MemoryBlock *block     = nullptr;
+    VkDeviceSize offset    = 0;
+    VkDeviceSize chunkSize = 0;
+    for (std::unique_ptr<MemoryBlock> &candidate : blocks)
+    {
+        if (candidate->allocate(size, &offset, &chunkSize))
+        {
+            block = candidate.get();
+            break;
+        }
+    }
+
+    if (block == nullptr)
+    {
+        VkMemoryAllocateInfo allocInfo = {};
+        allocInfo.sType                = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+        allocInfo.memoryTypeIndex      = memoryTypeIndex;
+        allocInfo.allocationSize       = mBlockSizes[memoryTypeIndex];
+
+        VkDeviceMemory memory = VK_NULL_HANDLE;
+        VkResult result       = mBackend->allocate(allocInfo, &memory);
+        if (result != VK_SUCCESS)
+        {
+            return result;
+        }
+
+        blocks.emplace_back(new MemoryBlock(memory, allocInfo.allocationSize, kMinAllocationSize));
+        block = blocks.back().get();
+
+        mStats.deviceMemoryCount++;
+        mStats.blockCount++;
+        mStats.blockBytes += allocInfo.allocationSize;
+
+        bool allocated = block->allocate(size, &offset, &chunkSize);
+        ASSERT(allocated);
+    }
+
+    record->block          = block;
+    record->blockListIndex = blockListIndex;
+    record->memory         = block->getMemory();
+    record->offset         = offset;
+    record->size           = chunkSize;
+    record->mappedMemory   = nullptr;
+
+    mStats.subAllocationCount++;
+    mStats.subAllocatedBytes += chunkSize;
+    return VK_SUCCESS;
+}
+
+void MemoryAllocator::free(AllocationRecord *record)
+{
+    std::unique_ptr<AllocationRecord> owner(record);
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    if (record->block == nullptr)
+    {
+        mBackend->free(record->memory);
+
+        mStats.deviceMemoryCount--;
+        mStats.dedicatedAllocationCount--;
+        mStats.dedicatedBytes -= record->size;
+        return;
+    }
+
+    MemoryBlock *block = record->block;
+    block->free(record->offset);
+
+    mStats.subAllocationCount--;
+    mStats.subAllocatedBytes -= record->size;
+
+    if (!block->isEmpty())
+    {
+        return;
+    }
+
+    // Keep a single empty block around per list, so a resource that's repeatedly created and
+    // deleted doesn't allocate device memory every time.
+    BlockList &blocks      = mBlockLists[record->blockListIndex];
+    size_t emptyBlockCount = 0;
+    for (const std::unique_ptr<MemoryBlock> &candidate : blocks)
+    {
+        emptyBlockCount += candidate->isEmpty() ? 1 : 0;
+    }
+
+    if (emptyBlockCount > 1)
+    {
+        auto iter = std::find_if(blocks.begin(), blocks.end(),
+                                 [block](const std::unique_ptr<MemoryBlock> &candidate) {
+                                     return candidate.get() == block;
+                                 });
+        ASSERT(iter != blocks.end());
+
+        mStats.deviceMemoryCount--;
+        mStats.blockCount--;
+        mStats.blockBytes -= block->getSize();
+
+        mBackend->free(block->getMemory());
+        blocks.erase(iter);
+    }
+}
+
+VkResult MemoryAllocator::map(AllocationRecord *record, uint8_t **mapPointerOut)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    if (record->block == nullptr)
+    {
+        if (record->mappedMemory == nullptr)
+        {
+            VkResult result = mBackend->map(record->memory, &record->mappedMemory);
+            if (result != VK_SUCCESS)
+            {
+                return result;
+            }
+        }
+        *mapPointerOut = record->mappedMemory;
+        return VK_SUCCESS;
+    }
+
+    MemoryBlock *block = record->block;
+    if (block->getMappedMemory() == nullptr)
+    {
+        uint8_t *mappedMemory = nullptr;
+        VkResult result       = mBackend->map(block->getMemory(), &mappedMemory);
+        if (result != VK_SUCCESS)
+        {
+            return result;
+        }
+        block->setMappedMemory(mappedMemory);
+    }
+
+    *mapPointerOut = block->getMappedMemory() + record->offset;
+    return VK_SUCCESS;
+}
+
+void MemoryAllocator::getMappedRange(const AllocationRecord *record,
+                                     VkDeviceSize offset,
+                                     VkDeviceSize size,
+                                     VkMappedMemoryRange *rangeOut) const
+{
+    ASSERT(offset <= record->size);
+    if (size == VK_WHOLE_SIZE || offset + size > record->size)
+    {
+        size = record->size - offset;
+    }
+
+    VkDeviceSize memorySize = record->block ? record->block->getSize() : record->size;
+    VkDeviceSize start      = record->offset + offset;
+    VkDeviceSize end        = start + size;
+
+    start = start / mNonCoherentAtomSize * mNonCoherentAtomSize;
+    end   = roundUp(end, mNonCoherentAtomSize);
+
+    rangeOut->sType  = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
+    rangeOut->memory = record->memory;
+    rangeOut->offset = start;
+    // The end of a dedicated allocation isn't necessarily a multiple of the atom size, in which
+    // case the range has to extend to the end of the memory object.
+    rangeOut->size = end >= memorySize ? VK_WHOLE_SIZE : end - start;
+}
+
+MemoryAllocatorStats MemoryAllocator::getStats() const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mStats;
+}
+
+VkDeviceSize MemoryAllocator::getBlockSize(uint32_t memoryTypeIndex) const
+{
+    ASSERT(memoryTypeIndex < mMemoryProperties.memoryTypeCount);
+    return mBlockSizes[memoryTypeIndex];
+}
+}  // namespace vk
+}  // namespace rx
@@ -0,0 +1,241 @@
+//
+// Copyright 2019 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// vk_memory_allocator:
+//    Sub-allocates buffer and image memory out of large VkDeviceMemory blocks, so that small
+//    resources don't each cost a vkAllocateMemory call and count against
+//    maxMemoryAllocationCount.
+//
+
+#ifndef LIBANGLE_RENDERER_VULKAN_VK_MEMORY_ALLOCATOR_H_
+#define LIBANGLE_RENDERER_VULKAN_VK_MEMORY_ALLOCATOR_H_
+
+#include <array>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <unordered_map>
+#include <vector>
+
+#include "libANGLE/renderer/vulkan/vk_wrapper.h"
+
+namespace rx
+{
+namespace vk
+{
+class MemoryAllocator;
+class MemoryBlock;
+
+// Creates and maps the VkDeviceMemory objects the allocator hands out.  The renderer uses
+// DeviceMemoryBackend, tests use a backend that doesn't need a device.
+class MemoryAllocatorBackend : angle::NonCopyable
+{
+  public:
+    virtual ~MemoryAllocatorBackend() {}
+
+    virtual VkResult allocate(const VkMemoryAllocateInfo &allocInfo, VkDeviceMemory *memoryOut) = 0;
+    virtual void free(VkDeviceMemory memory) = 0;
+
+    // Maps the whole memory object.  It's implicitly unmapped when freed.
+    virtual VkResult map(VkDeviceMemory memory, uint8_t **mapPointerOut) = 0;
+
+    virtual VkResult flush(const VkMappedMemoryRange &range) = 0;
+    virtual VkResult invalidate(const VkMappedMemoryRange &range) = 0;
+};
+
+class DeviceMemoryBackend final : public MemoryAllocatorBackend
+{
+  public:
+    explicit DeviceMemoryBackend(VkDevice device);
+    ~DeviceMemoryBackend() override;
+
+    VkResult allocate(const VkMemoryAllocateInfo &allocInfo, VkDeviceMemory *memoryOut) override;
+    void free(VkDeviceMemory memory) override;
+    VkResult map(VkDeviceMemory memory, uint8_t **mapPointerOut) override;
+    VkResult flush(const VkMappedMemoryRange &range) override;
+    VkResult invalidate(const VkMappedMemoryRange &range) override;
+
+  private:
+    VkDevice mDevice;
+};
+
+// Buffers and images are kept in separate blocks, so linear and optimal resources never share a
+// block and bufferImageGranularity doesn't need to be taken into account.
+enum class MemoryResourceType
+{
+    Buffer,
+    Image,
+
+    InvalidEnum,
+    EnumCount = InvalidEnum,
+};
+
+// Bookkeeping for a single allocation.  Allocation handles point to one of these.
+struct AllocationRecord
+{
+    MemoryAllocator *allocator;
+    // The block the allocation is carved out of, or nullptr for dedicated allocations.
+    MemoryBlock *block;
+    size_t blockListIndex;
+    VkDeviceMemory memory;
+    VkDeviceSize offset;
+    // The size reserved for the allocation, which may be larger than requested.
+    VkDeviceSize size;
+    // Only used by dedicated allocations.  Blocks keep their own mapping.
+    uint8_t *mappedMemory;
+};
+
+// A range of device memory, either sub-allocated from a block or dedicated to a single resource.
+// Host-visible memory stays mapped for as long as the allocation is alive, so unlike
+// DeviceMemory there is no unmap.
+class Allocation final : public WrappedObject<Allocation, AllocationRecord *>
+{
+  public:
+    Allocation() = default;
+    void destroy(VkDevice device);
+
+    // Frees an allocation that was released to a GarbageObject.
+    static void DestroyHandle(AllocationRecord *handle);
+
+    VkDeviceMemory getMemory() const { return mHandle->memory; }
+    VkDeviceSize getOffset() const { return mHandle->offset; }
+    VkDeviceSize getSize() const { return mHandle->size; }
+    bool isDedicated() const { return mHandle->block == nullptr; }
+
+    // Returns a pointer to |offset| bytes into the allocation.
+    VkResult map(VkDeviceSize offset, uint8_t **mapPointer) const;
+
+    // |offset| and |size| are relative to the allocation.  The range is widened to
+    // nonCoherentAtomSize as needed.
+    VkResult flush(VkDeviceSize offset, VkDeviceSize size) const;
+    VkResult invalidate(VkDeviceSize offset, VkDeviceSize size) const;
+
+  private:
+    friend class MemoryAllocator;
+};
+
+// A buddy allocator over a single VkDeviceMemory.  The block is split into power-of-two sized
+// chunks, the smallest being |minAllocationSize|.  A chunk of size S is always aligned to S, so
+// power-of-two alignment requirements are met by rounding the size up.  Free chunks are kept
+// sorted by offset and the lowest one is used first, which keeps live allocations packed at the
+// start of the block and lets freed neighbours merge back into larger chunks.
+class MemoryBlock final : angle::NonCopyable
+{
+  public:
+    MemoryBlock(VkDeviceMemory memory, VkDeviceSize size, VkDeviceSize minAllocationSize);
+    ~MemoryBlock();
+
+    // Returns false if there is no free chunk large enough.
+    bool allocate(VkDeviceSize size, VkDeviceSize *offsetOut, VkDeviceSize *allocatedSizeOut);
+    // Returns the size of the freed chunk.
+    VkDeviceSize free(VkDeviceSize offset);
+
+    VkDeviceMemory getMemory() const { return mMemory; }
+    VkDeviceSize getSize() const { return mSize; }
+    VkDeviceSize getUsedSize() const { return mUsedSize; }
+    size_t getAllocationCount() const { return mAllocatedOrders.size(); }
+    bool isEmpty() const { return mAllocatedOrders.empty(); }
+    // The size of the largest chunk that can currently be allocated.
+    VkDeviceSize getLargestFreeSize() const;
+
+    uint8_t *getMappedMemory() const { return mMappedMemory; }
+    void setMappedMemory(uint8_t *mappedMemory) { mMappedMemory = mappedMemory; }
+
+  private:
+    size_t getOrder(VkDeviceSize size) const;
+    VkDeviceSize getOrderSize(size_t order) const { return mMinAllocationSize << order; }
+
+    VkDeviceMemory mMemory;
+    VkDeviceSize mSize;
+    VkDeviceSize mMinAllocationSize;
+    size_t mMaxOrder;
+    VkDeviceSize mUsedSize;
+    uint8_t *mMappedMemory;
+
+    // Offsets of the free chunks of each order, in ascending order.
+    std::vector<std::set<VkDeviceSize>> mFreeChunks;
+    // The order of each live allocation, keyed by offset.
+    std::unordered_map<VkDeviceSize, uint8_t> mAllocatedOrders;
+};
+
+struct MemoryAllocatorStats
+{
+    // Number of VkDeviceMemory objects: blocks plus dedicated allocations.
+    uint32_t deviceMemoryCount;
+    uint32_t blockCount;
+    uint32_t dedicatedAllocationCount;
+    uint32_t subAllocationCount;
+    // Device memory held by blocks, and how much of it is sub-allocated.
+    VkDeviceSize blockBytes;
+    VkDeviceSize subAllocatedBytes;
+    VkDeviceSize dedicatedBytes;
+};
+
+// Hands out Allocations from a list of blocks per memory type and resource type.  Blocks are
+// tried in creation order, so new allocations fill the oldest blocks first and later blocks
+// drain as resources are freed.  A block that becomes empty is released unless it's the only
+// empty block of its list, which avoids thrashing when a resource is repeatedly recreated.
+// Allocations larger than half a block, or that need extra allocation info (such as imported
+// external memory), get a dedicated VkDeviceMemory.
+class MemoryAllocator final : angle::NonCopyable
+{
+  public:
+    static constexpr VkDeviceSize kMinAllocationSize   = 256;
+    static constexpr VkDeviceSize kDefaultBlockSize    = 16 * 1024 * 1024;
+    static constexpr VkDeviceSize kSmallHeapBlockRatio = 8;
+
+    MemoryAllocator();
+    ~MemoryAllocator();
+
+    // |preferredBlockSize| must be a power of two.  Heaps smaller than kSmallHeapBlockRatio
+    // blocks use proportionally smaller blocks.
+    void init(std::unique_ptr<MemoryAllocatorBackend> &&backend,
+              const VkPhysicalDeviceMemoryProperties &memoryProperties,
+              VkDeviceSize nonCoherentAtomSize,
+              VkDeviceSize preferredBlockSize);
+    void destroy();
+
+    VkResult allocate(uint32_t memoryTypeIndex,
+                      MemoryResourceType resourceType,
+                      const VkMemoryRequirements &memoryRequirements,
+                      const void *extraAllocationInfo,
+                      Allocation *allocationOut);
+
+    MemoryAllocatorStats getStats() const;
+    VkDeviceSize getBlockSize(uint32_t memoryTypeIndex) const;
+
+  private:
+    friend class Allocation;
+
+    using BlockList = std::vector<std::unique_ptr<MemoryBlock>>;
+
+    VkResult allocateDedicated(uint32_t memoryTypeIndex,
+                               const VkMemoryRequirements &memoryRequirements,
+                               const void *extraAllocationInfo,
+                               AllocationRecord *record);
+    VkResult allocateFromBlocks(uint32_t memoryTypeIndex,
+                                MemoryResourceType resourceType,
+                                VkDeviceSize size,
+                                AllocationRecord *record);
+    void free(AllocationRecord *record);
+    VkResult map(AllocationRecord *record, uint8_t **mapPointerOut);
+    void getMappedRange(const AllocationRecord *record,
+                        VkDeviceSize offset,
+                        VkDeviceSize size,
+                        VkMappedMemoryRange *rangeOut) const;
+
+    mutable std::mutex mMutex;
+    std::unique_ptr<MemoryAllocatorBackend> mBackend;
+    VkPhysicalDeviceMemoryProperties mMemoryProperties;
+    VkDeviceSize mNonCoherentAtomSize;
+    std::array<VkDeviceSize, VK_MAX_MEMORY_TYPES> mBlockSizes;
+    std::array<BlockList, VK_MAX_MEMORY_TYPES * static_cast<size_t>(MemoryResourceType::EnumCount)>
+        mBlockLists;
+    MemoryAllocatorStats mStats;
+};
+}  // namespace vk
+}  // namespace rx
+
+#endif  // LIBANGLE_RENDERER_VULKAN_VK_MEMORY_ALLOCATOR_H_
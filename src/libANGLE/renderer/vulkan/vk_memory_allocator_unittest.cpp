@@ -0,0 +1,420 @@
+//
+// Copyright 2019 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// vk_memory_allocator_unittest.cpp: Unit tests for the Vulkan device memory sub-allocator.  The
+//   allocator runs against a mock backend, so no device is needed.
+
+#include <gtest/gtest.h>
+
+#include <deque>
+#include <map>
+#include <memory>
+
+#include "libANGLE/renderer/vulkan/vk_memory_allocator.h"
+
+namespace rx
+{
+namespace vk
+{
+namespace
+{
+constexpr VkDeviceSize kBlockSize           = 1024 * 1024;
+constexpr VkDeviceSize kHeapSize            = 1024 * 1024 * 1024;
+constexpr VkDeviceSize kNonCoherentAtomSize = 64;
+constexpr uint32_t kHostVisibleType         = 0;
+constexpr uint32_t kDeviceLocalType         = 1;
+
+class MockMemoryBackend final : public MemoryAllocatorBackend
+{
+  public:
+    VkResult allocate(const VkMemoryAllocateInfo &allocInfo, VkDeviceMemory *memoryOut) override
+    {
+        if (failAllocations)
+        {
+            return VK_ERROR_OUT_OF_DEVICE_MEMORY;
+        }
+
+        VkDeviceMemory memory = (VkDeviceMemory)(uintptr_t)(++mNextHandle);
+        mMemory[memory].resize(static_cast<size_t>(allocInfo.allocationSize));
+        lastAllocateInfo = allocInfo;
+        allocateCount++;
+        *memoryOut = memory;
+        return VK_SUCCESS;
+    }
+
+    void free(VkDeviceMemory memory) override
+    {
+        ASSERT_EQ(1u, mMemory.erase(memory));
+        freeCount++;
+    }
+
+    VkResult map(VkDeviceMemory memory, uint8_t **mapPointerOut) override
+    {
+        mapCount++;
+        *mapPointerOut = mMemory[memory].data();
+        return VK_SUCCESS;
+    }
+
+    VkResult flush(const VkMappedMemoryRange &range) override
+    {
+        lastRange = range;
+        return VK_SUCCESS;
+    }
+
+    VkResult invalidate(const VkMappedMemoryRange &range) override
+    {
+        lastRange = range;
+        return VK_SUCCESS;
+    }
+
+    size_t liveMemoryCount() const { return mMemory.size(); }
+
+    bool failAllocations                  = false;
+    uint32_t allocateCount                = 0;
+    uint32_t freeCount                    = 0;
+    uint32_t mapCount                     = 0;
+    VkMemoryAllocateInfo lastAllocateInfo = {};
+    VkMappedMemoryRange lastRange         = {};
+
+  private:
+    uint64_t mNextHandle = 0;
+    std::map<VkDeviceMemory, std::vector<uint8_t>> mMemory;
+};
+
+VkPhysicalDeviceMemoryProperties MakeMemoryProperties(VkDeviceSize heapSize)
+{
+    VkPhysicalDeviceMemoryProperties properties = {};
+    properties.memoryHeapCount                  = 1;
+    properties.memoryHeaps[0].size              = heapSize;
+    properties.memoryHeaps[0].flags             = VK_MEMORY_HEAP_DEVICE_LOCAL_BIT;
+    properties.memoryTypeCount                  = 2;
+    properties.memoryTypes[kHostVisibleType].propertyFlags =
+        VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+    properties.memoryTypes[kHostVisibleType].heapIndex = 0;
+    properties.memoryTypes[kDeviceLocalType].propertyFlags =
+        VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+    properties.memoryTypes[kDeviceLocalType].heapIndex = 0;
+    return properties;
+}
+
+VkMemoryRequirements MakeRequirements(VkDeviceSize size, VkDeviceSize alignment)
+{
+    VkMemoryRequirements requirements = {};
+    requirements.size                 = size;
+    requirements.alignment            = alignment;
+    requirements.memoryTypeBits       = 0x3;
+    return requirements;
+}
+
+class MemoryAllocatorTest : public testing::Test
+{
+  protected:
+    void SetUp() override { init(kHeapSize); }
+
+    void TearDown() override
+    {
+        for (Allocation &allocation : mAllocations)
+        {
+            allocation.destroy(VK_NULL_HANDLE);
+        }
+        mAllocations.clear();
+        mAllocator.destroy();
+    }
+
+    void init(VkDeviceSize heapSize)
+    {
+        std::unique_ptr<MockMemoryBackend> backend(new MockMemoryBackend());
+        mBackend = backend.get();
+        mAllocator.init(std::move(backend), MakeMemoryProperties(heapSize), kNonCoherentAtomSize,
+                        kBlockSize);
+    }
+
+    Allocation *allocate(VkDeviceSize size,
+                         VkDeviceSize alignment,
+                         uint32_t memoryTypeIndex        = kDeviceLocalType,
+                         MemoryResourceType type         = MemoryResourceType::Buffer,
+                         const void *extraAllocationInfo = nullptr)
+    {
+        mAllocations.emplace_back();
+        EXPECT_EQ(VK_SUCCESS,
+                  mAllocator.allocate(memoryTypeIndex, type, MakeRequirements(size, alignment),
+                                      extraAllocationInfo, &mAllocations.back()));
+        return &mAllocations.back();
+    }
+
+    void freeAll()
+    {
+        for (Allocation &allocation : mAllocations)
+        {
+            allocation.destroy(VK_NULL_HANDLE);
+        }
+        mAllocations.clear();
+    }
+
+    MockMemoryBackend *mBackend = nullptr;
+    MemoryAllocator mAllocator;
+    std::deque<Allocation> mAllocations;
+};
+
+// Tests that small allocations share a single device memory object without overlapping.
+TEST_F(MemoryAllocatorTest, SmallAllocationsShareBlock)
+{
+    constexpr size_t kCount = 1000;
+    std::map<VkDeviceSize, VkDeviceSize> ranges;
+    for (size_t index = 0; index < kCount; ++index)
+    {
+        Allocation *allocation = allocate(100 + index % 300, 16);
+        EXPECT_FALSE(allocation->isDedicated());
+        EXPECT_GE(allocation->getSize(), 100 + index % 300);
+        ranges[allocation->getOffset()] = allocation->getSize();
+    }
+
+    EXPECT_EQ(1u, mBackend->allocateCount);
+    EXPECT_EQ(kBlockSize, mBackend->lastAllocateInfo.allocationSize);
+
+    ASSERT_EQ(kCount, ranges.size());
+    VkDeviceSize end = 0;
+    for (const auto &range : ranges)
+    {
+        EXPECT_GE(range.first, end);
+        end = range.first + range.second;
+    }
+    EXPECT_LE(end, kBlockSize);
+
+    MemoryAllocatorStats stats = mAllocator.getStats();
+    EXPECT_EQ(1u, stats.deviceMemoryCount);
+    EXPECT_EQ(1u, stats.blockCount);
+    EXPECT_EQ(kCount, stats.subAllocationCount);
+    EXPECT_EQ(0u, stats.dedicatedAllocationCount);
+    EXPECT_EQ(kBlockSize, stats.blockBytes);
+}
+
+// Tests that allocations honor their alignment requirement.
+TEST_F(MemoryAllocatorTest, Alignment)
+{
+    allocate(300, 4);
+    for (VkDeviceSize alignment = 256; alignment <= 64 * 1024; alignment *= 4)
+    {
+        Allocation *allocation = allocate(300, alignment);
+        EXPECT_EQ(0u, allocation->getOffset() % alignment);
+        allocate(300, 4);
+    }
+    EXPECT_EQ(1u, mAllocator.getStats().blockCount);
+}
+
+// Tests that large allocations and allocations with extra allocation info are dedicated.
+TEST_F(MemoryAllocatorTest, DedicatedAllocations)
+{
+    Allocation *large = allocate(kBlockSize / 2 + 1, 256);
+    EXPECT_TRUE(large->isDedicated());
+    EXPECT_EQ(0u, large->getOffset());
+    EXPECT_EQ(kBlockSize / 2 + 1, mBackend->lastAllocateInfo.allocationSize);
+
+    VkExportMemoryAllocateInfo exportInfo = {};
+    exportInfo.sType                      = VK_STRUCTURE_TYPE_EXPORT_MEMORY_ALLOCATE_INFO;
+    Allocation *external =
+        allocate(1024, 256, kDeviceLocalType, MemoryResourceType::Image, &exportInfo);
+    EXPECT_TRUE(external->isDedicated());
+    EXPECT_EQ(&exportInfo, mBackend->lastAllocateInfo.pNext);
+
+    Allocation *small = allocate(1024, 256);
+    EXPECT_FALSE(small->isDedicated());
+
+    MemoryAllocatorStats stats = mAllocator.getStats();
+    EXPECT_EQ(3u, stats.deviceMemoryCount);
+    EXPECT_EQ(2u, stats.dedicatedAllocationCount);
+    EXPECT_EQ(kBlockSize / 2 + 1 + 1024, stats.dedicatedBytes);
+    EXPECT_EQ(1u, stats.subAllocationCount);
+
+    freeAll();
+    stats = mAllocator.getStats();
+    EXPECT_EQ(1u, stats.deviceMemoryCount);
+    EXPECT_EQ(0u, stats.dedicatedAllocationCount);
+    EXPECT_EQ(0u, stats.dedicatedBytes);
+}
+
+// Tests that buffers and images are never placed in the same block.
+TEST_F(MemoryAllocatorTest, BuffersAndImagesUseSeparateBlocks)
+{
+    Allocation *buffer    = allocate(1024, 256, kDeviceLocalType, MemoryResourceType::Buffer);
+    Allocation *image     = allocate(1024, 256, kDeviceLocalType, MemoryResourceType::Image);
+    Allocation *otherType = allocate(1024, 256, kHostVisibleType, MemoryResourceType::Buffer);
+
+    EXPECT_NE(buffer->getMemory(), image->getMemory());
+    EXPECT_NE(buffer->getMemory(), otherType->getMemory());
+    EXPECT_EQ(3u, mAllocator.getStats().blockCount);
+}
+
+// Tests that freed chunks merge back with their buddies, so the whole block becomes available
+// again.
+TEST_F(MemoryAllocatorTest, FreedChunksMerge)
+{
+    constexpr VkDeviceSize kChunkSize = 4096;
+    for (VkDeviceSize offset = 0; offset < kBlockSize; offset += kChunkSize)
+    {
+        allocate(kChunkSize, 256);
+    }
+    EXPECT_EQ(1u, mAllocator.getStats().blockCount);
+
+    // Free every other chunk.  Nothing can merge, so a larger allocation needs a new block.
+    for (size_t index = 0; index < mAllocations.size(); index += 2)
+    {
+        mAllocations[index].destroy(VK_NULL_HANDLE);
+    }
+    allocate(2 * kChunkSize, 256);
+    EXPECT_EQ(2u, mAllocator.getStats().blockCount);
+
+    // Once everything is freed, a half-block allocation fits in the first block again.
+    freeAll();
+    Allocation *half = allocate(kBlockSize / 2, 256);
+    EXPECT_EQ(0u, half->getOffset());
+}
+
+// Tests that empty blocks are released, except for one that's kept to avoid thrashing.
+TEST_F(MemoryAllocatorTest, EmptyBlocksAreReleased)
+{
+    for (int index = 0; index < 4; ++index)
+    {
+        allocate(kBlockSize / 2, 256);
+    }
+    EXPECT_EQ(2u, mAllocator.getStats().blockCount);
+
+    freeAll();
+    EXPECT_EQ(1u, mAllocator.getStats().blockCount);
+    EXPECT_EQ(1u, mBackend->freeCount);
+    EXPECT_EQ(1u, mBackend->liveMemoryCount());
+
+    // The retained block is reused.
+    allocate(1024, 256);
+    EXPECT_EQ(2u, mBackend->allocateCount);
+}
+
+// Tests that new allocations fill the oldest block first, so later blocks can drain.
+TEST_F(MemoryAllocatorTest, OldestBlockIsFilledFirst)
+{
+    Allocation *first = allocate(kBlockSize / 2, 256);
+    allocate(kBlockSize / 2, 256);
+    Allocation *second = allocate(kBlockSize / 2, 256);
+    EXPECT_NE(first->getMemory(), second->getMemory());
+
+    VkDeviceMemory firstMemory = first->getMemory();
+    first->destroy(VK_NULL_HANDLE);
+
+    Allocation *reused = allocate(1024, 256);
+    EXPECT_EQ(firstMemory, reused->getMemory());
+}
+
+// Tests that host-visible blocks are mapped once and each allocation gets its own range.
+TEST_F(MemoryAllocatorTest, Map)
+{
+    Allocation *first  = allocate(1000, 256, kHostVisibleType);
+    Allocation *second = allocate(1000, 256, kHostVisibleType);
+
+    uint8_t *firstPointer  = nullptr;
+    uint8_t *secondPointer = nullptr;
+    EXPECT_EQ(VK_SUCCESS, first->map(0, &firstPointer));
+    EXPECT_EQ(VK_SUCCESS, second->map(0, &secondPointer));
+    EXPECT_EQ(1u, mBackend->mapCount);
+    EXPECT_EQ(static_cast<ptrdiff_t>(second->getOffset() - first->getOffset()),
+              secondPointer - firstPointer);
+
+    uint8_t *offsetPointer = nullptr;
+    EXPECT_EQ(VK_SUCCESS, second->map(100, &offsetPointer));
+    EXPECT_EQ(secondPointer + 100, offsetPointer);
+    EXPECT_EQ(1u, mBackend->mapCount);
+
+    memset(firstPointer, 0xAA, 1000);
+    memset(secondPointer, 0x55, 1000);
+    EXPECT_EQ(0xAA, firstPointer[999]);
+}
+
+// Tests that flushed ranges are translated to the device memory object and widened to
+// nonCoherentAtomSize.
+TEST_F(MemoryAllocatorTest, FlushRange)
+{
+    allocate(1000, 256, kHostVisibleType);
+    Allocation *allocation = allocate(1000, 256, kHostVisibleType);
+
+    EXPECT_EQ(VK_SUCCESS, allocation->flush(10, 100));
+    EXPECT_EQ(allocation->getMemory(), mBackend->lastRange.memory);
+    EXPECT_EQ(allocation->getOffset(), mBackend->lastRange.offset);
+    EXPECT_EQ(2 * kNonCoherentAtomSize, mBackend->lastRange.size);
+
+    EXPECT_EQ(VK_SUCCESS, allocation->invalidate(0, VK_WHOLE_SIZE));
+    EXPECT_EQ(allocation->getOffset(), mBackend->lastRange.offset);
+    EXPECT_EQ(allocation->getSize(), mBackend->lastRange.size);
+
+    // The end of a dedicated allocation may not be atom aligned, in which case the range
+    // extends to the end of the memory object.
+    Allocation *dedicated = allocate(kBlockSize - 10, 256, kHostVisibleType);
+    ASSERT_TRUE(dedicated->isDedicated());
+    EXPECT_EQ(VK_SUCCESS, dedicated->flush(kBlockSize - 100, 50));
+    EXPECT_EQ(kBlockSize - 128, mBackend->lastRange.offset);
+    EXPECT_EQ(static_cast<VkDeviceSize>(VK_WHOLE_SIZE), mBackend->lastRange.size);
+}
+
+// Tests that backend failures are returned without affecting the allocator's state.
+TEST_F(MemoryAllocatorTest, AllocationFailure)
+{
+    allocate(1024, 256);
+    mBackend->failAllocations = true;
+
+    Allocation allocation;
+    EXPECT_EQ(VK_ERROR_OUT_OF_DEVICE_MEMORY,
+              mAllocator.allocate(kDeviceLocalType, MemoryResourceType::Image,
+                                  MakeRequirements(1024, 256), nullptr, &allocation));
+    EXPECT_FALSE(allocation.valid());
+
+    // The existing block still has room.
+    allocate(1024, 256);
+
+    MemoryAllocatorStats stats = mAllocator.getStats();
+    EXPECT_EQ(1u, stats.blockCount);
+    EXPECT_EQ(2u, stats.subAllocationCount);
+}
+
+// Tests that small heaps use proportionally smaller blocks.
+TEST_F(MemoryAllocatorTest, SmallHeap)
+{
+    mAllocator.destroy();
+    init(4 * kBlockSize);
+
+    EXPECT_EQ(kBlockSize / 2, mAllocator.getBlockSize(kDeviceLocalType));
+    allocate(1024, 256);
+    EXPECT_EQ(kBlockSize / 2, mBackend->lastAllocateInfo.allocationSize);
+}
+
+// Tests the buddy allocator's bookkeeping directly.
+TEST(MemoryBlockTest, Bookkeeping)
+{
+    MemoryBlock block(VK_NULL_HANDLE, 4096, 256);
+    EXPECT_TRUE(block.isEmpty());
+    EXPECT_EQ(4096u, block.getLargestFreeSize());
+
+    VkDeviceSize offset = 0;
+    VkDeviceSize size   = 0;
+    ASSERT_TRUE(block.allocate(300, &offset, &size));
+    EXPECT_EQ(0u, offset);
+    EXPECT_EQ(512u, size);
+    EXPECT_EQ(2048u, block.getLargestFreeSize());
+
+    VkDeviceSize secondOffset = 0;
+    ASSERT_TRUE(block.allocate(256, &secondOffset, &size));
+    EXPECT_EQ(512u, secondOffset);
+    EXPECT_EQ(256u, size);
+    EXPECT_EQ(768u, block.getUsedSize());
+    EXPECT_EQ(2u, block.getAllocationCount());
+
+    EXPECT_FALSE(block.allocate(4096, &offset, &size));
+
+    EXPECT_EQ(512u, block.free(0));
+    EXPECT_EQ(2048u, block.getLargestFreeSize());
+    EXPECT_EQ(256u, block.free(secondOffset));
+    EXPECT_TRUE(block.isEmpty());
+    EXPECT_EQ(4096u, block.getLargestFreeSize());
+}
+}  // anonymous namespace
+}  // namespace vk
+}  // namespace rx
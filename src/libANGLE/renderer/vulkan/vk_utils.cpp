@@ -96,62 +96,49 @@ bool HasValidationLayers(const std::vector<VkLayerProperties> &layerProps)
     return true;
 }
 
-angle::Result FindAndAllocateCompatibleMemory(vk::Context *context,
-                                              const vk::MemoryProperties &memoryProperties,
-                                              VkMemoryPropertyFlags requestedMemoryPropertyFlags,
-                                              VkMemoryPropertyFlags *memoryPropertyFlagsOut,
-                                              const VkMemoryRequirements &memoryRequirements,
-                                              const void *extraAllocationInfo,
-                                              vk::DeviceMemory *deviceMemoryOut)
-{
-    uint32_t memoryTypeIndex = 0;
-    ANGLE_TRY(memoryProperties.findCompatibleMemoryIndex(context, memoryRequirements,
-                                                         requestedMemoryPropertyFlags,
-                                                         memoryPropertyFlagsOut, &memoryTypeIndex));
-
-    VkMemoryAllocateInfo allocInfo = {};
-    allocInfo.sType                = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-    allocInfo.pNext                = extraAllocationInfo;
-    allocInfo.memoryTypeIndex      = memoryTypeIndex;
-    allocInfo.allocationSize       = memoryRequirements.size;
-
-    ANGLE_VK_TRY(context, deviceMemoryOut->allocate(context->getDevice(), allocInfo));
-    return angle::Result::Continue;
-}
-
 template <typename T>
 angle::Result AllocateAndBindBufferOrImageMemory(vk::Context *context,
+                                                 vk::MemoryResourceType resourceType,
                                                  VkMemoryPropertyFlags requestedMemoryPropertyFlags,
                                                  VkMemoryPropertyFlags *memoryPropertyFlagsOut,
                                                  const VkMemoryRequirements &memoryRequirements,
                                                  const void *extraAllocationInfo,
                                                  T *bufferOrImage,
-                                                 vk::DeviceMemory *deviceMemoryOut)
+                                                 vk::Allocation *allocationOut)
 {
-    const vk::MemoryProperties &memoryProperties = context->getRenderer()->getMemoryProperties();
+    RendererVk *renderer                         = context->getRenderer();
+    const vk::MemoryProperties &memoryProperties = renderer->getMemoryProperties();
+
+    uint32_t memoryTypeIndex = 0;
+    ANGLE_TRY(memoryProperties.findCompatibleMemoryIndex(context, memoryRequirements,
+                                                         requestedMemoryPropertyFlags,
+                                                         memoryPropertyFlagsOut, &memoryTypeIndex));
 
-    ANGLE_TRY(FindAndAllocateCompatibleMemory(
-        context, memoryProperties, requestedMemoryPropertyFlags, memoryPropertyFlagsOut,
-        memoryRequirements, extraAllocationInfo, deviceMemoryOut));
-    ANGLE_VK_TRY(context, bufferOrImage->bindMemory(context->getDevice(), *deviceMemoryOut));
+    ANGLE_VK_TRY(context, renderer->getMemoryAllocator().allocate(
+                              memoryTypeIndex, resourceType, memoryRequirements,
+                              extraAllocationInfo, allocationOut));
+    ANGLE_VK_TRY(context, bufferOrImage->bindMemory(context->getDevice(),
+                                                    allocationOut->getMemory(),
+                                                    allocationOut->getOffset()));
     return angle::Result::Continue;
 }
 
 template <typename T>
 angle::Result AllocateBufferOrImageMemory(vk::Context *context,
+                                          vk::MemoryResourceType resourceType,
                                           VkMemoryPropertyFlags requestedMemoryPropertyFlags,
                                           VkMemoryPropertyFlags *memoryPropertyFlagsOut,
                                           const void *extraAllocationInfo,
                                           T *bufferOrImage,
-                                          vk::DeviceMemory *deviceMemoryOut)
+                                          vk::Allocation *allocationOut)
 {
     // Call driver to determine memory requirements.
     VkMemoryRequirements memoryRequirements;
     bufferOrImage->getMemoryRequirements(context->getDevice(), &memoryRequirements);
 
     ANGLE_TRY(AllocateAndBindBufferOrImageMemory(
-        context, requestedMemoryPropertyFlags, memoryPropertyFlagsOut, memoryRequirements,
-        extraAllocationInfo, bufferOrImage, deviceMemoryOut));
+        context, resourceType, requestedMemoryPropertyFlags, memoryPropertyFlagsOut,
+        memoryRequirements, extraAllocationInfo, bufferOrImage, allocationOut));
 
     return angle::Result::Continue;
 }
@@ -347,13 +334,12 @@ StagingBuffer::StagingBuffer() : mSize(0) {}
 void StagingBuffer::destroy(VkDevice device)
 {
     mBuffer.destroy(device);
-    mDeviceMemory.destroy(device);
+    mAllocation.destroy(device);
     mSize = 0;
 }
 
 angle::Result StagingBuffer::init(ContextVk *contextVk, VkDeviceSize size, StagingUsage usage)
 {
-    // TODO: Remove with anglebug.com/2162: Vulkan: Implement device memory sub-allocation
     // Check if we have too many resources allocated already and need to free some before allocating
     // more and (possibly) exceeding the device's limits.
     if (contextVk->shouldFlush())
@@ -375,7 +361,7 @@ angle::Result StagingBuffer::init(ContextVk *contextVk, VkDeviceSize size, Stagi
 
     ANGLE_VK_TRY(contextVk, mBuffer.init(contextVk->getDevice(), createInfo));
     VkMemoryPropertyFlags flagsOut = 0;
-    ANGLE_TRY(AllocateBufferMemory(contextVk, flags, &flagsOut, nullptr, &mBuffer, &mDeviceMemory));
+    ANGLE_TRY(AllocateBufferMemory(contextVk, flags, &flagsOut, nullptr, &mBuffer, &mAllocation));
     mSize = static_cast<size_t>(size);
     return angle::Result::Continue;
 }
@@ -383,7 +369,7 @@ angle::Result StagingBuffer::init(ContextVk *contextVk, VkDeviceSize size, Stagi
 void StagingBuffer::release(ContextVk *contextVk)
 {
     contextVk->addGarbage(&mBuffer);
-    contextVk->addGarbage(&mDeviceMemory);
+    contextVk->addGarbage(&mAllocation);
 }
 
 angle::Result AllocateBufferMemory(vk::Context *context,
@@ -391,22 +377,23 @@ angle::Result AllocateBufferMemory(vk::Context *context,
                                    VkMemoryPropertyFlags *memoryPropertyFlagsOut,
                                    const void *extraAllocationInfo,
                                    Buffer *buffer,
-                                   DeviceMemory *deviceMemoryOut)
+                                   Allocation *allocationOut)
 {
-    return AllocateBufferOrImageMemory(context, requestedMemoryPropertyFlags,
-                                       memoryPropertyFlagsOut, extraAllocationInfo, buffer,
-                                       deviceMemoryOut);
+    return AllocateBufferOrImageMemory(context, MemoryResourceType::Buffer,
+                                       requestedMemoryPropertyFlags, memoryPropertyFlagsOut,
+                                       extraAllocationInfo, buffer, allocationOut);
 }
 
 angle::Result AllocateImageMemory(vk::Context *context,
                                   VkMemoryPropertyFlags memoryPropertyFlags,
                                   const void *extraAllocationInfo,
                                   Image *image,
-                                  DeviceMemory *deviceMemoryOut)
+                                  Allocation *allocationOut)
 {
     VkMemoryPropertyFlags memoryPropertyFlagsOut = 0;
-    return AllocateBufferOrImageMemory(context, memoryPropertyFlags, &memoryPropertyFlagsOut,
-                                       extraAllocationInfo, image, deviceMemoryOut);
+    return AllocateBufferOrImageMemory(context, MemoryResourceType::Image, memoryPropertyFlags,
+                                       &memoryPropertyFlagsOut, extraAllocationInfo, image,
+                                       allocationOut);
 }
 
 angle::Result AllocateImageMemoryWithRequirements(vk::Context *context,
@@ -414,12 +401,13 @@ angle::Result AllocateImageMemoryWithRequirements(vk::Context *context,
                                                   const VkMemoryRequirements &memoryRequirements,
                                                   const void *extraAllocationInfo,
                                                   Image *image,
-                                                  DeviceMemory *deviceMemoryOut)
+                                                  Allocation *allocationOut)
 {
     VkMemoryPropertyFlags memoryPropertyFlagsOut = 0;
-    return AllocateAndBindBufferOrImageMemory(context, memoryPropertyFlags, &memoryPropertyFlagsOut,
+    return AllocateAndBindBufferOrImageMemory(context, MemoryResourceType::Image,
+                                              memoryPropertyFlags, &memoryPropertyFlagsOut,
                                               memoryRequirements, extraAllocationInfo, image,
-                                              deviceMemoryOut);
+                                              allocationOut);
 }
 
 angle::Result InitShaderAndSerial(Context *context,
@@ -505,6 +493,9 @@ void GarbageObject::destroy(VkDevice device)
         case HandleType::DeviceMemory:
             vkFreeMemory(device, (VkDeviceMemory)mHandle, nullptr);
             break;
+        case HandleType::Allocation:
+            Allocation::DestroyHandle((AllocationRecord *)(uintptr_t)mHandle);
+            break;
         case HandleType::Buffer:
             vkDestroyBuffer(device, (VkBuffer)mHandle, nullptr);
             break;
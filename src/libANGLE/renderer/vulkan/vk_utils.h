@@ -19,6 +19,7 @@
 #include "libANGLE/Error.h"
 #include "libANGLE/Observer.h"
 #include "libANGLE/renderer/vulkan/SecondaryCommandBuffer.h"
+#include "libANGLE/renderer/vulkan/vk_memory_allocator.h"
 #include "libANGLE/renderer/vulkan/vk_wrapper.h"
 
 #define ANGLE_GL_OBJECTS_X(PROC) \
@@ -291,6 +292,8 @@ class MemoryProperties final : angle::NonCopyable
                                             uint32_t *indexOut) const;
     void destroy();
 
+    const VkPhysicalDeviceMemoryProperties &getProperties() const { return mMemoryProperties; }
+
   private:
     VkPhysicalDeviceMemoryProperties mMemoryProperties;
 };
@@ -307,13 +310,13 @@ class StagingBuffer final : angle::NonCopyable
 
     Buffer &getBuffer() { return mBuffer; }
     const Buffer &getBuffer() const { return mBuffer; }
-    DeviceMemory &getDeviceMemory() { return mDeviceMemory; }
-    const DeviceMemory &getDeviceMemory() const { return mDeviceMemory; }
+    Allocation &getAllocation() { return mAllocation; }
+    const Allocation &getAllocation() const { return mAllocation; }
     size_t getSize() const { return mSize; }
 
   private:
     Buffer mBuffer;
-    DeviceMemory mDeviceMemory;
+    Allocation mAllocation;
     size_t mSize;
 };
 
@@ -322,19 +325,19 @@ angle::Result AllocateBufferMemory(Context *context,
                                    VkMemoryPropertyFlags *memoryPropertyFlagsOut,
                                    const void *extraAllocationInfo,
                                    Buffer *buffer,
-                                   DeviceMemory *deviceMemoryOut);
+                                   Allocation *allocationOut);
 
 angle::Result AllocateImageMemory(Context *context,
                                   VkMemoryPropertyFlags memoryPropertyFlags,
                                   const void *extraAllocationInfo,
                                   Image *image,
-                                  DeviceMemory *deviceMemoryOut);
+                                  Allocation *allocationOut);
 angle::Result AllocateImageMemoryWithRequirements(Context *context,
                                                   VkMemoryPropertyFlags memoryPropertyFlags,
                                                   const VkMemoryRequirements &memoryRequirements,
                                                   const void *extraAllocationInfo,
                                                   Image *image,
-                                                  DeviceMemory *deviceMemoryOut);
+                                                  Allocation *allocationOut);
 
 using ShaderAndSerial = ObjectAndSerial<ShaderModule>;
 
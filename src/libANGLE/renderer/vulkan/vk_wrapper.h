@@ -28,6 +28,7 @@ namespace vk
 // DescriptorSet
 
 #define ANGLE_HANDLE_TYPES_X(FUNC) \
+    FUNC(Allocation)               \
     FUNC(Buffer)                   \
     FUNC(BufferView)               \
     FUNC(CommandPool)              \
@@ -368,7 +369,7 @@ class Image final : public WrappedObject<Image, VkImage>
     VkResult init(VkDevice device, const VkImageCreateInfo &createInfo);
 
     void getMemoryRequirements(VkDevice device, VkMemoryRequirements *requirementsOut) const;
-    VkResult bindMemory(VkDevice device, const DeviceMemory &deviceMemory);
+    VkResult bindMemory(VkDevice device, VkDeviceMemory memory, VkDeviceSize memoryOffset);
 
     void getSubresourceLayout(VkDevice device,
                               VkImageAspectFlagBits aspectMask,
@@ -445,7 +446,7 @@ class Buffer final : public WrappedObject<Buffer, VkBuffer>
     void destroy(VkDevice device);
 
     VkResult init(VkDevice device, const VkBufferCreateInfo &createInfo);
-    VkResult bindMemory(VkDevice device, const DeviceMemory &deviceMemory);
+    VkResult bindMemory(VkDevice device, VkDeviceMemory memory, VkDeviceSize memoryOffset);
     void getMemoryRequirements(VkDevice device, VkMemoryRequirements *memoryRequirementsOut);
 };
 
@@ -1069,10 +1070,12 @@ ANGLE_INLINE void Image::getMemoryRequirements(VkDevice device,
     vkGetImageMemoryRequirements(device, mHandle, requirementsOut);
 }
 
-ANGLE_INLINE VkResult Image::bindMemory(VkDevice device, const vk::DeviceMemory &deviceMemory)
+ANGLE_INLINE VkResult Image::bindMemory(VkDevice device,
+                                        VkDeviceMemory memory,
+                                        VkDeviceSize memoryOffset)
 {
-    ASSERT(valid() && deviceMemory.valid());
-    return vkBindImageMemory(device, mHandle, deviceMemory.getHandle(), 0);
+    ASSERT(valid() && memory != VK_NULL_HANDLE);
+    return vkBindImageMemory(device, mHandle, memory, memoryOffset);
 }
 
 ANGLE_INLINE void Image::getSubresourceLayout(VkDevice device,
@@ -1210,10 +1213,12 @@ ANGLE_INLINE VkResult Buffer::init(VkDevice device, const VkBufferCreateInfo &cr
     return vkCreateBuffer(device, &createInfo, nullptr, &mHandle);
 }
 
-ANGLE_INLINE VkResult Buffer::bindMemory(VkDevice device, const DeviceMemory &deviceMemory)
+ANGLE_INLINE VkResult Buffer::bindMemory(VkDevice device,
+                                         VkDeviceMemory memory,
+                                         VkDeviceSize memoryOffset)
 {
-    ASSERT(valid() && deviceMemory.valid());
-    return vkBindBufferMemory(device, mHandle, deviceMemory.getHandle(), 0);
+    ASSERT(valid() && memory != VK_NULL_HANDLE);
+    return vkBindBufferMemory(device, mHandle, memory, memoryOffset);
 }
 
 ANGLE_INLINE void Buffer::getMemoryRequirements(VkDevice device,
@@ -1254,6 +1254,20 @@ Error ValidateCreateContext(Display *display,
                 }
                 break;
 
+            case EGL_CONTEXT_DEFERRED_EXECUTION_ANGLE:
+                if (!display->getExtensions().createContextDeferredExecution)
+                {
+                    return EglBadAttribute()
+                           << "Attribute EGL_CONTEXT_DEFERRED_EXECUTION_ANGLE "
+                              "requires EGL_ANGLE_create_context_deferred_execution.";
+                }
+                if (value != EGL_TRUE && value != EGL_FALSE)
+                {
+                    return EglBadAttribute() << "EGL_CONTEXT_DEFERRED_EXECUTION_ANGLE must be "
+                                                "either EGL_TRUE or EGL_FALSE.";
+                }
+                break;
+
             default:
                 return EglBadAttribute() << "Unknown attribute.";
         }
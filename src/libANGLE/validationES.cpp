@@ -2838,6 +2838,36 @@ const char *ValidateDrawStates(Context *context)
     return nullptr;
 }
 
+bool ValidateDrawModeAndStates(Context *context, PrimitiveMode mode)
+{
+    const StateCache &stateCache = context->getStateCache();
+
+    if (!stateCache.isValidDrawMode(mode))
+    {
+        RecordDrawModeError(context, mode);
+        return false;
+    }
+
+    intptr_t drawStatesError = stateCache.getBasicDrawStatesError(context);
+    if (drawStatesError)
+    {
+        const char *errorMessage = reinterpret_cast<const char *>(drawStatesError);
+
+        // All errors from ValidateDrawStates should return INVALID_OPERATION except Framebuffer
+        // Incomplete.
+        GLenum errorCode =
+            (errorMessage == kDrawFramebufferIncomplete ? GL_INVALID_FRAMEBUFFER_OPERATION
+                                                        : GL_INVALID_OPERATION);
+        context->validationError(errorCode, errorMessage);
+        return false;
+    }
+
+    // The verdicts were invalidated since the last draw, otherwise this draw would have taken the
+    // fast path in ValidateDrawBase.
+    stateCache.updateDrawVerdicts(context);
+    return true;
+}
+
 void RecordDrawModeError(Context *context, PrimitiveMode mode)
 {
     const State &state                      = context->getState();
@@ -309,29 +309,17 @@ bool ValidateCopyTexImageParametersBase(Context *context,
 void RecordDrawModeError(Context *context, PrimitiveMode mode);
 const char *ValidateDrawElementsStates(Context *context);
 
+// Checks the draw mode and the basic draw states without the cached draw verdicts.
+bool ValidateDrawModeAndStates(Context *context, PrimitiveMode mode);
+
 ANGLE_INLINE bool ValidateDrawBase(Context *context, PrimitiveMode mode)
 {
-    if (!context->getStateCache().isValidDrawMode(mode))
-    {
-        RecordDrawModeError(context, mode);
-        return false;
-    }
-
-    intptr_t drawStatesError = context->getStateCache().getBasicDrawStatesError(context);
-    if (drawStatesError)
+    if (ANGLE_LIKELY(context->getStateCache().isDrawArraysVerdictValid(mode)))
     {
-        const char *errorMessage = reinterpret_cast<const char *>(drawStatesError);
-
-        // All errors from ValidateDrawStates should return INVALID_OPERATION except Framebuffer
-        // Incomplete.
-        GLenum errorCode =
-            (errorMessage == err::kDrawFramebufferIncomplete ? GL_INVALID_FRAMEBUFFER_OPERATION
-                                                             : GL_INVALID_OPERATION);
-        context->validationError(errorCode, errorMessage);
-        return false;
+        return true;
     }
 
-    return true;
+    return ValidateDrawModeAndStates(context, mode);
 }
 
 bool ValidateDrawArraysInstancedBase(Context *context,
@@ -862,7 +850,10 @@ ANGLE_INLINE bool ValidateDrawElementsCommon(Context *context,
                                              const void *indices,
                                              GLsizei primcount)
 {
-    if (!ValidateDrawElementsBase(context, mode, type))
+    // Covers both ValidateDrawElementsBase and ValidateDrawBase.
+    bool hasValidVerdict = context->getStateCache().isDrawElementsVerdictValid(mode, type);
+
+    if (!hasValidVerdict && !ValidateDrawElementsBase(context, mode, type))
     {
         return false;
     }
@@ -901,10 +892,10 @@ ANGLE_INLINE bool ValidateDrawElementsCommon(Context *context,
         }
 
         // Early exit.
-        return ValidateDrawBase(context, mode);
+        return hasValidVerdict || ValidateDrawBase(context, mode);
     }
 
-    if (!ValidateDrawBase(context, mode))
+    if (!hasValidVerdict && !ValidateDrawBase(context, mode))
     {
         return false;
     }
@@ -2742,6 +2742,14 @@ bool ValidateIndexedStateQuery(Context *context, GLenum pname, GLuint index, GLs
                 return false;
             }
             break;
+        case GL_EFFECTIVE_STATE_CALLS_ANGLE:
+        case GL_REDUNDANT_STATE_CALLS_ANGLE:
+            if (index >= angle::EnumSize<StateCall>())
+            {
+                context->validationError(GL_INVALID_VALUE, kIndexExceedsStateCalls);
+                return false;
+            }
+            break;
         default:
             context->validationError(GL_INVALID_ENUM, kEnumNotSupported);
             return false;
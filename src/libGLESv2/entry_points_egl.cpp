@@ -328,6 +328,7 @@ EGLBoolean EGLAPIENTRY EGL_DestroySurface(EGLDisplay dpy, EGLSurface surface)
     ANGLE_EGL_TRY_RETURN(thread, ValidateDestroySurface(display, eglSurface, surface),
                          "eglDestroySurface", GetSurfaceIfValid(display, eglSurface), EGL_FALSE);
 
+    ScopedShareGroupLock shareGroupLock(thread->getContext());
     ANGLE_EGL_TRY_RETURN(thread, display->destroySurface(eglSurface), "eglDestroySurface",
                          GetSurfaceIfValid(display, eglSurface), EGL_FALSE);
 
@@ -380,6 +381,8 @@ EGLContext EGLAPIENTRY EGL_CreateContext(EGLDisplay dpy,
                          ValidateCreateContext(display, configuration, sharedGLContext, attributes),
                          "eglCreateContext", GetDisplayIfValid(display), EGL_NO_CONTEXT);
 
+    ScopedShareGroupLock shareGroupLock(sharedGLContext);
+
     gl::Context *context = nullptr;
     ANGLE_EGL_TRY_RETURN(thread,
                          display->createContext(configuration, sharedGLContext, thread->getAPI(),
@@ -405,6 +408,9 @@ EGLBoolean EGLAPIENTRY EGL_DestroyContext(EGLDisplay dpy, EGLContext ctx)
 
     bool contextWasCurrent = context == thread->getContext();
 
+    // The context is made current while it's destroyed, and the current one is restored after.
+    ScopedShareGroupLock shareGroupLock(context, thread->getContext());
+
     ANGLE_EGL_TRY_RETURN(thread, display->destroyContext(thread, context), "eglDestroyContext",
                          GetContextIfValid(display, context), EGL_FALSE);
 
@@ -445,6 +451,7 @@ EGLBoolean EGLAPIENTRY EGL_MakeCurrent(EGLDisplay dpy,
     // Only call makeCurrent if the context or surfaces have changed.
     if (previousDraw != drawSurface || previousRead != readSurface || previousContext != context)
     {
+        ScopedShareGroupLock shareGroupLock(previousContext, context);
         ANGLE_EGL_TRY_RETURN(thread,
                              display->makeCurrent(thread, drawSurface, readSurface, context),
                              "eglMakeCurrent", GetContextIfValid(display, context), EGL_FALSE);
@@ -531,6 +538,7 @@ EGLBoolean EGLAPIENTRY EGL_WaitGL(void)
 
     // eglWaitGL like calling eglWaitClient with the OpenGL ES API bound. Since we only implement
     // OpenGL ES we can do the call directly.
+    ScopedShareGroupLock shareGroupLock(thread->getContext());
     ANGLE_EGL_TRY_RETURN(thread, display->waitClient(thread->getContext()), "eglWaitGL",
                          GetDisplayIfValid(display), EGL_FALSE);
 
@@ -549,6 +557,7 @@ EGLBoolean EGLAPIENTRY EGL_WaitNative(EGLint engine)
     ANGLE_EGL_TRY_RETURN(thread, ValidateWaitNative(display, engine), "eglWaitNative",
                          GetThreadIfValid(thread), EGL_FALSE);
 
+    ScopedShareGroupLock shareGroupLock(thread->getContext());
     ANGLE_EGL_TRY_RETURN(thread, display->waitNative(thread->getContext(), engine), "eglWaitNative",
                          GetThreadIfValid(thread), EGL_FALSE);
 
@@ -569,6 +578,7 @@ EGLBoolean EGLAPIENTRY EGL_SwapBuffers(EGLDisplay dpy, EGLSurface surface)
     ANGLE_EGL_TRY_RETURN(thread, ValidateSwapBuffers(thread, display, eglSurface), "eglSwapBuffers",
                          GetSurfaceIfValid(display, eglSurface), EGL_FALSE);
 
+    ScopedShareGroupLock shareGroupLock(thread->getContext());
     ANGLE_EGL_TRY_RETURN(thread, eglSurface->swap(thread->getContext()), "eglSwapBuffers",
                          GetSurfaceIfValid(display, eglSurface), EGL_FALSE);
 
@@ -619,6 +629,7 @@ EGLBoolean EGLAPIENTRY EGL_BindTexImage(EGLDisplay dpy, EGLSurface surface, EGLi
 
     if (context)
     {
+        ScopedShareGroupLock shareGroupLock(context);
         ANGLE_EGL_TRY_RETURN(thread, eglSurface->bindTexImage(context, textureObject, buffer),
                              "eglBindTexImage", GetSurfaceIfValid(display, eglSurface), EGL_FALSE);
     }
@@ -669,6 +680,7 @@ EGLBoolean EGLAPIENTRY EGL_ReleaseTexImage(EGLDisplay dpy, EGLSurface surface, E
 
     if (texture)
     {
+        ScopedShareGroupLock shareGroupLock(thread->getContext());
         ANGLE_EGL_TRY_RETURN(thread, eglSurface->releaseTexImage(thread->getContext(), buffer),
                              "eglReleaseTexImage", GetSurfaceIfValid(display, eglSurface),
                              EGL_FALSE);
@@ -781,6 +793,7 @@ EGLBoolean EGLAPIENTRY EGL_ReleaseThread(void)
     {
         if (previousDisplay != EGL_NO_DISPLAY)
         {
+            ScopedShareGroupLock shareGroupLock(previousContext);
             ANGLE_EGL_TRY_RETURN(thread,
                                  previousDisplay->makeCurrent(thread, nullptr, nullptr, nullptr),
                                  "eglReleaseThread", nullptr, EGL_FALSE);
@@ -805,6 +818,7 @@ EGLBoolean EGLAPIENTRY EGL_WaitClient(void)
     ANGLE_EGL_TRY_RETURN(thread, ValidateDisplay(display), "eglWaitClient",
                          GetContextIfValid(display, context), EGL_FALSE);
 
+    ScopedShareGroupLock shareGroupLock(context);
     ANGLE_EGL_TRY_RETURN(thread, display->waitClient(context), "eglWaitClient",
                          GetContextIfValid(display, context), EGL_FALSE);
 
@@ -844,6 +858,7 @@ EGLSync EGLAPIENTRY EGL_CreateSync(EGLDisplay dpy, EGLenum type, const EGLAttrib
         thread, ValidateCreateSyncKHR(display, type, attributes, currentDisplay, currentContext),
         "eglCreateSync", GetDisplayIfValid(display), EGL_NO_SYNC);
 
+    ScopedShareGroupLock shareGroupLock(currentContext);
     egl::Sync *syncObject = nullptr;
     ANGLE_EGL_TRY_RETURN(thread, display->createSync(currentContext, type, attributes, &syncObject),
                          "eglCreateSync", GetDisplayIfValid(display), EGL_NO_SYNC);
@@ -888,6 +903,7 @@ EGLint EGLAPIENTRY EGL_ClientWaitSync(EGLDisplay dpy, EGLSync sync, EGLint flags
 
     gl::Context *currentContext = thread->getContext();
     EGLint syncStatus           = EGL_FALSE;
+    ScopedShareGroupLock shareGroupLock(currentContext);
     ANGLE_EGL_TRY_RETURN(
         thread, syncObject->clientWait(display, currentContext, flags, timeout, &syncStatus),
         "eglClientWaitSync", GetSyncIfValid(display, syncObject), EGL_FALSE);
@@ -949,6 +965,7 @@ EGLImage EGLAPIENTRY EGL_CreateImage(EGLDisplay dpy,
         return EGL_NO_IMAGE;
     }
 
+    ScopedShareGroupLock shareGroupLock(context);
     Image *image = nullptr;
     error        = display->createImage(context, target, buffer, attributes, &image);
     if (error.isError())
@@ -977,6 +994,7 @@ EGLBoolean EGLAPIENTRY EGL_DestroyImage(EGLDisplay dpy, EGLImage image)
         return EGL_FALSE;
     }
 
+    ScopedShareGroupLock shareGroupLock(thread->getContext(), img->getShareGroupMutex());
     display->destroyImage(img);
 
     thread->setSuccess();
@@ -1071,6 +1089,7 @@ EGLBoolean EGLAPIENTRY EGL_WaitSync(EGLDisplay dpy, EGLSync sync, EGLint flags)
                          "eglWaitSync", GetSyncIfValid(display, syncObject), EGL_FALSE);
 
     gl::Context *currentContext = thread->getContext();
+    ScopedShareGroupLock shareGroupLock(currentContext);
     ANGLE_EGL_TRY_RETURN(thread, syncObject->serverWait(display, currentContext, flags),
                          "eglWaitSync", GetSyncIfValid(display, syncObject), EGL_FALSE);
 
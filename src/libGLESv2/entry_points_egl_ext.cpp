@@ -153,6 +153,7 @@ EGLBoolean EGLAPIENTRY EGL_PostSubBufferNV(EGLDisplay dpy,
     }
 
     // TODO(jmadill): Validate Surface is bound to the thread.
+    ScopedShareGroupLock shareGroupLock(thread->getContext());
     error = eglSurface->postSubBuffer(thread->getContext(), x, y, width, height);
     if (error.isError())
     {
@@ -425,6 +426,7 @@ ANGLE_EXPORT EGLImageKHR EGLAPIENTRY EGL_CreateImageKHR(EGLDisplay dpy,
         return EGL_NO_IMAGE;
     }
 
+    ScopedShareGroupLock shareGroupLock(context);
     Image *image = nullptr;
     error        = display->createImage(context, target, buffer, attributes, &image);
     if (error.isError())
@@ -454,6 +456,7 @@ ANGLE_EXPORT EGLBoolean EGLAPIENTRY EGL_DestroyImageKHR(EGLDisplay dpy, EGLImage
         return EGL_FALSE;
     }
 
+    ScopedShareGroupLock shareGroupLock(thread->getContext(), img->getShareGroupMutex());
     display->destroyImage(img);
 
     thread->setSuccess();
@@ -705,6 +708,7 @@ EGLBoolean EGLAPIENTRY EGL_StreamConsumerGLTextureExternalKHR(EGLDisplay dpy, EG
         return EGL_FALSE;
     }
 
+    ScopedShareGroupLock shareGroupLock(context);
     error = streamObject->createConsumerGLTextureExternal(AttributeMap(), context);
     if (error.isError())
     {
@@ -736,6 +740,7 @@ EGLBoolean EGLAPIENTRY EGL_StreamConsumerAcquireKHR(EGLDisplay dpy, EGLStreamKHR
         return EGL_FALSE;
     }
 
+    ScopedShareGroupLock shareGroupLock(context);
     error = streamObject->consumerAcquire(context);
     if (error.isError())
     {
@@ -767,6 +772,7 @@ EGLBoolean EGLAPIENTRY EGL_StreamConsumerReleaseKHR(EGLDisplay dpy, EGLStreamKHR
         return EGL_FALSE;
     }
 
+    ScopedShareGroupLock shareGroupLock(context);
     error = streamObject->consumerRelease(context);
     if (error.isError())
     {
@@ -803,6 +809,7 @@ EGLBoolean EGLAPIENTRY EGL_StreamConsumerGLTextureExternalAttribsNV(EGLDisplay d
         return EGL_FALSE;
     }
 
+    ScopedShareGroupLock shareGroupLock(context);
     error = streamObject->createConsumerGLTextureExternal(attributes, context);
     if (error.isError())
     {
@@ -907,6 +914,7 @@ ANGLE_EXPORT EGLSync EGLAPIENTRY EGL_CreateSyncKHR(EGLDisplay dpy,
         thread, ValidateCreateSyncKHR(display, type, attributes, currentDisplay, currentContext),
         "eglCreateSync", GetDisplayIfValid(display), EGL_NO_SYNC);
 
+    ScopedShareGroupLock shareGroupLock(currentContext);
     egl::Sync *syncObject = nullptr;
     ANGLE_EGL_TRY_RETURN(thread, display->createSync(currentContext, type, attributes, &syncObject),
                          "eglCreateSync", GetDisplayIfValid(display), EGL_NO_SYNC);
@@ -954,6 +962,7 @@ ANGLE_EXPORT EGLint EGLAPIENTRY EGL_ClientWaitSyncKHR(EGLDisplay dpy,
 
     gl::Context *currentContext = thread->getContext();
     EGLint syncStatus           = EGL_FALSE;
+    ScopedShareGroupLock shareGroupLock(currentContext);
     ANGLE_EGL_TRY_RETURN(
         thread, syncObject->clientWait(display, currentContext, flags, timeout, &syncStatus),
         "eglClientWaitSync", GetSyncIfValid(display, syncObject), EGL_FALSE);
@@ -1004,6 +1013,7 @@ ANGLE_EXPORT EGLBoolean EGLAPIENTRY EGL_WaitSyncKHR(EGLDisplay dpy, EGLSync sync
                          "eglWaitSync", GetSyncIfValid(display, syncObject), EGL_FALSE);
 
     gl::Context *currentContext = thread->getContext();
+    ScopedShareGroupLock shareGroupLock(currentContext);
     ANGLE_EGL_TRY_RETURN(thread, syncObject->serverWait(display, currentContext, flags),
                          "eglWaitSync", GetSyncIfValid(display, syncObject), EGL_FALSE);
 
@@ -1072,6 +1082,7 @@ EGLBoolean EGLAPIENTRY EGL_SwapBuffersWithDamageKHR(EGLDisplay dpy,
         return EGL_FALSE;
     }
 
+    ScopedShareGroupLock shareGroupLock(thread->getContext());
     error = eglSurface->swapWithDamage(thread->getContext(), rects, n_rects);
     if (error.isError())
     {
@@ -20,6 +20,20 @@
 
 namespace gl
 {
+namespace
+{
+void ActiveTextureDeferred(Context *context, GLenum texture)
+{
+    std::unique_lock<std::mutex> shareContextLock = LockShareGroup(context);
+    bool isCallValid = (context->skipValidation() || ValidateActiveTexture(context, texture));
+    if (isCallValid)
+    {
+        context->activeTexture(texture);
+    }
+    ANGLE_CAPTURE(ActiveTexture, isCallValid, context, texture);
+}
+}  // anonymous namespace
+
 void GL_APIENTRY ActiveTexture(GLenum texture)
 {
     Context *context = GetValidGlobalContext();
@@ -28,6 +42,11 @@ void GL_APIENTRY ActiveTexture(GLenum texture)
 
     if (context)
     {
+        if (context->isDeferred())
+        {
+            context->getDeferredCommandQueue()->push(ActiveTextureDeferred, texture);
+            return;
+        }
         std::unique_lock<std::mutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateActiveTexture(context, texture));
         if (isCallValid)
@@ -143,6 +162,21 @@ void GL_APIENTRY BindRenderbuffer(GLenum target, GLuint renderbuffer)
     }
 }
 
+namespace
+{
+void BindTextureDeferred(Context *context, TextureType targetPacked, TextureID texturePacked)
+{
+    std::unique_lock<std::mutex> shareContextLock = LockShareGroup(context);
+    bool isCallValid =
+        (context->skipValidation() || ValidateBindTexture(context, targetPacked, texturePacked));
+    if (isCallValid)
+    {
+        context->bindTexture(targetPacked, texturePacked);
+    }
+    ANGLE_CAPTURE(BindTexture, isCallValid, context, targetPacked, texturePacked);
+}
+}  // anonymous namespace
+
 void GL_APIENTRY BindTexture(GLenum target, GLuint texture)
 {
     Context *context = GetValidGlobalContext();
@@ -151,8 +185,14 @@ void GL_APIENTRY BindTexture(GLenum target, GLuint texture)
 
     if (context)
     {
-        TextureType targetPacked                      = FromGL<TextureType>(target);
-        TextureID texturePacked                       = FromGL<TextureID>(texture);
+        TextureType targetPacked = FromGL<TextureType>(target);
+        TextureID texturePacked  = FromGL<TextureID>(texture);
+        if (context->isDeferred())
+        {
+            context->getDeferredCommandQueue()->push(BindTextureDeferred, targetPacked,
+                                                     texturePacked);
+            return;
+        }
         std::unique_lock<std::mutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                              = (context->skipValidation() ||
                             ValidateBindTexture(context, targetPacked, texturePacked));
@@ -223,6 +263,20 @@ void GL_APIENTRY BlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha)
     }
 }
 
+namespace
+{
+void BlendFuncDeferred(Context *context, GLenum sfactor, GLenum dfactor)
+{
+    std::unique_lock<std::mutex> shareContextLock = LockShareGroup(context);
+    bool isCallValid = (context->skipValidation() || ValidateBlendFunc(context, sfactor, dfactor));
+    if (isCallValid)
+    {
+        context->blendFunc(sfactor, dfactor);
+    }
+    ANGLE_CAPTURE(BlendFunc, isCallValid, context, sfactor, dfactor);
+}
+}  // anonymous namespace
+
 void GL_APIENTRY BlendFunc(GLenum sfactor, GLenum dfactor)
 {
     Context *context = GetValidGlobalContext();
@@ -232,6 +286,11 @@ void GL_APIENTRY BlendFunc(GLenum sfactor, GLenum dfactor)
 
     if (context)
     {
+        if (context->isDeferred())
+        {
+            context->getDeferredCommandQueue()->push(BlendFuncDeferred, sfactor, dfactor);
+            return;
+        }
         std::unique_lock<std::mutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateBlendFunc(context, sfactor, dfactor));
@@ -350,6 +409,20 @@ GLenum GL_APIENTRY CheckFramebufferStatus(GLenum target)
     return returnValue;
 }
 
+namespace
+{
+void ClearDeferred(Context *context, GLbitfield mask)
+{
+    std::unique_lock<std::mutex> shareContextLock = LockShareGroup(context);
+    bool isCallValid = (context->skipValidation() || ValidateClear(context, mask));
+    if (isCallValid)
+    {
+        context->clear(mask);
+    }
+    ANGLE_CAPTURE(Clear, isCallValid, context, mask);
+}
+}  // anonymous namespace
+
 void GL_APIENTRY Clear(GLbitfield mask)
 {
     Context *context = GetValidGlobalContext();
@@ -358,6 +431,11 @@ void GL_APIENTRY Clear(GLbitfield mask)
 
     if (context)
     {
+        if (context->isDeferred())
+        {
+            context->getDeferredCommandQueue()->push(ClearDeferred, mask);
+            return;
+        }
         std::unique_lock<std::mutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateClear(context, mask));
         if (isCallValid)
@@ -368,6 +446,21 @@ void GL_APIENTRY Clear(GLbitfield mask)
     }
 }
 
+namespace
+{
+void ClearColorDeferred(Context *context, GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
+{
+    std::unique_lock<std::mutex> shareContextLock = LockShareGroup(context);
+    bool isCallValid =
+        (context->skipValidation() || ValidateClearColor(context, red, green, blue, alpha));
+    if (isCallValid)
+    {
+        context->clearColor(red, green, blue, alpha);
+    }
+    ANGLE_CAPTURE(ClearColor, isCallValid, context, red, green, blue, alpha);
+}
+}  // anonymous namespace
+
 void GL_APIENTRY ClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha)
 {
     Context *context = GetValidGlobalContext();
@@ -378,6 +471,11 @@ void GL_APIENTRY ClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat al
 
     if (context)
     {
+        if (context->isDeferred())
+        {
+            context->getDeferredCommandQueue()->push(ClearColorDeferred, red, green, blue, alpha);
+            return;
+        }
         std::unique_lock<std::mutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateClearColor(context, red, green, blue, alpha));
@@ -423,6 +521,25 @@ void GL_APIENTRY ClearStencil(GLint s)
     }
 }
 
+namespace
+{
+void ColorMaskDeferred(Context *context,
+                       GLboolean red,
+                       GLboolean green,
+                       GLboolean blue,
+                       GLboolean alpha)
+{
+    std::unique_lock<std::mutex> shareContextLock = LockShareGroup(context);
+    bool isCallValid =
+        (context->skipValidation() || ValidateColorMask(context, red, green, blue, alpha));
+    if (isCallValid)
+    {
+        context->colorMask(red, green, blue, alpha);
+    }
+    ANGLE_CAPTURE(ColorMask, isCallValid, context, red, green, blue, alpha);
+}
+}  // anonymous namespace
+
 void GL_APIENTRY ColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha)
 {
     Context *context = GetValidGlobalContext();
@@ -434,6 +551,11 @@ void GL_APIENTRY ColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboo
 
     if (context)
     {
+        if (context->isDeferred())
+        {
+            context->getDeferredCommandQueue()->push(ColorMaskDeferred, red, green, blue, alpha);
+            return;
+        }
         std::unique_lock<std::mutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateColorMask(context, red, green, blue, alpha));
@@ -817,6 +939,20 @@ void GL_APIENTRY DepthFunc(GLenum func)
     }
 }
 
+namespace
+{
+void DepthMaskDeferred(Context *context, GLboolean flag)
+{
+    std::unique_lock<std::mutex> shareContextLock = LockShareGroup(context);
+    bool isCallValid = (context->skipValidation() || ValidateDepthMask(context, flag));
+    if (isCallValid)
+    {
+        context->depthMask(flag);
+    }
+    ANGLE_CAPTURE(DepthMask, isCallValid, context, flag);
+}
+}  // anonymous namespace
+
 void GL_APIENTRY DepthMask(GLboolean flag)
 {
     Context *context = GetValidGlobalContext();
@@ -825,6 +961,11 @@ void GL_APIENTRY DepthMask(GLboolean flag)
 
     if (context)
     {
+        if (context->isDeferred())
+        {
+            context->getDeferredCommandQueue()->push(DepthMaskDeferred, flag);
+            return;
+        }
         std::unique_lock<std::mutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateDepthMask(context, flag));
         if (isCallValid)
@@ -873,6 +1014,20 @@ void GL_APIENTRY DetachShader(GLuint program, GLuint shader)
     }
 }
 
+namespace
+{
+void DisableDeferred(Context *context, GLenum cap)
+{
+    std::unique_lock<std::mutex> shareContextLock = LockShareGroup(context);
+    bool isCallValid = (context->skipValidation() || ValidateDisable(context, cap));
+    if (isCallValid)
+    {
+        context->disable(cap);
+    }
+    ANGLE_CAPTURE(Disable, isCallValid, context, cap);
+}
+}  // anonymous namespace
+
 void GL_APIENTRY Disable(GLenum cap)
 {
     Context *context = GetValidGlobalContext();
@@ -881,6 +1036,11 @@ void GL_APIENTRY Disable(GLenum cap)
 
     if (context)
     {
+        if (context->isDeferred())
+        {
+            context->getDeferredCommandQueue()->push(DisableDeferred, cap);
+            return;
+        }
         std::unique_lock<std::mutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateDisable(context, cap));
         if (isCallValid)
@@ -909,6 +1069,21 @@ void GL_APIENTRY DisableVertexAttribArray(GLuint index)
     }
 }
 
+namespace
+{
+void DrawArraysDeferred(Context *context, PrimitiveMode modePacked, GLint first, GLsizei count)
+{
+    std::unique_lock<std::mutex> shareContextLock = LockShareGroup(context);
+    bool isCallValid =
+        (context->skipValidation() || ValidateDrawArrays(context, modePacked, first, count));
+    if (isCallValid)
+    {
+        context->drawArrays(modePacked, first, count);
+    }
+    ANGLE_CAPTURE(DrawArrays, isCallValid, context, modePacked, first, count);
+}
+}  // anonymous namespace
+
 void GL_APIENTRY DrawArrays(GLenum mode, GLint first, GLsizei count)
 {
     Context *context = GetValidGlobalContext();
@@ -917,7 +1092,12 @@ void GL_APIENTRY DrawArrays(GLenum mode, GLint first, GLsizei count)
 
     if (context)
     {
-        PrimitiveMode modePacked                      = FromGL<PrimitiveMode>(mode);
+        PrimitiveMode modePacked = FromGL<PrimitiveMode>(mode);
+        if (context->isDeferred() && context->canDeferDraw())
+        {
+            context->getDeferredCommandQueue()->push(DrawArraysDeferred, modePacked, first, count);
+            return;
+        }
         std::unique_lock<std::mutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateDrawArrays(context, modePacked, first, count));
@@ -929,6 +1109,25 @@ void GL_APIENTRY DrawArrays(GLenum mode, GLint first, GLsizei count)
     }
 }
 
+namespace
+{
+void DrawElementsDeferred(Context *context,
+                          PrimitiveMode modePacked,
+                          GLsizei count,
+                          DrawElementsType typePacked,
+                          const void *indices)
+{
+    std::unique_lock<std::mutex> shareContextLock = LockShareGroup(context);
+    bool isCallValid                              = (context->skipValidation() ||
+                        ValidateDrawElements(context, modePacked, count, typePacked, indices));
+    if (isCallValid)
+    {
+        context->drawElements(modePacked, count, typePacked, indices);
+    }
+    ANGLE_CAPTURE(DrawElements, isCallValid, context, modePacked, count, typePacked, indices);
+}
+}  // anonymous namespace
+
 void GL_APIENTRY DrawElements(GLenum mode, GLsizei count, GLenum type, const void *indices)
 {
     Context *context = GetValidGlobalContext();
@@ -940,8 +1139,14 @@ void GL_APIENTRY DrawElements(GLenum mode, GLsizei count, GLenum type, const voi
 
     if (context)
     {
-        PrimitiveMode modePacked                      = FromGL<PrimitiveMode>(mode);
-        DrawElementsType typePacked                   = FromGL<DrawElementsType>(type);
+        PrimitiveMode modePacked    = FromGL<PrimitiveMode>(mode);
+        DrawElementsType typePacked = FromGL<DrawElementsType>(type);
+        if (context->isDeferred() && context->canDeferDrawElements())
+        {
+            context->getDeferredCommandQueue()->push(DrawElementsDeferred, modePacked, count,
+                                                     typePacked, indices);
+            return;
+        }
         std::unique_lock<std::mutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                              = (context->skipValidation() ||
                             ValidateDrawElements(context, modePacked, count, typePacked, indices));
@@ -953,6 +1158,20 @@ void GL_APIENTRY DrawElements(GLenum mode, GLsizei count, GLenum type, const voi
     }
 }
 
+namespace
+{
+void EnableDeferred(Context *context, GLenum cap)
+{
+    std::unique_lock<std::mutex> shareContextLock = LockShareGroup(context);
+    bool isCallValid = (context->skipValidation() || ValidateEnable(context, cap));
+    if (isCallValid)
+    {
+        context->enable(cap);
+    }
+    ANGLE_CAPTURE(Enable, isCallValid, context, cap);
+}
+}  // anonymous namespace
+
 void GL_APIENTRY Enable(GLenum cap)
 {
     Context *context = GetValidGlobalContext();
@@ -961,6 +1180,11 @@ void GL_APIENTRY Enable(GLenum cap)
 
     if (context)
     {
+        if (context->isDeferred())
+        {
+            context->getDeferredCommandQueue()->push(EnableDeferred, cap);
+            return;
+        }
         std::unique_lock<std::mutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateEnable(context, cap));
         if (isCallValid)
@@ -2221,6 +2445,20 @@ void GL_APIENTRY SampleCoverage(GLfloat value, GLboolean invert)
     }
 }
 
+namespace
+{
+void ScissorDeferred(Context *context, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    std::unique_lock<std::mutex> shareContextLock = LockShareGroup(context);
+    bool isCallValid = (context->skipValidation() || ValidateScissor(context, x, y, width, height));
+    if (isCallValid)
+    {
+        context->scissor(x, y, width, height);
+    }
+    ANGLE_CAPTURE(Scissor, isCallValid, context, x, y, width, height);
+}
+}  // anonymous namespace
+
 void GL_APIENTRY Scissor(GLint x, GLint y, GLsizei width, GLsizei height)
 {
     Context *context = GetValidGlobalContext();
@@ -2230,6 +2468,11 @@ void GL_APIENTRY Scissor(GLint x, GLint y, GLsizei width, GLsizei height)
 
     if (context)
     {
+        if (context->isDeferred())
+        {
+            context->getDeferredCommandQueue()->push(ScissorDeferred, x, y, width, height);
+            return;
+        }
         std::unique_lock<std::mutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateScissor(context, x, y, width, height));
@@ -2579,6 +2822,20 @@ void GL_APIENTRY TexSubImage2D(GLenum target,
     }
 }
 
+namespace
+{
+void Uniform1fDeferred(Context *context, GLint location, GLfloat v0)
+{
+    std::unique_lock<std::mutex> shareContextLock = LockShareGroup(context);
+    bool isCallValid = (context->skipValidation() || ValidateUniform1f(context, location, v0));
+    if (isCallValid)
+    {
+        context->uniform1f(location, v0);
+    }
+    ANGLE_CAPTURE(Uniform1f, isCallValid, context, location, v0);
+}
+}  // anonymous namespace
+
 void GL_APIENTRY Uniform1f(GLint location, GLfloat v0)
 {
     Context *context = GetValidGlobalContext();
@@ -2587,6 +2844,11 @@ void GL_APIENTRY Uniform1f(GLint location, GLfloat v0)
 
     if (context)
     {
+        if (context->isDeferred())
+        {
+            context->getDeferredCommandQueue()->push(Uniform1fDeferred, location, v0);
+            return;
+        }
         std::unique_lock<std::mutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateUniform1f(context, location, v0));
         if (isCallValid)
@@ -2618,6 +2880,20 @@ void GL_APIENTRY Uniform1fv(GLint location, GLsizei count, const GLfloat *value)
     }
 }
 
+namespace
+{
+void Uniform1iDeferred(Context *context, GLint location, GLint v0)
+{
+    std::unique_lock<std::mutex> shareContextLock = LockShareGroup(context);
+    bool isCallValid = (context->skipValidation() || ValidateUniform1i(context, location, v0));
+    if (isCallValid)
+    {
+        context->uniform1i(location, v0);
+    }
+    ANGLE_CAPTURE(Uniform1i, isCallValid, context, location, v0);
+}
+}  // anonymous namespace
+
 void GL_APIENTRY Uniform1i(GLint location, GLint v0)
 {
     Context *context = GetValidGlobalContext();
@@ -2626,6 +2902,11 @@ void GL_APIENTRY Uniform1i(GLint location, GLint v0)
 
     if (context)
     {
+        if (context->isDeferred())
+        {
+            context->getDeferredCommandQueue()->push(Uniform1iDeferred, location, v0);
+            return;
+        }
         std::unique_lock<std::mutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateUniform1i(context, location, v0));
         if (isCallValid)
@@ -2658,6 +2939,20 @@ void GL_APIENTRY Uniform1iv(GLint location, GLsizei count, const GLint *value)
     }
 }
 
+namespace
+{
+void Uniform2fDeferred(Context *context, GLint location, GLfloat v0, GLfloat v1)
+{
+    std::unique_lock<std::mutex> shareContextLock = LockShareGroup(context);
+    bool isCallValid = (context->skipValidation() || ValidateUniform2f(context, location, v0, v1));
+    if (isCallValid)
+    {
+        context->uniform2f(location, v0, v1);
+    }
+    ANGLE_CAPTURE(Uniform2f, isCallValid, context, location, v0, v1);
+}
+}  // anonymous namespace
+
 void GL_APIENTRY Uniform2f(GLint location, GLfloat v0, GLfloat v1)
 {
     Context *context = GetValidGlobalContext();
@@ -2666,6 +2961,11 @@ void GL_APIENTRY Uniform2f(GLint location, GLfloat v0, GLfloat v1)
 
     if (context)
     {
+        if (context->isDeferred())
+        {
+            context->getDeferredCommandQueue()->push(Uniform2fDeferred, location, v0, v1);
+            return;
+        }
         std::unique_lock<std::mutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateUniform2f(context, location, v0, v1));
@@ -2698,6 +2998,20 @@ void GL_APIENTRY Uniform2fv(GLint location, GLsizei count, const GLfloat *value)
     }
 }
 
+namespace
+{
+void Uniform2iDeferred(Context *context, GLint location, GLint v0, GLint v1)
+{
+    std::unique_lock<std::mutex> shareContextLock = LockShareGroup(context);
+    bool isCallValid = (context->skipValidation() || ValidateUniform2i(context, location, v0, v1));
+    if (isCallValid)
+    {
+        context->uniform2i(location, v0, v1);
+    }
+    ANGLE_CAPTURE(Uniform2i, isCallValid, context, location, v0, v1);
+}
+}  // anonymous namespace
+
 void GL_APIENTRY Uniform2i(GLint location, GLint v0, GLint v1)
 {
     Context *context = GetValidGlobalContext();
@@ -2706,6 +3020,11 @@ void GL_APIENTRY Uniform2i(GLint location, GLint v0, GLint v1)
 
     if (context)
     {
+        if (context->isDeferred())
+        {
+            context->getDeferredCommandQueue()->push(Uniform2iDeferred, location, v0, v1);
+            return;
+        }
         std::unique_lock<std::mutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateUniform2i(context, location, v0, v1));
@@ -2739,6 +3058,21 @@ void GL_APIENTRY Uniform2iv(GLint location, GLsizei count, const GLint *value)
     }
 }
 
+namespace
+{
+void Uniform3fDeferred(Context *context, GLint location, GLfloat v0, GLfloat v1, GLfloat v2)
+{
+    std::unique_lock<std::mutex> shareContextLock = LockShareGroup(context);
+    bool isCallValid =
+        (context->skipValidation() || ValidateUniform3f(context, location, v0, v1, v2));
+    if (isCallValid)
+    {
+        context->uniform3f(location, v0, v1, v2);
+    }
+    ANGLE_CAPTURE(Uniform3f, isCallValid, context, location, v0, v1, v2);
+}
+}  // anonymous namespace
+
 void GL_APIENTRY Uniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2)
 {
     Context *context = GetValidGlobalContext();
@@ -2748,6 +3082,11 @@ void GL_APIENTRY Uniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2)
 
     if (context)
     {
+        if (context->isDeferred())
+        {
+            context->getDeferredCommandQueue()->push(Uniform3fDeferred, location, v0, v1, v2);
+            return;
+        }
         std::unique_lock<std::mutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateUniform3f(context, location, v0, v1, v2));
@@ -2780,6 +3119,21 @@ void GL_APIENTRY Uniform3fv(GLint location, GLsizei count, const GLfloat *value)
     }
 }
 
+namespace
+{
+void Uniform3iDeferred(Context *context, GLint location, GLint v0, GLint v1, GLint v2)
+{
+    std::unique_lock<std::mutex> shareContextLock = LockShareGroup(context);
+    bool isCallValid =
+        (context->skipValidation() || ValidateUniform3i(context, location, v0, v1, v2));
+    if (isCallValid)
+    {
+        context->uniform3i(location, v0, v1, v2);
+    }
+    ANGLE_CAPTURE(Uniform3i, isCallValid, context, location, v0, v1, v2);
+}
+}  // anonymous namespace
+
 void GL_APIENTRY Uniform3i(GLint location, GLint v0, GLint v1, GLint v2)
 {
     Context *context = GetValidGlobalContext();
@@ -2789,6 +3143,11 @@ void GL_APIENTRY Uniform3i(GLint location, GLint v0, GLint v1, GLint v2)
 
     if (context)
     {
+        if (context->isDeferred())
+        {
+            context->getDeferredCommandQueue()->push(Uniform3iDeferred, location, v0, v1, v2);
+            return;
+        }
         std::unique_lock<std::mutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateUniform3i(context, location, v0, v1, v2));
@@ -2822,6 +3181,26 @@ void GL_APIENTRY Uniform3iv(GLint location, GLsizei count, const GLint *value)
     }
 }
 
+namespace
+{
+void Uniform4fDeferred(Context *context,
+                       GLint location,
+                       GLfloat v0,
+                       GLfloat v1,
+                       GLfloat v2,
+                       GLfloat v3)
+{
+    std::unique_lock<std::mutex> shareContextLock = LockShareGroup(context);
+    bool isCallValid =
+        (context->skipValidation() || ValidateUniform4f(context, location, v0, v1, v2, v3));
+    if (isCallValid)
+    {
+        context->uniform4f(location, v0, v1, v2, v3);
+    }
+    ANGLE_CAPTURE(Uniform4f, isCallValid, context, location, v0, v1, v2, v3);
+}
+}  // anonymous namespace
+
 void GL_APIENTRY Uniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3)
 {
     Context *context = GetValidGlobalContext();
@@ -2832,6 +3211,11 @@ void GL_APIENTRY Uniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, G
 
     if (context)
     {
+        if (context->isDeferred())
+        {
+            context->getDeferredCommandQueue()->push(Uniform4fDeferred, location, v0, v1, v2, v3);
+            return;
+        }
         std::unique_lock<std::mutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateUniform4f(context, location, v0, v1, v2, v3));
@@ -2864,6 +3248,21 @@ void GL_APIENTRY Uniform4fv(GLint location, GLsizei count, const GLfloat *value)
     }
 }
 
+namespace
+{
+void Uniform4iDeferred(Context *context, GLint location, GLint v0, GLint v1, GLint v2, GLint v3)
+{
+    std::unique_lock<std::mutex> shareContextLock = LockShareGroup(context);
+    bool isCallValid =
+        (context->skipValidation() || ValidateUniform4i(context, location, v0, v1, v2, v3));
+    if (isCallValid)
+    {
+        context->uniform4i(location, v0, v1, v2, v3);
+    }
+    ANGLE_CAPTURE(Uniform4i, isCallValid, context, location, v0, v1, v2, v3);
+}
+}  // anonymous namespace
+
 void GL_APIENTRY Uniform4i(GLint location, GLint v0, GLint v1, GLint v2, GLint v3)
 {
     Context *context = GetValidGlobalContext();
@@ -2874,6 +3273,11 @@ void GL_APIENTRY Uniform4i(GLint location, GLint v0, GLint v1, GLint v2, GLint v
 
     if (context)
     {
+        if (context->isDeferred())
+        {
+            context->getDeferredCommandQueue()->push(Uniform4iDeferred, location, v0, v1, v2, v3);
+            return;
+        }
         std::unique_lock<std::mutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateUniform4i(context, location, v0, v1, v2, v3));
@@ -3205,6 +3609,21 @@ void GL_APIENTRY VertexAttribPointer(GLuint index,
     }
 }
 
+namespace
+{
+void ViewportDeferred(Context *context, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    std::unique_lock<std::mutex> shareContextLock = LockShareGroup(context);
+    bool isCallValid =
+        (context->skipValidation() || ValidateViewport(context, x, y, width, height));
+    if (isCallValid)
+    {
+        context->viewport(x, y, width, height);
+    }
+    ANGLE_CAPTURE(Viewport, isCallValid, context, x, y, width, height);
+}
+}  // anonymous namespace
+
 void GL_APIENTRY Viewport(GLint x, GLint y, GLsizei width, GLsizei height)
 {
     Context *context = GetValidGlobalContext();
@@ -3214,6 +3633,11 @@ void GL_APIENTRY Viewport(GLint x, GLint y, GLsizei width, GLsizei height)
 
     if (context)
     {
+        if (context->isDeferred())
+        {
+            context->getDeferredCommandQueue()->push(ViewportDeferred, x, y, width, height);
+            return;
+        }
         std::unique_lock<std::mutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateViewport(context, x, y, width, height));
@@ -567,6 +567,27 @@ void GL_APIENTRY DeleteVertexArrays(GLsizei n, const GLuint *arrays)
     }
 }
 
+namespace
+{
+void DrawArraysInstancedDeferred(Context *context,
+                                 PrimitiveMode modePacked,
+                                 GLint first,
+                                 GLsizei count,
+                                 GLsizei instancecount)
+{
+    std::unique_lock<std::mutex> shareContextLock = LockShareGroup(context);
+    bool isCallValid =
+        (context->skipValidation() ||
+         ValidateDrawArraysInstanced(context, modePacked, first, count, instancecount));
+    if (isCallValid)
+    {
+        context->drawArraysInstanced(modePacked, first, count, instancecount);
+    }
+    ANGLE_CAPTURE(DrawArraysInstanced, isCallValid, context, modePacked, first, count,
+                  instancecount);
+}
+}  // anonymous namespace
+
 void GL_APIENTRY DrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instancecount)
 {
     Context *context = GetValidGlobalContext();
@@ -578,7 +599,13 @@ void GL_APIENTRY DrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GL
 
     if (context)
     {
-        PrimitiveMode modePacked                      = FromGL<PrimitiveMode>(mode);
+        PrimitiveMode modePacked = FromGL<PrimitiveMode>(mode);
+        if (context->isDeferred() && context->canDeferDraw())
+        {
+            context->getDeferredCommandQueue()->push(DrawArraysInstancedDeferred, modePacked, first,
+                                                     count, instancecount);
+            return;
+        }
         std::unique_lock<std::mutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() ||
@@ -610,6 +637,28 @@ void GL_APIENTRY DrawBuffers(GLsizei n, const GLenum *bufs)
     }
 }
 
+namespace
+{
+void DrawElementsInstancedDeferred(Context *context,
+                                   PrimitiveMode modePacked,
+                                   GLsizei count,
+                                   DrawElementsType typePacked,
+                                   const void *indices,
+                                   GLsizei instancecount)
+{
+    std::unique_lock<std::mutex> shareContextLock = LockShareGroup(context);
+    bool isCallValid                              = (context->skipValidation() ||
+                        ValidateDrawElementsInstanced(context, modePacked, count, typePacked,
+                                                      indices, instancecount));
+    if (isCallValid)
+    {
+        context->drawElementsInstanced(modePacked, count, typePacked, indices, instancecount);
+    }
+    ANGLE_CAPTURE(DrawElementsInstanced, isCallValid, context, modePacked, count, typePacked,
+                  indices, instancecount);
+}
+}  // anonymous namespace
+
 void GL_APIENTRY DrawElementsInstanced(GLenum mode,
                                        GLsizei count,
                                        GLenum type,
@@ -625,8 +674,14 @@ void GL_APIENTRY DrawElementsInstanced(GLenum mode,
 
     if (context)
     {
-        PrimitiveMode modePacked                      = FromGL<PrimitiveMode>(mode);
-        DrawElementsType typePacked                   = FromGL<DrawElementsType>(type);
+        PrimitiveMode modePacked    = FromGL<PrimitiveMode>(mode);
+        DrawElementsType typePacked = FromGL<DrawElementsType>(type);
+        if (context->isDeferred() && context->canDeferDrawElements())
+        {
+            context->getDeferredCommandQueue()->push(DrawElementsInstancedDeferred, modePacked,
+                                                     count, typePacked, indices, instancecount);
+            return;
+        }
         std::unique_lock<std::mutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid                              = (context->skipValidation() ||
                             ValidateDrawElementsInstanced(context, modePacked, count, typePacked,
@@ -640,6 +695,29 @@ void GL_APIENTRY DrawElementsInstanced(GLenum mode,
     }
 }
 
+namespace
+{
+void DrawRangeElementsDeferred(Context *context,
+                               PrimitiveMode modePacked,
+                               GLuint start,
+                               GLuint end,
+                               GLsizei count,
+                               DrawElementsType typePacked,
+                               const void *indices)
+{
+    std::unique_lock<std::mutex> shareContextLock = LockShareGroup(context);
+    bool isCallValid =
+        (context->skipValidation() || ValidateDrawRangeElements(context, modePacked, start, end,
+                                                                count, typePacked, indices));
+    if (isCallValid)
+    {
+        context->drawRangeElements(modePacked, start, end, count, typePacked, indices);
+    }
+    ANGLE_CAPTURE(DrawRangeElements, isCallValid, context, modePacked, start, end, count,
+                  typePacked, indices);
+}
+}  // anonymous namespace
+
 void GL_APIENTRY DrawRangeElements(GLenum mode,
                                    GLuint start,
                                    GLuint end,
@@ -656,8 +734,14 @@ void GL_APIENTRY DrawRangeElements(GLenum mode,
 
     if (context)
     {
-        PrimitiveMode modePacked                      = FromGL<PrimitiveMode>(mode);
-        DrawElementsType typePacked                   = FromGL<DrawElementsType>(type);
+        PrimitiveMode modePacked    = FromGL<PrimitiveMode>(mode);
+        DrawElementsType typePacked = FromGL<DrawElementsType>(type);
+        if (context->isDeferred() && context->canDeferDrawElements())
+        {
+            context->getDeferredCommandQueue()->push(DrawRangeElementsDeferred, modePacked, start,
+                                                     end, count, typePacked, indices);
+            return;
+        }
         std::unique_lock<std::mutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateDrawRangeElements(context, modePacked, start, end,
@@ -2062,6 +2146,20 @@ void GL_APIENTRY TransformFeedbackVaryings(GLuint program,
     }
 }
 
+namespace
+{
+void Uniform1uiDeferred(Context *context, GLint location, GLuint v0)
+{
+    std::unique_lock<std::mutex> shareContextLock = LockShareGroup(context);
+    bool isCallValid = (context->skipValidation() || ValidateUniform1ui(context, location, v0));
+    if (isCallValid)
+    {
+        context->uniform1ui(location, v0);
+    }
+    ANGLE_CAPTURE(Uniform1ui, isCallValid, context, location, v0);
+}
+}  // anonymous namespace
+
 void GL_APIENTRY Uniform1ui(GLint location, GLuint v0)
 {
     Context *context = GetValidGlobalContext();
@@ -2070,6 +2168,11 @@ void GL_APIENTRY Uniform1ui(GLint location, GLuint v0)
 
     if (context)
     {
+        if (context->isDeferred())
+        {
+            context->getDeferredCommandQueue()->push(Uniform1uiDeferred, location, v0);
+            return;
+        }
         std::unique_lock<std::mutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid = (context->skipValidation() || ValidateUniform1ui(context, location, v0));
         if (isCallValid)
@@ -2101,6 +2204,20 @@ void GL_APIENTRY Uniform1uiv(GLint location, GLsizei count, const GLuint *value)
     }
 }
 
+namespace
+{
+void Uniform2uiDeferred(Context *context, GLint location, GLuint v0, GLuint v1)
+{
+    std::unique_lock<std::mutex> shareContextLock = LockShareGroup(context);
+    bool isCallValid = (context->skipValidation() || ValidateUniform2ui(context, location, v0, v1));
+    if (isCallValid)
+    {
+        context->uniform2ui(location, v0, v1);
+    }
+    ANGLE_CAPTURE(Uniform2ui, isCallValid, context, location, v0, v1);
+}
+}  // anonymous namespace
+
 void GL_APIENTRY Uniform2ui(GLint location, GLuint v0, GLuint v1)
 {
     Context *context = GetValidGlobalContext();
@@ -2109,6 +2226,11 @@ void GL_APIENTRY Uniform2ui(GLint location, GLuint v0, GLuint v1)
 
     if (context)
     {
+        if (context->isDeferred())
+        {
+            context->getDeferredCommandQueue()->push(Uniform2uiDeferred, location, v0, v1);
+            return;
+        }
         std::unique_lock<std::mutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateUniform2ui(context, location, v0, v1));
@@ -2141,6 +2263,21 @@ void GL_APIENTRY Uniform2uiv(GLint location, GLsizei count, const GLuint *value)
     }
 }
 
+namespace
+{
+void Uniform3uiDeferred(Context *context, GLint location, GLuint v0, GLuint v1, GLuint v2)
+{
+    std::unique_lock<std::mutex> shareContextLock = LockShareGroup(context);
+    bool isCallValid =
+        (context->skipValidation() || ValidateUniform3ui(context, location, v0, v1, v2));
+    if (isCallValid)
+    {
+        context->uniform3ui(location, v0, v1, v2);
+    }
+    ANGLE_CAPTURE(Uniform3ui, isCallValid, context, location, v0, v1, v2);
+}
+}  // anonymous namespace
+
 void GL_APIENTRY Uniform3ui(GLint location, GLuint v0, GLuint v1, GLuint v2)
 {
     Context *context = GetValidGlobalContext();
@@ -2150,6 +2287,11 @@ void GL_APIENTRY Uniform3ui(GLint location, GLuint v0, GLuint v1, GLuint v2)
 
     if (context)
     {
+        if (context->isDeferred())
+        {
+            context->getDeferredCommandQueue()->push(Uniform3uiDeferred, location, v0, v1, v2);
+            return;
+        }
         std::unique_lock<std::mutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateUniform3ui(context, location, v0, v1, v2));
@@ -2182,6 +2324,26 @@ void GL_APIENTRY Uniform3uiv(GLint location, GLsizei count, const GLuint *value)
     }
 }
 
+namespace
+{
+void Uniform4uiDeferred(Context *context,
+                        GLint location,
+                        GLuint v0,
+                        GLuint v1,
+                        GLuint v2,
+                        GLuint v3)
+{
+    std::unique_lock<std::mutex> shareContextLock = LockShareGroup(context);
+    bool isCallValid =
+        (context->skipValidation() || ValidateUniform4ui(context, location, v0, v1, v2, v3));
+    if (isCallValid)
+    {
+        context->uniform4ui(location, v0, v1, v2, v3);
+    }
+    ANGLE_CAPTURE(Uniform4ui, isCallValid, context, location, v0, v1, v2, v3);
+}
+}  // anonymous namespace
+
 void GL_APIENTRY Uniform4ui(GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3)
 {
     Context *context = GetValidGlobalContext();
@@ -2192,6 +2354,11 @@ void GL_APIENTRY Uniform4ui(GLint location, GLuint v0, GLuint v1, GLuint v2, GLu
 
     if (context)
     {
+        if (context->isDeferred())
+        {
+            context->getDeferredCommandQueue()->push(Uniform4uiDeferred, location, v0, v1, v2, v3);
+            return;
+        }
         std::unique_lock<std::mutex> shareContextLock = GetShareGroupLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateUniform4ui(context, location, v0, v1, v2, v3));
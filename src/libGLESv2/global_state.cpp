@@ -90,6 +90,78 @@ std::mutex &GetGlobalMutex()
     return *g_Mutex;
 }
 
+ScopedShareGroupLock::ScopedShareGroupLock(const gl::Context *context,
+                                           const gl::Context *otherContext)
+{
+    // The worker threads of deferred contexts take the share group locks, so they must be done
+    // before the locks are taken here.
+    for (const gl::Context *deferredContext : {context, otherContext})
+    {
+        if (deferredContext && deferredContext->isDeferred())
+        {
+            deferredContext->getDeferredCommandQueue()->finish();
+        }
+    }
+
+    if (context && context->isShared())
+    {
+        mMutex = context->getShareGroupMutex();
+    }
+    if (otherContext && otherContext->isShared() &&
+        otherContext->getShareGroupMutex() != mMutex)
+    {
+        mOtherMutex = otherContext->getShareGroupMutex();
+    }
+
+    lock();
+}
+
+ScopedShareGroupLock::ScopedShareGroupLock(const gl::Context *context,
+                                           const std::shared_ptr<std::mutex> &otherMutex)
+{
+    if (context && context->isDeferred())
+    {
+        context->getDeferredCommandQueue()->finish();
+    }
+
+    if (context && context->isShared())
+    {
+        mMutex = context->getShareGroupMutex();
+    }
+    if (otherMutex != mMutex)
+    {
+        mOtherMutex = otherMutex;
+    }
+
+    lock();
+}
+
+void ScopedShareGroupLock::lock()
+{
+    // Only EGL calls hold two share group locks, and they are serialized by the global mutex, so
+    // the order doesn't matter.
+    if (mMutex)
+    {
+        mMutex->lock();
+    }
+    if (mOtherMutex)
+    {
+        mOtherMutex->lock();
+    }
+}
+
+ScopedShareGroupLock::~ScopedShareGroupLock()
+{
+    if (mMutex)
+    {
+        mMutex->unlock();
+    }
+    if (mOtherMutex)
+    {
+        mOtherMutex->unlock();
+    }
+}
+
 Thread *GetCurrentThread()
 {
     // Create a TLS index if one has not been created for this DLL
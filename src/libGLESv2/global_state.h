@@ -14,6 +14,7 @@
 #include "libANGLE/Thread.h"
 #include "libANGLE/features.h"
 
+#include <memory>
 #include <mutex>
 
 namespace egl
@@ -27,9 +28,36 @@ Debug *GetDebug();
 void SetContextCurrent(Thread *thread, gl::Context *context);
 }  // namespace egl
 
+// The global mutex serializes EGL calls, and with them the lifetime of EGL objects.  GL calls only
+// take the lock of their context's share group.
 #define ANGLE_SCOPED_GLOBAL_LOCK() \
     std::lock_guard<std::mutex> globalMutexLock(egl::GetGlobalMutex())
 
+namespace egl
+{
+// EGL calls that reach into the GL objects of contexts take the locks of their share groups after
+// the global mutex, so they don't race with GL calls made on other threads.  The contexts may be
+// null, and may be in the same share group.  The deferred calls of the contexts run first.
+class ScopedShareGroupLock final : angle::NonCopyable
+{
+  public:
+    explicit ScopedShareGroupLock(const gl::Context *context,
+                                  const gl::Context *otherContext = nullptr);
+    // For objects such as EGLImages that outlive the context they were created from and keep the
+    // lock of its share group.
+    ScopedShareGroupLock(const gl::Context *context,
+                         const std::shared_ptr<std::mutex> &otherMutex);
+    ~ScopedShareGroupLock();
+
+  private:
+    void lock();
+
+    // Kept alive here, as the call may destroy the contexts.
+    std::shared_ptr<std::mutex> mMutex;
+    std::shared_ptr<std::mutex> mOtherMutex;
+};
+}  // namespace egl
+
 namespace gl
 {
 extern Context *gSingleThreadedContext;
@@ -56,11 +84,22 @@ ANGLE_INLINE Context *GetValidGlobalContext()
     return thread->getValidContext();
 }
 
-ANGLE_INLINE std::unique_lock<std::mutex> GetShareGroupLock(const Context *context)
+// Used directly by the calls that a deferred context runs on its worker thread.
+ANGLE_INLINE std::unique_lock<std::mutex> LockShareGroup(const Context *context)
 {
-    return context->isShared() ? std::unique_lock<std::mutex>(egl::GetGlobalMutex())
+    return context->isShared() ? std::unique_lock<std::mutex>(*context->getShareGroupMutex())
                                : std::unique_lock<std::mutex>();
 }
+
+// Calls that aren't deferred first wait for the deferred ones, so they see their results.
+ANGLE_INLINE std::unique_lock<std::mutex> GetShareGroupLock(const Context *context)
+{
+    if (ANGLE_UNLIKELY(context->isDeferred()))
+    {
+        context->getDeferredCommandQueue()->finish();
+    }
+    return LockShareGroup(context);
+}
 }  // namespace gl
 
 #endif  // LIBGLESV2_GLOBALSTATE_H_
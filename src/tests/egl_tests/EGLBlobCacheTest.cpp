@@ -33,6 +33,22 @@ namespace
 std::map<std::vector<uint8_t>, std::vector<uint8_t>> gApplicationCache;
 CacheOpResult gLastCacheOpResult = CacheOpResult::VALUE_NOT_SET;
 
+// Samples of the shader cache result histogram.  0 is a miss, any other value is a hit.
+constexpr char kShaderCacheResultHistogram[] = "GPU.ANGLE.ShaderCache.CacheResult";
+constexpr int kCacheMiss                      = 0;
+std::vector<int> gShaderCacheResults;
+
+void TestHistogramEnumeration(PlatformMethods *platform,
+                              const char *name,
+                              int sample,
+                              int boundaryValue)
+{
+    if (strcmp(name, kShaderCacheResultHistogram) == 0)
+    {
+        gShaderCacheResults.push_back(sample);
+    }
+}
+
 void SetBlob(const void *key, EGLsizeiANDROID keySize, const void *value, EGLsizeiANDROID valueSize)
 {
     std::vector<uint8_t> keyVec(keySize);
@@ -82,12 +98,19 @@ class EGLBlobCacheTest : public ANGLETest
     {
         // Force disply caching off. Blob cache functions require it.
         forceNewDisplay();
+        gDefaultPlatformMethods.histogramEnumeration = TestHistogramEnumeration;
     }
 
     void testSetUp() override
     {
         EGLDisplay display = getEGLWindow()->getDisplay();
         mHasBlobCache      = IsEGLDisplayExtensionEnabled(display, kEGLExtName);
+        gShaderCacheResults.clear();
+    }
+
+    void testTearDown() override
+    {
+        gDefaultPlatformMethods.histogramEnumeration = DefaultHistogramEnumeration;
     }
 
     bool programBinaryAvailable()
@@ -169,6 +192,115 @@ void main()
     }
 }
 
+// Makes sure translated shaders are cached, so compiling the same shader again doesn't run the
+// translator, and that a program linked from cached shaders works.
+TEST_P(EGLBlobCacheTest, ShaderCache)
+{
+    // Only the Vulkan back-end caches translated shaders.
+    ANGLE_SKIP_TEST_IF(!IsVulkan());
+
+    EGLDisplay display = getEGLWindow()->getDisplay();
+
+    EXPECT_TRUE(mHasBlobCache);
+    eglSetBlobCacheFuncsANDROID(display, SetBlob, GetBlob);
+    ASSERT_EGL_SUCCESS();
+
+    gApplicationCache.clear();
+
+    constexpr char kFS[] = R"(precision mediump float;
+uniform vec4 uColor;
+void main()
+{
+    gl_FragColor = uColor;
+})";
+
+    // Compile the shader so its translation is put in the cache.
+    GLuint fragmentShader = CompileShader(GL_FRAGMENT_SHADER, kFS);
+    ASSERT_NE(0u, fragmentShader);
+    EXPECT_EQ(CacheOpResult::SET_SUCCESS, gLastCacheOpResult);
+    glDeleteShader(fragmentShader);
+
+    GLuint vertexShader = CompileShader(GL_VERTEX_SHADER, essl1_shaders::vs::Simple());
+    ASSERT_NE(0u, vertexShader);
+    gLastCacheOpResult = CacheOpResult::VALUE_NOT_SET;
+
+    // Compile the same shader again, which should retrieve the translation from the cache.
+    fragmentShader = CompileShader(GL_FRAGMENT_SHADER, kFS);
+    ASSERT_NE(0u, fragmentShader);
+    EXPECT_EQ(CacheOpResult::GET_SUCCESS, gLastCacheOpResult);
+
+    GLuint program = glCreateProgram();
+    glAttachShader(program, vertexShader);
+    glAttachShader(program, fragmentShader);
+    glLinkProgram(program);
+    glDeleteShader(vertexShader);
+    glDeleteShader(fragmentShader);
+
+    GLint linkStatus = GL_FALSE;
+    glGetProgramiv(program, GL_LINK_STATUS, &linkStatus);
+    ASSERT_GL_TRUE(linkStatus);
+
+    glUseProgram(program);
+    GLint colorLocation = glGetUniformLocation(program, "uColor");
+    ASSERT_NE(-1, colorLocation);
+    glUniform4f(colorLocation, 1.0f, 0.0f, 0.0f, 1.0f);
+
+    drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
+    ASSERT_GL_NO_ERROR();
+
+    glDeleteProgram(program);
+}
+
+// Makes sure translated shaders are cached in memory when the application doesn't set the blob
+// cache functions, and that the cache is shared by the contexts of the display.
+TEST_P(EGLBlobCacheTest, ShaderCacheWithoutCallbacks)
+{
+    // Only the Vulkan back-end caches translated shaders.
+    ANGLE_SKIP_TEST_IF(!IsVulkan());
+
+    EGLWindow *window   = getEGLWindow();
+    EGLDisplay display  = window->getDisplay();
+    EGLSurface surface  = window->getSurface();
+    EGLContext context1 = window->getContext();
+
+    constexpr char kFS[] = R"(precision mediump float;
+uniform vec4 uColor;
+void main()
+{
+    gl_FragColor = uColor + vec4(0.25);
+})";
+
+    GLuint shader = CompileShader(GL_FRAGMENT_SHADER, kFS);
+    ASSERT_NE(0u, shader);
+    glDeleteShader(shader);
+    size_t lookupCount = gShaderCacheResults.size();
+    ASSERT_NE(0u, lookupCount);
+
+    EGLint contextAttributes[] = {
+        EGL_CONTEXT_MAJOR_VERSION_KHR,
+        GetParam().majorVersion,
+        EGL_CONTEXT_MINOR_VERSION_KHR,
+        GetParam().minorVersion,
+        EGL_NONE,
+    };
+    EGLContext context2 =
+        eglCreateContext(display, window->getConfig(), EGL_NO_CONTEXT, contextAttributes);
+    ASSERT_NE(EGL_NO_CONTEXT, context2);
+    eglMakeCurrent(display, surface, surface, context2);
+
+    // Compiling the same shader in the other context should find its translation in the cache.
+    shader = CompileShader(GL_FRAGMENT_SHADER, kFS);
+    EXPECT_NE(0u, shader);
+    glDeleteShader(shader);
+    ASSERT_EQ(lookupCount + 1, gShaderCacheResults.size());
+    EXPECT_NE(kCacheMiss, gShaderCacheResults.back());
+
+    eglMakeCurrent(display, surface, surface, context1);
+    eglDestroyContext(display, context2);
+    ASSERT_EGL_SUCCESS();
+}
+
 // Tests error conditions of the APIs.
 TEST_P(EGLBlobCacheTest, NegativeAPI)
 {
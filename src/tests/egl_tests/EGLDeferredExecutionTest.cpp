@@ -0,0 +1,253 @@
+//
+// Copyright 2019 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// EGLDeferredExecutionTest.cpp:
+//   Coverage of the EGL_ANGLE_create_context_deferred_execution extension
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "test_utils/ANGLETest.h"
+#include "test_utils/angle_test_configs.h"
+#include "test_utils/angle_test_instantiate.h"
+#include "test_utils/gl_raii.h"
+#include "util/shader_utils.h"
+
+namespace angle
+{
+namespace
+{
+constexpr EGLint kPbufferSize = 16;
+
+constexpr GLfloat kQuadVertices[] = {
+    -1.0f, 1.0f, -1.0f, -1.0f, 1.0f, -1.0f, -1.0f, 1.0f, 1.0f, -1.0f, 1.0f, 1.0f,
+};
+}  // anonymous namespace
+
+class EGLDeferredExecutionTest : public ANGLETest
+{
+  public:
+    void testSetUp() override
+    {
+        EGLint dispattrs[] = {EGL_PLATFORM_ANGLE_TYPE_ANGLE, GetParam().getRenderer(), EGL_NONE};
+        mDisplay           = eglGetPlatformDisplayEXT(
+            EGL_PLATFORM_ANGLE_ANGLE, reinterpret_cast<void *>(EGL_DEFAULT_DISPLAY), dispattrs);
+        ASSERT_TRUE(mDisplay != EGL_NO_DISPLAY);
+
+        ASSERT_EGL_TRUE(eglInitialize(mDisplay, nullptr, nullptr));
+
+        int configsCount = 0;
+        ASSERT_EGL_TRUE(eglGetConfigs(mDisplay, nullptr, 0, &configsCount));
+        ASSERT_TRUE(configsCount != 0);
+
+        std::vector<EGLConfig> configs(configsCount);
+        ASSERT_EGL_TRUE(eglGetConfigs(mDisplay, configs.data(), configsCount, &configsCount));
+
+        for (EGLConfig config : configs)
+        {
+            EGLint surfaceType = 0;
+            EGLint redSize     = 0;
+            eglGetConfigAttrib(mDisplay, config, EGL_SURFACE_TYPE, &surfaceType);
+            eglGetConfigAttrib(mDisplay, config, EGL_RED_SIZE, &redSize);
+            if ((surfaceType & EGL_PBUFFER_BIT) != 0 && redSize == 8)
+            {
+                mConfig = config;
+                break;
+            }
+        }
+        ASSERT_NE(nullptr, mConfig);
+
+        const EGLint pbufferAttribs[] = {EGL_WIDTH, kPbufferSize, EGL_HEIGHT, kPbufferSize,
+                                         EGL_NONE};
+        mPbuffer = eglCreatePbufferSurface(mDisplay, mConfig, pbufferAttribs);
+        EXPECT_TRUE(mPbuffer != EGL_NO_SURFACE);
+    }
+
+    void testTearDown() override
+    {
+        eglMakeCurrent(mDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+
+        if (mContext != EGL_NO_CONTEXT)
+        {
+            eglDestroyContext(mDisplay, mContext);
+        }
+
+        if (mPbuffer != EGL_NO_SURFACE)
+        {
+            eglDestroySurface(mDisplay, mPbuffer);
+        }
+
+        eglTerminate(mDisplay);
+    }
+
+    bool hasExtension() const
+    {
+        return IsEGLDisplayExtensionEnabled(mDisplay,
+                                            "EGL_ANGLE_create_context_deferred_execution");
+    }
+
+    void makeDeferredContextCurrent()
+    {
+        EGLint attribs[] = {EGL_CONTEXT_CLIENT_VERSION, 2, EGL_CONTEXT_DEFERRED_EXECUTION_ANGLE,
+                            EGL_TRUE, EGL_NONE};
+        mContext         = eglCreateContext(mDisplay, mConfig, nullptr, attribs);
+        ASSERT_NE(EGL_NO_CONTEXT, mContext);
+        ASSERT_EGL_TRUE(eglMakeCurrent(mDisplay, mPbuffer, mPbuffer, mContext));
+    }
+
+    EGLDisplay mDisplay = EGL_NO_DISPLAY;
+    EGLSurface mPbuffer = EGL_NO_SURFACE;
+    EGLContext mContext = EGL_NO_CONTEXT;
+    EGLConfig mConfig   = 0;
+};
+
+// Test that the attribute is rejected with invalid values.
+TEST_P(EGLDeferredExecutionTest, InvalidAttributeValue)
+{
+    ANGLE_SKIP_TEST_IF(!hasExtension());
+
+    EGLint attribs[] = {EGL_CONTEXT_CLIENT_VERSION, 2, EGL_CONTEXT_DEFERRED_EXECUTION_ANGLE, 2,
+                        EGL_NONE};
+    EXPECT_EQ(EGL_NO_CONTEXT, eglCreateContext(mDisplay, mConfig, nullptr, attribs));
+    EXPECT_EGL_ERROR(EGL_BAD_ATTRIBUTE);
+}
+
+// Test that draws and state changes made through a deferred context are visible to ReadPixels.
+TEST_P(EGLDeferredExecutionTest, DrawThenRead)
+{
+    ANGLE_SKIP_TEST_IF(!hasExtension());
+    makeDeferredContextCurrent();
+
+    ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Simple(), essl1_shaders::fs::UniformColor());
+    glUseProgram(program);
+    GLint colorLocation = glGetUniformLocation(program, essl1_shaders::ColorUniform());
+    ASSERT_NE(-1, colorLocation);
+
+    GLBuffer buffer;
+    glBindBuffer(GL_ARRAY_BUFFER, buffer);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(kQuadVertices), kQuadVertices, GL_STATIC_DRAW);
+    GLint positionLocation = glGetAttribLocation(program, essl1_shaders::PositionAttrib());
+    glVertexAttribPointer(positionLocation, 2, GL_FLOAT, GL_FALSE, 0, nullptr);
+    glEnableVertexAttribArray(positionLocation);
+
+    glViewport(0, 0, kPbufferSize, kPbufferSize);
+    glClearColor(0.0f, 0.0f, 1.0f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    // Only the last draw covers the whole surface, so any reordering shows.
+    for (int iteration = 0; iteration < 100; ++iteration)
+    {
+        glUniform4f(colorLocation, 1.0f, 0.0f, 0.0f, 1.0f);
+        glDrawArrays(GL_TRIANGLES, 0, 3);
+    }
+    glUniform4f(colorLocation, 0.0f, 1.0f, 0.0f, 1.0f);
+    glDrawArrays(GL_TRIANGLES, 0, 6);
+
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
+    EXPECT_PIXEL_COLOR_EQ(kPbufferSize - 1, kPbufferSize - 1, GLColor::green);
+    ASSERT_GL_NO_ERROR();
+}
+
+// Test that draws from client memory, which aren't deferred, still run after the deferred calls.
+TEST_P(EGLDeferredExecutionTest, ClientArrays)
+{
+    ANGLE_SKIP_TEST_IF(!hasExtension());
+    makeDeferredContextCurrent();
+
+    ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Simple(), essl1_shaders::fs::Red());
+    glUseProgram(program);
+
+    glViewport(0, 0, kPbufferSize, kPbufferSize);
+    glClearColor(0.0f, 0.0f, 1.0f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    GLint positionLocation = glGetAttribLocation(program, essl1_shaders::PositionAttrib());
+    glVertexAttribPointer(positionLocation, 2, GL_FLOAT, GL_FALSE, 0, kQuadVertices);
+    glEnableVertexAttribArray(positionLocation);
+    glDrawArrays(GL_TRIANGLES, 0, 6);
+
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
+    ASSERT_GL_NO_ERROR();
+}
+
+// Test that errors generated by deferred calls are returned by glGetError.
+TEST_P(EGLDeferredExecutionTest, DeferredError)
+{
+    ANGLE_SKIP_TEST_IF(!hasExtension());
+    makeDeferredContextCurrent();
+
+    glEnable(GL_TEXTURE_2D);
+    EXPECT_GL_ERROR(GL_INVALID_ENUM);
+
+    glDrawArrays(GL_TRIANGLES, 0, -1);
+    EXPECT_GL_ERROR(GL_INVALID_VALUE);
+    ASSERT_GL_NO_ERROR();
+}
+
+// Test that EGL calls on another thread that wait for a deferred context's calls, such as creating
+// a context that shares with it, work while the context keeps queueing calls on its own thread.
+TEST_P(EGLDeferredExecutionTest, WaitFromOtherThread)
+{
+    ANGLE_SKIP_TEST_IF(!hasExtension());
+
+    EGLint attribs[] = {EGL_CONTEXT_CLIENT_VERSION, 2, EGL_CONTEXT_DEFERRED_EXECUTION_ANGLE,
+                        EGL_TRUE, EGL_NONE};
+    mContext         = eglCreateContext(mDisplay, mConfig, nullptr, attribs);
+    ASSERT_NE(EGL_NO_CONTEXT, mContext);
+
+    constexpr int kIterations = 200;
+    std::atomic<bool> drawing(true);
+
+    std::thread drawThread([this, &drawing]() {
+        EXPECT_EGL_TRUE(eglMakeCurrent(mDisplay, mPbuffer, mPbuffer, mContext));
+
+        {
+            ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Simple(), essl1_shaders::fs::Red());
+            glUseProgram(program);
+
+            GLBuffer buffer;
+            glBindBuffer(GL_ARRAY_BUFFER, buffer);
+            glBufferData(GL_ARRAY_BUFFER, sizeof(kQuadVertices), kQuadVertices, GL_STATIC_DRAW);
+            GLint positionLocation = glGetAttribLocation(program, essl1_shaders::PositionAttrib());
+            glVertexAttribPointer(positionLocation, 2, GL_FLOAT, GL_FALSE, 0, nullptr);
+            glEnableVertexAttribArray(positionLocation);
+
+            glViewport(0, 0, kPbufferSize, kPbufferSize);
+            glClearColor(0.0f, 0.0f, 1.0f, 1.0f);
+
+            // Reading pixels makes this thread wait for the worker as well.
+            for (int iteration = 0; iteration < kIterations; ++iteration)
+            {
+                glClear(GL_COLOR_BUFFER_BIT);
+                glDrawArrays(GL_TRIANGLES, 0, 6);
+                if (iteration % 10 == 0)
+                {
+                    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
+                }
+            }
+            ASSERT_GL_NO_ERROR();
+        }
+
+        drawing = false;
+        EXPECT_EGL_TRUE(eglMakeCurrent(mDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT));
+    });
+
+    // Creating a context that shares with the deferred context waits for its queued calls.
+    EGLint sharedAttribs[] = {EGL_CONTEXT_CLIENT_VERSION, 2, EGL_NONE};
+    while (drawing)
+    {
+        EGLContext sharedContext = eglCreateContext(mDisplay, mConfig, mContext, sharedAttribs);
+        EXPECT_NE(EGL_NO_CONTEXT, sharedContext);
+        eglDestroyContext(mDisplay, sharedContext);
+    }
+
+    drawThread.join();
+}
+
+ANGLE_INSTANTIATE_TEST(EGLDeferredExecutionTest, WithNoFixture(ES2_VULKAN()));
+
+}  // namespace angle
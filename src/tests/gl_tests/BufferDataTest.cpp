@@ -519,6 +519,107 @@ TEST_P(BufferDataTest, MapBufferOES)
     EXPECT_EQ(data, actualData);
 }
 
+// Test that updating a whole vertex buffer that previous draws still use doesn't change what those
+// draws see.
+TEST_P(BufferDataTest, SubDataWhileInUse)
+{
+    constexpr GLint kQuadrantSize = 8;
+
+    std::vector<GLfloat> data(6, 0.0f);
+
+    glUseProgram(mProgram);
+    glBindBuffer(GL_ARRAY_BUFFER, mBuffer);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(GLfloat) * data.size(), data.data(), GL_DYNAMIC_DRAW);
+    glVertexAttribPointer(mAttribLocation, 1, GL_FLOAT, GL_FALSE, 0, nullptr);
+    glEnableVertexAttribArray(mAttribLocation);
+
+    // Draw each quadrant with a different value.
+    glEnable(GL_SCISSOR_TEST);
+    for (GLint quadrant = 0; quadrant < 4; ++quadrant)
+    {
+        std::fill(data.begin(), data.end(), static_cast<GLfloat>(quadrant + 1) * 0.25f);
+        glBindBuffer(GL_ARRAY_BUFFER, mBuffer);
+        glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(GLfloat) * data.size(), data.data());
+
+        glScissor((quadrant % 2) * kQuadrantSize, (quadrant / 2) * kQuadrantSize, kQuadrantSize,
+                  kQuadrantSize);
+        drawQuad(mProgram, "position", 0.5f);
+    }
+    ASSERT_GL_NO_ERROR();
+
+    for (GLint quadrant = 0; quadrant < 4; ++quadrant)
+    {
+        GLint expectedRed = static_cast<GLint>(static_cast<GLfloat>(quadrant + 1) * 0.25f * 255);
+        EXPECT_PIXEL_NEAR((quadrant % 2) * kQuadrantSize, (quadrant / 2) * kQuadrantSize,
+                          expectedRed, 0, 0, 255, 1);
+    }
+}
+
+// Test that repeatedly updating part of a vertex buffer that previous draws still use keeps the
+// rest of its contents.
+TEST_P(BufferDataTest, PartialSubDataWhileInUse)
+{
+    // The attribute reads the second half of the buffer, which is only written once.
+    std::vector<GLfloat> data(12, 1.0f);
+    std::vector<GLfloat> unreadData(6, 0.0f);
+
+    glUseProgram(mProgram);
+    glBindBuffer(GL_ARRAY_BUFFER, mBuffer);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(GLfloat) * data.size(), data.data(), GL_DYNAMIC_DRAW);
+    glVertexAttribPointer(mAttribLocation, 1, GL_FLOAT, GL_FALSE, 0,
+                          reinterpret_cast<const void *>(sizeof(GLfloat) * unreadData.size()));
+    glEnableVertexAttribArray(mAttribLocation);
+
+    for (int drawCount = 0; drawCount < 8; ++drawCount)
+    {
+        glBindBuffer(GL_ARRAY_BUFFER, mBuffer);
+        glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(GLfloat) * unreadData.size(),
+                        unreadData.data());
+        drawQuad(mProgram, "position", 0.5f);
+    }
+    ASSERT_GL_NO_ERROR();
+
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
+}
+
+// Test that mapping a vertex buffer that previous draws still use with GL_MAP_INVALIDATE_BUFFER_BIT
+// doesn't change what those draws see.
+TEST_P(BufferDataTestES3, MapBufferRangeInvalidateWhileInUse)
+{
+    constexpr GLint kQuadrantSize = 8;
+    constexpr size_t kDataSize    = sizeof(GLfloat) * 6;
+
+    glUseProgram(mProgram);
+    glBindBuffer(GL_ARRAY_BUFFER, mBuffer);
+    glBufferData(GL_ARRAY_BUFFER, kDataSize, nullptr, GL_DYNAMIC_DRAW);
+    glVertexAttribPointer(mAttribLocation, 1, GL_FLOAT, GL_FALSE, 0, nullptr);
+    glEnableVertexAttribArray(mAttribLocation);
+
+    // Draw each quadrant with a different value.
+    glEnable(GL_SCISSOR_TEST);
+    for (GLint quadrant = 0; quadrant < 4; ++quadrant)
+    {
+        glBindBuffer(GL_ARRAY_BUFFER, mBuffer);
+        GLfloat *mapPtr = reinterpret_cast<GLfloat *>(glMapBufferRange(
+            GL_ARRAY_BUFFER, 0, kDataSize, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT));
+        ASSERT_NE(nullptr, mapPtr);
+        std::fill(mapPtr, mapPtr + 6, static_cast<GLfloat>(quadrant + 1) * 0.25f);
+        glUnmapBuffer(GL_ARRAY_BUFFER);
+
+        glScissor((quadrant % 2) * kQuadrantSize, (quadrant / 2) * kQuadrantSize, kQuadrantSize,
+                  kQuadrantSize);
+        drawQuad(mProgram, "position", 0.5f);
+    }
+    ASSERT_GL_NO_ERROR();
+
+    for (GLint quadrant = 0; quadrant < 4; ++quadrant)
+    {
+        GLint expectedRed = static_cast<GLint>(static_cast<GLfloat>(quadrant + 1) * 0.25f * 255);
+        EXPECT_PIXEL_NEAR((quadrant % 2) * kQuadrantSize, (quadrant / 2) * kQuadrantSize,
+                          expectedRed, 0, 0, 255, 1);
+    }
+}
+
 // Tests a bug where copying buffer data immediately after creation hit a nullptr in D3D11.
 TEST_P(BufferDataTestES3, NoBufferInitDataCopyBug)
 {
@@ -536,6 +637,86 @@ TEST_P(BufferDataTestES3, NoBufferInitDataCopyBug)
     ASSERT_GL_NO_ERROR();
 }
 
+class BufferDataTestES31 : public BufferDataTest
+{};
+
+// Test that a storage buffer bound in a shared context sees updates to the buffer that are made
+// while the shared context's dispatches still use it.
+TEST_P(BufferDataTestES31, StorageBufferUpdateWhileInUseInSharedContext)
+{
+    constexpr char kCS[] = R"(#version 310 es
+layout(local_size_x=1, local_size_y=1, local_size_z=1) in;
+layout(std430, binding = 0) readonly buffer Input { uint inputValue; };
+layout(std430, binding = 1) buffer Output { uint outputValue; };
+void main()
+{
+    outputValue = inputValue;
+})";
+
+    EGLWindow *window   = getEGLWindow();
+    EGLDisplay display  = window->getDisplay();
+    EGLSurface surface  = window->getSurface();
+    EGLContext context1 = window->getContext();
+
+    GLuint value = 1;
+
+    GLBuffer inputBuffer;
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, inputBuffer);
+    glBufferData(GL_SHADER_STORAGE_BUFFER, sizeof(value), &value, GL_DYNAMIC_DRAW);
+
+    GLBuffer outputBuffer;
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, outputBuffer);
+    glBufferData(GL_SHADER_STORAGE_BUFFER, sizeof(value), nullptr, GL_DYNAMIC_READ);
+    ASSERT_GL_NO_ERROR();
+
+    EGLint contextAttributes[] = {
+        EGL_CONTEXT_MAJOR_VERSION_KHR,
+        GetParam().majorVersion,
+        EGL_CONTEXT_MINOR_VERSION_KHR,
+        GetParam().minorVersion,
+        EGL_NONE,
+    };
+    EGLContext context2 =
+        eglCreateContext(display, window->getConfig(), context1, contextAttributes);
+    ASSERT_NE(EGL_NO_CONTEXT, context2);
+
+    eglMakeCurrent(display, surface, surface, context2);
+    ANGLE_GL_COMPUTE_PROGRAM(program, kCS);
+    glUseProgram(program);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, inputBuffer);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 1, outputBuffer);
+
+    // Update the input buffer in the first context while the second context's dispatch uses it,
+    // more times than the buffer keeps previous memory around.
+    for (GLuint iteration = 0; iteration < 8; ++iteration)
+    {
+        eglMakeCurrent(display, surface, surface, context2);
+        glDispatchCompute(1, 1, 1);
+        ASSERT_GL_NO_ERROR();
+
+        eglMakeCurrent(display, surface, surface, context1);
+        value = iteration + 2;
+        glBindBuffer(GL_SHADER_STORAGE_BUFFER, inputBuffer);
+        glBufferData(GL_SHADER_STORAGE_BUFFER, sizeof(value), &value, GL_DYNAMIC_DRAW);
+        ASSERT_GL_NO_ERROR();
+    }
+
+    eglMakeCurrent(display, surface, surface, context2);
+    glDispatchCompute(1, 1, 1);
+    glMemoryBarrier(GL_BUFFER_UPDATE_BARRIER_BIT);
+
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, outputBuffer);
+    const GLuint *outputPtr = reinterpret_cast<const GLuint *>(
+        glMapBufferRange(GL_SHADER_STORAGE_BUFFER, 0, sizeof(value), GL_MAP_READ_BIT));
+    ASSERT_NE(nullptr, outputPtr);
+    EXPECT_EQ(value, *outputPtr);
+    glUnmapBuffer(GL_SHADER_STORAGE_BUFFER);
+    ASSERT_GL_NO_ERROR();
+
+    eglMakeCurrent(display, surface, surface, context1);
+    eglDestroyContext(display, context2);
+}
+
 // Use this to select which configurations (e.g. which renderer, which GLES major version) these
 // tests should be run against.
 ANGLE_INSTANTIATE_TEST(BufferDataTest,
@@ -545,6 +726,11 @@ ANGLE_INSTANTIATE_TEST(BufferDataTest,
                        ES2_OPENGLES(),
                        ES2_VULKAN());
 ANGLE_INSTANTIATE_TEST(BufferDataTestES3, ES3_D3D11(), ES3_OPENGL(), ES3_OPENGLES(), ES3_VULKAN());
+ANGLE_INSTANTIATE_TEST(BufferDataTestES31,
+                       ES31_D3D11(),
+                       ES31_OPENGL(),
+                       ES31_OPENGLES(),
+                       ES31_VULKAN());
 ANGLE_INSTANTIATE_TEST(IndexedBufferCopyTest,
                        ES3_D3D11(),
                        ES3_OPENGL(),
@@ -8,6 +8,9 @@
 //
 
 #include "test_utils/ANGLETest.h"
+#include "test_utils/gl_raii.h"
+
+#include <random>
 
 using namespace angle;
 
@@ -260,4 +263,95 @@ ANGLE_INSTANTIATE_TEST(ETCTextureTest,
                        ES2_OPENGL(),
                        ES3_OPENGL(),
                        ES2_VULKAN());
+
+class ETCTextureUploadTest : public ETCTextureTest
+{
+  protected:
+    // Draws |texture| over the whole window and reads the result back.
+    void drawTexture(GLuint texture, std::vector<GLColor> *pixelsOut)
+    {
+        ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Texture2D(), essl1_shaders::fs::Texture2D());
+        glBindTexture(GL_TEXTURE_2D, texture);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f);
+        ASSERT_GL_NO_ERROR();
+
+        pixelsOut->resize(getWindowWidth() * getWindowHeight());
+        glReadPixels(0, 0, getWindowWidth(), getWindowHeight(), GL_RGBA, GL_UNSIGNED_BYTE,
+                     pixelsOut->data());
+        ASSERT_GL_NO_ERROR();
+    }
+
+    // Uploads the same random blocks in a single call and in small pieces, and checks that both
+    // textures draw the same.  On Vulkan, large uploads may be decoded on the GPU while the small
+    // ones are always decoded on the CPU.
+    void testLargeUpload(GLenum format, GLsizei blockSize)
+    {
+        constexpr GLsizei kSize      = 512;
+        constexpr GLsizei kChunkSize = 64;
+
+        GLsizei blocksWide = kSize / 4;
+        std::vector<uint8_t> data(blocksWide * blocksWide * blockSize);
+        std::mt19937 generator(0xE7C);
+        std::uniform_int_distribution<int> byteValue(0, 255);
+        for (uint8_t &value : data)
+        {
+            value = static_cast<uint8_t>(byteValue(generator));
+        }
+
+        GLTexture wholeTexture;
+        glBindTexture(GL_TEXTURE_2D, wholeTexture);
+        glCompressedTexImage2D(GL_TEXTURE_2D, 0, format, kSize, kSize, 0,
+                               static_cast<GLsizei>(data.size()), data.data());
+        ASSERT_GL_NO_ERROR();
+
+        GLTexture chunkedTexture;
+        glBindTexture(GL_TEXTURE_2D, chunkedTexture);
+        glTexStorage2D(GL_TEXTURE_2D, 1, format, kSize, kSize);
+        GLsizei chunkBlocks = kChunkSize / 4;
+        std::vector<uint8_t> chunk(chunkBlocks * chunkBlocks * blockSize);
+        for (GLsizei y = 0; y < kSize; y += kChunkSize)
+        {
+            for (GLsizei x = 0; x < kSize; x += kChunkSize)
+            {
+                for (GLsizei row = 0; row < chunkBlocks; ++row)
+                {
+                    size_t srcOffset = ((y / 4 + row) * blocksWide + x / 4) * blockSize;
+                    memcpy(chunk.data() + row * chunkBlocks * blockSize, data.data() + srcOffset,
+                           chunkBlocks * blockSize);
+                }
+                glCompressedTexSubImage2D(GL_TEXTURE_2D, 0, x, y, kChunkSize, kChunkSize, format,
+                                          static_cast<GLsizei>(chunk.size()), chunk.data());
+            }
+        }
+        ASSERT_GL_NO_ERROR();
+
+        std::vector<GLColor> wholePixels;
+        std::vector<GLColor> chunkedPixels;
+        drawTexture(wholeTexture, &wholePixels);
+        drawTexture(chunkedTexture, &chunkedPixels);
+        EXPECT_EQ(chunkedPixels, wholePixels);
+    }
+};
+
+// Test that a large ETC2 RGB8 upload decodes the same as small ones.
+TEST_P(ETCTextureUploadTest, LargeRGB8Upload)
+{
+    testLargeUpload(GL_COMPRESSED_RGB8_ETC2, 8);
+}
+
+// Test that a large ETC2 RGB8 punch-through alpha upload decodes the same as small ones.
+TEST_P(ETCTextureUploadTest, LargeRGB8A1Upload)
+{
+    testLargeUpload(GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_ETC2, 8);
+}
+
+// Test that a large ETC2 RGBA8 upload decodes the same as small ones.
+TEST_P(ETCTextureUploadTest, LargeRGBA8Upload)
+{
+    testLargeUpload(GL_COMPRESSED_RGBA8_ETC2_EAC, 16);
+}
+
+ANGLE_INSTANTIATE_TEST(ETCTextureUploadTest, ES3_OPENGL(), ES3_OPENGLES(), ES3_VULKAN());
 }  // anonymous namespace
@@ -0,0 +1,245 @@
+//
+// Copyright 2019 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// StateCallStatisticsTest.cpp : Tests of the GL_ANGLE_state_call_statistics extension.
+
+#include "test_utils/ANGLETest.h"
+
+#include "test_utils/gl_raii.h"
+
+namespace angle
+{
+namespace
+{
+// Indices of the counted calls, from the extension specification.
+constexpr GLuint kBindTextureIndex = 5;
+constexpr GLuint kEnableIndex      = 21;
+constexpr GLuint kStencilFuncIndex = 27;
+constexpr GLuint kUseProgramIndex  = 33;
+constexpr GLuint kStateCallCount   = 35;
+}  // anonymous namespace
+
+class StateCallStatisticsTest : public ANGLETest
+{
+  protected:
+    StateCallStatisticsTest()
+    {
+        setWindowWidth(16);
+        setWindowHeight(16);
+        setConfigRedBits(8);
+        setConfigGreenBits(8);
+        setConfigBlueBits(8);
+        setConfigAlphaBits(8);
+    }
+
+    GLint getTotal(GLenum pname)
+    {
+        GLint result = -1;
+        glGetIntegerv(pname, &result);
+        EXPECT_GL_NO_ERROR();
+        return result;
+    }
+
+    GLint64 getCount(GLenum pname, GLuint index)
+    {
+        GLint64 result = -1;
+        glGetInteger64i_v(pname, index, &result);
+        EXPECT_GL_NO_ERROR();
+        return result;
+    }
+};
+
+// GL_ANGLE_state_call_statistics is implemented in the front-end and should always be exposed.
+TEST_P(StateCallStatisticsTest, ExtensionStringExposed)
+{
+    EXPECT_TRUE(EnsureGLExtensionEnabled("GL_ANGLE_state_call_statistics"));
+}
+
+// Test that calls that don't change the state are counted as redundant.
+TEST_P(StateCallStatisticsTest, TotalCounts)
+{
+    ANGLE_SKIP_TEST_IF(!EnsureGLExtensionEnabled("GL_ANGLE_state_call_statistics"));
+
+    glDisable(GL_BLEND);
+    glDepthFunc(GL_LESS);
+
+    GLint effective = getTotal(GL_EFFECTIVE_STATE_CALLS_ANGLE);
+    GLint redundant = getTotal(GL_REDUNDANT_STATE_CALLS_ANGLE);
+
+    glEnable(GL_BLEND);
+    glEnable(GL_BLEND);
+    glDepthFunc(GL_LESS);
+    glDepthFunc(GL_GREATER);
+    glDepthFunc(GL_GREATER);
+    glDepthFunc(GL_GREATER);
+
+    EXPECT_EQ(effective + 2, getTotal(GL_EFFECTIVE_STATE_CALLS_ANGLE));
+    EXPECT_EQ(redundant + 4, getTotal(GL_REDUNDANT_STATE_CALLS_ANGLE));
+}
+
+// Test the counts of single calls.
+TEST_P(StateCallStatisticsTest, PerCallCounts)
+{
+    ANGLE_SKIP_TEST_IF(!EnsureGLExtensionEnabled("GL_ANGLE_state_call_statistics"));
+
+    GLint64 effectiveEnables = getCount(GL_EFFECTIVE_STATE_CALLS_ANGLE, kEnableIndex);
+    GLint64 redundantEnables = getCount(GL_REDUNDANT_STATE_CALLS_ANGLE, kEnableIndex);
+    GLint64 effectiveBinds   = getCount(GL_EFFECTIVE_STATE_CALLS_ANGLE, kBindTextureIndex);
+    GLint64 redundantBinds   = getCount(GL_REDUNDANT_STATE_CALLS_ANGLE, kBindTextureIndex);
+
+    glDisable(GL_CULL_FACE);
+    glEnable(GL_CULL_FACE);
+    glEnable(GL_CULL_FACE);
+
+    GLTexture texture;
+    glBindTexture(GL_TEXTURE_2D, texture);
+    glBindTexture(GL_TEXTURE_2D, texture);
+    glBindTexture(GL_TEXTURE_2D, texture);
+
+    EXPECT_EQ(effectiveEnables + 1, getCount(GL_EFFECTIVE_STATE_CALLS_ANGLE, kEnableIndex));
+    EXPECT_EQ(redundantEnables + 1, getCount(GL_REDUNDANT_STATE_CALLS_ANGLE, kEnableIndex));
+    EXPECT_EQ(effectiveBinds + 1, getCount(GL_EFFECTIVE_STATE_CALLS_ANGLE, kBindTextureIndex));
+    EXPECT_EQ(redundantBinds + 2, getCount(GL_REDUNDANT_STATE_CALLS_ANGLE, kBindTextureIndex));
+}
+
+// Test that a call that sets both faces is counted once, under its own entry point.
+TEST_P(StateCallStatisticsTest, StencilFuncCountedOnce)
+{
+    ANGLE_SKIP_TEST_IF(!EnsureGLExtensionEnabled("GL_ANGLE_state_call_statistics"));
+
+    GLint64 effective = getCount(GL_EFFECTIVE_STATE_CALLS_ANGLE, kStencilFuncIndex);
+    GLint64 separate  = getCount(GL_EFFECTIVE_STATE_CALLS_ANGLE, kStencilFuncIndex + 1);
+
+    glStencilFunc(GL_EQUAL, 1, 0xFF);
+
+    EXPECT_EQ(effective + 1, getCount(GL_EFFECTIVE_STATE_CALLS_ANGLE, kStencilFuncIndex));
+    EXPECT_EQ(separate, getCount(GL_EFFECTIVE_STATE_CALLS_ANGLE, kStencilFuncIndex + 1));
+}
+
+// Test that a redundant texture bind doesn't lose the binding used by a draw.
+TEST_P(StateCallStatisticsTest, RedundantBindTextureThenDraw)
+{
+    ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Texture2D(), essl1_shaders::fs::Texture2D());
+
+    GLTexture texture;
+    glBindTexture(GL_TEXTURE_2D, texture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, &GLColor::green);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+
+    drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f);
+    glBindTexture(GL_TEXTURE_2D, texture);
+    glUseProgram(program);
+    drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f);
+
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
+    ASSERT_GL_NO_ERROR();
+}
+
+// Test that rebinding the current program after another context relinked it installs the new
+// executable and is counted as effective, while rebinding it again is redundant.
+TEST_P(StateCallStatisticsTest, UseProgramAfterRelinkInSharedContext)
+{
+    ANGLE_SKIP_TEST_IF(!EnsureGLExtensionEnabled("GL_ANGLE_state_call_statistics"));
+
+    EGLWindow *window   = getEGLWindow();
+    EGLDisplay display  = window->getDisplay();
+    EGLSurface surface  = window->getSurface();
+    EGLContext context1 = window->getContext();
+
+    GLShader vs(GL_VERTEX_SHADER);
+    GLShader redFS(GL_FRAGMENT_SHADER);
+    GLShader greenFS(GL_FRAGMENT_SHADER);
+    for (auto shader : {std::make_pair(vs.get(), essl1_shaders::vs::Simple()),
+                        std::make_pair(redFS.get(), essl1_shaders::fs::Red()),
+                        std::make_pair(greenFS.get(), essl1_shaders::fs::Green())})
+    {
+        glShaderSource(shader.first, 1, &shader.second, nullptr);
+        glCompileShader(shader.first);
+    }
+
+    GLProgram program;
+    glAttachShader(program, vs);
+    glAttachShader(program, redFS);
+    glLinkProgram(program);
+    glUseProgram(program);
+    drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
+
+    EGLint contextAttributes[] = {
+        EGL_CONTEXT_MAJOR_VERSION_KHR,
+        GetParam().majorVersion,
+        EGL_CONTEXT_MINOR_VERSION_KHR,
+        GetParam().minorVersion,
+        EGL_NONE,
+    };
+    EGLContext context2 =
+        eglCreateContext(display, window->getConfig(), context1, contextAttributes);
+    ASSERT_NE(context2, EGL_NO_CONTEXT);
+
+    eglMakeCurrent(display, surface, surface, context2);
+    glDetachShader(program, redFS);
+    glAttachShader(program, greenFS);
+    glLinkProgram(program);
+    glFinish();
+    eglMakeCurrent(display, surface, surface, context1);
+
+    GLint64 effective = getCount(GL_EFFECTIVE_STATE_CALLS_ANGLE, kUseProgramIndex);
+    GLint64 redundant = getCount(GL_REDUNDANT_STATE_CALLS_ANGLE, kUseProgramIndex);
+
+    glUseProgram(program);
+    EXPECT_EQ(effective + 1, getCount(GL_EFFECTIVE_STATE_CALLS_ANGLE, kUseProgramIndex));
+    glUseProgram(program);
+    EXPECT_EQ(redundant + 1, getCount(GL_REDUNDANT_STATE_CALLS_ANGLE, kUseProgramIndex));
+
+    drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
+    ASSERT_GL_NO_ERROR();
+
+    eglDestroyContext(display, context2);
+}
+
+// Test that indices past the last counted call are rejected.
+TEST_P(StateCallStatisticsTest, InvalidIndex)
+{
+    ANGLE_SKIP_TEST_IF(!EnsureGLExtensionEnabled("GL_ANGLE_state_call_statistics"));
+
+    GLint64 result = 0;
+    glGetInteger64i_v(GL_REDUNDANT_STATE_CALLS_ANGLE, kStateCallCount - 1, &result);
+    EXPECT_GL_NO_ERROR();
+
+    glGetInteger64i_v(GL_REDUNDANT_STATE_CALLS_ANGLE, kStateCallCount, &result);
+    EXPECT_GL_ERROR(GL_INVALID_VALUE);
+}
+
+// The per-call counts are queried with glGetInteger64i_v, so only the totals are tested on ES 2.0.
+class StateCallStatisticsTestES2 : public StateCallStatisticsTest
+{};
+
+// Test that ES 2.0 contexts can query the totals.
+TEST_P(StateCallStatisticsTestES2, TotalCounts)
+{
+    ANGLE_SKIP_TEST_IF(!EnsureGLExtensionEnabled("GL_ANGLE_state_call_statistics"));
+
+    glLineWidth(1.0f);
+    GLint redundant = getTotal(GL_REDUNDANT_STATE_CALLS_ANGLE);
+
+    glLineWidth(1.0f);
+    EXPECT_EQ(redundant + 1, getTotal(GL_REDUNDANT_STATE_CALLS_ANGLE));
+}
+
+ANGLE_INSTANTIATE_TEST(StateCallStatisticsTest,
+                       ES3_D3D11(),
+                       ES3_OPENGL(),
+                       ES3_OPENGLES(),
+                       ES3_VULKAN());
+ANGLE_INSTANTIATE_TEST(StateCallStatisticsTestES2,
+                       ES2_D3D9(),
+                       ES2_D3D11(),
+                       ES2_OPENGL(),
+                       ES2_OPENGLES(),
+                       ES2_VULKAN());
+}  // namespace angle
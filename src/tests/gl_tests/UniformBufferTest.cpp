@@ -1513,6 +1513,47 @@ TEST_P(UniformBufferTest, DependentBufferChange)
     EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
 }
 
+// Test switching back and forth between buffers, and replacing one of them, between draws.  The
+// Vulkan back-end reuses the descriptor sets written for previously bound buffers.
+TEST_P(UniformBufferTest, AlternateBuffers)
+{
+    ANGLE_GL_PROGRAM(program, essl3_shaders::vs::Simple(), kFragmentShader);
+    GLint uboIndex = glGetUniformBlockIndex(program, "color_ubo");
+    glUniformBlockBinding(program, uboIndex, 0);
+
+    GLBuffer redBuffer;
+    glBindBuffer(GL_UNIFORM_BUFFER, redBuffer);
+    glBufferData(GL_UNIFORM_BUFFER, sizeof(GLColor32F), &kFloatRed, GL_STATIC_DRAW);
+
+    GLBuffer greenBuffer;
+    glBindBuffer(GL_UNIFORM_BUFFER, greenBuffer);
+    glBufferData(GL_UNIFORM_BUFFER, sizeof(GLColor32F), &kFloatGreen, GL_STATIC_DRAW);
+
+    for (int iteration = 0; iteration < 3; ++iteration)
+    {
+        glBindBufferBase(GL_UNIFORM_BUFFER, 0, redBuffer);
+        drawQuad(program, essl3_shaders::PositionAttrib(), 0.5f);
+        EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
+
+        glBindBufferBase(GL_UNIFORM_BUFFER, 0, greenBuffer);
+        drawQuad(program, essl3_shaders::PositionAttrib(), 0.5f);
+        EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
+    }
+
+    // Give the red buffer new storage with new contents, and make sure it's used.
+    glBindBuffer(GL_UNIFORM_BUFFER, redBuffer);
+    glBufferData(GL_UNIFORM_BUFFER, sizeof(GLColor32F), &kFloatBlue, GL_STATIC_DRAW);
+
+    glBindBufferBase(GL_UNIFORM_BUFFER, 0, redBuffer);
+    drawQuad(program, essl3_shaders::PositionAttrib(), 0.5f);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::blue);
+
+    glBindBufferBase(GL_UNIFORM_BUFFER, 0, greenBuffer);
+    drawQuad(program, essl3_shaders::PositionAttrib(), 0.5f);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
+    ASSERT_GL_NO_ERROR();
+}
+
 // Recreate WebGL conformance test conformance2/uniforms/large-uniform-buffers.html to test
 // regression in http://anglebug.com/3388
 TEST_P(UniformBufferTest, SizeOverMaxBlockSize)
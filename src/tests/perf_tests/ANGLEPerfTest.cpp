@@ -659,6 +659,11 @@ void ANGLERenderTest::setRobustResourceInit(bool enabled)
     mConfigParams.robustResourceInit = enabled;
 }
 
+void ANGLERenderTest::setDeferredExecutionEnabled(bool enabled)
+{
+    mConfigParams.deferredExecution = enabled;
+}
+
 std::vector<TraceEvent> &ANGLERenderTest::getTraceEventBuffer()
 {
     return mTraceEventBuffer;
@@ -140,6 +140,7 @@ class ANGLERenderTest : public ANGLEPerfTest
 
     void setWebGLCompatibilityEnabled(bool webglCompatibility);
     void setRobustResourceInit(bool enabled);
+    void setDeferredExecutionEnabled(bool enabled);
 
     void startGpuTimer();
     void stopGpuTimer();
@@ -18,6 +18,9 @@ namespace
 {
 constexpr unsigned int kIterationsPerStep = 4;
 
+// The default buffer is large enough that each update only touches a small part of it.
+constexpr GLsizeiptr kDefaultBufferSize = 40000000;
+
 struct BufferSubDataParams final : public RenderTestParams
 {
     BufferSubDataParams()
@@ -28,7 +31,7 @@ struct BufferSubDataParams final : public RenderTestParams
         windowWidth       = 512;
         windowHeight      = 512;
         updateSize        = 3000;
-        bufferSize        = 40000000;
+        bufferSize        = kDefaultBufferSize;
         iterationsPerStep = kIterationsPerStep;
         updateRate        = 1;
     }
@@ -245,6 +248,12 @@ std::string BufferSubDataParams::story() const
     strstr << vertexComponentCount;
     strstr << "_every" << updateRate;
 
+    // Small buffers are updated while the GPU still uses them, as streamed vertex data is.
+    if (bufferSize != kDefaultBufferSize)
+    {
+        strstr << "_buffer" << bufferSize;
+    }
+
     return strstr.str();
 }
 
@@ -380,6 +389,22 @@ BufferSubDataParams BufferUpdateVulkanParams()
     return params;
 }
 
+// Each update replaces the whole buffer, which the previous draw is still using.
+BufferSubDataParams BufferStreamParams(const BufferSubDataParams &base)
+{
+    BufferSubDataParams params = base;
+    params.bufferSize          = params.updateSize;
+    return params;
+}
+
+// Each update replaces a quarter of a small buffer the previous draw is still using.
+BufferSubDataParams BufferPartialStreamParams(const BufferSubDataParams &base)
+{
+    BufferSubDataParams params = base;
+    params.bufferSize          = params.updateSize * 4;
+    return params;
+}
+
 TEST_P(BufferSubDataBenchmark, Run)
 {
     run();
@@ -389,6 +414,9 @@ ANGLE_INSTANTIATE_TEST(BufferSubDataBenchmark,
                        BufferUpdateD3D11Params(),
                        BufferUpdateD3D9Params(),
                        BufferUpdateOpenGLOrGLESParams(),
-                       BufferUpdateVulkanParams());
+                       BufferUpdateVulkanParams(),
+                       BufferStreamParams(BufferUpdateOpenGLOrGLESParams()),
+                       BufferStreamParams(BufferUpdateVulkanParams()),
+                       BufferPartialStreamParams(BufferUpdateVulkanParams()));
 
 }  // namespace
@@ -11,6 +11,10 @@
 
 #include "ANGLEPerfTest.h"
 
+#include <map>
+
+#include "ANGLEPerfTestArgs.h"
+
 #include "GLSLANG/ShaderLang.h"
 #include "compiler/translator/Compiler.h"
 #include "compiler/translator/InitializeGlobals.h"
@@ -162,8 +166,197 @@ void main()
 
 const char *kTrickyESSL300Id = "TrickyESSL300";
 
+// A larger material shader in the style of the uber-shaders of game engines, with lighting, shadow
+// and environment mapping.
+const char *kUberESSL300FragSource = R"(#version 300 es
+precision highp float;
+precision highp int;
+precision highp sampler2D;
+precision highp samplerCube;
+
+#define MAX_LIGHTS 8
+#define USE_NORMAL_MAP 1
+#define USE_SHADOWS 1
+
+struct Light
+{
+    vec4 positionAndRange;
+    vec4 colorAndIntensity;
+    vec4 directionAndCone;
+    int type;
+};
+
+struct Material
+{
+    vec4 baseColor;
+    float metallic;
+    float roughness;
+    float occlusion;
+    vec3 emissive;
+};
+
+layout(std140) uniform Lights
+{
+    Light uLights[MAX_LIGHTS];
+    int uLightCount;
+};
+
+uniform Material uMaterial;
+uniform sampler2D uBaseColorMap;
+uniform sampler2D uNormalMap;
+uniform sampler2D uMetallicRoughnessMap;
+uniform sampler2D uShadowMap;
+uniform samplerCube uEnvironmentMap;
+uniform mat4 uShadowMatrix;
+uniform vec3 uCameraPosition;
+uniform float uExposure;
+
+in vec3 vWorldPosition;
+in vec3 vNormal;
+in vec4 vTangent;
+in vec2 vTexCoord;
+
+layout(location = 0) out vec4 outColor;
+
+const float kPi = 3.14159265;
+
+float distributionGGX(float NdotH, float roughness)
+{
+    float a  = roughness * roughness;
+    float a2 = a * a;
+    float d  = NdotH * NdotH * (a2 - 1.0) + 1.0;
+    return a2 / (kPi * d * d);
+}
+
+float geometrySmith(float NdotV, float NdotL, float roughness)
+{
+    float k = (roughness + 1.0) * (roughness + 1.0) / 8.0;
+    float gv = NdotV / (NdotV * (1.0 - k) + k);
+    float gl = NdotL / (NdotL * (1.0 - k) + k);
+    return gv * gl;
+}
+
+vec3 fresnelSchlick(float cosTheta, vec3 f0)
+{
+    return f0 + (1.0 - f0) * pow(1.0 - cosTheta, 5.0);
+}
+
+vec3 getNormal()
+{
+    vec3 n = normalize(vNormal);
+#if USE_NORMAL_MAP
+    vec3 t = normalize(vTangent.xyz);
+    vec3 b = cross(n, t) * vTangent.w;
+    vec3 mapped = texture(uNormalMap, vTexCoord).xyz * 2.0 - 1.0;
+    n = normalize(mat3(t, b, n) * mapped);
+#endif
+    return n;
+}
+
+float getShadow(vec3 worldPosition)
+{
+#if USE_SHADOWS
+    vec4 shadowCoord = uShadowMatrix * vec4(worldPosition, 1.0);
+    shadowCoord.xyz /= shadowCoord.w;
+    float shadow = 0.0;
+    vec2 texelSize = 1.0 / vec2(textureSize(uShadowMap, 0));
+    for (int x = -1; x <= 1; ++x)
+    {
+        for (int y = -1; y <= 1; ++y)
+        {
+            float depth = texture(uShadowMap, shadowCoord.xy + vec2(x, y) * texelSize).r;
+            shadow += shadowCoord.z - 0.005 > depth ? 1.0 : 0.0;
+        }
+    }
+    return 1.0 - shadow / 9.0;
+#else
+    return 1.0;
+#endif
+}
+
+float getAttenuation(Light light, vec3 toLight)
+{
+    if (light.type == 0)
+    {
+        return 1.0;
+    }
+    float distance = length(toLight);
+    float range = light.positionAndRange.w;
+    float attenuation = clamp(1.0 - pow(distance / range, 4.0), 0.0, 1.0) / (distance * distance);
+    if (light.type == 2)
+    {
+        float cosAngle = dot(normalize(-toLight), light.directionAndCone.xyz);
+        float cone = light.directionAndCone.w;
+        attenuation *= smoothstep(cone, cone + 0.1, cosAngle);
+    }
+    return attenuation;
+}
+
+void main()
+{
+    vec4 baseColor = uMaterial.baseColor * texture(uBaseColorMap, vTexCoord);
+    vec2 metallicRoughness = texture(uMetallicRoughnessMap, vTexCoord).bg;
+    float metallic = uMaterial.metallic * metallicRoughness.x;
+    float roughness = clamp(uMaterial.roughness * metallicRoughness.y, 0.04, 1.0);
+
+    vec3 n = getNormal();
+    vec3 v = normalize(uCameraPosition - vWorldPosition);
+    float NdotV = max(dot(n, v), 1e-4);
+    vec3 f0 = mix(vec3(0.04), baseColor.rgb, metallic);
+
+    vec3 color = vec3(0.0);
+    for (int i = 0; i < MAX_LIGHTS; ++i)
+    {
+        if (i >= uLightCount)
+        {
+            break;
+        }
+        Light light = uLights[i];
+        vec3 toLight = light.type == 0 ? -light.directionAndCone.xyz
+                                       : light.positionAndRange.xyz - vWorldPosition;
+        vec3 l = normalize(toLight);
+        vec3 h = normalize(l + v);
+        float NdotL = max(dot(n, l), 0.0);
+        if (NdotL <= 0.0)
+        {
+            continue;
+        }
+        float NdotH = max(dot(n, h), 0.0);
+        vec3 f = fresnelSchlick(max(dot(h, v), 0.0), f0);
+        float ndf = distributionGGX(NdotH, roughness);
+        float g = geometrySmith(NdotV, NdotL, roughness);
+        vec3 specular = ndf * g * f / (4.0 * NdotV * NdotL + 1e-4);
+        vec3 diffuse = (1.0 - f) * (1.0 - metallic) * baseColor.rgb / kPi;
+        vec3 radiance = light.colorAndIntensity.rgb * light.colorAndIntensity.a *
+                        getAttenuation(light, toLight);
+        color += (diffuse + specular) * radiance * NdotL;
+    }
+
+    color *= getShadow(vWorldPosition);
+
+    vec3 r = reflect(-v, n);
+    vec3 environment = textureLod(uEnvironmentMap, r, roughness * 8.0).rgb;
+    color += environment * fresnelSchlick(NdotV, f0) * uMaterial.occlusion;
+    color += uMaterial.emissive;
+
+    color = vec3(1.0) - exp(-color * uExposure);
+    color = pow(color, vec3(1.0 / 2.2));
+    outColor = vec4(color, baseColor.a);
+})";
+
+const char *kUberESSL300Id = "UberESSL300";
+
 constexpr int kNumIterationsPerStep = 4;
 
+// The number of compiles the time spent in each pass over the AST is averaged over.
+constexpr int kNumPassTimingCompiles = 16;
+
+constexpr double kNanoSecondsPerSecond = 1e9;
+
+constexpr ShCompileOptions kCompileOptions = SH_OBJECT_CODE | SH_VARIABLES |
+                                             SH_INITIALIZE_UNINITIALIZED_LOCALS |
+                                             SH_INIT_OUTPUT_VARIABLES;
+
 struct CompilerParameters
 {
     CompilerParameters() { output = SH_HLSL_4_1_OUTPUT; }
@@ -256,6 +449,8 @@ class CompilerPerfTest : public ANGLEPerfTest,
     void setTestShader(const char *str) { mTestShader = str; }
 
   private:
+    void reportPassTimings();
+
     const char *mTestShader;
 
     ShBuiltInResources mResources;
@@ -290,6 +485,11 @@ void CompilerPerfTest::SetUp()
 
 void CompilerPerfTest::TearDown()
 {
+    if (mTranslator && !mSkipTest && !gCalibration)
+    {
+        reportPassTimings();
+    }
+
     SafeDelete(mTranslator);
 
     SetGlobalPoolAllocator(nullptr);
@@ -300,16 +500,36 @@ void CompilerPerfTest::TearDown()
     ANGLEPerfTest::TearDown();
 }
 
-void CompilerPerfTest::step()
+void CompilerPerfTest::reportPassTimings()
 {
     const char *shaderStrings[] = {mTestShader};
 
-    ShCompileOptions compileOptions = SH_OBJECT_CODE | SH_VARIABLES |
-                                      SH_INITIALIZE_UNINITIALIZED_LOCALS | SH_INIT_OUTPUT_VARIABLES;
+    // Passes that run more than once in a compile are reported together.
+    std::map<std::string, double> passSeconds;
+    for (int compile = 0; compile < kNumPassTimingCompiles; ++compile)
+    {
+        mTranslator->compile(shaderStrings, 1, kCompileOptions | SH_COLLECT_PASS_TIMINGS);
+        for (const sh::PassTiming &timing : mTranslator->getPassTimings())
+        {
+            passSeconds[timing.name] += timing.seconds;
+        }
+    }
+
+    for (const auto &pass : passSeconds)
+    {
+        std::string metric = ".pass_" + pass.first;
+        mReporter->RegisterFyiMetric(metric, "ns");
+        mReporter->AddResult(metric, pass.second * kNanoSecondsPerSecond / kNumPassTimingCompiles);
+    }
+}
+
+void CompilerPerfTest::step()
+{
+    const char *shaderStrings[] = {mTestShader};
 
 #if !defined(NDEBUG)
     // Make sure that compilation succeeds and print the info log if it doesn't in debug mode.
-    if (!mTranslator->compile(shaderStrings, 1, compileOptions))
+    if (!mTranslator->compile(shaderStrings, 1, kCompileOptions))
     {
         std::cout << "Compiling perf test shader failed with log:\n"
                   << mTranslator->getInfoSink().info.c_str();
@@ -318,7 +538,7 @@ void CompilerPerfTest::step()
 
     for (unsigned int iteration = 0; iteration < kNumIterationsPerStep; ++iteration)
     {
-        mTranslator->compile(shaderStrings, 1, compileOptions);
+        mTranslator->compile(shaderStrings, 1, kCompileOptions);
     }
 }
 
@@ -333,15 +553,18 @@ ANGLE_INSTANTIATE_TEST(
     CompilerPerfParameters(SH_HLSL_4_1_OUTPUT, kSimpleESSL300FragSource, kSimpleESSL300Id),
     CompilerPerfParameters(SH_HLSL_4_1_OUTPUT, kRealWorldESSL100FragSource, kRealWorldESSL100Id),
     CompilerPerfParameters(SH_HLSL_4_1_OUTPUT, kTrickyESSL300FragSource, kTrickyESSL300Id),
+    CompilerPerfParameters(SH_HLSL_4_1_OUTPUT, kUberESSL300FragSource, kUberESSL300Id),
     CompilerPerfParameters(SH_GLSL_450_CORE_OUTPUT, kSimpleESSL100FragSource, kSimpleESSL100Id),
     CompilerPerfParameters(SH_GLSL_450_CORE_OUTPUT, kSimpleESSL300FragSource, kSimpleESSL300Id),
     CompilerPerfParameters(SH_GLSL_450_CORE_OUTPUT,
                            kRealWorldESSL100FragSource,
                            kRealWorldESSL100Id),
     CompilerPerfParameters(SH_GLSL_450_CORE_OUTPUT, kTrickyESSL300FragSource, kTrickyESSL300Id),
+    CompilerPerfParameters(SH_GLSL_450_CORE_OUTPUT, kUberESSL300FragSource, kUberESSL300Id),
     CompilerPerfParameters(SH_ESSL_OUTPUT, kSimpleESSL100FragSource, kSimpleESSL100Id),
     CompilerPerfParameters(SH_ESSL_OUTPUT, kSimpleESSL300FragSource, kSimpleESSL300Id),
     CompilerPerfParameters(SH_ESSL_OUTPUT, kRealWorldESSL100FragSource, kRealWorldESSL100Id),
-    CompilerPerfParameters(SH_ESSL_OUTPUT, kTrickyESSL300FragSource, kTrickyESSL300Id));
+    CompilerPerfParameters(SH_ESSL_OUTPUT, kTrickyESSL300FragSource, kTrickyESSL300Id),
+    CompilerPerfParameters(SH_ESSL_OUTPUT, kUberESSL300FragSource, kUberESSL300Id));
 
 }  // anonymous namespace
@@ -9,6 +9,7 @@
 
 #include "ANGLEPerfTest.h"
 #include "DrawCallPerfParams.h"
+#include "common/system_utils.h"
 #include "test_utils/draw_call_perf_utils.h"
 #include "util/shader_utils.h"
 
@@ -30,6 +31,8 @@ struct DrawArraysPerfParams : public DrawCallPerfParams
     std::string story() const override;
 
     StateChange stateChange = StateChange::NoChange;
+    // Creates the context with EGL_CONTEXT_DEFERRED_EXECUTION_ANGLE.
+    bool deferredExecution = false;
 };
 
 std::string DrawArraysPerfParams::story() const
@@ -56,6 +59,11 @@ std::string DrawArraysPerfParams::story() const
             break;
     }
 
+    if (deferredExecution)
+    {
+        strstr << "_deferred";
+    }
+
     return strstr.str();
 }
 
@@ -114,9 +122,17 @@ class DrawCallPerfBenchmark : public ANGLERenderTest,
     GLuint mTexture1   = 0;
     GLuint mTexture2   = 0;
     int mNumTris       = GetParam().numTris;
+
+    // Time spent in the GL calls of drawBenchmark, which deferred contexts hand to their worker
+    // thread, and the number of iterations run in it.
+    double mAppThreadTime       = 0.0;
+    size_t mAppThreadIterations = 0;
 };
 
-DrawCallPerfBenchmark::DrawCallPerfBenchmark() : ANGLERenderTest("DrawCallPerf", GetParam()) {}
+DrawCallPerfBenchmark::DrawCallPerfBenchmark() : ANGLERenderTest("DrawCallPerf", GetParam())
+{
+    setDeferredExecutionEnabled(GetParam().deferredExecution);
+}
 
 void DrawCallPerfBenchmark::initializeBenchmark()
 {
@@ -192,6 +208,8 @@ void main()
     mTexture1 = CreateSimpleTexture2D();
     mTexture2 = CreateSimpleTexture2D();
 
+    mReporter->RegisterImportantMetric(".app_thread_time", "ns");
+
     ASSERT_GL_NO_ERROR();
 }
 
@@ -204,6 +222,11 @@ void DrawCallPerfBenchmark::destroyBenchmark()
     glDeleteTextures(1, &mTexture1);
     glDeleteTextures(1, &mTexture2);
     glDeleteFramebuffers(1, &mFBO);
+
+    if (mAppThreadIterations > 0)
+    {
+        mReporter->AddResult(".app_thread_time", mAppThreadTime * 1e9 / mAppThreadIterations);
+    }
 }
 
 void ClearThenDraw(unsigned int iterations, GLsizei numElements)
@@ -290,6 +313,7 @@ void DrawCallPerfBenchmark::drawBenchmark()
     const auto &eglParams = GetParam().eglParameters;
     const auto &params    = GetParam();
     GLsizei numElements   = static_cast<GLsizei>(3 * mNumTris);
+    double startTime      = angle::GetCurrentTime();
 
     switch (params.stateChange)
     {
@@ -321,6 +345,10 @@ void DrawCallPerfBenchmark::drawBenchmark()
             break;
     }
 
+    // Measured before glGetError, which waits for the deferred calls to run.
+    mAppThreadTime += angle::GetCurrentTime() - startTime;
+    mAppThreadIterations += params.iterationsPerStep;
+
     ASSERT_GL_NO_ERROR();
 }
 
@@ -336,6 +364,13 @@ DrawArraysPerfParams DrawArrays(const DrawCallPerfParams &base, StateChange stat
     return params;
 }
 
+DrawArraysPerfParams Deferred(const DrawArraysPerfParams &base)
+{
+    DrawArraysPerfParams params(base);
+    params.deferredExecution = true;
+    return params;
+}
+
 using namespace params;
 
 ANGLE_INSTANTIATE_TEST(DrawCallPerfBenchmark,
@@ -362,9 +397,16 @@ ANGLE_INSTANTIATE_TEST(DrawCallPerfBenchmark,
                        DrawArrays(DrawCallOpenGL(), StateChange::Texture),
                        DrawArrays(NullDevice(DrawCallOpenGL()), StateChange::Texture),
                        DrawArrays(DrawCallValidation(), StateChange::NoChange),
+                       DrawArrays(DrawCallNull(), StateChange::NoChange),
+                       DrawArrays(ValidationOnly(DrawCallNull()), StateChange::NoChange),
+                       DrawArrays(ValidationOnly(DrawCallNull()), StateChange::Texture),
+                       Deferred(DrawArrays(DrawCallNull(), StateChange::NoChange)),
+                       DrawArrays(DrawCallNull(), StateChange::Texture),
+                       Deferred(DrawArrays(DrawCallNull(), StateChange::Texture)),
                        DrawArrays(DrawCallVulkan(), StateChange::NoChange),
                        DrawArrays(Offscreen(DrawCallVulkan()), StateChange::NoChange),
                        DrawArrays(NullDevice(DrawCallVulkan()), StateChange::NoChange),
+                       Deferred(DrawArrays(NullDevice(DrawCallVulkan()), StateChange::NoChange)),
                        DrawArrays(DrawCallVulkan(), StateChange::VertexAttrib),
                        DrawArrays(Offscreen(DrawCallVulkan()), StateChange::VertexAttrib),
                        DrawArrays(NullDevice(DrawCallVulkan()), StateChange::VertexAttrib),
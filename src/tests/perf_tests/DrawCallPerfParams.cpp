@@ -68,6 +68,13 @@ DrawCallPerfParams DrawCallD3D9()
     return params;
 }
 
+DrawCallPerfParams DrawCallNull()
+{
+    DrawCallPerfParams params;
+    params.eglParameters = EGLPlatformParameters(EGL_PLATFORM_ANGLE_TYPE_NULL_ANGLE);
+    return params;
+}
+
 DrawCallPerfParams DrawCallOpenGL()
 {
     DrawCallPerfParams params;
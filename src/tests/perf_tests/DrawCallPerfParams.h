@@ -31,10 +31,20 @@ namespace params
 {
 DrawCallPerfParams DrawCallD3D11();
 DrawCallPerfParams DrawCallD3D9();
+DrawCallPerfParams DrawCallNull();
 DrawCallPerfParams DrawCallOpenGL();
 DrawCallPerfParams DrawCallValidation();
 DrawCallPerfParams DrawCallVulkan();
 DrawCallPerfParams DrawCallWGL();
+
+// Draws no triangles, so that the draw calls measure the validation and front-end overhead.
+template <typename ParamsT>
+ParamsT ValidationOnly(const ParamsT &input)
+{
+    ParamsT output = input;
+    output.numTris = 0;
+    return output;
+}
 }  // namespace params
 
 #endif  // TESTS_PERF_TESTS_DRAW_CALL_PERF_PARAMS_H_
@@ -266,6 +266,14 @@ DrawElementsPerfParams DrawElementsPerfVulkanParams(bool indexBufferChanged,
     return params;
 }
 
+DrawElementsPerfParams DrawElementsPerfNullParams(GLenum indexType)
+{
+    DrawElementsPerfParams params;
+    params.eglParameters = EGLPlatformParameters(EGL_PLATFORM_ANGLE_TYPE_NULL_ANGLE);
+    params.type          = indexType;
+    return params;
+}
+
 DrawElementsPerfParams DrawElementsPerfWGLParams(bool indexBufferChanged, GLenum indexType)
 {
     DrawElementsPerfParams params;
@@ -304,6 +312,8 @@ ANGLE_INSTANTIATE_TEST(DrawElementsPerfBenchmark,
                        DrawElementsPerfVulkanParams(false, true, GL_UNSIGNED_SHORT),
                        DrawElementsPerfVulkanParams(false, false, GL_UNSIGNED_INT),
                        DrawElementsPerfVulkanParams(false, true, GL_UNSIGNED_INT),
+                       DrawElementsPerfNullParams(GL_UNSIGNED_SHORT),
+                       DrawElementsPerfNullParams(GL_UNSIGNED_INT),
                        DrawElementsPerfWGLParams(false, GL_UNSIGNED_SHORT));
 
 }  // anonymous namespace
@@ -0,0 +1,196 @@
+//
+// Copyright 2019 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// IndexRangePerf:
+//   Performance test for computing and caching the range of indices used by a draw.  See
+//   DrawElementsPerf for the cost of the same work as seen through the GL API.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <random>
+
+#include "common/utilities.h"
+#include "libANGLE/IndexRangeCache.h"
+#include "libANGLE/formatutils.h"
+
+namespace
+{
+constexpr unsigned int kIterationsPerStep = 16;
+constexpr size_t kIndexCount              = 64 * 1024;
+constexpr size_t kDrawCount               = 32;
+constexpr size_t kIndicesPerDraw          = kIndexCount / kDrawCount;
+
+enum class Scenario
+{
+    // Scans all the indices with ComputeIndexRange.
+    Scan,
+    // Looks up the ranges of a set of draws that are all cached.
+    CacheHit,
+    // Before looking up the draws, overwrites the indices of one of them, like an application
+    // streaming into a dynamic index buffer would.
+    DynamicUpdate,
+};
+
+struct IndexRangeParams
+{
+    Scenario scenario;
+    gl::DrawElementsType type;
+    bool primitiveRestart;
+};
+
+std::string GetStory(const IndexRangeParams &params)
+{
+    std::stringstream strstr;
+    switch (params.scenario)
+    {
+        case Scenario::Scan:
+            strstr << "scan";
+            break;
+        case Scenario::CacheHit:
+            strstr << "cache_hit";
+            break;
+        case Scenario::DynamicUpdate:
+            strstr << "dynamic_update";
+            break;
+    }
+
+    switch (params.type)
+    {
+        case gl::DrawElementsType::UnsignedByte:
+            strstr << "_ubyte";
+            break;
+        case gl::DrawElementsType::UnsignedShort:
+            strstr << "_ushort";
+            break;
+        default:
+            strstr << "_uint";
+            break;
+    }
+
+    if (params.primitiveRestart)
+    {
+        strstr << "_restart";
+    }
+    return strstr.str();
+}
+
+std::ostream &operator<<(std::ostream &os, const IndexRangeParams &params)
+{
+    os << GetStory(params);
+    return os;
+}
+
+class IndexRangePerfTest : public ANGLEPerfTest,
+                           public ::testing::WithParamInterface<IndexRangeParams>
+{
+  public:
+    IndexRangePerfTest();
+
+    void SetUp() override;
+    void step() override;
+
+  private:
+    gl::IndexRange getDrawRange(size_t draw);
+
+    size_t mIndexSize;
+    std::vector<uint8_t> mIndices;
+    gl::IndexRangeCache mCache;
+    size_t mUpdatedDraw;
+    size_t mChecksum;
+};
+
+IndexRangePerfTest::IndexRangePerfTest()
+    : ANGLEPerfTest("IndexRangePerf", "", GetStory(GetParam()), kIterationsPerStep),
+      mIndexSize(gl::GetDrawElementsTypeSize(GetParam().type)),
+      mUpdatedDraw(0),
+      mChecksum(0)
+{}
+
+void IndexRangePerfTest::SetUp()
+{
+    ANGLEPerfTest::SetUp();
+
+    // Random indices, with roughly one primitive restart index in every hundred.
+    std::mt19937 generator(0x5EED);
+    std::uniform_int_distribution<uint32_t> value(0, 0xFFFFFFFE);
+    mIndices.resize(kIndexCount * mIndexSize);
+    for (size_t index = 0; index < kIndexCount; ++index)
+    {
+        uint32_t indexValue = (index % 100 == 99) ? 0xFFFFFFFF : value(generator);
+        memcpy(&mIndices[index * mIndexSize], &indexValue, mIndexSize);
+    }
+
+    for (size_t draw = 0; draw < kDrawCount; ++draw)
+    {
+        getDrawRange(draw);
+    }
+}
+
+gl::IndexRange IndexRangePerfTest::getDrawRange(size_t draw)
+{
+    const IndexRangeParams &params = GetParam();
+    size_t offset                  = draw * kIndicesPerDraw * mIndexSize;
+
+    gl::IndexRange range;
+    if (!mCache.findRange(params.type, offset, kIndicesPerDraw, params.primitiveRestart, &range))
+    {
+        range = gl::ComputeIndexRange(params.type, &mIndices[offset], kIndicesPerDraw,
+                                      params.primitiveRestart);
+        mCache.addRange(params.type, offset, kIndicesPerDraw, params.primitiveRestart, range);
+    }
+    return range;
+}
+
+void IndexRangePerfTest::step()
+{
+    const IndexRangeParams &params = GetParam();
+
+    for (unsigned int iteration = 0; iteration < kIterationsPerStep; ++iteration)
+    {
+        if (params.scenario == Scenario::Scan)
+        {
+            gl::IndexRange range = gl::ComputeIndexRange(params.type, mIndices.data(),
+                                                         kIndexCount, params.primitiveRestart);
+            mChecksum += range.end;
+            continue;
+        }
+
+        if (params.scenario == Scenario::DynamicUpdate)
+        {
+            mUpdatedDraw = (mUpdatedDraw + 1) % kDrawCount;
+            mCache.invalidateRange(mUpdatedDraw * kIndicesPerDraw * mIndexSize,
+                                   kIndicesPerDraw * mIndexSize);
+        }
+
+        for (size_t draw = 0; draw < kDrawCount; ++draw)
+        {
+            mChecksum += getDrawRange(draw).end;
+        }
+    }
+}
+
+TEST_P(IndexRangePerfTest, Run)
+{
+    run();
+}
+
+using gl::DrawElementsType;
+
+INSTANTIATE_TEST_SUITE_P(
+    ,
+    IndexRangePerfTest,
+    ::testing::Values(
+        IndexRangeParams{Scenario::Scan, DrawElementsType::UnsignedByte, false},
+        IndexRangeParams{Scenario::Scan, DrawElementsType::UnsignedShort, false},
+        IndexRangeParams{Scenario::Scan, DrawElementsType::UnsignedInt, false},
+        IndexRangeParams{Scenario::Scan, DrawElementsType::UnsignedByte, true},
+        IndexRangeParams{Scenario::Scan, DrawElementsType::UnsignedShort, true},
+        IndexRangeParams{Scenario::Scan, DrawElementsType::UnsignedInt, true},
+        IndexRangeParams{Scenario::CacheHit, DrawElementsType::UnsignedShort, false},
+        IndexRangeParams{Scenario::DynamicUpdate, DrawElementsType::UnsignedShort, false},
+        IndexRangeParams{Scenario::DynamicUpdate, DrawElementsType::UnsignedShort, true}));
+
+}  // anonymous namespace
@@ -23,6 +23,9 @@ enum class TaskOption
 {
     CompileOnly,
     CompileAndLink,
+    // Same as CompileAndLink, but with the program cache enabled, so that every link after the
+    // first is satisfied from the cache.  Set ANGLE_BLOB_CACHE_DIR to measure the disk store.
+    CompileAndLinkWithWarmCache,
 
     Unspecified
 };
@@ -62,6 +65,10 @@ struct LinkProgramParams final : public RenderTestParams
         {
             strstr << "_compile_and_link";
         }
+        else if (taskOption == TaskOption::CompileAndLinkWithWarmCache)
+        {
+            strstr << "_compile_and_link_warm_cache";
+        }
 
         if (threadOption == ThreadOption::SingleThread)
         {
@@ -113,6 +120,20 @@ void LinkProgramBenchmark::initializeBenchmark()
         glMaxShaderCompilerThreadsKHR(0);
     }
 
+    if (GetParam().taskOption == TaskOption::CompileAndLinkWithWarmCache)
+    {
+        constexpr EGLint kProgramCacheSize = 1024 * 1024;
+
+        EGLDisplay display = eglGetCurrentDisplay();
+        if (!CheckExtensionExists(eglQueryString(display, EGL_EXTENSIONS),
+                                  "EGL_ANGLE_program_cache_control"))
+        {
+            mSkipTest = true;
+            return;
+        }
+        eglProgramCacheResizeANGLE(display, kProgramCacheSize, EGL_PROGRAM_CACHE_RESIZE_ANGLE);
+    }
+
     std::array<Vector3, 6> vertices = {{Vector3(-1.0f, 1.0f, 0.5f), Vector3(-1.0f, -1.0f, 0.5f),
                                         Vector3(1.0f, -1.0f, 0.5f), Vector3(-1.0f, 1.0f, 0.5f),
                                         Vector3(1.0f, -1.0f, 0.5f), Vector3(1.0f, 1.0f, 0.5f)}};
@@ -224,6 +245,10 @@ ANGLE_INSTANTIATE_TEST(
     LinkProgramD3D11Params(TaskOption::CompileAndLink, ThreadOption::SingleThread),
     LinkProgramD3D9Params(TaskOption::CompileAndLink, ThreadOption::SingleThread),
     LinkProgramOpenGLOrGLESParams(TaskOption::CompileAndLink, ThreadOption::SingleThread),
-    LinkProgramVulkanParams(TaskOption::CompileAndLink, ThreadOption::SingleThread));
+    LinkProgramVulkanParams(TaskOption::CompileAndLink, ThreadOption::SingleThread),
+    LinkProgramD3D11Params(TaskOption::CompileAndLinkWithWarmCache, ThreadOption::MultiThread),
+    LinkProgramOpenGLOrGLESParams(TaskOption::CompileAndLinkWithWarmCache,
+                                  ThreadOption::MultiThread),
+    LinkProgramVulkanParams(TaskOption::CompileAndLinkWithWarmCache, ThreadOption::MultiThread));
 
 }  // anonymous namespace
@@ -0,0 +1,222 @@
+//
+// Copyright 2019 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// LoadImagePerf:
+//   Performance test for converting texture uploads on the calling thread and the worker threads.
+//   Compare the results across thread counts to see how the striped loads scale.  The ETC tests
+//   measure the throughput of the software ETC2 decoder, used when the device can't sample ETC
+//   textures.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <random>
+#include <vector>
+
+#include "image_util/loadimage.h"
+#include "libANGLE/WorkerThread.h"
+#include "libANGLE/renderer/renderer_utils.h"
+
+namespace
+{
+constexpr unsigned int kIterationsPerStep = 1;
+
+enum class LoadFormat
+{
+    // RGB8 client data expanded to RGBA8, as on most Vulkan implementations.
+    RGB8ToRGBA8,
+    // RGBA32F client data converted to a half float texture.
+    RGBA32FToRGBA16F,
+    // ETC2 RGB8 blocks decoded to RGBA8.
+    ETC2RGB8ToRGBA8,
+    // ETC2 RGBA8 blocks, with an EAC alpha block each, decoded to RGBA8.
+    ETC2RGBA8ToRGBA8,
+};
+
+const char *GetFormatName(LoadFormat format)
+{
+    switch (format)
+    {
+        case LoadFormat::RGB8ToRGBA8:
+            return "rgb8_to_rgba8";
+        case LoadFormat::RGBA32FToRGBA16F:
+            return "rgba32f_to_rgba16f";
+        case LoadFormat::ETC2RGB8ToRGBA8:
+            return "etc2_rgb8_to_rgba8";
+        case LoadFormat::ETC2RGBA8ToRGBA8:
+            return "etc2_rgba8_to_rgba8";
+    }
+    return "";
+}
+
+struct LoadImageParams
+{
+    LoadFormat format;
+    size_t width;
+    size_t height;
+    size_t depth;
+    // The calling thread plus the worker threads.
+    size_t threads;
+};
+
+std::string GetStory(const LoadImageParams &params)
+{
+    std::stringstream strstr;
+    strstr << GetFormatName(params.format) << "_" << params.width << "x" << params.height;
+    if (params.depth > 1)
+    {
+        strstr << "x" << params.depth;
+    }
+    strstr << "_" << params.threads << "_threads";
+    return strstr.str();
+}
+
+std::ostream &operator<<(std::ostream &os, const LoadImageParams &params)
+{
+    os << GetStory(params);
+    return os;
+}
+
+class LoadImagePerfTest : public ANGLEPerfTest,
+                          public ::testing::WithParamInterface<LoadImageParams>
+{
+  public:
+    LoadImagePerfTest();
+
+    void SetUp() override;
+    void TearDown() override;
+    void step() override;
+
+  private:
+    std::shared_ptr<angle::WorkerThreadPool> mPool;
+    rx::LoadImageFunction mLoadFunction;
+    // Compressed input has a row of blocks for each |mInputBlockHeight| rows of pixels.
+    size_t mInputBlockHeight;
+    size_t mInputRowPitch;
+    size_t mOutputRowPitch;
+    std::vector<uint8_t> mInput;
+    std::vector<uint8_t> mOutput;
+};
+
+LoadImagePerfTest::LoadImagePerfTest()
+    : ANGLEPerfTest("LoadImagePerf", "", GetStory(GetParam()), kIterationsPerStep),
+      mLoadFunction(nullptr),
+      mInputBlockHeight(1),
+      mInputRowPitch(0),
+      mOutputRowPitch(0)
+{}
+
+void LoadImagePerfTest::SetUp()
+{
+    ANGLEPerfTest::SetUp();
+
+    const LoadImageParams &params = GetParam();
+    switch (params.format)
+    {
+        case LoadFormat::RGB8ToRGBA8:
+            mLoadFunction   = angle::LoadToNative3To4<uint8_t, 0xFF>;
+            mInputRowPitch  = params.width * 3;
+            mOutputRowPitch = params.width * 4;
+            break;
+        case LoadFormat::RGBA32FToRGBA16F:
+            mLoadFunction   = angle::Load32FTo16F<4>;
+            mInputRowPitch  = params.width * 16;
+            mOutputRowPitch = params.width * 8;
+            break;
+        case LoadFormat::ETC2RGB8ToRGBA8:
+            mLoadFunction     = angle::LoadETC2RGB8ToRGBA8;
+            mInputBlockHeight = 4;
+            mInputRowPitch    = (params.width / 4) * 8;
+            mOutputRowPitch   = params.width * 4;
+            break;
+        case LoadFormat::ETC2RGBA8ToRGBA8:
+            mLoadFunction     = angle::LoadETC2RGBA8ToRGBA8;
+            mInputBlockHeight = 4;
+            mInputRowPitch    = (params.width / 4) * 16;
+            mOutputRowPitch   = params.width * 4;
+            break;
+    }
+
+    // Random blocks use all the ETC2 block modes, in similar proportions.  This makes the decode
+    // rates comparable between runs rather than representative of any particular texture.
+    std::mt19937 generator(0x10AD);
+    std::uniform_int_distribution<int> byteValue(0, 255);
+    mInput.resize(mInputRowPitch * (params.height / mInputBlockHeight) * params.depth);
+    for (uint8_t &value : mInput)
+    {
+        value = static_cast<uint8_t>(byteValue(generator));
+    }
+    mOutput.resize(mOutputRowPitch * params.height * params.depth);
+
+    mPool = angle::WorkerThreadPool::Create(params.threads > 1);
+    mPool->setMaxThreads(params.threads - 1);
+
+    mReporter->RegisterImportantMetric(".load_rate", "MB/s");
+    mReporter->RegisterImportantMetric(".texel_rate", "Mtexels/s");
+}
+
+void LoadImagePerfTest::TearDown()
+{
+    ANGLEPerfTest::TearDown();
+
+    double elapsedTime = mTimer.getElapsedTime();
+    if (elapsedTime > 0.0)
+    {
+        const LoadImageParams &params = GetParam();
+        double steps                  = static_cast<double>(getNumStepsPerformed());
+        double loadedBytes            = static_cast<double>(mInput.size()) * steps;
+        double loadedTexels =
+            static_cast<double>(params.width * params.height * params.depth) * steps;
+        mReporter->AddResult(".load_rate", loadedBytes / elapsedTime / (1024.0 * 1024.0));
+        mReporter->AddResult(".texel_rate", loadedTexels / elapsedTime / 1000000.0);
+    }
+}
+
+void LoadImagePerfTest::step()
+{
+    const LoadImageParams &params = GetParam();
+
+    size_t inputDepthPitch  = mInputRowPitch * (params.height / mInputBlockHeight);
+    size_t outputDepthPitch = mOutputRowPitch * params.height;
+    rx::LoadImageInStripes(mPool, mLoadFunction, params.width, params.height, params.depth,
+                           mInputBlockHeight, 1, mInput.data(), mInputRowPitch, inputDepthPitch,
+                           mOutput.data(), mOutputRowPitch, outputDepthPitch);
+}
+
+TEST_P(LoadImagePerfTest, Run)
+{
+    run();
+}
+
+LoadImageParams Load2D(LoadFormat format, size_t threads)
+{
+    return LoadImageParams{format, 4096, 4096, 1, threads};
+}
+
+LoadImageParams LoadArray(LoadFormat format, size_t threads)
+{
+    return LoadImageParams{format, 1024, 1024, 16, threads};
+}
+
+INSTANTIATE_TEST_SUITE_P(,
+                         LoadImagePerfTest,
+                         ::testing::Values(Load2D(LoadFormat::RGB8ToRGBA8, 1),
+                                           Load2D(LoadFormat::RGB8ToRGBA8, 2),
+                                           Load2D(LoadFormat::RGB8ToRGBA8, 4),
+                                           Load2D(LoadFormat::RGB8ToRGBA8, 8),
+                                           Load2D(LoadFormat::RGBA32FToRGBA16F, 1),
+                                           Load2D(LoadFormat::RGBA32FToRGBA16F, 2),
+                                           Load2D(LoadFormat::RGBA32FToRGBA16F, 4),
+                                           Load2D(LoadFormat::RGBA32FToRGBA16F, 8),
+                                           Load2D(LoadFormat::ETC2RGB8ToRGBA8, 1),
+                                           Load2D(LoadFormat::ETC2RGB8ToRGBA8, 2),
+                                           Load2D(LoadFormat::ETC2RGB8ToRGBA8, 4),
+                                           Load2D(LoadFormat::ETC2RGB8ToRGBA8, 8),
+                                           Load2D(LoadFormat::ETC2RGBA8ToRGBA8, 1),
+                                           Load2D(LoadFormat::ETC2RGBA8ToRGBA8, 4),
+                                           LoadArray(LoadFormat::RGB8ToRGBA8, 1),
+                                           LoadArray(LoadFormat::RGB8ToRGBA8, 4)));
+
+}  // anonymous namespace
@@ -0,0 +1,201 @@
+//
+// Copyright 2019 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// MaterialsPerf:
+//   Performance test for draws that cycle through a small set of materials, each made of a uniform
+//   buffer and a texture.  Every draw switches material, so the descriptors of the bound resources
+//   change on every draw while taking only a handful of distinct values.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <array>
+#include <sstream>
+#include <vector>
+
+#include "util/shader_utils.h"
+
+namespace angle
+{
+namespace
+{
+constexpr unsigned int kIterationsPerStep = 256;
+
+struct MaterialsParams final : public RenderTestParams
+{
+    MaterialsParams()
+    {
+        iterationsPerStep = kIterationsPerStep;
+
+        // Common default params
+        majorVersion = 3;
+        minorVersion = 0;
+        windowWidth  = 256;
+        windowHeight = 256;
+
+        numMaterials = 4;
+    }
+
+    std::string story() const override;
+
+    size_t numMaterials;
+};
+
+std::ostream &operator<<(std::ostream &os, const MaterialsParams &params)
+{
+    os << params.backendAndStory().substr(1);
+    return os;
+}
+
+std::string MaterialsParams::story() const
+{
+    std::stringstream strstr;
+
+    strstr << RenderTestParams::story();
+
+    if (eglParameters.deviceType == EGL_PLATFORM_ANGLE_DEVICE_TYPE_NULL_ANGLE)
+    {
+        strstr << "_null";
+    }
+
+    strstr << "_" << numMaterials << "_materials";
+
+    return strstr.str();
+}
+
+class MaterialsBenchmark : public ANGLERenderTest,
+                           public ::testing::WithParamInterface<MaterialsParams>
+{
+  public:
+    MaterialsBenchmark();
+
+    void initializeBenchmark() override;
+    void destroyBenchmark() override;
+    void drawBenchmark() override;
+
+  private:
+    GLuint mProgram      = 0;
+    GLuint mVertexBuffer = 0;
+
+    std::vector<GLuint> mUniformBuffers;
+    std::vector<GLuint> mTextures;
+};
+
+MaterialsBenchmark::MaterialsBenchmark() : ANGLERenderTest("Materials", GetParam()) {}
+
+void MaterialsBenchmark::initializeBenchmark()
+{
+    const MaterialsParams &params = GetParam();
+
+    constexpr char kVS[] = R"(#version 300 es
+in vec2 position;
+out vec2 texCoord;
+void main()
+{
+    texCoord = position * 0.5 + 0.5;
+    gl_Position = vec4(position, 0, 1);
+})";
+
+    constexpr char kFS[] = R"(#version 300 es
+precision mediump float;
+uniform Material
+{
+    vec4 tint;
+};
+uniform sampler2D albedo;
+in vec2 texCoord;
+out vec4 color;
+void main()
+{
+    color = texture(albedo, texCoord) * tint;
+})";
+
+    mProgram = CompileProgram(kVS, kFS);
+    ASSERT_NE(0u, mProgram);
+    glUseProgram(mProgram);
+    glUniformBlockBinding(mProgram, glGetUniformBlockIndex(mProgram, "Material"), 0);
+    glUniform1i(glGetUniformLocation(mProgram, "albedo"), 0);
+
+    constexpr GLfloat kTriangle[] = {-1.0f, -1.0f, 1.0f, -1.0f, 0.0f, 1.0f};
+    glGenBuffers(1, &mVertexBuffer);
+    glBindBuffer(GL_ARRAY_BUFFER, mVertexBuffer);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(kTriangle), kTriangle, GL_STATIC_DRAW);
+    GLint positionLocation = glGetAttribLocation(mProgram, "position");
+    glVertexAttribPointer(positionLocation, 2, GL_FLOAT, GL_FALSE, 0, nullptr);
+    glEnableVertexAttribArray(positionLocation);
+
+    mUniformBuffers.resize(params.numMaterials);
+    mTextures.resize(params.numMaterials);
+    glGenBuffers(static_cast<GLsizei>(mUniformBuffers.size()), mUniformBuffers.data());
+    glGenTextures(static_cast<GLsizei>(mTextures.size()), mTextures.data());
+
+    for (size_t material = 0; material < params.numMaterials; ++material)
+    {
+        GLfloat shade                 = static_cast<GLfloat>(material + 1) / params.numMaterials;
+        std::array<GLfloat, 4> tint   = {{shade, 1.0f - shade, 0.5f, 1.0f}};
+        std::array<GLubyte, 4> albedo = {{255, 255, static_cast<GLubyte>(shade * 255), 255}};
+
+        glBindBuffer(GL_UNIFORM_BUFFER, mUniformBuffers[material]);
+        glBufferData(GL_UNIFORM_BUFFER, sizeof(tint), tint.data(), GL_STATIC_DRAW);
+
+        glBindTexture(GL_TEXTURE_2D, mTextures[material]);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, albedo.data());
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    }
+
+    glViewport(0, 0, getWindow()->getWidth(), getWindow()->getHeight());
+
+    ASSERT_GL_NO_ERROR();
+}
+
+void MaterialsBenchmark::destroyBenchmark()
+{
+    glDeleteProgram(mProgram);
+    glDeleteBuffers(1, &mVertexBuffer);
+    glDeleteBuffers(static_cast<GLsizei>(mUniformBuffers.size()), mUniformBuffers.data());
+    glDeleteTextures(static_cast<GLsizei>(mTextures.size()), mTextures.data());
+}
+
+void MaterialsBenchmark::drawBenchmark()
+{
+    const MaterialsParams &params = GetParam();
+
+    for (unsigned int iteration = 0; iteration < params.iterationsPerStep; ++iteration)
+    {
+        size_t material = iteration % params.numMaterials;
+        glBindBufferBase(GL_UNIFORM_BUFFER, 0, mUniformBuffers[material]);
+        glBindTexture(GL_TEXTURE_2D, mTextures[material]);
+        glDrawArrays(GL_TRIANGLES, 0, 3);
+    }
+
+    ASSERT_GL_NO_ERROR();
+}
+
+using namespace egl_platform;
+
+MaterialsParams Materials(const EGLPlatformParameters &egl, size_t numMaterials)
+{
+    MaterialsParams params;
+    params.eglParameters = egl;
+    params.numMaterials  = numMaterials;
+    return params;
+}
+
+}  // anonymous namespace
+
+TEST_P(MaterialsBenchmark, Run)
+{
+    run();
+}
+
+ANGLE_INSTANTIATE_TEST(MaterialsBenchmark,
+                       Materials(D3D11(), 4),
+                       Materials(OPENGL_OR_GLES(), 4),
+                       Materials(VULKAN(), 4),
+                       Materials(VULKAN(), 16),
+                       Materials(VULKAN_NULL(), 4),
+                       Materials(VULKAN_NULL(), 16));
+}  // namespace angle
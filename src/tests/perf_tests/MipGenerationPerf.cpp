@@ -0,0 +1,298 @@
+//
+// Copyright 2019 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// MipGenerationPerf:
+//   Performance test for generating mip chains on the CPU, as the Vulkan and D3D11 backends do for
+//   formats they can't filter with the GPU.  Compares the generic per-pixel box filter with the
+//   vectorized one, for 2D, cube map and array textures, on the calling thread and on the worker
+//   threads.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <random>
+#include <vector>
+
+#include "image_util/generatemip.h"
+#include "libANGLE/WorkerThread.h"
+#include "libANGLE/renderer/renderer_utils.h"
+
+namespace
+{
+constexpr unsigned int kIterationsPerStep = 1;
+
+enum class MipFormat
+{
+    R8,
+    RG8,
+    RGBA8,
+    RGBA16F,
+    RGBA32F,
+};
+
+enum class MipTextureType
+{
+    // One 2048x2048 layer.
+    _2D,
+    // Six 1024x1024 faces.
+    Cube,
+    // Sixteen 512x512 layers.
+    Array,
+};
+
+enum class MipFilter
+{
+    // The per-pixel functions that all formats have.
+    Generic,
+    // GenerateMip, which uses the vectorized functions where there are some.
+    Vectorized,
+};
+
+// The per-pixel path, as GenerateMip was before the vectorized functions.
+template <typename T>
+void GenerateMipGeneric(size_t sourceWidth,
+                        size_t sourceHeight,
+                        size_t sourceDepth,
+                        const uint8_t *sourceData,
+                        size_t sourceRowPitch,
+                        size_t sourceDepthPitch,
+                        uint8_t *destData,
+                        size_t destRowPitch,
+                        size_t destDepthPitch)
+{
+    angle::priv::MipGenerationFunction generationFunction =
+        angle::priv::GetMipGenerationFunction<T>(sourceWidth, sourceHeight, sourceDepth);
+    generationFunction(sourceWidth, sourceHeight, sourceDepth, sourceData, sourceRowPitch,
+                       sourceDepthPitch, std::max<size_t>(1, sourceWidth >> 1),
+                       std::max<size_t>(1, sourceHeight >> 1),
+                       std::max<size_t>(1, sourceDepth >> 1), destData, destRowPitch,
+                       destDepthPitch);
+}
+
+struct MipFormatInfo
+{
+    const char *name;
+    size_t pixelBytes;
+    rx::MipGenerationFunction generic;
+    rx::MipGenerationFunction vectorized;
+};
+
+MipFormatInfo GetMipFormatInfo(MipFormat format)
+{
+    switch (format)
+    {
+        case MipFormat::R8:
+            return {"r8", 1, GenerateMipGeneric<angle::R8>, angle::GenerateMip<angle::R8>};
+        case MipFormat::RG8:
+            return {"rg8", 2, GenerateMipGeneric<angle::R8G8>, angle::GenerateMip<angle::R8G8>};
+        case MipFormat::RGBA8:
+            return {"rgba8", 4, GenerateMipGeneric<angle::R8G8B8A8>,
+                    angle::GenerateMip<angle::R8G8B8A8>};
+        case MipFormat::RGBA16F:
+            return {"rgba16f", 8, GenerateMipGeneric<angle::R16G16B16A16F>,
+                    angle::GenerateMip<angle::R16G16B16A16F>};
+        case MipFormat::RGBA32F:
+            return {"rgba32f", 16, GenerateMipGeneric<angle::R32G32B32A32F>,
+                    angle::GenerateMip<angle::R32G32B32A32F>};
+    }
+    return {"", 0, nullptr, nullptr};
+}
+
+const char *GetTextureTypeName(MipTextureType type)
+{
+    switch (type)
+    {
+        case MipTextureType::_2D:
+            return "2d";
+        case MipTextureType::Cube:
+            return "cube";
+        case MipTextureType::Array:
+            return "array";
+    }
+    return "";
+}
+
+struct MipGenerationParams
+{
+    MipFormat format;
+    MipTextureType type;
+    MipFilter filter;
+    // The calling thread plus the worker threads.
+    size_t threads;
+};
+
+std::string GetStory(const MipGenerationParams &params)
+{
+    std::stringstream strstr;
+    strstr << GetMipFormatInfo(params.format).name << "_" << GetTextureTypeName(params.type)
+           << (params.filter == MipFilter::Generic ? "_generic" : "_vectorized") << "_"
+           << params.threads << "_threads";
+    return strstr.str();
+}
+
+std::ostream &operator<<(std::ostream &os, const MipGenerationParams &params)
+{
+    os << GetStory(params);
+    return os;
+}
+
+class MipGenerationPerfTest : public ANGLEPerfTest,
+                              public ::testing::WithParamInterface<MipGenerationParams>
+{
+  public:
+    MipGenerationPerfTest();
+
+    void SetUp() override;
+    void TearDown() override;
+    void step() override;
+
+  private:
+    struct Level
+    {
+        size_t size;
+        size_t rowPitch;
+        size_t layerPitch;
+        std::vector<uint8_t> data;
+    };
+
+    std::shared_ptr<angle::WorkerThreadPool> mPool;
+    rx::MipGenerationFunction mMipFunction;
+    size_t mLayerCount;
+    std::vector<Level> mLevels;
+};
+
+MipGenerationPerfTest::MipGenerationPerfTest()
+    : ANGLEPerfTest("MipGenerationPerf", "", GetStory(GetParam()), kIterationsPerStep),
+      mMipFunction(nullptr),
+      mLayerCount(1)
+{}
+
+void MipGenerationPerfTest::SetUp()
+{
+    ANGLEPerfTest::SetUp();
+
+    const MipGenerationParams &params = GetParam();
+    const MipFormatInfo formatInfo    = GetMipFormatInfo(params.format);
+    mMipFunction = params.filter == MipFilter::Generic ? formatInfo.generic : formatInfo.vectorized;
+
+    size_t baseSize = 0;
+    switch (params.type)
+    {
+        case MipTextureType::_2D:
+            baseSize    = 2048;
+            mLayerCount = 1;
+            break;
+        case MipTextureType::Cube:
+            baseSize    = 1024;
+            mLayerCount = 6;
+            break;
+        case MipTextureType::Array:
+            baseSize    = 512;
+            mLayerCount = 16;
+            break;
+    }
+
+    for (size_t size = baseSize; size > 0; size >>= 1)
+    {
+        Level level;
+        level.size       = size;
+        level.rowPitch   = size * formatInfo.pixelBytes;
+        level.layerPitch = level.rowPitch * size;
+        level.data.resize(level.layerPitch * mLayerCount);
+        mLevels.push_back(std::move(level));
+    }
+
+    // Random bytes also give the half float format some denormals, infinities and NaNs.
+    std::mt19937 generator(0x3119);
+    std::uniform_int_distribution<int> byteValue(0, 255);
+    if (params.format == MipFormat::RGBA32F)
+    {
+        std::uniform_real_distribution<float> floatValue(0.0f, 1.0f);
+        float *base = reinterpret_cast<float *>(mLevels[0].data.data());
+        for (size_t component = 0; component < mLevels[0].data.size() / sizeof(float); ++component)
+        {
+            base[component] = floatValue(generator);
+        }
+    }
+    else
+    {
+        for (uint8_t &value : mLevels[0].data)
+        {
+            value = static_cast<uint8_t>(byteValue(generator));
+        }
+    }
+
+    mPool = angle::WorkerThreadPool::Create(params.threads > 1);
+    mPool->setMaxThreads(params.threads - 1);
+
+    mReporter->RegisterImportantMetric(".texel_rate", "Mtexels/s");
+}
+
+void MipGenerationPerfTest::TearDown()
+{
+    ANGLEPerfTest::TearDown();
+
+    double elapsedTime = mTimer.getElapsedTime();
+    if (elapsedTime > 0.0)
+    {
+        // Count the texels read from the base level, which dominate the work.
+        double steps        = static_cast<double>(getNumStepsPerformed());
+        double sourceTexels = static_cast<double>(mLevels[0].size * mLevels[0].size * mLayerCount);
+        mReporter->AddResult(".texel_rate", sourceTexels * steps / elapsedTime / 1000000.0);
+    }
+}
+
+void MipGenerationPerfTest::step()
+{
+    for (size_t level = 1; level < mLevels.size(); ++level)
+    {
+        const Level &source = mLevels[level - 1];
+        Level &dest         = mLevels[level];
+        rx::GenerateMipLayers(mPool, mMipFunction, source.size, source.size, mLayerCount,
+                              source.data.data(), source.rowPitch, source.layerPitch,
+                              dest.data.data(), dest.rowPitch, dest.layerPitch);
+    }
+}
+
+TEST_P(MipGenerationPerfTest, Run)
+{
+    run();
+}
+
+MipGenerationParams Generic(MipFormat format, MipTextureType type)
+{
+    return MipGenerationParams{format, type, MipFilter::Generic, 1};
+}
+
+MipGenerationParams Vectorized(MipFormat format, MipTextureType type, size_t threads)
+{
+    return MipGenerationParams{format, type, MipFilter::Vectorized, threads};
+}
+
+INSTANTIATE_TEST_SUITE_P(,
+                         MipGenerationPerfTest,
+                         ::testing::Values(Generic(MipFormat::RGBA8, MipTextureType::_2D),
+                                           Vectorized(MipFormat::RGBA8, MipTextureType::_2D, 1),
+                                           Vectorized(MipFormat::RGBA8, MipTextureType::_2D, 4),
+                                           Generic(MipFormat::RGBA8, MipTextureType::Cube),
+                                           Vectorized(MipFormat::RGBA8, MipTextureType::Cube, 1),
+                                           Vectorized(MipFormat::RGBA8, MipTextureType::Cube, 4),
+                                           Generic(MipFormat::RGBA8, MipTextureType::Array),
+                                           Vectorized(MipFormat::RGBA8, MipTextureType::Array, 1),
+                                           Vectorized(MipFormat::RGBA8, MipTextureType::Array, 4),
+                                           Generic(MipFormat::R8, MipTextureType::_2D),
+                                           Vectorized(MipFormat::R8, MipTextureType::_2D, 1),
+                                           Generic(MipFormat::RG8, MipTextureType::_2D),
+                                           Vectorized(MipFormat::RG8, MipTextureType::_2D, 1),
+                                           Generic(MipFormat::RGBA16F, MipTextureType::_2D),
+                                           Vectorized(MipFormat::RGBA16F, MipTextureType::_2D, 1),
+                                           Vectorized(MipFormat::RGBA16F, MipTextureType::Cube, 4),
+                                           Generic(MipFormat::RGBA32F, MipTextureType::_2D),
+                                           Vectorized(MipFormat::RGBA32F, MipTextureType::_2D, 1),
+                                           Vectorized(MipFormat::RGBA32F,
+                                                      MipTextureType::Cube,
+                                                      4)));
+
+}  // anonymous namespace
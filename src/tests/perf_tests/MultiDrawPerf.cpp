@@ -0,0 +1,229 @@
+//
+// Copyright 2019 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// MultiDrawPerf:
+//   Performance test for the ANGLE_multi_draw entry points.  Each multi-draw is made of many small
+//   sub-draws, and the time spent in the calls is reported per sub-draw.
+//
+
+#include "ANGLEPerfTest.h"
+#include "DrawCallPerfParams.h"
+#include "common/system_utils.h"
+#include "test_utils/draw_call_perf_utils.h"
+#include "util/shader_utils.h"
+
+#include <sstream>
+
+namespace
+{
+struct MultiDrawPerfParams final : public DrawCallPerfParams
+{
+    MultiDrawPerfParams(const DrawCallPerfParams &base) : DrawCallPerfParams(base)
+    {
+        // Each iteration makes subDrawCount draws.
+        iterationsPerStep /= 100;
+    }
+
+    std::string story() const override;
+
+    GLsizei subDrawCount = 64;
+    bool indexed         = false;
+    bool useDrawID       = false;
+};
+
+std::string MultiDrawPerfParams::story() const
+{
+    std::stringstream strstr;
+
+    strstr << DrawCallPerfParams::story() << "_" << subDrawCount << "_subdraws";
+
+    if (indexed)
+    {
+        strstr << "_indexed";
+    }
+
+    if (useDrawID)
+    {
+        strstr << "_drawid";
+    }
+
+    return strstr.str();
+}
+
+std::ostream &operator<<(std::ostream &os, const MultiDrawPerfParams &params)
+{
+    os << params.backendAndStory().substr(1);
+    return os;
+}
+
+class MultiDrawPerfBenchmark : public ANGLERenderTest,
+                               public ::testing::WithParamInterface<MultiDrawPerfParams>
+{
+  public:
+    MultiDrawPerfBenchmark();
+
+    void initializeBenchmark() override;
+    void destroyBenchmark() override;
+    void drawBenchmark() override;
+
+  private:
+    GLuint mProgram     = 0;
+    GLuint mBuffer      = 0;
+    GLuint mIndexBuffer = 0;
+
+    std::vector<GLint> mFirsts;
+    std::vector<GLsizei> mCounts;
+    std::vector<const GLvoid *> mOffsets;
+
+    // Time spent in the multi-draw calls and the number of sub-draws they made.
+    double mDrawTime      = 0.0;
+    size_t mSubDrawsDrawn = 0;
+};
+
+MultiDrawPerfBenchmark::MultiDrawPerfBenchmark() : ANGLERenderTest("MultiDrawPerf", GetParam())
+{
+    addExtensionPrerequisite("GL_ANGLE_multi_draw");
+}
+
+void MultiDrawPerfBenchmark::initializeBenchmark()
+{
+    const MultiDrawPerfParams &params = GetParam();
+
+    constexpr char kVS[] = R"(#extension GL_ANGLE_multi_draw : require
+attribute vec2 vPosition;
+varying float vColor;
+void main()
+{
+    vColor = 1.0;
+    gl_Position = vec4(vPosition, 0, 1);
+})";
+
+    constexpr char kDrawIDVS[] = R"(#extension GL_ANGLE_multi_draw : require
+attribute vec2 vPosition;
+varying float vColor;
+void main()
+{
+    vColor = float(gl_DrawID) / 256.0;
+    gl_Position = vec4(vPosition, 0, 1);
+})";
+
+    constexpr char kFS[] = R"(precision mediump float;
+varying float vColor;
+void main()
+{
+    gl_FragColor = vec4(vColor, 0, 0, 1);
+})";
+
+    mProgram = CompileProgram(params.useDrawID ? kDrawIDVS : kVS, kFS);
+    ASSERT_NE(0u, mProgram);
+
+    glBindAttribLocation(mProgram, 0, "vPosition");
+    glLinkProgram(mProgram);
+    glUseProgram(mProgram);
+
+    // One triangle per sub-draw.
+    mBuffer = Create2DTriangleBuffer(params.subDrawCount, GL_STATIC_DRAW);
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, 0);
+    glEnableVertexAttribArray(0);
+
+    for (GLsizei drawID = 0; drawID < params.subDrawCount; ++drawID)
+    {
+        mFirsts.push_back(drawID * 3);
+        mCounts.push_back(3);
+        mOffsets.push_back(reinterpret_cast<const GLvoid *>(drawID * 3 * sizeof(GLushort)));
+    }
+
+    if (params.indexed)
+    {
+        std::vector<GLushort> indices(params.subDrawCount * 3);
+        for (size_t index = 0; index < indices.size(); ++index)
+        {
+            indices[index] = static_cast<GLushort>(index);
+        }
+
+        glGenBuffers(1, &mIndexBuffer);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mIndexBuffer);
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(GLushort), indices.data(),
+                     GL_STATIC_DRAW);
+    }
+
+    glViewport(0, 0, getWindow()->getWidth(), getWindow()->getHeight());
+
+    mReporter->RegisterImportantMetric(".sub_draw_time", "ns");
+
+    ASSERT_GL_NO_ERROR();
+}
+
+void MultiDrawPerfBenchmark::destroyBenchmark()
+{
+    glDeleteProgram(mProgram);
+    glDeleteBuffers(1, &mBuffer);
+    glDeleteBuffers(1, &mIndexBuffer);
+
+    if (mSubDrawsDrawn > 0)
+    {
+        mReporter->AddResult(".sub_draw_time", mDrawTime * 1e9 / mSubDrawsDrawn);
+    }
+}
+
+void MultiDrawPerfBenchmark::drawBenchmark()
+{
+    const MultiDrawPerfParams &params = GetParam();
+    double startTime                  = angle::GetCurrentTime();
+
+    if (params.indexed)
+    {
+        for (unsigned int iteration = 0; iteration < params.iterationsPerStep; ++iteration)
+        {
+            glMultiDrawElementsANGLE(GL_TRIANGLES, mCounts.data(), GL_UNSIGNED_SHORT,
+                                     mOffsets.data(), params.subDrawCount);
+        }
+    }
+    else
+    {
+        for (unsigned int iteration = 0; iteration < params.iterationsPerStep; ++iteration)
+        {
+            glMultiDrawArraysANGLE(GL_TRIANGLES, mFirsts.data(), mCounts.data(),
+                                   params.subDrawCount);
+        }
+    }
+
+    mDrawTime += angle::GetCurrentTime() - startTime;
+    mSubDrawsDrawn += params.iterationsPerStep * params.subDrawCount;
+
+    ASSERT_GL_NO_ERROR();
+}
+
+TEST_P(MultiDrawPerfBenchmark, Run)
+{
+    run();
+}
+
+MultiDrawPerfParams MultiDraw(const DrawCallPerfParams &base,
+                              GLsizei subDrawCount,
+                              bool indexed,
+                              bool useDrawID)
+{
+    MultiDrawPerfParams params(base);
+    params.subDrawCount = subDrawCount;
+    params.indexed      = indexed;
+    params.useDrawID    = useDrawID;
+    return params;
+}
+
+using namespace params;
+
+ANGLE_INSTANTIATE_TEST(MultiDrawPerfBenchmark,
+                       MultiDraw(DrawCallOpenGL(), 64, false, false),
+                       MultiDraw(DrawCallVulkan(), 64, false, false),
+                       MultiDraw(DrawCallVulkan(), 64, true, false),
+                       MultiDraw(DrawCallVulkan(), 64, false, true),
+                       MultiDraw(NullDevice(DrawCallVulkan()), 8, false, false),
+                       MultiDraw(NullDevice(DrawCallVulkan()), 64, false, false),
+                       MultiDraw(NullDevice(DrawCallVulkan()), 64, true, false),
+                       MultiDraw(NullDevice(DrawCallVulkan()), 64, false, true),
+                       MultiDraw(NullDevice(DrawCallVulkan()), 64, true, true));
+
+}  // anonymous namespace
@@ -0,0 +1,253 @@
+//
+// Copyright 2019 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// MultithreadedDrawPerf:
+//   Performance test for draw calls made from several threads at once.  Each thread draws with a
+//   context of its own share group, and every share group has a second context so that its GL
+//   calls take the share group lock.  Each thread makes the same number of draw calls per step, so
+//   the time per draw call stays flat as threads are added for as long as the share groups don't
+//   contend with each other.
+//
+
+#include "ANGLEPerfTest.h"
+#include "DrawCallPerfParams.h"
+#include "test_utils/draw_call_perf_utils.h"
+
+#include <condition_variable>
+#include <mutex>
+#include <sstream>
+#include <thread>
+
+namespace
+{
+constexpr EGLint kPBufferSize = 64;
+
+struct MultithreadedDrawParams : public DrawCallPerfParams
+{
+    MultithreadedDrawParams(const DrawCallPerfParams &base, size_t threadCountIn)
+        : DrawCallPerfParams(base), threadCount(threadCountIn)
+    {
+        runTimeSeconds = 5.0;
+    }
+
+    std::string story() const override;
+
+    size_t threadCount;
+};
+
+std::string MultithreadedDrawParams::story() const
+{
+    std::stringstream strstr;
+    strstr << DrawCallPerfParams::story() << "_" << threadCount << "_threads";
+    return strstr.str();
+}
+
+std::ostream &operator<<(std::ostream &os, const MultithreadedDrawParams &params)
+{
+    os << params.backendAndStory().substr(1);
+    return os;
+}
+
+class MultithreadedDrawPerfBenchmark
+    : public ANGLERenderTest,
+      public ::testing::WithParamInterface<MultithreadedDrawParams>
+{
+  public:
+    MultithreadedDrawPerfBenchmark();
+
+    void initializeBenchmark() override;
+    void destroyBenchmark() override;
+    void drawBenchmark() override;
+
+  private:
+    struct ShareGroup
+    {
+        EGLContext firstContext  = EGL_NO_CONTEXT;
+        EGLContext secondContext = EGL_NO_CONTEXT;
+        EGLSurface surface       = EGL_NO_SURFACE;
+    };
+
+    void drawThread(size_t threadIndex);
+
+    EGLDisplay mDisplay = EGL_NO_DISPLAY;
+    std::vector<ShareGroup> mShareGroups;
+    std::vector<std::thread> mThreads;
+
+    // Each step increments mStep to start the threads, and waits until mPendingThreads is zero.
+    std::mutex mMutex;
+    std::condition_variable mStepStarted;
+    std::condition_variable mStepFinished;
+    unsigned int mStep     = 0;
+    size_t mPendingThreads = 0;
+    bool mStopping         = false;
+};
+
+MultithreadedDrawPerfBenchmark::MultithreadedDrawPerfBenchmark()
+    : ANGLERenderTest("MultithreadedDrawPerf", GetParam())
+{}
+
+void MultithreadedDrawPerfBenchmark::initializeBenchmark()
+{
+    const MultithreadedDrawParams &params = GetParam();
+
+    mDisplay = eglGetCurrentDisplay();
+    ASSERT_NE(EGL_NO_DISPLAY, mDisplay);
+
+    EGLint configAttributes[] = {EGL_RED_SIZE,
+                                 8,
+                                 EGL_GREEN_SIZE,
+                                 8,
+                                 EGL_BLUE_SIZE,
+                                 8,
+                                 EGL_RENDERABLE_TYPE,
+                                 params.majorVersion == 3 ? EGL_OPENGL_ES3_BIT : EGL_OPENGL_ES2_BIT,
+                                 EGL_SURFACE_TYPE,
+                                 EGL_PBUFFER_BIT,
+                                 EGL_NONE};
+    EGLConfig config   = nullptr;
+    EGLint configCount = 0;
+    ASSERT_TRUE(eglChooseConfig(mDisplay, configAttributes, &config, 1, &configCount));
+    ASSERT_EQ(1, configCount);
+
+    EGLint contextAttributes[] = {EGL_CONTEXT_MAJOR_VERSION_KHR, params.majorVersion,
+                                  EGL_CONTEXT_MINOR_VERSION_KHR, params.minorVersion, EGL_NONE};
+    EGLint pbufferAttributes[] = {EGL_WIDTH, kPBufferSize, EGL_HEIGHT, kPBufferSize, EGL_NONE};
+
+    mShareGroups.resize(params.threadCount);
+    for (ShareGroup &shareGroup : mShareGroups)
+    {
+        shareGroup.firstContext =
+            eglCreateContext(mDisplay, config, EGL_NO_CONTEXT, contextAttributes);
+        ASSERT_NE(EGL_NO_CONTEXT, shareGroup.firstContext);
+        shareGroup.secondContext =
+            eglCreateContext(mDisplay, config, shareGroup.firstContext, contextAttributes);
+        ASSERT_NE(EGL_NO_CONTEXT, shareGroup.secondContext);
+        shareGroup.surface = eglCreatePbufferSurface(mDisplay, config, pbufferAttributes);
+        ASSERT_NE(EGL_NO_SURFACE, shareGroup.surface);
+    }
+
+    // Wait for the threads to set up their programs and buffers.
+    mPendingThreads = params.threadCount;
+    for (size_t threadIndex = 0; threadIndex < params.threadCount; ++threadIndex)
+    {
+        mThreads.emplace_back(&MultithreadedDrawPerfBenchmark::drawThread, this, threadIndex);
+    }
+
+    std::unique_lock<std::mutex> lock(mMutex);
+    mStepFinished.wait(lock, [this]() { return mPendingThreads == 0; });
+}
+
+void MultithreadedDrawPerfBenchmark::destroyBenchmark()
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mStopping = true;
+    }
+    mStepStarted.notify_all();
+
+    for (std::thread &thread : mThreads)
+    {
+        thread.join();
+    }
+    mThreads.clear();
+
+    for (ShareGroup &shareGroup : mShareGroups)
+    {
+        eglDestroySurface(mDisplay, shareGroup.surface);
+        eglDestroyContext(mDisplay, shareGroup.secondContext);
+        eglDestroyContext(mDisplay, shareGroup.firstContext);
+    }
+    mShareGroups.clear();
+}
+
+void MultithreadedDrawPerfBenchmark::drawBenchmark()
+{
+    std::unique_lock<std::mutex> lock(mMutex);
+    mPendingThreads = mThreads.size();
+    mStep++;
+    mStepStarted.notify_all();
+    mStepFinished.wait(lock, [this]() { return mPendingThreads == 0; });
+}
+
+void MultithreadedDrawPerfBenchmark::drawThread(size_t threadIndex)
+{
+    const MultithreadedDrawParams &params = GetParam();
+    const ShareGroup &shareGroup          = mShareGroups[threadIndex];
+    GLsizei numElements                   = static_cast<GLsizei>(3 * params.numTris);
+
+    EXPECT_TRUE(
+        eglMakeCurrent(mDisplay, shareGroup.surface, shareGroup.surface, shareGroup.secondContext));
+
+    GLuint program = SetupSimpleDrawProgram();
+    EXPECT_NE(0u, program);
+
+    // Re-link program to ensure the attrib bindings are used.
+    glBindAttribLocation(program, 0, "vPosition");
+    glLinkProgram(program);
+    glUseProgram(program);
+
+    GLuint buffer = Create2DTriangleBuffer(params.numTris, GL_STATIC_DRAW);
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, 0);
+    glEnableVertexAttribArray(0);
+    glViewport(0, 0, kPBufferSize, kPBufferSize);
+    EXPECT_EQ(static_cast<GLenum>(GL_NO_ERROR), glGetError());
+
+    unsigned int step = 0;
+    std::unique_lock<std::mutex> lock(mMutex);
+    while (true)
+    {
+        if (--mPendingThreads == 0)
+        {
+            mStepFinished.notify_one();
+        }
+
+        mStepStarted.wait(lock, [this, step]() { return mStopping || mStep != step; });
+        if (mStopping)
+        {
+            break;
+        }
+        step = mStep;
+
+        lock.unlock();
+        for (unsigned int iteration = 0; iteration < params.iterationsPerStep; ++iteration)
+        {
+            glDrawArrays(GL_TRIANGLES, 0, numElements);
+        }
+        // Keep the commands from piling up, as the window swap does for the main context.
+        glFlush();
+        lock.lock();
+    }
+    lock.unlock();
+
+    glDeleteBuffers(1, &buffer);
+    glDeleteProgram(program);
+    EXPECT_EQ(static_cast<GLenum>(GL_NO_ERROR), glGetError());
+
+    EXPECT_TRUE(eglMakeCurrent(mDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT));
+}
+
+TEST_P(MultithreadedDrawPerfBenchmark, Run)
+{
+    run();
+}
+
+MultithreadedDrawParams Threads(const DrawCallPerfParams &base, size_t threadCount)
+{
+    return MultithreadedDrawParams(base, threadCount);
+}
+
+using namespace params;
+
+ANGLE_INSTANTIATE_TEST(MultithreadedDrawPerfBenchmark,
+                       Threads(NullDevice(DrawCallVulkan()), 1),
+                       Threads(NullDevice(DrawCallVulkan()), 2),
+                       Threads(NullDevice(DrawCallVulkan()), 4),
+                       Threads(NullDevice(DrawCallVulkan()), 8),
+                       Threads(DrawCallVulkan(), 1),
+                       Threads(DrawCallVulkan(), 2),
+                       Threads(DrawCallVulkan(), 4),
+                       Threads(DrawCallVulkan(), 8));
+
+}  // anonymous namespace
@@ -0,0 +1,280 @@
+//
+// Copyright 2019 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// ResourceMapPerf:
+//   Performance test for the handle allocator and resource map used by the resource managers.
+//   Compares gl::ResourceMap with an unordered map, which is what the map used for all handles
+//   above 16k before it was made of pages, for applications that keep tens of thousands of
+//   objects alive while creating and deleting some every frame.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <random>
+#include <sstream>
+#include <unordered_map>
+#include <vector>
+
+#include "libANGLE/HandleAllocator.h"
+#include "libANGLE/ResourceMap.h"
+
+namespace
+{
+constexpr unsigned int kIterationsPerStep = 1;
+
+// The number of operations made by each step.
+constexpr size_t kOperationsPerStep = 10000;
+
+enum class MapType
+{
+    ResourceMap,
+    HashMap,
+};
+
+enum class Workload
+{
+    // Delete one object and create another.
+    Churn,
+    // Look up live objects, as binds and draws do.
+    Lookup,
+    // Visit all objects, as context teardown does.
+    Iterate,
+};
+
+struct ResourceMapParams
+{
+    MapType mapType;
+    Workload workload;
+    size_t liveCount;
+};
+
+std::string GetStory(const ResourceMapParams &params)
+{
+    std::stringstream strstr;
+    strstr << (params.mapType == MapType::ResourceMap ? "resource_map" : "hash_map");
+    switch (params.workload)
+    {
+        case Workload::Churn:
+            strstr << "_churn";
+            break;
+        case Workload::Lookup:
+            strstr << "_lookup";
+            break;
+        case Workload::Iterate:
+            strstr << "_iterate";
+            break;
+    }
+    strstr << "_" << params.liveCount << "_objects";
+    return strstr.str();
+}
+
+std::ostream &operator<<(std::ostream &os, const ResourceMapParams &params)
+{
+    os << GetStory(params);
+    return os;
+}
+
+// The maps store the address of a dummy object, like the resource managers store pointers.
+using Object = uint32_t;
+
+// Wraps an unordered map in the subset of the ResourceMap interface used by the test.
+class HashResourceMap final : angle::NonCopyable
+{
+  public:
+    Object *query(GLuint handle) const
+    {
+        auto it = mMap.find(handle);
+        return (it == mMap.end() ? nullptr : it->second);
+    }
+
+    void assign(GLuint handle, Object *object) { mMap[handle] = object; }
+
+    bool erase(GLuint handle, Object **objectOut)
+    {
+        auto it = mMap.find(handle);
+        if (it == mMap.end())
+        {
+            return false;
+        }
+        *objectOut = it->second;
+        mMap.erase(it);
+        return true;
+    }
+
+    void clear() { mMap.clear(); }
+
+    std::unordered_map<GLuint, Object *>::const_iterator begin() const { return mMap.begin(); }
+    std::unordered_map<GLuint, Object *>::const_iterator end() const { return mMap.end(); }
+
+  private:
+    std::unordered_map<GLuint, Object *> mMap;
+};
+
+class ResourceMapPerfTest : public ANGLEPerfTest,
+                            public ::testing::WithParamInterface<ResourceMapParams>
+{
+  public:
+    ResourceMapPerfTest();
+
+    void SetUp() override;
+    void TearDown() override;
+    void step() override;
+
+  private:
+    template <typename MapT>
+    void runWorkload(MapT *map);
+
+    gl::HandleAllocator mHandleAllocator;
+    gl::ResourceMap<Object, GLuint> mResourceMap;
+    HashResourceMap mHashMap;
+
+    Object mObject;
+    std::vector<GLuint> mLiveHandles;
+    std::vector<size_t> mRandomIndices;
+    size_t mNextRandomIndex;
+    size_t mFound;
+};
+
+ResourceMapPerfTest::ResourceMapPerfTest()
+    : ANGLEPerfTest("ResourceMapPerf", "", GetStory(GetParam()), kIterationsPerStep),
+      mObject(0),
+      mNextRandomIndex(0),
+      mFound(0)
+{}
+
+void ResourceMapPerfTest::SetUp()
+{
+    ANGLEPerfTest::SetUp();
+
+    const ResourceMapParams &params = GetParam();
+
+    for (size_t index = 0; index < params.liveCount; ++index)
+    {
+        GLuint handle = mHandleAllocator.allocate();
+        mLiveHandles.push_back(handle);
+        if (params.mapType == MapType::ResourceMap)
+        {
+            mResourceMap.assign(handle, &mObject);
+        }
+        else
+        {
+            mHashMap.assign(handle, &mObject);
+        }
+    }
+
+    std::mt19937 generator(0x7183);
+    std::uniform_int_distribution<size_t> liveIndex(0, params.liveCount - 1);
+    mRandomIndices.resize(kOperationsPerStep * 4);
+    for (size_t &index : mRandomIndices)
+    {
+        index = liveIndex(generator);
+    }
+
+    mReporter->RegisterImportantMetric(".operation_time", "ns");
+}
+
+void ResourceMapPerfTest::TearDown()
+{
+    ANGLEPerfTest::TearDown();
+
+    double elapsedTime = mTimer.getElapsedTime();
+    size_t operations  = getNumStepsPerformed() * kOperationsPerStep;
+    if (operations > 0)
+    {
+        mReporter->AddResult(".operation_time", elapsedTime * 1e9 / operations);
+    }
+
+    // Keeps the lookups from being optimized out.
+    ASSERT_GT(mFound, 0u);
+
+    mResourceMap.clear();
+    mHashMap.clear();
+}
+
+void ResourceMapPerfTest::step()
+{
+    if (GetParam().mapType == MapType::ResourceMap)
+    {
+        runWorkload(&mResourceMap);
+    }
+    else
+    {
+        runWorkload(&mHashMap);
+    }
+}
+
+template <typename MapT>
+void ResourceMapPerfTest::runWorkload(MapT *map)
+{
+    const ResourceMapParams &params = GetParam();
+
+    switch (params.workload)
+    {
+        case Workload::Churn:
+            for (size_t operation = 0; operation < kOperationsPerStep; ++operation)
+            {
+                size_t liveIndex = mRandomIndices[mNextRandomIndex++ % mRandomIndices.size()];
+                GLuint handle    = mLiveHandles[liveIndex];
+
+                Object *object = nullptr;
+                map->erase(handle, &object);
+                mHandleAllocator.release(handle);
+
+                handle = mHandleAllocator.allocate();
+                map->assign(handle, &mObject);
+                mLiveHandles[liveIndex] = handle;
+                mFound += (object != nullptr);
+            }
+            break;
+
+        case Workload::Lookup:
+            for (size_t operation = 0; operation < kOperationsPerStep; ++operation)
+            {
+                size_t liveIndex = mRandomIndices[mNextRandomIndex++ % mRandomIndices.size()];
+                mFound += (map->query(mLiveHandles[liveIndex]) != nullptr);
+            }
+            break;
+
+        case Workload::Iterate:
+            // One operation is one visited object.
+            for (size_t visited = 0; visited < kOperationsPerStep;)
+            {
+                for (const auto &handleAndObject : *map)
+                {
+                    mFound += (handleAndObject.second != nullptr);
+                    if (++visited == kOperationsPerStep)
+                    {
+                        break;
+                    }
+                }
+            }
+            break;
+    }
+}
+
+TEST_P(ResourceMapPerfTest, Run)
+{
+    run();
+}
+
+ResourceMapParams Params(MapType mapType, Workload workload, size_t liveCount)
+{
+    return ResourceMapParams{mapType, workload, liveCount};
+}
+
+INSTANTIATE_TEST_SUITE_P(,
+                         ResourceMapPerfTest,
+                         ::testing::Values(Params(MapType::ResourceMap, Workload::Churn, 1000),
+                                           Params(MapType::HashMap, Workload::Churn, 1000),
+                                           Params(MapType::ResourceMap, Workload::Churn, 50000),
+                                           Params(MapType::HashMap, Workload::Churn, 50000),
+                                           Params(MapType::ResourceMap, Workload::Lookup, 1000),
+                                           Params(MapType::HashMap, Workload::Lookup, 1000),
+                                           Params(MapType::ResourceMap, Workload::Lookup, 50000),
+                                           Params(MapType::HashMap, Workload::Lookup, 50000),
+                                           Params(MapType::ResourceMap, Workload::Iterate, 50000),
+                                           Params(MapType::HashMap, Workload::Iterate, 50000)));
+
+}  // anonymous namespace
@@ -22,6 +22,16 @@ namespace
 {
 constexpr unsigned int kIterationsPerStep = 2;
 
+// Client formats that go through different load functions on upload.
+enum class UploadFormat
+{
+    RGBA8,
+    RGB8,
+    Luminance8,
+    LuminanceAlpha8,
+    RGBA32FToRGBA16F,
+};
+
 struct TextureUploadParams final : public RenderTestParams
 {
     TextureUploadParams()
@@ -33,6 +43,8 @@ struct TextureUploadParams final : public RenderTestParams
         subImageSize = 64;
 
         webgl = false;
+
+        uploadFormat = UploadFormat::RGBA8;
     }
 
     std::string story() const override;
@@ -41,6 +53,8 @@ struct TextureUploadParams final : public RenderTestParams
     GLsizei subImageSize;
 
     bool webgl;
+
+    UploadFormat uploadFormat;
 };
 
 std::ostream &operator<<(std::ostream &os, const TextureUploadParams &params)
@@ -60,9 +74,52 @@ std::string TextureUploadParams::story() const
         strstr << "_webgl";
     }
 
+    switch (uploadFormat)
+    {
+        case UploadFormat::RGBA8:
+            break;
+        case UploadFormat::RGB8:
+            strstr << "_rgb8";
+            break;
+        case UploadFormat::Luminance8:
+            strstr << "_l8";
+            break;
+        case UploadFormat::LuminanceAlpha8:
+            strstr << "_la8";
+            break;
+        case UploadFormat::RGBA32FToRGBA16F:
+            strstr << "_rgba32f_to_rgba16f";
+            break;
+    }
+
     return strstr.str();
 }
 
+struct UploadFormatInfo
+{
+    GLenum internalFormat;
+    GLenum format;
+    GLenum type;
+    size_t pixelBytes;
+};
+
+UploadFormatInfo GetUploadFormatInfo(UploadFormat uploadFormat)
+{
+    switch (uploadFormat)
+    {
+        case UploadFormat::RGB8:
+            return {GL_RGB8, GL_RGB, GL_UNSIGNED_BYTE, 3};
+        case UploadFormat::Luminance8:
+            return {GL_LUMINANCE, GL_LUMINANCE, GL_UNSIGNED_BYTE, 1};
+        case UploadFormat::LuminanceAlpha8:
+            return {GL_LUMINANCE_ALPHA, GL_LUMINANCE_ALPHA, GL_UNSIGNED_BYTE, 2};
+        case UploadFormat::RGBA32FToRGBA16F:
+            return {GL_RGBA16F, GL_RGBA, GL_FLOAT, 16};
+        default:
+            return {GL_RGBA8, GL_RGBA, GL_UNSIGNED_BYTE, 4};
+    }
+}
+
 class TextureUploadBenchmarkBase : public ANGLERenderTest,
                                    public ::testing::WithParamInterface<TextureUploadParams>
 {
@@ -109,6 +166,47 @@ class TextureUploadFullMipBenchmark : public TextureUploadBenchmarkBase
     void drawBenchmark() override;
 };
 
+// Uploads large sub images in one client format and reports the rate at which the client data is
+// consumed.  Most of the CPU time goes to converting the data to the format of the texture.
+class TextureUploadFormatBenchmark : public TextureUploadBenchmarkBase
+{
+  public:
+    TextureUploadFormatBenchmark() : TextureUploadBenchmarkBase("TextureUploadFormat")
+    {
+        mReporter->RegisterImportantMetric(".upload_rate", "MB/s");
+    }
+
+    void initializeBenchmark() override
+    {
+        TextureUploadBenchmarkBase::initializeBenchmark();
+
+        const auto &params    = GetParam();
+        UploadFormatInfo info = GetUploadFormatInfo(params.uploadFormat);
+        glTexImage2D(GL_TEXTURE_2D, 0, info.internalFormat, params.baseSize, params.baseSize, 0,
+                     info.format, info.type, nullptr);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+        ASSERT_GL_NO_ERROR();
+    }
+
+    void drawBenchmark() override;
+
+    void reportUploadRate()
+    {
+        double elapsedTime = mTimer.getElapsedTime();
+        if (mSkipTest || elapsedTime <= 0.0)
+        {
+            return;
+        }
+
+        const auto &params    = GetParam();
+        UploadFormatInfo info = GetUploadFormatInfo(params.uploadFormat);
+        double uploadedBytes  = static_cast<double>(params.subImageSize * params.subImageSize) *
+                               info.pixelBytes * params.iterationsPerStep * getNumStepsPerformed();
+        mReporter->AddResult(".upload_rate", uploadedBytes / elapsedTime / (1024.0 * 1024.0));
+    }
+};
+
 TextureUploadBenchmarkBase::TextureUploadBenchmarkBase(const char *benchmarkName)
     : ANGLERenderTest(benchmarkName, GetParam())
 {
@@ -228,6 +326,23 @@ void TextureUploadFullMipBenchmark::drawBenchmark()
     ASSERT_GL_NO_ERROR();
 }
 
+void TextureUploadFormatBenchmark::drawBenchmark()
+{
+    const auto &params    = GetParam();
+    UploadFormatInfo info = GetUploadFormatInfo(params.uploadFormat);
+
+    startGpuTimer();
+    for (unsigned int iteration = 0; iteration < params.iterationsPerStep; ++iteration)
+    {
+        glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, params.subImageSize, params.subImageSize,
+                        info.format, info.type, mTextureData.data());
+        glDrawArrays(GL_TRIANGLES, 0, 3);
+    }
+    stopGpuTimer();
+
+    ASSERT_GL_NO_ERROR();
+}
+
 TextureUploadParams D3D11Params(bool webglCompat)
 {
     TextureUploadParams params;
@@ -252,6 +367,15 @@ TextureUploadParams VulkanParams(bool webglCompat)
     return params;
 }
 
+TextureUploadParams UploadFormatParams(const TextureUploadParams &in, UploadFormat uploadFormat)
+{
+    TextureUploadParams params = in;
+    params.majorVersion        = 3;
+    params.subImageSize        = 512;
+    params.uploadFormat        = uploadFormat;
+    return params;
+}
+
 }  // anonymous namespace
 
 TEST_P(TextureUploadSubImageBenchmark, Run)
@@ -264,6 +388,12 @@ TEST_P(TextureUploadFullMipBenchmark, Run)
     run();
 }
 
+TEST_P(TextureUploadFormatBenchmark, Run)
+{
+    run();
+    reportUploadRate();
+}
+
 using namespace params;
 
 ANGLE_INSTANTIATE_TEST(TextureUploadSubImageBenchmark,
@@ -283,3 +413,13 @@ ANGLE_INSTANTIATE_TEST(TextureUploadFullMipBenchmark,
                        VulkanParams(false),
                        NullDevice(VulkanParams(false)),
                        VulkanParams(true));
+
+ANGLE_INSTANTIATE_TEST(TextureUploadFormatBenchmark,
+                       UploadFormatParams(VulkanParams(false), UploadFormat::RGBA8),
+                       UploadFormatParams(VulkanParams(false), UploadFormat::RGB8),
+                       UploadFormatParams(VulkanParams(false), UploadFormat::Luminance8),
+                       UploadFormatParams(VulkanParams(false), UploadFormat::LuminanceAlpha8),
+                       UploadFormatParams(VulkanParams(false), UploadFormat::RGBA32FToRGBA16F),
+                       UploadFormatParams(NullDevice(VulkanParams(false)), UploadFormat::RGB8),
+                       UploadFormatParams(NullDevice(VulkanParams(false)),
+                                          UploadFormat::RGBA32FToRGBA16F));
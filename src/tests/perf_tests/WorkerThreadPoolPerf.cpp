@@ -0,0 +1,155 @@
+//
+// Copyright 2019 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// WorkerThreadPoolPerf:
+//   Performance test for posting tasks to the worker thread pool.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <array>
+#include <atomic>
+
+#include "common/system_utils.h"
+#include "libANGLE/WorkerThread.h"
+
+namespace
+{
+constexpr unsigned int kTasksPerStep = 256;
+
+enum class TaskSize
+{
+    // Measures the scheduling overhead.
+    Empty,
+    // Roughly the cost of translating a small shader.
+    Small,
+};
+
+struct WorkerThreadPoolParams
+{
+    bool multithreaded;
+    TaskSize taskSize;
+};
+
+std::string GetStory(const WorkerThreadPoolParams &params)
+{
+    std::stringstream strstr;
+    strstr << (params.multithreaded ? "multi_thread" : "single_thread")
+           << (params.taskSize == TaskSize::Empty ? "_empty_tasks" : "_small_tasks");
+    return strstr.str();
+}
+
+std::ostream &operator<<(std::ostream &os, const WorkerThreadPoolParams &params)
+{
+    os << GetStory(params);
+    return os;
+}
+
+class TimedTask : public angle::Closure
+{
+  public:
+    TimedTask(TaskSize taskSize, std::atomic<uint64_t> *totalLatencyNs)
+        : mTaskSize(taskSize), mTotalLatencyNs(totalLatencyNs), mPostTime(0.0)
+    {}
+
+    void setPostTime(double postTime) { mPostTime = postTime; }
+
+    void operator()() override
+    {
+        double startTime = angle::GetCurrentTime();
+        *mTotalLatencyNs += static_cast<uint64_t>((startTime - mPostTime) * 1e9);
+
+        if (mTaskSize == TaskSize::Small)
+        {
+            uint32_t hash = 2166136261u;
+            for (uint32_t iteration = 0; iteration < 50000; ++iteration)
+            {
+                hash = (hash ^ iteration) * 16777619u;
+            }
+            mResult = hash;
+        }
+    }
+
+  private:
+    TaskSize mTaskSize;
+    std::atomic<uint64_t> *mTotalLatencyNs;
+    double mPostTime;
+    volatile uint32_t mResult = 0;
+};
+
+class WorkerThreadPoolPerfTest : public ANGLEPerfTest,
+                                 public ::testing::WithParamInterface<WorkerThreadPoolParams>
+{
+  public:
+    WorkerThreadPoolPerfTest();
+
+    void SetUp() override;
+    void TearDown() override;
+    void step() override;
+
+  private:
+    std::shared_ptr<angle::WorkerThreadPool> mPool;
+    std::array<std::shared_ptr<TimedTask>, kTasksPerStep> mTasks;
+    std::array<std::shared_ptr<angle::WaitableEvent>, kTasksPerStep> mWaitables;
+    std::atomic<uint64_t> mTotalLatencyNs;
+    uint64_t mPostedTaskCount;
+};
+
+WorkerThreadPoolPerfTest::WorkerThreadPoolPerfTest()
+    : ANGLEPerfTest("WorkerThreadPoolPerf", "", GetStory(GetParam()), kTasksPerStep),
+      mTotalLatencyNs(0),
+      mPostedTaskCount(0)
+{}
+
+void WorkerThreadPoolPerfTest::SetUp()
+{
+    ANGLEPerfTest::SetUp();
+
+    mPool = angle::WorkerThreadPool::Create(GetParam().multithreaded);
+    for (std::shared_ptr<TimedTask> &task : mTasks)
+    {
+        task = std::make_shared<TimedTask>(GetParam().taskSize, &mTotalLatencyNs);
+    }
+
+    // Time from posting a task to a worker starting it, averaged over all tasks.
+    mReporter->RegisterImportantMetric(".task_latency", "ns");
+}
+
+void WorkerThreadPoolPerfTest::TearDown()
+{
+    ANGLEPerfTest::TearDown();
+
+    if (mPostedTaskCount > 0)
+    {
+        mReporter->AddResult(".task_latency",
+                             static_cast<size_t>(mTotalLatencyNs / mPostedTaskCount));
+    }
+}
+
+void WorkerThreadPoolPerfTest::step()
+{
+    for (unsigned int taskIndex = 0; taskIndex < kTasksPerStep; ++taskIndex)
+    {
+        mTasks[taskIndex]->setPostTime(angle::GetCurrentTime());
+        mWaitables[taskIndex] = angle::WorkerThreadPool::PostWorkerTask(mPool, mTasks[taskIndex]);
+    }
+
+    angle::WaitableEvent::WaitMany(&mWaitables);
+    mPostedTaskCount += kTasksPerStep;
+}
+
+TEST_P(WorkerThreadPoolPerfTest, Run)
+{
+    run();
+}
+
+INSTANTIATE_TEST_SUITE_P(,
+                         WorkerThreadPoolPerfTest,
+                         ::testing::Values(WorkerThreadPoolParams{false, TaskSize::Empty},
+                                           WorkerThreadPoolParams{true, TaskSize::Empty},
+                                           WorkerThreadPoolParams{false, TaskSize::Small},
+                                           WorkerThreadPoolParams{true, TaskSize::Small}));
+
+}  // anonymous namespace
@@ -32,7 +32,8 @@ ConfigParameters::ConfigParameters()
       clientArraysEnabled(true),
       robustAccess(false),
       samples(-1),
-      resetStrategy(EGL_NO_RESET_NOTIFICATION_EXT)
+      resetStrategy(EGL_NO_RESET_NOTIFICATION_EXT),
+      deferredExecution(false)
 {}
 
 ConfigParameters::~ConfigParameters() = default;
@@ -353,6 +354,14 @@ EGLContext EGLWindow::createContext(EGLContext share) const
         return EGL_NO_CONTEXT;
     }
 
+    bool hasDeferredExecutionExtension =
+        strstr(displayExtensions, "EGL_ANGLE_create_context_deferred_execution") != nullptr;
+    if (mConfigParams.deferredExecution && !hasDeferredExecutionExtension)
+    {
+        std::cerr << "EGL_ANGLE_create_context_deferred_execution missing.\n";
+        return EGL_NO_CONTEXT;
+    }
+
     eglBindAPI(EGL_OPENGL_ES_API);
     if (eglGetError() != EGL_SUCCESS)
     {
@@ -436,6 +445,12 @@ EGLContext EGLWindow::createContext(EGLContext share) const
             contextAttributes.push_back(mConfigParams.robustResourceInit.value() ? EGL_TRUE
                                                                                  : EGL_FALSE);
         }
+
+        if (mConfigParams.deferredExecution)
+        {
+            contextAttributes.push_back(EGL_CONTEXT_DEFERRED_EXECUTION_ANGLE);
+            contextAttributes.push_back(EGL_TRUE);
+        }
     }
     contextAttributes.push_back(EGL_NONE);
 
@@ -56,6 +56,7 @@ struct ANGLE_UTIL_EXPORT ConfigParameters
     EGLint samples;
     Optional<bool> contextProgramCacheEnabled;
     EGLenum resetStrategy;
+    bool deferredExecution;
 };
 
 class ANGLE_UTIL_EXPORT GLWindowBase : angle::NonCopyable